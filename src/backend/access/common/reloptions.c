@@ -21,6 +21,7 @@
 #include "access/nbtree.h"
 #include "access/reloptions.h"
 #include "access/spgist.h"
+#include "catalog/pg_statistic.h"
 #include "catalog/pg_type.h"
 #include "cdb/cdbappendonlyam.h"
 #include "cdb/cdbvars.h"
@@ -275,6 +276,8 @@ static relopt_real realRelOpts[] =
 	{{NULL}}
 };
 
+static void validateStatisticsGroupOption(char *value);
+
 static relopt_string stringRelOpts[] =
 {
 	{
@@ -299,6 +302,17 @@ static relopt_string stringRelOpts[] =
 		validateWithCheckOption,
 		NULL
 	},
+	{
+		{
+			"statistics_group",
+			"Other columns whose combined statistics with this column are collected by ANALYZE",
+			RELOPT_KIND_ATTRIBUTE
+		},
+		0,
+		true,
+		validateStatisticsGroupOption,
+		NULL
+	},
 	/* list terminator */
 	{{NULL}}
 };
@@ -1358,7 +1372,8 @@ attribute_reloptions(Datum reloptions, bool validate)
 	int			numoptions;
 	static const relopt_parse_elt tab[] = {
 		{"n_distinct", RELOPT_TYPE_REAL, offsetof(AttributeOpts, n_distinct)},
-		{"n_distinct_inherited", RELOPT_TYPE_REAL, offsetof(AttributeOpts, n_distinct_inherited)}
+		{"n_distinct_inherited", RELOPT_TYPE_REAL, offsetof(AttributeOpts, n_distinct_inherited)},
+		{"statistics_group", RELOPT_TYPE_STRING, offsetof(AttributeOpts, statistics_group)}
 	};
 
 	options = parseRelOptions(reloptions, validate, RELOPT_KIND_ATTRIBUTE,
@@ -1377,6 +1392,39 @@ attribute_reloptions(Datum reloptions, bool validate)
 	return (bytea *) aopts;
 }
 
+/*
+ * Validator for the statistics_group attribute option: a comma-separated
+ * list of column names. The names are resolved by ANALYZE, since the option
+ * can be set before the columns it refers to exist.
+ */
+static void
+validateStatisticsGroupOption(char *value)
+{
+	char	   *rawstring;
+	List	   *namelist;
+
+	if (value == NULL)
+		return;
+
+	rawstring = pstrdup(value);
+	if (!SplitIdentifierString(rawstring, ',', &namelist) || namelist == NIL)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("invalid value for \"statistics_group\" option"),
+				 errdetail("Valid values are comma-separated lists of column names.")));
+
+	/* the column the option is set on is part of the group as well */
+	if (list_length(namelist) + 1 > STATISTIC_GROUP_MAX_COLUMNS)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("invalid value for \"statistics_group\" option"),
+				 errdetail("A statistics group can have at most %d columns.",
+						   STATISTIC_GROUP_MAX_COLUMNS)));
+
+	list_free(namelist);
+	pfree(rawstring);
+}
+
 /*
  * Option parser for tablespace reloptions
  */
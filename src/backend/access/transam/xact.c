@@ -48,6 +48,7 @@
 #include "replication/walsender.h"
 #include "replication/syncrep.h"
 #include "storage/bufmgr.h"
+#include "storage/condition_variable.h"
 #include "storage/fd.h"
 #include "storage/freespace.h"
 #include "storage/lmgr.h"
@@ -3246,6 +3247,9 @@ AbortTransaction(void)
 	 */
 	LWLockReleaseAll();
 
+	/* Cancel condition variable sleep */
+	ConditionVariableCancelSleep();
+
 	/* Clean up buffer I/O and buffer context locks, too */
 	AbortBufferIO();
 	UnlockBuffers();
@@ -5601,6 +5605,8 @@ AbortSubTransaction(void)
 	 */
 	LWLockReleaseAll();
 
+	ConditionVariableCancelSleep();
+
 	AbortBufferIO();
 	UnlockBuffers();
 
@@ -220,6 +220,10 @@ bool		gp_interconnect_aggressive_retry = true;	/* fast-track app-level
 
 bool		gp_interconnect_full_crc = false;	/* sanity check UDP data. */
 
+bool		gp_interconnect_compression = false;	/* compress tuple chunks */
+
+int			gp_motion_batch_size = 0;	/* tuples per batch sent by motions */
+
 bool		gp_interconnect_log_stats = false;	/* emit stats at log-level */
 
 bool		gp_interconnect_cache_future_packets = true;
@@ -264,6 +268,9 @@ int			gp_segments_for_planner = 0;
 
 int			gp_hashagg_default_nbatches = 32;
 
+/* Minimum reduction for the bottom stage of a hashagg to keep aggregating */
+double		gp_hashagg_stream_min_reduction = 0.1;
+
 bool		gp_adjust_selectivity_for_outerjoins = TRUE;
 bool		gp_selectivity_damping_for_scans = false;
 bool		gp_selectivity_damping_for_joins = false;
@@ -316,6 +323,9 @@ int			gp_workfile_limit_per_query = 0;
 /* Maximum number of workfiles to be created by a query */
 int			gp_workfile_limit_files_per_query = 0;
 
+/* Maximum size of a cross-slice shared scan kept in shared memory, in kilobytes */
+int			gp_shared_scan_memory_limit = 4096;
+
 /*
  * The overhead memory (kB) used by all compressed workfiles of a single
  * workfile_set
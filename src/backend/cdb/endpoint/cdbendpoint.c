@@ -533,7 +533,7 @@ create_and_connect_mq(TupleDesc tupleDesc, dsm_segment **mqSeg /* out */ ,
 	tocSize = shm_toc_estimate(&tocEst);
 
 	/* Create dsm and initialize toc. */
-	*mqSeg = dsm_create(tocSize);
+	*mqSeg = dsm_create(tocSize, 0);
 	/* Make sure the dsm sticks around up until session exit */
 	dsm_pin_mapping(*mqSeg);
 
@@ -34,6 +34,14 @@
  */
 int			Gp_max_tuple_chunk_size;
 
+/*
+ * Memory budget of the batches of a sending motion, shared evenly among its
+ * routes.  A batch is sent once it uses up its share, even if it isn't full,
+ * and with many routes the batches hold fewer tuples.  See
+ * CreateSerTupBatch() for how closely a batch sticks to its share.
+ */
+#define MOTION_BATCH_MEMORY		(1024 * 1024)
+
 /*
  * STATIC STATE VARS
  *
@@ -66,9 +74,12 @@ static void processIncomingChunks(MotionLayerState *mlStates,
 					  int16 srcRoute);
 
 static inline void reconstructTuple(MotionNodeEntry *pMNEntry, ChunkSorterEntry *pCSEntry, TupleRemapper *remapper);
+static bool sendBatch(MotionLayerState *mlStates, ChunkTransportState *transportStates,
+					  MotionNodeEntry *pMNEntry, int16 motNodeID, int16 targetRoute,
+					  SerTupBatch *batch);
 
 /* Stats-function declarations. */
-static void statSendTuple(MotionLayerState *mlStates, MotionNodeEntry *pMNEntry, TupleChunkList tcList);
+static void statSendTuple(MotionLayerState *mlStates, MotionNodeEntry *pMNEntry, TupleChunkList tcList, int ntuples);
 static void statSendEOS(MotionLayerState *mlStates, MotionNodeEntry *pMNEntry);
 static void statChunksProcessed(MotionLayerState *mlStates, MotionNodeEntry *pMNEntry, int chunksProcessed, int chunkBytes, int tupleBytes);
 static void statNewTupleArrived(MotionNodeEntry *pMNEntry, ChunkSorterEntry *pCSEntry);
@@ -97,6 +108,22 @@ reconstructTuple(MotionNodeEntry *pMNEntry, ChunkSorterEntry *pCSEntry, TupleRem
 	/* We're done with the chunks now. */
 	clearTCList(NULL, &pCSEntry->chunk_list);
 
+	if (pSerInfo->batch_ntuples > 0)
+	{
+		int			i;
+
+		/* A batch of tuples, stow them away in order */
+		for (i = 0; i < pSerInfo->batch_ntuples; i++)
+		{
+			tup = TRCheckAndRemap(remapper, pSerInfo->tupdesc,
+								  pSerInfo->batch_tuples[i]);
+			htfifo_addtuple(pCSEntry->ready_tuples, tup);
+			statNewTupleArrived(pMNEntry, pCSEntry);
+		}
+		pSerInfo->batch_ntuples = 0;
+		return;
+	}
+
 	if (!tup)
 		return;
 
@@ -244,7 +271,8 @@ createMotionLayerState(int maxMotNodeID)
  * This function is called from:  ExecInitMotion()
  */
 void
-UpdateMotionLayerNode(MotionLayerState *mlStates, int16 motNodeID, bool preserveOrder, TupleDesc tupDesc)
+UpdateMotionLayerNode(MotionLayerState *mlStates, int16 motNodeID, bool preserveOrder,
+					  TupleDesc tupDesc, int batchSize)
 {
 	MemoryContext oldCtxt;
 	MotionNodeEntry *pEntry;
@@ -271,6 +299,19 @@ UpdateMotionLayerNode(MotionLayerState *mlStates, int16 motNodeID, bool preserve
 	pEntry->tuple_desc = CreateTupleDescCopy(tupDesc);
 	InitSerTupInfo(pEntry->tuple_desc, &pEntry->ser_tup_info);
 
+	/*
+	 * Batching only pays off with more than one tuple per batch. Tuples that
+	 * may contain transient record types are sent one by one, so that the
+	 * record cache is always sent ahead of the tuples that need it.
+	 */
+	if (batchSize > 1 && pEntry->tuple_desc->natts > 0 &&
+		!pEntry->ser_tup_info.has_record_types)
+		pEntry->batch_size = batchSize;
+	else
+		pEntry->batch_size = 0;
+	pEntry->send_batches = NULL;
+	pEntry->num_send_batches = 0;
+
 	if (!preserveOrder)
 	{
 		/* Create a tuple-store for the motion node's incoming tuples. */
@@ -418,7 +459,7 @@ CheckAndSendRecordCache(MotionLayerState *mlStates,
 	else
 	{
 		/* update stats */
-		statSendTuple(mlStates, pMNEntry, &tcList);
+		statSendTuple(mlStates, pMNEntry, &tcList, 1);
 	}
 
 	/* cleanup */
@@ -457,6 +498,55 @@ SendTuple(MotionLayerState *mlStates,
 	 */
 	pMNEntry = getMotionNodeEntry(mlStates, motNodeID);
 
+	if (pMNEntry->batch_size > 0)
+	{
+		SerTupBatch *batch;
+		int			batchno;
+
+		if (pMNEntry->send_batches == NULL)
+		{
+			ChunkTransportStateEntry *pEntry = NULL;
+
+			getChunkTransportState(transportStates, motNodeID, &pEntry);
+
+			/* one batch per route, and one for broadcasts */
+			pMNEntry->num_send_batches = pEntry->numConns + 1;
+			pMNEntry->send_batches = (SerTupBatch **)
+				MemoryContextAllocZero(mlStates->motion_layer_mctx,
+									   pMNEntry->num_send_batches * sizeof(SerTupBatch *));
+		}
+
+		if (targetRoute == BROADCAST_SEGIDX)
+			batchno = pMNEntry->num_send_batches - 1;
+		else
+			batchno = targetRoute;
+		Assert(batchno >= 0 && batchno < pMNEntry->num_send_batches);
+
+		oldCtxt = MemoryContextSwitchTo(mlStates->motion_layer_mctx);
+
+		batch = pMNEntry->send_batches[batchno];
+		if (batch == NULL)
+		{
+			batch = CreateSerTupBatch(&pMNEntry->ser_tup_info, pMNEntry->batch_size,
+									  MOTION_BATCH_MEMORY / pMNEntry->num_send_batches);
+			pMNEntry->send_batches[batchno] = batch;
+		}
+		AddTupleToBatch(slot, &pMNEntry->ser_tup_info, batch);
+
+		MemoryContextSwitchTo(oldCtxt);
+
+		/* send the batch once it is full, or has used up its share of memory */
+		if (batch->ntuples >= batch->capacity ||
+			batch->nbytes >= batch->maxbytes)
+		{
+			if (!sendBatch(mlStates, transportStates, pMNEntry, motNodeID,
+						   targetRoute, batch))
+				return STOP_SENDING;
+		}
+
+		return SEND_COMPLETE;
+	}
+
 #ifdef AMS_VERBOSE_LOGGING
 	elog(DEBUG5, "Serializing HeapTuple for sending.");
 #endif
@@ -482,7 +572,7 @@ SendTuple(MotionLayerState *mlStates,
 		tcList.serialized_data_length = sent;
 
 		/* update stats */
-		statSendTuple(mlStates, pMNEntry, &tcList);
+		statSendTuple(mlStates, pMNEntry, &tcList, 1);
 
 		return SEND_COMPLETE;
 	}
@@ -507,7 +597,7 @@ SendTuple(MotionLayerState *mlStates,
 	else
 	{
 		/* update stats */
-		statSendTuple(mlStates, pMNEntry, &tcList);
+		statSendTuple(mlStates, pMNEntry, &tcList, 1);
 
 		rc = SEND_COMPLETE;
 	}
@@ -518,6 +608,44 @@ SendTuple(MotionLayerState *mlStates,
 	return rc;
 }
 
+/*
+ * Send the tuples collected in a batch, and empty it.
+ *
+ * Returns false if the receiver doesn't want any more tuples.
+ */
+static bool
+sendBatch(MotionLayerState *mlStates,
+		  ChunkTransportState *transportStates,
+		  MotionNodeEntry *pMNEntry,
+		  int16 motNodeID,
+		  int16 targetRoute,
+		  SerTupBatch *batch)
+{
+	TupleChunkListData tcList;
+	MemoryContext oldCtxt;
+	int			ntuples = batch->ntuples;
+	bool		sent;
+
+	Assert(ntuples > 0);
+
+	oldCtxt = MemoryContextSwitchTo(mlStates->motion_layer_mctx);
+
+	SerializeBatchIntoChunks(&pMNEntry->ser_tup_info, batch, &tcList);
+
+	MemoryContextSwitchTo(oldCtxt);
+
+	sent = SendTupleChunkToAMS(mlStates, transportStates, motNodeID,
+							   targetRoute, tcList.p_first);
+	if (!sent)
+		pMNEntry->stopped = true;
+	else
+		statSendTuple(mlStates, pMNEntry, &tcList, ntuples);
+
+	clearTCList(&pMNEntry->ser_tup_info.chunkCache, &tcList);
+
+	return sent;
+}
+
 TupleChunkListItem
 get_eos_tuplechunklist(void)
 {
@@ -542,6 +670,30 @@ SendEndOfStream(MotionLayerState *mlStates,
 	 */
 	pMNEntry = getMotionNodeEntry(mlStates, motNodeID);
 
+	/* Send out the tuples still waiting in batches, ahead of the EOS. */
+	if (pMNEntry->send_batches != NULL && !pMNEntry->stopped)
+	{
+		int			i;
+
+		for (i = 0; i < pMNEntry->num_send_batches; i++)
+		{
+			SerTupBatch *batch = pMNEntry->send_batches[i];
+			int16		targetRoute;
+
+			if (batch == NULL || batch->ntuples == 0)
+				continue;
+
+			if (i == pMNEntry->num_send_batches - 1)
+				targetRoute = BROADCAST_SEGIDX;
+			else
+				targetRoute = i;
+
+			if (!sendBatch(mlStates, transportStates, pMNEntry, motNodeID,
+						   targetRoute, batch))
+				break;
+		}
+	}
+
 	transportStates->SendEos(transportStates, motNodeID, s_eos_chunk_data);
 
 	/*
@@ -1143,7 +1295,8 @@ addChunkToSorter(MotionLayerState *mlStates,
  * SerializeTupleDirect() only fills those fields out.
  */
 static void
-statSendTuple(MotionLayerState *mlStates, MotionNodeEntry *pMNEntry, TupleChunkList tcList)
+statSendTuple(MotionLayerState *mlStates, MotionNodeEntry *pMNEntry, TupleChunkList tcList,
+			  int ntuples)
 {
 	int			headerOverhead;
 
@@ -1152,7 +1305,7 @@ statSendTuple(MotionLayerState *mlStates, MotionNodeEntry *pMNEntry, TupleChunkL
 	headerOverhead = TUPLE_CHUNK_HEADER_SIZE * tcList->num_chunks;
 
 	/* per motion-node stats. */
-	pMNEntry->stat_total_sends++;
+	pMNEntry->stat_total_sends += ntuples;
 	pMNEntry->stat_total_chunks_sent += tcList->num_chunks;
 	pMNEntry->stat_total_bytes_sent += tcList->serialized_data_length + headerOverhead;
 	pMNEntry->stat_tuple_bytes_sent += tcList->serialized_data_length;
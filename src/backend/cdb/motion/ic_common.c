@@ -31,10 +31,34 @@
 #include <sys/time.h>
 #include <netinet/in.h>
 
+#ifdef HAVE_LIBZSTD
+#include <zstd.h>
+#endif
+
 /*
   #define AMS_VERBOSE_LOGGING
 */
 
+/*
+ * Interconnect compression.
+ *
+ * With gp_interconnect_compression on, the sender compresses the tuple
+ * chunks of every outgoing packet with zstd, right before the packet is
+ * sent. If that saves at least 1/IC_COMPRESS_MIN_SAVING of the bytes, the
+ * chunks are replaced with one TC_COMPRESSED chunk, holding the size of the
+ * uncompressed chunks (uint32) and the zstd frame. The chunk type tells the
+ * receiver which packets to decompress, so it does not depend on the
+ * setting of the sender.
+ *
+ * When a packet does not compress well, the connection sends the next
+ * packets as they are; the number of packets to skip doubles with every
+ * packet that does not pay off, up to IC_COMPRESS_MAX_BACKOFF.
+ */
+#define IC_COMPRESS_LEVEL		1
+#define IC_COMPRESS_MIN_SIZE	256
+#define IC_COMPRESS_MIN_SAVING	8
+#define IC_COMPRESS_MAX_BACKOFF	64
+
 /*=========================================================================
  * STRUCTS
  */
@@ -88,6 +112,172 @@ logChunkParseDetails(MotionConn *conn, uint32 ic_instance_id)
 		 pkt->srcPid, pkt->dstPid, pkt->recvSliceIndex, pkt->sendSliceIndex, pkt->srcContentId, pkt->dstContentId);
 }
 
+#ifdef HAVE_LIBZSTD
+/*
+ * Decompress a packet that holds a TC_COMPRESSED chunk.
+ *
+ * The chunks are decompressed into a buffer of their own, at the same
+ * offset as in the packet; the buffer is returned, and the size of the
+ * decompressed message is stored in *msgSize. The chunks returned by RecvTupleChunk() are consumed
+ * before it is called again, so one buffer serves all connections.
+ */
+static uint8 *
+decompressPacketChunks(MotionConn *conn, int hdrSize, int *msgSize)
+{
+	static ZSTD_DCtx *cxt = NULL;	/* ZSTD decompression context */
+	static uint8 *buf = NULL;
+	static int	bufSize = 0;
+	uint8	   *chunk = conn->msgPos + hdrSize;
+	uint16		dataSize;
+	uint32		rawSize;
+	size_t		n;
+
+	if (!cxt)
+	{
+		cxt = ZSTD_createDCtx();
+		if (!cxt)
+			elog(ERROR, "out of memory");
+	}
+
+	memcpy(&dataSize, chunk, sizeof(uint16));
+	if (dataSize < sizeof(uint32) ||
+		TYPEALIGN(TUPLE_CHUNK_ALIGN, TUPLE_CHUNK_HEADER_SIZE + dataSize) != conn->msgSize - hdrSize)
+		ereport(ERROR,
+				(errcode(ERRCODE_GP_INTERCONNECTION_ERROR),
+				 errmsg("interconnect error parsing message: invalid compressed chunk"),
+				 errdetail("chunk size %d message size %d",
+						   TUPLE_CHUNK_HEADER_SIZE + dataSize, conn->msgSize - hdrSize)));
+
+	memcpy(&rawSize, chunk + TUPLE_CHUNK_HEADER_SIZE, sizeof(uint32));
+	if (rawSize > MAX_PACKET_SIZE)
+		ereport(ERROR,
+				(errcode(ERRCODE_GP_INTERCONNECTION_ERROR),
+				 errmsg("interconnect error parsing message: invalid compressed chunk"),
+				 errdetail("uncompressed size %u > max %d", rawSize, MAX_PACKET_SIZE)));
+
+	if (bufSize < hdrSize + (int) rawSize)
+	{
+		if (buf)
+			pfree(buf);
+		bufSize = hdrSize + MAX_PACKET_SIZE;
+		buf = MemoryContextAlloc(TopMemoryContext, bufSize);
+	}
+
+	n = ZSTD_decompressDCtx(cxt, buf + hdrSize, rawSize,
+							chunk + TUPLE_CHUNK_HEADER_SIZE + sizeof(uint32),
+							dataSize - sizeof(uint32));
+	if (ZSTD_isError(n) || n != rawSize)
+		ereport(ERROR,
+				(errcode(ERRCODE_GP_INTERCONNECTION_ERROR),
+				 errmsg("interconnect error decompressing message"),
+				 errdetail("%s", ZSTD_isError(n) ? ZSTD_getErrorName(n) :
+						   "size mismatch")));
+
+	*msgSize = hdrSize + rawSize;
+	return buf;
+}
+#endif							/* HAVE_LIBZSTD */
+
+/*
+ * Compress the tuple chunks of an outgoing packet, which start after the
+ * transport header of hdrSize bytes, if gp_interconnect_compression is on
+ * and it pays off. conn->msgSize is updated to the new size of the packet.
+ */
+void
+CompressPacketChunks(MotionConn *conn, int hdrSize)
+{
+#ifdef HAVE_LIBZSTD
+	static ZSTD_CCtx *cxt = NULL;	/* ZSTD compression context */
+	static uint8 *buf = NULL;
+	static size_t bufSize = 0;
+	uint32		rawSize = conn->msgSize - hdrSize;
+	uint8	   *chunk = conn->pBuff + hdrSize;
+	int			compressedSize;
+	size_t		n;
+
+	if (!gp_interconnect_compression || conn->msgSize <= hdrSize)
+		return;
+
+	conn->stat_bytes_before_compression += rawSize;
+
+	if (rawSize < IC_COMPRESS_MIN_SIZE || conn->compress_skip > 0)
+	{
+		if (conn->compress_skip > 0)
+			conn->compress_skip--;
+		conn->stat_bytes_after_compression += rawSize;
+		return;
+	}
+
+	if (!cxt)
+	{
+		cxt = ZSTD_createCCtx();
+		if (!cxt)
+			elog(ERROR, "out of memory");
+	}
+
+	if (bufSize < ZSTD_compressBound(rawSize))
+	{
+		if (buf)
+			pfree(buf);
+		bufSize = ZSTD_compressBound(MAX_PACKET_SIZE);
+		buf = MemoryContextAlloc(TopMemoryContext, bufSize);
+	}
+
+	n = ZSTD_compressCCtx(cxt, buf, bufSize, chunk, rawSize, IC_COMPRESS_LEVEL);
+	if (ZSTD_isError(n))
+		elog(ERROR, "interconnect compression failed: %s", ZSTD_getErrorName(n));
+
+	compressedSize = TYPEALIGN(TUPLE_CHUNK_ALIGN,
+							   TUPLE_CHUNK_HEADER_SIZE + sizeof(uint32) + n);
+	if (compressedSize > rawSize - rawSize / IC_COMPRESS_MIN_SAVING)
+	{
+		conn->compress_backoff = Min(Max(conn->compress_backoff * 2, 1),
+									 IC_COMPRESS_MAX_BACKOFF);
+		conn->compress_skip = conn->compress_backoff;
+		conn->stat_bytes_after_compression += rawSize;
+		return;
+	}
+	conn->compress_backoff = 0;
+
+	SetChunkDataSize(chunk, sizeof(uint32) + n);
+	SetChunkType(chunk, TC_COMPRESSED);
+	memcpy(chunk + TUPLE_CHUNK_HEADER_SIZE, &rawSize, sizeof(uint32));
+	memcpy(chunk + TUPLE_CHUNK_HEADER_SIZE + sizeof(uint32), buf, n);
+
+	conn->msgSize = hdrSize + compressedSize;
+	conn->stat_bytes_after_compression += compressedSize;
+#endif							/* HAVE_LIBZSTD */
+}
+
+/*
+ * Sum up the bytes of tuple chunks sent or received by a motion, before and
+ * after compression. Both are zero if the motion is not set up.
+ */
+void
+GetMotionCompressionStats(ChunkTransportState *transportStates, int16 motNodeID,
+						  uint64 *bytesBefore, uint64 *bytesAfter)
+{
+	ChunkTransportStateEntry *pEntry;
+	int			i;
+
+	*bytesBefore = 0;
+	*bytesAfter = 0;
+
+	if (transportStates == NULL || motNodeID <= 0 ||
+		motNodeID > transportStates->size)
+		return;
+
+	pEntry = &transportStates->states[motNodeID - 1];
+	if (!pEntry->valid || pEntry->conns == NULL)
+		return;
+
+	for (i = 0; i < pEntry->numConns; i++)
+	{
+		*bytesBefore += pEntry->conns[i].stat_bytes_before_compression;
+		*bytesAfter += pEntry->conns[i].stat_bytes_after_compression;
+	}
+}
+
 TupleChunkListItem
 RecvTupleChunk(MotionConn *conn, ChunkTransportState *transportStates)
 {
@@ -96,6 +286,8 @@ RecvTupleChunk(MotionConn *conn, ChunkTransportState *transportStates)
 	TupleChunkListItem lastTcItem = NULL;
 	uint32		tcSize;
 	int			bytesProcessed = 0;
+	uint8	   *msgPos;
+	int			msgSize;
 
 	if (Gp_interconnect_type == INTERCONNECT_TYPE_TCP ||
 		Gp_interconnect_type == INTERCONNECT_TYPE_PROXY)
@@ -117,9 +309,35 @@ RecvTupleChunk(MotionConn *conn, ChunkTransportState *transportStates)
 		 conn->recvBytes, conn->msgSize, conn->pBuff, conn->msgPos);
 #endif
 
-	while (bytesProcessed != conn->msgSize)
+	msgPos = conn->msgPos;
+	msgSize = conn->msgSize;
+
+	/*
+	 * A compressed packet holds a single TC_COMPRESSED chunk; parse the
+	 * chunks from its decompressed copy.
+	 */
+	if (msgSize - bytesProcessed >= TUPLE_CHUNK_HEADER_SIZE)
+	{
+		uint16		tcType;
+
+		memcpy(&tcType, msgPos + bytesProcessed + 2, sizeof(uint16));
+		if (tcType == TC_COMPRESSED)
+		{
+#ifdef HAVE_LIBZSTD
+			msgPos = decompressPacketChunks(conn, bytesProcessed, &msgSize);
+#else
+			ereport(ERROR,
+					(errcode(ERRCODE_GP_INTERCONNECTION_ERROR),
+					 errmsg("interconnect error parsing message: compressed chunks are not supported by this build")));
+#endif
+		}
+	}
+	conn->stat_bytes_before_compression += msgSize - bytesProcessed;
+	conn->stat_bytes_after_compression += conn->msgSize - bytesProcessed;
+
+	while (bytesProcessed != msgSize)
 	{
-		if (conn->msgSize - bytesProcessed < TUPLE_CHUNK_HEADER_SIZE)
+		if (msgSize - bytesProcessed < TUPLE_CHUNK_HEADER_SIZE)
 		{
 			logChunkParseDetails(conn, transportStates->sliceTable->ic_instance_id);
 
@@ -127,10 +345,10 @@ RecvTupleChunk(MotionConn *conn, ChunkTransportState *transportStates)
 					(errcode(ERRCODE_GP_INTERCONNECTION_ERROR),
 					 errmsg("interconnect error parsing message: insufficient data received"),
 					 errdetail("conn->msgSize %d bytesProcessed %d < chunk-header %d",
-							   conn->msgSize, bytesProcessed, TUPLE_CHUNK_HEADER_SIZE)));
+							   msgSize, bytesProcessed, TUPLE_CHUNK_HEADER_SIZE)));
 		}
 
-		tcSize = TUPLE_CHUNK_HEADER_SIZE + (*(uint16 *) (conn->msgPos + bytesProcessed));
+		tcSize = TUPLE_CHUNK_HEADER_SIZE + (*(uint16 *) (msgPos + bytesProcessed));
 
 		/* sanity check */
 		if (tcSize > Gp_max_packet_size)
@@ -157,7 +375,7 @@ RecvTupleChunk(MotionConn *conn, ChunkTransportState *transportStates)
 					 errdetail("tcSize %d > max %d header %d processed %d/%d from %p",
 							   tcSize, Gp_max_packet_size,
 							   TUPLE_CHUNK_HEADER_SIZE, bytesProcessed,
-							   conn->msgSize, conn->msgPos)));
+							   msgSize, msgPos)));
 		}
 
 
@@ -168,7 +386,7 @@ RecvTupleChunk(MotionConn *conn, ChunkTransportState *transportStates)
 		if (Gp_interconnect_type == INTERCONNECT_TYPE_TCP ||
 			Gp_interconnect_type == INTERCONNECT_TYPE_PROXY)
 		{
-			if (tcSize >= conn->msgSize)
+			if (tcSize >= msgSize)
 			{
 				/*
 				 * see MPP-720: it is possible that our message got messed up
@@ -182,10 +400,10 @@ RecvTupleChunk(MotionConn *conn, ChunkTransportState *transportStates)
 						(errcode(ERRCODE_GP_INTERCONNECTION_ERROR),
 						 errmsg("interconnect error parsing message"),
 						 errdetail("tcSize %d >= conn->msgSize %d",
-								   tcSize, conn->msgSize)));
+								   tcSize, msgSize)));
 			}
 		}
-		Assert(tcSize < conn->msgSize);
+		Assert(tcSize < msgSize);
 
 		/*
 		 * We store the data inplace, and handle any necessary copying later
@@ -195,7 +413,7 @@ RecvTupleChunk(MotionConn *conn, ChunkTransportState *transportStates)
 
 		tcItem->p_next = NULL;
 		tcItem->chunk_length = tcSize;
-		tcItem->inplace = (char *) (conn->msgPos + bytesProcessed);
+		tcItem->inplace = (char *) (msgPos + bytesProcessed);
 
 		bytesProcessed += TYPEALIGN(TUPLE_CHUNK_ALIGN, tcSize);
 
@@ -2777,6 +2777,8 @@ flushBuffer(ChunkTransportState *transportStates,
 	}
 #endif
 
+	CompressPacketChunks(conn, PACKET_HEADER_SIZE);
+
 	/* first set header length */
 	*(uint32 *) conn->pBuff = conn->msgSize;
 
@@ -5489,6 +5489,7 @@ SendChunkUDPIFC(ChunkTransportState *transportStates,
 
 	/* try to send it */
 
+	CompressPacketChunks(conn, sizeof(conn->conn_info));
 	prepareXmit(conn);
 
 	icBufferListAppend(&conn->sndQueue, conn->curBuff);
@@ -5620,6 +5621,7 @@ SendEosUDPIFC(ChunkTransportState *transportStates,
 			if (pEntry->sendingEos)
 				conn->conn_info.flags |= UDPIC_FLAGS_EOS;
 
+			CompressPacketChunks(conn, sizeof(conn->conn_info));
 			prepareXmit(conn);
 
 			/* place it into the send queue */
@@ -16,6 +16,7 @@
 #include "postgres.h"
 
 #include "access/htup.h"
+#include "access/tuptoaster.h"
 #include "catalog/pg_type.h"
 #include "cdb/cdbmotion.h"
 #include "cdb/cdbsrlz.h"
@@ -45,6 +46,22 @@
 #define RECORD_CACHE_MAGIC_NATTS	0xffff
 #define RECORD_CACHE_MAGIC_INFOMASK	0xffff
 
+/*
+ * A batch of tuples is sent like a tuple too, with natts set to
+ * BATCH_MAGIC_NATTS and infomask set to BATCH_MAGIC_INFOMASK in the header.
+ * The tuples are laid out column by column after the header:
+ *
+ * - the number of tuples (uint32) and attributes (uint32);
+ * - for each attribute, the size of its values (uint32), a null bitmap with
+ *	 a bit per tuple, set for non-null values, and the values of the non-null
+ *	 tuples. Fixed-width values are packed contiguously, typlen bytes each;
+ *	 varlenas and cstrings are padded to TUPLE_CHUNK_ALIGN each.
+ *
+ * The null bitmap and the values are padded to TUPLE_CHUNK_ALIGN.
+ */
+#define BATCH_MAGIC_NATTS			0xffff
+#define BATCH_MAGIC_INFOMASK		0xfffe
+
 /* A MemoryContext used within the tuple serialize code, so that freeing of
  * space is SUPAFAST.  It is initialized in the first call to InitSerTupInfo()
  * since that must be called before any tuple serialization or deserialization
@@ -206,6 +223,12 @@ CleanupSerTupInfo(SerTupInfo *pSerInfo)
 		pfree(pSerInfo->nulls);
 	pSerInfo->nulls = NULL;
 
+	if (pSerInfo->batch_tuples != NULL)
+		pfree(pSerInfo->batch_tuples);
+	pSerInfo->batch_tuples = NULL;
+	pSerInfo->batch_ntuples = 0;
+	pSerInfo->batch_capacity = 0;
+
 	pSerInfo->tupdesc = NULL;
 
 	while (pSerInfo->chunkCache.items != NULL)
@@ -379,6 +402,254 @@ SerializeRecordCacheIntoChunks(SerTupInfo *pSerInfo,
 	return;
 }
 
+/*
+ * Create an empty batch of up to 'capacity' tuples of pSerInfo's
+ * descriptor, in the current memory context.
+ *
+ * Half of 'maxbytes' goes to the null bitmaps, which may lower the capacity,
+ * and the batch is due to be sent once its values take the other half.  The
+ * column buffers double as they fill up, so the batch uses up to about
+ * 'maxbytes' + 'maxbytes' / 2, plus the last tuple added.
+ */
+SerTupBatch *
+CreateSerTupBatch(SerTupInfo *pSerInfo, int capacity, int maxbytes)
+{
+	SerTupBatch *batch;
+	int			natts = pSerInfo->tupdesc->natts;
+	int			initlen;
+	int			i;
+
+	AssertArg(capacity > 0);
+	AssertArg(maxbytes > 0);
+
+	capacity = Min(capacity, (maxbytes / 2 / natts) * BITS_PER_BYTE);
+	capacity = Max(capacity, 1);
+
+	initlen = maxbytes / 2 / natts;
+	initlen = Max(initlen, 32);
+	initlen = Min(initlen, 1024);
+
+	batch = (SerTupBatch *) palloc0(sizeof(SerTupBatch));
+	batch->capacity = capacity;
+	batch->maxbytes = Max(maxbytes / 2, 1);
+	batch->nullbitmaps = (bits8 *) palloc0(natts * BITMAPLEN(capacity));
+	batch->values = (StringInfoData *) palloc(natts * sizeof(StringInfoData));
+	for (i = 0; i < natts; i++)
+	{
+		/* like initStringInfo(), with a smaller buffer */
+		batch->values[i].data = (char *) palloc(initlen);
+		batch->values[i].maxlen = initlen;
+		resetStringInfo(&batch->values[i]);
+	}
+
+	return batch;
+}
+
+/* Append the bytes of a pass-by-value datum to a column of a batch. */
+static inline void
+appendByvalToBatch(StringInfo values, Datum datum, int16 typlen)
+{
+	switch (typlen)
+	{
+		case sizeof(char):
+			{
+				char		v = DatumGetChar(datum);
+
+				appendBinaryStringInfo(values, (char *) &v, sizeof(v));
+				break;
+			}
+		case sizeof(int16):
+			{
+				int16		v = DatumGetInt16(datum);
+
+				appendBinaryStringInfo(values, (char *) &v, sizeof(v));
+				break;
+			}
+		case sizeof(int32):
+			{
+				int32		v = DatumGetInt32(datum);
+
+				appendBinaryStringInfo(values, (char *) &v, sizeof(v));
+				break;
+			}
+#if SIZEOF_DATUM == 8
+		case sizeof(Datum):
+			appendBinaryStringInfo(values, (char *) &datum, sizeof(datum));
+			break;
+#endif
+		default:
+			elog(ERROR, "unsupported byval length: %d", (int) typlen);
+	}
+}
+
+/* Pad a column of a batch to TUPLE_CHUNK_ALIGN. */
+static inline void
+padBatchValues(StringInfo values)
+{
+	while (values->len & (TUPLE_CHUNK_ALIGN - 1))
+		appendStringInfoCharMacro(values, 0);
+}
+
+/*
+ * Add the tuple in a slot to a batch, column by column. Out-of-line values
+ * are fetched, so that the receiver doesn't need to.
+ */
+void
+AddTupleToBatch(TupleTableSlot *slot, SerTupInfo *pSerInfo, SerTupBatch *batch)
+{
+	int			natts = pSerInfo->tupdesc->natts;
+	int			bitmaplen = BITMAPLEN(batch->capacity);
+	int			row = batch->ntuples;
+	Datum	   *values;
+	bool	   *isnull;
+	int			i;
+
+	AssertArg(batch->ntuples < batch->capacity);
+
+	slot_getallattrs(slot);
+	values = slot_get_values(slot);
+	isnull = slot_get_isnull(slot);
+
+	for (i = 0; i < natts; i++)
+	{
+		SerAttrInfo *attrInfo = pSerInfo->myinfo + i;
+		StringInfo	colValues = &batch->values[i];
+		int			oldlen = colValues->len;
+
+		if (isnull[i])
+			continue;
+
+		batch->nullbitmaps[i * bitmaplen + row / BITS_PER_BYTE] |=
+			1 << (row % BITS_PER_BYTE);
+
+		if (attrInfo->typbyval)
+			appendByvalToBatch(colValues, values[i], attrInfo->typlen);
+		else if (attrInfo->typlen > 0)
+			appendBinaryStringInfo(colValues, DatumGetPointer(values[i]),
+								   attrInfo->typlen);
+		else if (attrInfo->typlen == -1)
+		{
+			struct varlena *v = (struct varlena *) DatumGetPointer(values[i]);
+
+			if (VARATT_IS_EXTERNAL(v))
+			{
+				struct varlena *fetched = heap_tuple_fetch_attr(v);
+
+				appendBinaryStringInfo(colValues, (char *) fetched,
+									   VARSIZE_ANY(fetched));
+				pfree(fetched);
+			}
+			else
+				appendBinaryStringInfo(colValues, (char *) v, VARSIZE_ANY(v));
+			padBatchValues(colValues);
+		}
+		else
+		{
+			char	   *str = DatumGetCString(values[i]);
+
+			appendBinaryStringInfo(colValues, str, strlen(str) + 1);
+			padBatchValues(colValues);
+		}
+
+		batch->nbytes += colValues->len - oldlen;
+	}
+
+	batch->ntuples++;
+}
+
+/*
+ * Convert a batch into a byte-sequence, and store it directly into a
+ * chunklist for transmission. The batch is emptied, to collect the next
+ * tuples.
+ */
+void
+SerializeBatchIntoChunks(SerTupInfo *pSerInfo,
+						 SerTupBatch *batch,
+						 TupleChunkList tcList)
+{
+	TupleChunkListItem tcItem;
+	TupSerHeader tsh;
+	uint32		ntuples = batch->ntuples;
+	uint32		natts = pSerInfo->tupdesc->natts;
+	int			bitmaplen = BITMAPLEN(batch->capacity);
+	int			usedbitmaplen = BITMAPLEN(ntuples);
+	int			i;
+
+	AssertArg(tcList != NULL);
+	AssertArg(ntuples > 0);
+
+	/* get ready to go */
+	tcList->p_first = NULL;
+	tcList->p_last = NULL;
+	tcList->num_chunks = 0;
+	tcList->serialized_data_length = 0;
+	tcList->max_chunk_length = Gp_max_tuple_chunk_size;
+
+	tcItem = getChunkFromCache(&pSerInfo->chunkCache);
+
+	/* assume that we'll take a single chunk */
+	SetChunkType(tcItem->chunk_data, TC_WHOLE);
+	tcItem->chunk_length = TUPLE_CHUNK_HEADER_SIZE;
+	appendChunkToTCList(tcList, tcItem);
+
+	tsh.tuplen = sizeof(TupSerHeader) + 2 * sizeof(uint32) +
+		natts * (sizeof(uint32) + TYPEALIGN(TUPLE_CHUNK_ALIGN, usedbitmaplen));
+	for (i = 0; i < natts; i++)
+	{
+		/* varlenas are already padded, fixed-width values are not */
+		padBatchValues(&batch->values[i]);
+		tsh.tuplen += batch->values[i].len;
+	}
+	tsh.natts = BATCH_MAGIC_NATTS;
+	tsh.infomask = BATCH_MAGIC_INFOMASK;
+
+	addByteStringToChunkList(tcList, (char *) &tsh, sizeof(TupSerHeader),
+							 &pSerInfo->chunkCache);
+	addInt32ToChunkList(tcList, ntuples, &pSerInfo->chunkCache);
+	addInt32ToChunkList(tcList, natts, &pSerInfo->chunkCache);
+
+	for (i = 0; i < natts; i++)
+	{
+		StringInfo	colValues = &batch->values[i];
+
+		addInt32ToChunkList(tcList, colValues->len, &pSerInfo->chunkCache);
+		addByteStringToChunkList(tcList, (char *) batch->nullbitmaps + i * bitmaplen,
+								 usedbitmaplen, &pSerInfo->chunkCache);
+		addPadding(tcList, &pSerInfo->chunkCache, usedbitmaplen);
+		if (colValues->len > 0)
+			addByteStringToChunkList(tcList, colValues->data, colValues->len,
+									 &pSerInfo->chunkCache);
+
+		resetStringInfo(colValues);
+	}
+
+	Assert(tcList->serialized_data_length == tsh.tuplen);
+
+	/*
+	 * if we have more than 1 chunk we have to set the chunk types on our
+	 * first chunk and last chunk
+	 */
+	if (tcList->num_chunks > 1)
+	{
+		TupleChunkListItem first,
+					last;
+
+		first = tcList->p_first;
+		last = tcList->p_last;
+
+		Assert(first != NULL);
+		Assert(first != last);
+		Assert(last != NULL);
+
+		SetChunkType(first->chunk_data, TC_PARTIAL_START);
+		SetChunkType(last->chunk_data, TC_PARTIAL_END);
+	}
+
+	memset(batch->nullbitmaps, 0, natts * bitmaplen);
+	batch->ntuples = 0;
+	batch->nbytes = 0;
+}
+
 static bool
 CandidateForSerializeDirect(int16 targetRoute, struct directTransportBuffer *b)
 {
@@ -602,6 +873,171 @@ SerializeTuple(TupleTableSlot *slot, SerTupInfo *pSerInfo, struct directTranspor
 	return 0;
 }
 
+/* Read a uint32 off a serialized batch, checking that it's there. */
+static uint32
+readBatchInt32(StringInfo serData)
+{
+	uint32		x;
+
+	if (serData->cursor + sizeof(x) > serData->len)
+		ereport(ERROR,
+				(errcode(ERRCODE_GP_INTERCONNECTION_ERROR),
+				 errmsg("interconnect error: truncated tuple batch")));
+	memcpy(&x, serData->data + serData->cursor, sizeof(x));
+	serData->cursor += sizeof(x);
+
+	return x;
+}
+
+/*
+ * Deserialize a batch of tuples, serialized by SerializeBatchIntoChunks(),
+ * into pSerInfo->batch_tuples. The data of each column is read in turn,
+ * and the tuples are formed once all the columns are in.
+ */
+static void
+DeserializeBatch(SerTupInfo *pSerInfo, StringInfo serData)
+{
+	TupleDesc	tupdesc = pSerInfo->tupdesc;
+	int			natts = tupdesc->natts;
+	uint32		ntuples;
+	int			bitmaplen;
+	Datum	   *values;
+	bool	   *isnull;
+	int			i;
+	int			row;
+
+	serData->cursor = sizeof(TupSerHeader);
+	ntuples = readBatchInt32(serData);
+	if (natts <= 0 || readBatchInt32(serData) != (uint32) natts)
+		ereport(ERROR,
+				(errcode(ERRCODE_GP_INTERCONNECTION_ERROR),
+				 errmsg("interconnect error: tuple batch has the wrong number of attributes")));
+	if (ntuples == 0 ||
+		ntuples > MaxAllocSize / (sizeof(Datum) + sizeof(bool)) / natts)
+		ereport(ERROR,
+				(errcode(ERRCODE_GP_INTERCONNECTION_ERROR),
+				 errmsg("interconnect error: invalid tuple batch size %u", ntuples)));
+	bitmaplen = BITMAPLEN(ntuples);
+
+	if (pSerInfo->batch_capacity < ntuples)
+	{
+		if (pSerInfo->batch_tuples != NULL)
+			pfree(pSerInfo->batch_tuples);
+		pSerInfo->batch_tuples = (GenericTuple *)
+			MemoryContextAlloc(GetMemoryChunkContext(pSerInfo->myinfo),
+							   ntuples * sizeof(GenericTuple));
+		pSerInfo->batch_capacity = ntuples;
+	}
+
+	/* Values of the tuples, column by column. */
+	values = (Datum *) palloc(ntuples * natts * sizeof(Datum));
+	isnull = (bool *) palloc(ntuples * natts * sizeof(bool));
+
+	for (i = 0; i < natts; i++)
+	{
+		SerAttrInfo *attrInfo = pSerInfo->myinfo + i;
+		uint32		datalen = readBatchInt32(serData);
+		int			paddedbitmaplen = TYPEALIGN(TUPLE_CHUNK_ALIGN, bitmaplen);
+		bits8	   *bitmap;
+		char	   *pos;
+		char	   *end;
+
+		if (serData->cursor + paddedbitmaplen > serData->len ||
+			datalen > serData->len - serData->cursor - paddedbitmaplen)
+			ereport(ERROR,
+					(errcode(ERRCODE_GP_INTERCONNECTION_ERROR),
+					 errmsg("interconnect error: truncated tuple batch")));
+
+		bitmap = (bits8 *) (serData->data + serData->cursor);
+		serData->cursor += bitmaplen;
+		skipPadding(serData);
+
+		pos = serData->data + serData->cursor;
+		end = pos + datalen;
+		serData->cursor += datalen;
+
+		for (row = 0; row < ntuples; row++)
+		{
+			Datum	   *value = &values[row * natts + i];
+			int			len;
+
+			if (!(bitmap[row / BITS_PER_BYTE] & (1 << (row % BITS_PER_BYTE))))
+			{
+				isnull[row * natts + i] = true;
+				*value = (Datum) 0;
+				continue;
+			}
+			isnull[row * natts + i] = false;
+
+			if (attrInfo->typlen > 0)
+				len = attrInfo->typlen;
+			else if (attrInfo->typlen == -1 && end - pos >= VARHDRSZ_SHORT &&
+					 (VARATT_IS_1B(pos) || end - pos >= VARHDRSZ))
+				len = VARSIZE_ANY(pos);
+			else if (attrInfo->typlen == -2 && memchr(pos, '\0', end - pos))
+				len = strlen(pos) + 1;
+			else
+				len = end - pos + 1;
+
+			if (len > end - pos)
+				ereport(ERROR,
+						(errcode(ERRCODE_GP_INTERCONNECTION_ERROR),
+						 errmsg("interconnect error: truncated tuple batch")));
+
+			if (attrInfo->typbyval)
+			{
+				switch (attrInfo->typlen)
+				{
+					case sizeof(char):
+						*value = CharGetDatum(*(char *) pos);
+						break;
+					case sizeof(int16):
+						{
+							int16		v;
+
+							memcpy(&v, pos, sizeof(v));
+							*value = Int16GetDatum(v);
+							break;
+						}
+					case sizeof(int32):
+						{
+							int32		v;
+
+							memcpy(&v, pos, sizeof(v));
+							*value = Int32GetDatum(v);
+							break;
+						}
+#if SIZEOF_DATUM == 8
+					case sizeof(Datum):
+						memcpy(value, pos, sizeof(Datum));
+						break;
+#endif
+					default:
+						elog(ERROR, "unsupported byval length: %d",
+							 (int) attrInfo->typlen);
+				}
+				pos += len;
+			}
+			else
+			{
+				/* heap_form_tuple() copies the values, no need to align them */
+				*value = PointerGetDatum(pos);
+				pos += len;
+				if (attrInfo->typlen < 0)
+					pos = (char *) TYPEALIGN(TUPLE_CHUNK_ALIGN, pos);
+			}
+		}
+	}
+
+	for (row = 0; row < ntuples; row++)
+		pSerInfo->batch_tuples[row] = (GenericTuple)
+			heap_form_tuple(tupdesc, &values[row * natts], &isnull[row * natts]);
+	pSerInfo->batch_ntuples = ntuples;
+
+	pfree(values);
+	pfree(isnull);
+}
+
 /*
  * Reassemble and deserialize a list of tuple chunks, into a tuple.
  */
@@ -761,6 +1197,20 @@ CvtChunksToTup(TupleChunkList tcList, SerTupInfo *pSerInfo, TupleRemapper *remap
 			return NULL;
 		}
 
+		if (!(tshp->tuplen & MEMTUP_LEAD_BIT) &&
+			tshp->natts == BATCH_MAGIC_NATTS &&
+			tshp->infomask == BATCH_MAGIC_INFOMASK)
+		{
+			/* a batch of tuples, column by column */
+			DeserializeBatch(pSerInfo, &serData);
+
+			/* Free up memory we used. */
+			if (serDataMustFree)
+				pfree(serData.data);
+
+			return NULL;
+		}
+
 		if ((tshp->tuplen & MEMTUP_LEAD_BIT) != 0)
 		{
 			uint32		tuplen = memtuple_size_from_uint32(tshp->tuplen);
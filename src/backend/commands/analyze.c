@@ -89,6 +89,7 @@
 #include "catalog/pg_collation.h"
 #include "catalog/pg_inherits_fn.h"
 #include "catalog/pg_namespace.h"
+#include "catalog/pg_statistic.h"
 #include "commands/dbcommands.h"
 #include "commands/tablecmds.h"
 #include "commands/vacuum.h"
@@ -187,6 +188,10 @@ static void compute_index_stats(Relation onerel, double totalrows,
 					AnlIndexData *indexdata, int nindexes,
 					HeapTuple *rows, int numrows,
 					MemoryContext col_context);
+static void compute_column_group_stats(Relation onerel, double totalrows,
+						   int attr_cnt, VacAttrStats **vacattrstats,
+						   HeapTuple *rows, int numrows, int elevel);
+static int	compare_group_rows(const void *a, const void *b, void *arg);
 static VacAttrStats *examine_attribute(Relation onerel, int attnum,
 				  Node *index_expr, int elevel);
 static int acquire_sample_rows_dispatcher(Relation onerel, bool inh, int elevel,
@@ -875,6 +880,12 @@ do_analyze_rel(Relation onerel, VacuumStmt *vacstmt,
 			MemoryContextResetAndDeleteChildren(col_context);
 		}
 
+		if (sample_needed)
+			compute_column_group_stats(onerel, totalrows,
+									   attr_cnt, vacattrstats,
+									   rows, numrows, elevel);
+		MemoryContextResetAndDeleteChildren(col_context);
+
 		/*
 		 * Datums exceeding WIDTH_THRESHOLD are masked as NULL in the sample, and
 		 * are used as is to evaluate index statistics. It is less likely to have
@@ -1217,6 +1228,334 @@ compute_index_stats(Relation onerel, double totalrows,
 	MemoryContextDelete(ind_context);
 }
 
+/*
+ * Context for sorting the sample rows on the columns of a group. The values
+ * of column c of sample row r are at values[r * ncols + c].
+ */
+typedef struct
+{
+	int			ncols;			/* # of columns of the group */
+	int		   *keycols;		/* columns of the sort key, in order */
+	SortSupport ssups;			/* sort support of each column */
+	Datum	   *values;
+	bool	   *nulls;
+} CompareGroupRowsContext;
+
+/*
+ * qsort_arg comparator for sorting sample rows, given by their index, on
+ * the columns of a group. NULLs sort after all the other values.
+ */
+static int
+compare_group_rows(const void *a, const void *b, void *arg)
+{
+	int			ra = *(const int *) a;
+	int			rb = *(const int *) b;
+	CompareGroupRowsContext *cxt = (CompareGroupRowsContext *) arg;
+	int			k;
+
+	for (k = 0; k < cxt->ncols; k++)
+	{
+		int			c = cxt->keycols[k];
+		int			ia = ra * cxt->ncols + c;
+		int			ib = rb * cxt->ncols + c;
+		int			compare;
+
+		compare = ApplySortComparator(cxt->values[ia], cxt->nulls[ia],
+									  cxt->values[ib], cxt->nulls[ib],
+									  &cxt->ssups[c]);
+		if (compare != 0)
+			return compare;
+	}
+
+	return ra - rb;
+}
+
+/*
+ * Are the two sample rows equal on the first nkeys columns of the sort key?
+ */
+static bool
+group_rows_equal(CompareGroupRowsContext *cxt, int ra, int rb, int nkeys)
+{
+	int			k;
+
+	for (k = 0; k < nkeys; k++)
+	{
+		int			c = cxt->keycols[k];
+		int			ia = ra * cxt->ncols + c;
+		int			ib = rb * cxt->ncols + c;
+
+		if (ApplySortComparator(cxt->values[ia], cxt->nulls[ia],
+								cxt->values[ib], cxt->nulls[ib],
+								&cxt->ssups[c]) != 0)
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * compute_column_group_stats -- statistics of the column groups
+ *
+ * A column can name other columns of the relation in its statistics_group
+ * option. For each such group, estimate from the sample the number of
+ * distinct combinations of values of the group, and for each column of the
+ * group the fraction of the sampled rows whose value of the column is
+ * determined by their values of the other columns. The result is stored
+ * in a STATISTIC_KIND_NDISTINCT_GROUP slot of the first column of the group,
+ * which must have been computed already.
+ */
+static void
+compute_column_group_stats(Relation onerel, double totalrows,
+						   int attr_cnt, VacAttrStats **vacattrstats,
+						   HeapTuple *rows, int numrows, int elevel)
+{
+	TupleDesc	tupdesc = RelationGetDescr(onerel);
+	int			i;
+
+	if (numrows <= 0)
+		return;
+
+	for (i = 0; i < attr_cnt; i++)
+	{
+		VacAttrStats *stats = vacattrstats[i];
+		AttributeOpts *aopt;
+		char	   *rawstring;
+		List	   *namelist;
+		ListCell   *lc;
+		AttrNumber	attnums[STATISTIC_GROUP_MAX_COLUMNS];
+		SortSupportData ssups[STATISTIC_GROUP_MAX_COLUMNS];
+		int			keycols[STATISTIC_GROUP_MAX_COLUMNS];
+		CompareGroupRowsContext cxt;
+		int		   *rowidx;
+		int			ncols;
+		int			slot;
+		int			r;
+		int			c;
+		int			d;
+		int			f1;
+		int			dupcnt;
+		double		stadistinct;
+		float4	   *stanumbers;
+		bool		valid = true;
+
+		if (!stats->stats_valid)
+			continue;
+
+		aopt = get_attribute_options(onerel->rd_id, stats->attr->attnum);
+		if (aopt == NULL)
+			continue;
+		if (aopt->statistics_group == 0)
+		{
+			pfree(aopt);
+			continue;
+		}
+		rawstring = pstrdup((char *) aopt + aopt->statistics_group);
+		pfree(aopt);
+
+		/* find a free slot; the last one is reserved for HLL counters */
+		for (slot = 0; slot < STATISTIC_NUM_SLOTS - 1; slot++)
+		{
+			if (stats->stakind[slot] == 0)
+				break;
+		}
+		if (slot >= STATISTIC_NUM_SLOTS - 1)
+		{
+			ereport(elevel,
+					(errmsg("no room for the statistics group of column \"%s\" of \"%s\"",
+							NameStr(stats->attr->attname),
+							RelationGetRelationName(onerel))));
+			pfree(rawstring);
+			continue;
+		}
+
+		/* resolve the columns of the group, the column itself first */
+		ncols = 0;
+		attnums[ncols++] = stats->attr->attnum;
+		if (!SplitIdentifierString(rawstring, ',', &namelist))
+			valid = false;
+		foreach(lc, namelist)
+		{
+			char	   *attname = (char *) lfirst(lc);
+			AttrNumber	attnum = attnameAttNum(onerel, attname, false);
+
+			for (c = 0; valid && c < ncols; c++)
+			{
+				if (attnums[c] == attnum)
+					valid = false;
+			}
+			if (!valid || attnum <= 0 || ncols >= STATISTIC_GROUP_MAX_COLUMNS)
+			{
+				ereport(WARNING,
+						(errmsg("skipping the statistics group of column \"%s\" of \"%s\": invalid column \"%s\"",
+								NameStr(stats->attr->attname),
+								RelationGetRelationName(onerel), attname)));
+				valid = false;
+				break;
+			}
+			attnums[ncols++] = attnum;
+		}
+		list_free(namelist);
+		pfree(rawstring);
+		if (!valid || ncols < 2)
+			continue;
+
+		/* prepare the sort support of each column */
+		for (c = 0; valid && c < ncols; c++)
+		{
+			Form_pg_attribute attr = tupdesc->attrs[attnums[c] - 1];
+			TypeCacheEntry *typentry;
+
+			typentry = lookup_type_cache(attr->atttypid, TYPECACHE_LT_OPR);
+			if (!OidIsValid(typentry->lt_opr))
+			{
+				ereport(WARNING,
+						(errmsg("skipping the statistics group of column \"%s\" of \"%s\": column \"%s\" has no ordering operator",
+								NameStr(stats->attr->attname),
+								RelationGetRelationName(onerel),
+								NameStr(attr->attname))));
+				valid = false;
+				break;
+			}
+
+			memset(&ssups[c], 0, sizeof(SortSupportData));
+			ssups[c].ssup_cxt = CurrentMemoryContext;
+			ssups[c].ssup_collation = attr->attcollation;
+			ssups[c].ssup_nulls_first = false;
+			PrepareSortSupportFromOrderingOp(typentry->lt_opr, &ssups[c]);
+		}
+		if (!valid)
+			continue;
+
+		/* deform the sampled values of the group */
+		cxt.ncols = ncols;
+		cxt.keycols = keycols;
+		cxt.ssups = ssups;
+		cxt.values = (Datum *) palloc(numrows * ncols * sizeof(Datum));
+		cxt.nulls = (bool *) palloc(numrows * ncols * sizeof(bool));
+		rowidx = (int *) palloc(numrows * sizeof(int));
+		for (r = 0; r < numrows; r++)
+		{
+			for (c = 0; c < ncols; c++)
+				cxt.values[r * ncols + c] = heap_getattr(rows[r], attnums[c],
+														 tupdesc,
+														 &cxt.nulls[r * ncols + c]);
+		}
+
+		stanumbers = (float4 *) MemoryContextAlloc(stats->anl_context,
+												   (1 + 2 * ncols) * sizeof(float4));
+
+		/*
+		 * Dependency degree of each column: sort on the other columns, then
+		 * on the column itself, and count the rows of the groups of equal
+		 * values of the other columns in which the column has a single value.
+		 * The last sort is on all the columns, and is also used to count the
+		 * distinct combinations.
+		 */
+		for (c = ncols - 1; c >= 0; c--)
+		{
+			int			k = 0;
+			int			j;
+			int			start;
+			int			determined = 0;
+
+			for (j = 0; j < ncols; j++)
+			{
+				if (j != c)
+					keycols[k++] = j;
+			}
+			keycols[k] = c;
+
+			for (r = 0; r < numrows; r++)
+				rowidx[r] = r;
+			qsort_arg((void *) rowidx, numrows, sizeof(int),
+					  compare_group_rows, (void *) &cxt);
+
+			start = 0;
+			while (start < numrows)
+			{
+				int			end = start + 1;
+				bool		single = true;
+
+				while (end < numrows &&
+					   group_rows_equal(&cxt, rowidx[start], rowidx[end],
+										ncols - 1))
+				{
+					if (single &&
+						!group_rows_equal(&cxt, rowidx[start], rowidx[end],
+										  ncols))
+						single = false;
+					end++;
+				}
+				if (single)
+					determined += end - start;
+				start = end;
+			}
+
+			stanumbers[1 + ncols + c] = (float4) determined / numrows;
+			stanumbers[1 + c] = (float4) attnums[c];
+		}
+
+		/*
+		 * Count the distinct combinations, and the ones that appear exactly
+		 * once, over the last sort, which is on all the columns.
+		 */
+		d = 0;
+		f1 = 0;
+		dupcnt = 0;
+		for (r = 0; r < numrows; r++)
+		{
+			if (r > 0 &&
+				group_rows_equal(&cxt, rowidx[r - 1], rowidx[r], ncols))
+			{
+				dupcnt++;
+				continue;
+			}
+			if (r > 0 && dupcnt == 1)
+				f1++;
+			d++;
+			dupcnt = 1;
+		}
+		if (dupcnt == 1)
+			f1++;
+
+		/* Haas-Stokes estimator, as in compute_scalar_stats */
+		if (f1 == d)
+			stadistinct = -1.0;
+		else
+		{
+			double		numer,
+						denom;
+
+			numer = (double) numrows * (double) d;
+			denom = (double) (numrows - f1) +
+				(double) f1 * (double) numrows / totalrows;
+			stadistinct = numer / denom;
+			if (stadistinct < (double) d)
+				stadistinct = (double) d;
+			if (stadistinct > totalrows)
+				stadistinct = totalrows;
+			stadistinct = floor(stadistinct + 0.5);
+			if (stadistinct > 0.1 * totalrows)
+				stadistinct = -(stadistinct / totalrows);
+		}
+		stanumbers[0] = (float4) stadistinct;
+
+		stats->stakind[slot] = STATISTIC_KIND_NDISTINCT_GROUP;
+		stats->staop[slot] = InvalidOid;
+		stats->stanumbers[slot] = stanumbers;
+		stats->numnumbers[slot] = 1 + 2 * ncols;
+		stats->numvalues[slot] = 0;
+
+		elog(elevel, "statistics group of column \"%s\" of \"%s\": %d columns, ndistinct %g",
+			 NameStr(stats->attr->attname), RelationGetRelationName(onerel),
+			 ncols, stadistinct);
+
+		pfree(rowidx);
+		pfree(cxt.values);
+		pfree(cxt.nulls);
+	}
+}
+
 /*
  * examine_attribute -- pre-analysis of a single column
  *
@@ -4232,6 +4571,8 @@ merge_leaf_stats(VacAttrStatsP stats,
 
 	GpHLLCounter finalHLL = NULL;
 	GpHLLCounter finalHLLFull = NULL;
+	GpHLLCounter rootHLL = NULL;
+	int16 rootHLLKind = 0;
 	int i = 0;
 	double ndistinct = 0.0;
 	int fullhll_count = 0;
@@ -4346,6 +4687,11 @@ merge_leaf_stats(VacAttrStatsP stats,
 		if (fullhll_count == totalhll_count)
 		{
 			ndistinct = gp_hyperloglog_estimate(finalHLLFull);
+
+			old_context = MemoryContextSwitchTo(stats->anl_context);
+			rootHLL = gp_hll_copy(finalHLLFull);
+			rootHLLKind = STATISTIC_KIND_FULLHLL;
+			MemoryContextSwitchTo(old_context);
 			pfree(finalHLLFull);
 			/*
 			 * For fullscan the ndistinct is calculated based on the entire table scan
@@ -4367,6 +4713,11 @@ merge_leaf_stats(VacAttrStatsP stats,
 		else if (finalHLL != NULL && samplehll_count == totalhll_count)
 		{
 			ndistinct = gp_hyperloglog_estimate(finalHLL);
+
+			old_context = MemoryContextSwitchTo(stats->anl_context);
+			rootHLL = gp_hll_copy(finalHLL);
+			rootHLLKind = STATISTIC_KIND_HLL;
+			MemoryContextSwitchTo(old_context);
 			pfree(finalHLL);
 			/*
 			 * For sampled HLL counter, the ndistinct calculated is based on the
@@ -4640,6 +4991,25 @@ merge_leaf_stats(VacAttrStatsP stats,
 			slot_idx++;
 		}
 	}
+
+	/*
+	 * Keep the merged HLL counter of the leaves on the root. ORCA uses it to
+	 * estimate the number of distinct values of a UNION ALL of the root with
+	 * other relations, which cannot be derived from the NDVs alone.
+	 */
+	if (rootHLL != NULL)
+	{
+		Datum	   *hll_values;
+
+		old_context = MemoryContextSwitchTo(stats->anl_context);
+		hll_values = (Datum *) palloc(sizeof(Datum));
+		hll_values[0] = PointerGetDatum(rootHLL);
+		MemoryContextSwitchTo(old_context);
+
+		stats->stakind[STATISTIC_NUM_SLOTS-1] = rootHLLKind;
+		stats->stavalues[STATISTIC_NUM_SLOTS-1] = hll_values;
+		stats->numvalues[STATISTIC_NUM_SLOTS-1] = 1;
+	}
 	for (i = 0; i < numPartitions; i++)
 	{
 		if (HeapTupleIsValid(heaptupleStats[i]))
@@ -44,6 +44,8 @@
 
 #ifdef USE_ORCA
 extern char *SerializeDXLPlan(Query *parse);
+extern void GetGPOPTPlanCacheStats(uint64 *hits, uint64 *misses);
+extern void GetGPOPTProfile(List **summary, List **xforms);
 #endif
 
 
@@ -412,6 +414,17 @@ ExplainOneQuery(Query *query, IntoClause *into, ExplainState *es,
 		INSTR_TIME_SET_CURRENT(planduration);
 		INSTR_TIME_SUBTRACT(planduration, planstart);
 
+#ifdef USE_ORCA
+		/*
+		 * Grab the profile of the optimization now, before executing the
+		 * query can optimize other queries and overwrite it.
+		 */
+		if (es->analyze && es->verbose && optimizer_explain_profile &&
+			plan->planGen == PLANGEN_OPTIMIZER)
+			GetGPOPTProfile(&es->extra->optprofile,
+							&es->extra->optprofilexforms);
+#endif
+
 		/*
 		 * GPDB_92_MERGE_FIXME: it really should be an optimizer's responsibility
 		 * to correctly set the into-clause and into-policy of the PlannedStmt.
@@ -662,7 +675,29 @@ ExplainOnePlan(PlannedStmt *plannedstmt, IntoClause *into, ExplainState *es,
 		ExplainProperty("Optimizer", "Postgres query optimizer", false, es);
 #ifdef USE_ORCA
 	else
+	{
 		ExplainPropertyStringInfo("Optimizer", es, "Pivotal Optimizer (GPORCA)");
+
+		if (optimizer_plan_cache_size > 0)
+		{
+			uint64		hits;
+			uint64		misses;
+
+			GetGPOPTPlanCacheStats(&hits, &misses);
+			ExplainPropertyStringInfo("Optimizer Plan Cache", es,
+									  "hits=" UINT64_FORMAT " misses=" UINT64_FORMAT,
+									  hits, misses);
+		}
+
+		/* Profile of the optimization, grabbed in ExplainOneQuery() */
+		if (es->extra->optprofile != NIL)
+			ExplainPropertyList("Optimizer Profile", es->extra->optprofile, es);
+		if (es->extra->optprofilexforms != NIL)
+			ExplainPropertyList("Optimizer Xforms",
+								es->extra->optprofilexforms, es);
+	}
+	es->extra->optprofile = NIL;
+	es->extra->optprofilexforms = NIL;
 #endif
 
 	/* We only list the non-default GUCs in verbose mode */
@@ -42,6 +42,17 @@
 #define BUFFER_INCREMENT_SIZE 1024
 #define HHA_MSG_LVL DEBUG2
 
+/*
+ * A streaming (bottom stage) HashAgg measures how many of its input tuples
+ * it merged into existing groups, once it has seen this many input tuples or
+ * when its hash table first fills up, whichever comes first. If that is less
+ * than gp_hashagg_stream_min_reduction, the aggregation is not paying off:
+ * from then on, the hash table is kept to HHA_STREAM_BATCH_GROUPS groups and
+ * streamed out whenever it holds that many.
+ */
+#define HHA_REDUCTION_SAMPLE_TUPLES 16384
+#define HHA_STREAM_BATCH_GROUPS 1024
+
 
 /* Encapture data related to a batch file. */
 struct BatchFileInfo
@@ -139,6 +150,7 @@ static void agg_hash_table_stat_upd(HashAggTable *ht);
 static void reset_agg_hash_table(AggState *aggstate, int64 nentries);
 static bool agg_hash_reload(AggState *aggstate);
 static void reCalcNumberBatches(HashAggTable *hashtable, SpillFile *spill_file);
+static void check_agg_reduction(HashAggTable *hashtable);
 static inline void *mpool_cxt_alloc(void *manager, Size len);
 
 static inline void *mpool_cxt_alloc(void *manager, Size len)
@@ -995,6 +1007,8 @@ agg_hash_initial_pass(AggState *aggstate)
 			if (streaming)
 			{
 				Assert(tuple_remaining);
+				if (!hashtable->reduction_checked)
+					check_agg_reduction(hashtable);
 				hashtable->prev_slot = outerslot;
 				/* Stream existing entries instead of spilling */
 				break;
@@ -1030,7 +1044,15 @@ agg_hash_initial_pass(AggState *aggstate)
 		/* Reset per-input-tuple context after each tuple */
 		ResetExprContext(tmpcontext);
 
-		if (streaming && !HAVE_FREESPACE(hashtable))
+		if (streaming && !hashtable->reduction_checked &&
+			(hashtable->num_tuples >= HHA_REDUCTION_SAMPLE_TUPLES ||
+			 !HAVE_FREESPACE(hashtable)))
+			check_agg_reduction(hashtable);
+
+		if (streaming &&
+			(!HAVE_FREESPACE(hashtable) ||
+			 (hashtable->stream_partial_groups &&
+			  hashtable->num_ht_groups >= HHA_STREAM_BATCH_GROUPS)))
 		{
 			Assert(tuple_remaining);
 			ExecClearTuple(aggstate->hashslot);
@@ -1835,11 +1857,47 @@ agg_hash_stream(AggState *aggstate)
 	elog(HHA_MSG_LVL,
 		"HashAgg: streaming");
 
-	reset_agg_hash_table(aggstate, 0 /* don't reallocate buckets */);
+	/*
+	 * Once aggregation has been found not to pay off, shrink the buckets to
+	 * the size of a batch, so that the resets stay cheap.
+	 */
+	if (aggstate->hhashtable->stream_partial_groups)
+		reset_agg_hash_table(aggstate, HHA_STREAM_BATCH_GROUPS);
+	else
+		reset_agg_hash_table(aggstate, 0 /* don't reallocate buckets */);
 	
 	return agg_hash_initial_pass(aggstate);
 }
 
+/*
+ * Function: check_agg_reduction
+ *
+ * Measure the fraction of the input tuples of a streaming HashAgg that were
+ * merged into existing groups, and decide whether to stream its partial
+ * groups in small batches from now on. Called only once, before the hash
+ * table is first reset, so that num_ht_groups covers all tuples so far.
+ */
+static void
+check_agg_reduction(HashAggTable *hashtable)
+{
+	hashtable->reduction_checked = true;
+
+	if (gp_hashagg_stream_min_reduction <= 0 || hashtable->num_tuples == 0)
+		return;
+
+	hashtable->reduction_tuples = hashtable->num_tuples;
+	hashtable->reduction = 1.0 - (double) hashtable->num_ht_groups /
+		(double) hashtable->num_tuples;
+
+	if (hashtable->reduction < gp_hashagg_stream_min_reduction)
+		hashtable->stream_partial_groups = true;
+
+	elog(HHA_MSG_LVL,
+		 "HashAgg: merged %.1f%% of " UINT64_FORMAT " input tuples, %s",
+		 hashtable->reduction * 100.0, hashtable->reduction_tuples,
+		 hashtable->stream_partial_groups ? "streaming partial groups" : "aggregating");
+}
+
 /*
  * Function: agg_hash_load
  *
@@ -2278,6 +2336,17 @@ agg_hash_explain(AggState *aggstate)
 				hashtable->total_buckets,
 				hashtable->num_expansions);
 	}
+
+	/* If aggregation was found not to pay off */
+	if (hashtable->stream_partial_groups)
+	{
+		appendStringInfo(hbuf,
+				"Streamed partial groups in batches of %d"
+				"; only %.1f%% of the first " UINT64_FORMAT " rows were merged.\n",
+				HHA_STREAM_BATCH_GROUPS,
+				hashtable->reduction * 100.0,
+				hashtable->reduction_tuples);
+	}
 }
 
 /* Resets all gpmon states for this agg and sends an updated gpmon packet */
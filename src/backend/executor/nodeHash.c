@@ -35,11 +35,13 @@
 #include "executor/nodeHash.h"
 #include "executor/nodeHashjoin.h"
 #include "miscadmin.h"
+#include "utils/datum.h"
 #include "utils/dynahash.h"
 #include "utils/memutils.h"
 #include "utils/lsyscache.h"
 #include "utils/faultinjector.h"
 #include "utils/syscache.h"
+#include "utils/typcache.h"
 
 #include "cdb/cdbexplain.h"
 #include "cdb/cdbutil.h"
@@ -63,6 +65,7 @@ ExecHashTableExplainBatches(HashJoinTable   hashtable,
                             const char     *title);
 
 static inline void ResetWorkFileSetStatsInfo(HashJoinTable hashtable);
+static void ExecHashRuntimeFilterFinish(HashRuntimeFilter filter);
 
 /* ----------------------------------------------------------------
  *		ExecHash
@@ -144,6 +147,9 @@ MultiExecHash(HashState *node)
 				ExecHashTableInsert(node, hashtable, slot, hashvalue);
 			}
 			hashtable->totalTuples += 1;
+
+			if (node->runtimefilter)
+				ExecHashRuntimeFilterInsert(node, econtext, hashvalue);
 		}
 
 		if (hashkeys_null)
@@ -161,6 +167,9 @@ MultiExecHash(HashState *node)
 	/* Now we have set up all the initial batches & primary overflow batches. */
 	hashtable->nbatch_outstart = hashtable->nbatch;
 
+	if (node->runtimefilter)
+		ExecHashRuntimeFilterFinish(node->runtimefilter);
+
 	/* must provide our own instrumentation support */
 	if (node->ps.instrument)
 		InstrStopNode(node->ps.instrument, hashtable->totalTuples);
@@ -197,6 +206,7 @@ ExecInitHash(Hash *node, EState *estate, int eflags)
 	hashstate->ps.state = estate;
 	hashstate->hashtable = NULL;
 	hashstate->hashkeys = NIL;	/* will be set by parent HashJoin */
+	hashstate->runtimefilter = NULL;	/* may be set by parent HashJoin */
 
 	/*
 	 * Miscellaneous initialization
@@ -292,6 +302,16 @@ ExecHashTableCreate(HashState *hashState, HashJoinState *hjstate, List *hashOper
 	 */
 	outerNode = outerPlan(node);
 
+	/* The Bloom filter of the runtime filter is part of our memory */
+	if (hashState->runtimefilter != NULL)
+	{
+		uint64		filterKB;
+
+		filterKB = (hashState->runtimefilter->bloom_mask + 1) / BITS_PER_BYTE / 1024;
+		Assert(filterKB < operatorMemKB);
+		operatorMemKB -= filterKB;
+	}
+
 	ExecChooseHashTableSize(outerNode->plan_rows, outerNode->plan_width,
 							OidIsValid(node->skewTable),
 							operatorMemKB,
@@ -2124,3 +2144,289 @@ static inline void ResetWorkFileSetStatsInfo(HashJoinTable hashtable)
 	hashtable->workset_avg_file_size = 0;
 	hashtable->workset_compression_buf_total = 0;
 }
+
+/*
+ * Bloom filter bits of a hash value: the hash value itself, and a second
+ * hash computed from it
+ */
+#define RUNTIME_FILTER_BIT1(filter, hashvalue) \
+	((hashvalue) & (filter)->bloom_mask)
+#define RUNTIME_FILTER_BIT2(filter, hashvalue) \
+	(DatumGetUInt32(hash_uint32(hashvalue)) & (filter)->bloom_mask)
+
+/* bounds of the size of the Bloom filter, in bits */
+#define RUNTIME_FILTER_MIN_BITS		(1 << 16)
+#define RUNTIME_FILTER_MAX_BITS		(1 << 26)
+
+/*
+ * ExecHashRuntimeFilterCreate
+ *		create the runtime filter of a hash join
+ *
+ * hashclauses are the OpExprs of the join, and scanattnos the columns of
+ * the scan tuple that hold their outer keys.  The Bloom filter is sized for
+ * the estimated number of inner rows, within RUNTIME_FILTER_MEM_PERCENT of
+ * operatorMemKB, the memory of the Hash node; if there are many more rows,
+ * it is not used (see MultiExecHash()).  Returns NULL if the smallest Bloom
+ * filter doesn't fit.
+ */
+HashRuntimeFilter
+ExecHashRuntimeFilterCreate(List *hashclauses, AttrNumber *scanattnos,
+							double ninner, uint64 operatorMemKB)
+{
+	HashRuntimeFilter filter;
+	ListCell   *lc;
+	uint64		maxbits;
+	uint32		nbits;
+	int			i;
+
+	maxbits = operatorMemKB * 1024L * RUNTIME_FILTER_MEM_PERCENT / 100 * BITS_PER_BYTE;
+	if (maxbits < RUNTIME_FILTER_MIN_BITS)
+		return NULL;
+
+	filter = (HashRuntimeFilter) palloc0(sizeof(HashRuntimeFilterData));
+	filter->nkeys = list_length(hashclauses);
+	filter->keys = (HashRuntimeFilterKey *)
+		palloc0(filter->nkeys * sizeof(HashRuntimeFilterKey));
+	filter->keyvals = (Datum *) palloc(filter->nkeys * sizeof(Datum));
+	filter->cxt = CurrentMemoryContext;
+
+	i = 0;
+	foreach(lc, hashclauses)
+	{
+		OpExpr	   *hclause = (OpExpr *) lfirst(lc);
+		HashRuntimeFilterKey *key = &filter->keys[i];
+		Oid			left_hashfn;
+		Oid			right_hashfn;
+		Oid			lefttype;
+		Oid			righttype;
+
+		Assert(IsA(hclause, OpExpr));
+
+		key->scanattno = scanattnos[i];
+		if (!get_op_hash_functions(hclause->opno, &left_hashfn, &right_hashfn))
+			elog(ERROR, "could not find hash function for hash operator %u",
+				 hclause->opno);
+		fmgr_info(left_hashfn, &key->hashfunction);
+
+		/*
+		 * The range can only be checked if both sides have the same type,
+		 * and the join operator is the equality of its default ordering.
+		 */
+		op_input_types(hclause->opno, &lefttype, &righttype);
+		if (lefttype == righttype)
+		{
+			TypeCacheEntry *typentry;
+
+			typentry = lookup_type_cache(lefttype,
+										 TYPECACHE_EQ_OPR |
+										 TYPECACHE_CMP_PROC_FINFO);
+			if (typentry->eq_opr == hclause->opno &&
+				OidIsValid(typentry->cmp_proc_finfo.fn_oid))
+			{
+				key->hasrange = true;
+				fmgr_info_copy(&key->cmpfunction, &typentry->cmp_proc_finfo,
+							   CurrentMemoryContext);
+				key->collation = hclause->inputcollid;
+				get_typlenbyval(lefttype, &key->typlen, &key->typbyval);
+			}
+		}
+		i++;
+	}
+
+	/* 8 bits per row, which gives 5% false positives with 2 bits per row */
+	nbits = RUNTIME_FILTER_MIN_BITS;
+	while (nbits < RUNTIME_FILTER_MAX_BITS && nbits * 2 <= maxbits &&
+		   nbits < ninner * 8)
+		nbits <<= 1;
+	filter->bloom = (uint64 *) palloc0(nbits / BITS_PER_BYTE);
+	filter->bloom_mask = nbits - 1;
+
+	return filter;
+}
+
+/*
+ * ExecHashRuntimeFilterReset
+ *		clear the runtime filter, before the inner side is (re)built
+ *
+ * Until the inner side is done, the filter passes all the rows.
+ */
+void
+ExecHashRuntimeFilterReset(HashRuntimeFilter filter)
+{
+	int			i;
+
+	for (i = 0; i < filter->nkeys; i++)
+	{
+		HashRuntimeFilterKey *key = &filter->keys[i];
+
+		if (filter->ninserted > 0 && key->hasrange && !key->typbyval)
+		{
+			pfree(DatumGetPointer(key->minval));
+			pfree(DatumGetPointer(key->maxval));
+		}
+	}
+
+	memset(filter->bloom, 0, (filter->bloom_mask + 1) / BITS_PER_BYTE);
+	filter->bloom_useful = false;
+	filter->ninserted = 0;
+	filter->built = false;
+}
+
+/*
+ * ExecHashRuntimeFilterInsert
+ *		add the keys of an inner row to the runtime filter
+ *
+ * Called by MultiExecHash() for every row that ExecHashGetHashValue() lets
+ * into the hash table, with the row still in econtext.  Rows with a null
+ * key can't be matched by the strict join operators, so they are left out,
+ * even if they are kept in the hash table for an outer join.
+ */
+void
+ExecHashRuntimeFilterInsert(HashState *hashState, ExprContext *econtext,
+							uint32 hashvalue)
+{
+	HashRuntimeFilter filter = hashState->runtimefilter;
+	MemoryContext oldContext;
+	ListCell   *hk;
+	uint32		bit;
+	int			i;
+
+	oldContext = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+
+	i = 0;
+	foreach(hk, hashState->hashkeys)
+	{
+		ExprState  *keyexpr = (ExprState *) lfirst(hk);
+		bool		isNull;
+
+		filter->keyvals[i] = ExecEvalExpr(keyexpr, econtext, &isNull, NULL);
+		if (isNull)
+		{
+			MemoryContextSwitchTo(oldContext);
+			return;
+		}
+		i++;
+	}
+
+	MemoryContextSwitchTo(filter->cxt);
+
+	for (i = 0; i < filter->nkeys; i++)
+	{
+		HashRuntimeFilterKey *key = &filter->keys[i];
+		Datum		keyval = filter->keyvals[i];
+
+		if (!key->hasrange)
+			continue;
+
+		if (filter->ninserted == 0)
+		{
+			key->minval = datumCopy(keyval, key->typbyval, key->typlen);
+			key->maxval = datumCopy(keyval, key->typbyval, key->typlen);
+		}
+		else if (DatumGetInt32(FunctionCall2Coll(&key->cmpfunction,
+												 key->collation,
+												 keyval, key->minval)) < 0)
+		{
+			if (!key->typbyval)
+				pfree(DatumGetPointer(key->minval));
+			key->minval = datumCopy(keyval, key->typbyval, key->typlen);
+		}
+		else if (DatumGetInt32(FunctionCall2Coll(&key->cmpfunction,
+												 key->collation,
+												 keyval, key->maxval)) > 0)
+		{
+			if (!key->typbyval)
+				pfree(DatumGetPointer(key->maxval));
+			key->maxval = datumCopy(keyval, key->typbyval, key->typlen);
+		}
+	}
+
+	MemoryContextSwitchTo(oldContext);
+
+	bit = RUNTIME_FILTER_BIT1(filter, hashvalue);
+	filter->bloom[bit / 64] |= ((uint64) 1) << (bit % 64);
+	bit = RUNTIME_FILTER_BIT2(filter, hashvalue);
+	filter->bloom[bit / 64] |= ((uint64) 1) << (bit % 64);
+
+	filter->ninserted += 1;
+}
+
+/*
+ * ExecHashRuntimeFilterFinish
+ *		mark the runtime filter as complete, after the inner side is done
+ *
+ * With more than one inserted row per four bits, the Bloom filter lets
+ * through 15% or more of the rows that don't match, and isn't worth
+ * checking.  ninserted counts duplicate keys too, so this gives up on some
+ * filters that would still be selective enough.
+ */
+static void
+ExecHashRuntimeFilterFinish(HashRuntimeFilter filter)
+{
+	filter->bloom_useful =
+		filter->ninserted * 4 <= (double) filter->bloom_mask + 1;
+	filter->built = true;
+}
+
+/*
+ * ExecHashRuntimeFilterCheck
+ *		may the outer row in the slot have a match in the hash table?
+ *
+ * The hash value is computed like ExecHashGetHashValue() does for outer
+ * rows; the hash functions of the join operators hash equal values of the
+ * two sides alike.  The caller takes care of the memory context.
+ */
+bool
+ExecHashRuntimeFilterCheck(HashRuntimeFilter filter, TupleTableSlot *slot)
+{
+	uint32		hashkey = 0;
+	uint32		bit;
+	int			i;
+
+	if (!filter->built)
+		return true;
+
+	/* an empty hash table, or only rows with null keys */
+	if (filter->ninserted == 0)
+		return false;
+
+	for (i = 0; i < filter->nkeys; i++)
+	{
+		HashRuntimeFilterKey *key = &filter->keys[i];
+		Datum		keyval;
+		bool		isNull;
+
+		keyval = slot_getattr(slot, key->scanattno, &isNull);
+		if (isNull)
+			return false;
+
+		if (key->hasrange &&
+			(DatumGetInt32(FunctionCall2Coll(&key->cmpfunction,
+											 key->collation,
+											 keyval, key->minval)) < 0 ||
+			 DatumGetInt32(FunctionCall2Coll(&key->cmpfunction,
+											 key->collation,
+											 keyval, key->maxval)) > 0))
+			return false;
+
+		if (filter->bloom_useful)
+		{
+			/* rotate hashkey left 1 bit at each step */
+			hashkey = (hashkey << 1) | ((hashkey & 0x80000000) ? 1 : 0);
+			hashkey ^= DatumGetUInt32(FunctionCall1(&key->hashfunction,
+													keyval));
+		}
+	}
+
+	if (filter->bloom_useful)
+	{
+		bit = RUNTIME_FILTER_BIT1(filter, hashkey);
+		if ((filter->bloom[bit / 64] & (((uint64) 1) << (bit % 64))) == 0)
+			return false;
+		bit = RUNTIME_FILTER_BIT2(filter, hashkey);
+		if ((filter->bloom[bit / 64] & (((uint64) 1) << (bit % 64))) == 0)
+			return false;
+	}
+
+	return true;
+}
@@ -23,7 +23,9 @@
 #include "executor/instrument.h"	/* Instrumentation */
 #include "executor/nodeHash.h"
 #include "executor/nodeHashjoin.h"
+#include "executor/nodeSeqscan.h"
 #include "miscadmin.h"
+#include "utils/lsyscache.h"
 #include "utils/faultinjector.h"
 #include "utils/memutils.h"
 
@@ -65,6 +67,10 @@ static void ExecEagerFreeHashJoin(HashJoinState *node);
 
 static inline void SaveWorkFileSetStatsInfo(HashJoinTable hashtable);
 
+static void PushdownRuntimeFilter(HashJoinState *hjstate);
+static SeqScanState *RuntimeFilterTarget(PlanState *planstate, AttrNumber attno,
+					AttrNumber *scanattno);
+
 /* ----------------------------------------------------------------
  *		ExecHashJoin
  *
@@ -131,6 +137,13 @@ ExecHashJoin_guts(HashJoinState *node)
 				 */
 				Assert(hashtable == NULL);
 
+				/*
+				 * The runtime filter passes all the rows until the new hash
+				 * table is built.
+				 */
+				if (hashNode->runtimefilter)
+					ExecHashRuntimeFilterReset(hashNode->runtimefilter);
+
 				/*
 				 * MPP-4165: My fix for MPP-3300 was correct in that we avoided
 				 * the *deadlock* but had very unexpected (and painful)
@@ -733,6 +746,9 @@ ExecInitHashJoin(HashJoin *node, EState *estate, int eflags)
 	/* child Hash node needs to evaluate inner hash keys, too */
 	((HashState *) innerPlanState(hjstate))->hashkeys = rclauses;
 
+	if (gp_enable_runtime_filter)
+		PushdownRuntimeFilter(hjstate);
+
 	hjstate->hj_JoinState = HJ_BUILD_HASHTABLE;
 	hjstate->hj_MatchedOuter = false;
 	hjstate->hj_OuterNotEmpty = false;
@@ -1493,6 +1509,134 @@ ExecHashJoinReloadHashTable(HashJoinState *hjstate)
 	return true;
 }
 
+/*
+ * PushdownRuntimeFilter
+ *		Have the Hash node build a runtime filter, and apply it at the
+ *		sequential scan that produces the outer keys, if there is one.
+ *
+ * The filter can only be applied to rows that would be dropped by the join
+ * when they don't match: it is not used for joins that keep unmatched outer
+ * rows, and the scan must be in our slice.  Its rows must reach us through
+ * hash joins that don't null-extend them, with the keys unchanged.  All the
+ * join operators must be strict, so that rows with null keys can be dropped.
+ */
+static void
+PushdownRuntimeFilter(HashJoinState *hjstate)
+{
+	HashState  *hashstate = (HashState *) innerPlanState(hjstate);
+	SeqScanState *target = NULL;
+	AttrNumber *scanattnos;
+	List	   *hclauses = NIL;
+	HashRuntimeFilter filter;
+	ListCell   *lc;
+	int			i;
+
+	if (hjstate->js.jointype != JOIN_INNER &&
+		hjstate->js.jointype != JOIN_SEMI &&
+		hjstate->js.jointype != JOIN_RIGHT)
+		return;
+
+	if (hjstate->hj_nonequijoin)
+		return;
+
+	scanattnos = (AttrNumber *)
+		palloc(list_length(hjstate->hashclauses) * sizeof(AttrNumber));
+
+	i = 0;
+	foreach(lc, hjstate->hashclauses)
+	{
+		FuncExprState *fstate = (FuncExprState *) lfirst(lc);
+		OpExpr	   *hclause = (OpExpr *) fstate->xprstate.expr;
+		Expr	   *outerkey = (Expr *) linitial(hclause->args);
+		SeqScanState *scanstate;
+
+		/* binary compatible relabeling doesn't change the hash value */
+		while (IsA(outerkey, RelabelType))
+			outerkey = ((RelabelType *) outerkey)->arg;
+
+		if (!IsA(outerkey, Var) ||
+			((Var *) outerkey)->varno != OUTER_VAR ||
+			!op_strict(hclause->opno))
+			break;
+
+		scanstate = RuntimeFilterTarget(outerPlanState(hjstate),
+										((Var *) outerkey)->varattno,
+										&scanattnos[i]);
+		if (scanstate == NULL || (target != NULL && scanstate != target))
+			break;
+
+		target = scanstate;
+		hclauses = lappend(hclauses, hclause);
+		i++;
+	}
+
+	if (target != NULL && i == list_length(hjstate->hashclauses))
+	{
+		filter = ExecHashRuntimeFilterCreate(hclauses, scanattnos,
+											 hashstate->ps.plan->plan_rows,
+											 PlanStateOperatorMemKB((PlanState *) hashstate));
+		if (filter != NULL)
+		{
+			hashstate->runtimefilter = filter;
+			ExecSeqScanAddRuntimeFilter(target, filter);
+		}
+	}
+
+	list_free(hclauses);
+	pfree(scanattnos);
+}
+
+/*
+ * RuntimeFilterTarget
+ *		Find the sequential scan that produces column attno of the output
+ *		of planstate, and the column of the scan tuple it comes from.
+ *
+ * Returns NULL if the column is not a plain column of a scan in our slice,
+ * passed up unchanged by inner, semi, left or anti hash joins.
+ */
+static SeqScanState *
+RuntimeFilterTarget(PlanState *planstate, AttrNumber attno,
+					AttrNumber *scanattno)
+{
+	for (;;)
+	{
+		List	   *targetlist = planstate->plan->targetlist;
+		TargetEntry *tle;
+		Var		   *var;
+		JoinType	jointype;
+
+		if (attno <= 0 || attno > list_length(targetlist))
+			return NULL;
+
+		tle = (TargetEntry *) list_nth(targetlist, attno - 1);
+		if (!IsA(tle->expr, Var))
+			return NULL;
+		var = (Var *) tle->expr;
+
+		switch (nodeTag(planstate))
+		{
+			case T_SeqScanState:
+				if (var->varno != ((Scan *) planstate->plan)->scanrelid ||
+					var->varattno <= 0)
+					return NULL;
+				*scanattno = var->varattno;
+				return (SeqScanState *) planstate;
+
+			case T_HashJoinState:
+				jointype = ((HashJoinState *) planstate)->js.jointype;
+				if (var->varno != OUTER_VAR ||
+					jointype == JOIN_RIGHT || jointype == JOIN_FULL)
+					return NULL;
+				planstate = outerPlanState(planstate);
+				attno = var->varattno;
+				break;
+
+			default:
+				return NULL;
+		}
+	}
+}
+
 static inline void SaveWorkFileSetStatsInfo(HashJoinTable hashtable)
 {
 	workfile_set *work_set = hashtable->work_set;
@@ -164,7 +164,8 @@ ExecMaterial(MaterialState *node)
 			{
 				if (ma->driver_slice == currentSliceId)
 				{
-					ntuplestore_flush(ts);
+					if (!shareinput_writer_store_in_memory(node->share_lk_ctxt, ts))
+						ntuplestore_flush(ts);
 					shareinput_writer_notifyready(node->share_lk_ctxt, ma->share_id,
 												  ma->nsharer_xslice, estate->es_plannedstmt->planGen);
 				}
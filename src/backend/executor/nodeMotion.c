@@ -21,6 +21,7 @@
 #include "cdb/cdbutil.h"
 #include "cdb/cdbvars.h"
 #include "cdb/cdbhash.h"
+#include "cdb/ml_ipc.h"
 #include "executor/executor.h"
 #include "executor/execdebug.h"
 #include "executor/execUtils.h"
@@ -108,6 +109,8 @@ static TupleTableSlot *execMotionSortedReceiver_mk(MotionState *node);
 
 static void execMotionSortedReceiverFirstTime(MotionState *node);
 
+static void ExecMotionExplainEnd(PlanState *planstate, struct StringInfoData *buf);
+
 static int	CdbMergeComparator(Datum lhs, Datum rhs, void *context);
 static uint32 evalHashKey(ExprContext *econtext, List *hashkeys, CdbHash *h);
 
@@ -1209,7 +1212,15 @@ ExecInitMotion(Motion *node, EState *estate, int eflags)
 	UpdateMotionLayerNode(motionstate->ps.state->motionlayer_context,
 						  node->motionID,
 						  node->sendSorted,
-						  tupDesc);
+						  tupDesc,
+						  motionstate->mstype == MOTIONSTATE_SEND ?
+						  gp_motion_batch_size : 0);
+
+	/* Report the interconnect compression of a receiver in EXPLAIN ANALYZE. */
+	if (gp_interconnect_compression &&
+		motionstate->mstype == MOTIONSTATE_RECV &&
+		(estate->es_instrument & INSTRUMENT_CDB))
+		motionstate->ps.cdbexplainfun = ExecMotionExplainEnd;
 
 
 #ifdef CDB_MOTION_DEBUG
@@ -1227,6 +1238,29 @@ ExecInitMotion(Motion *node, EState *estate, int eflags)
 	return motionstate;
 }
 
+/*
+ * ExecMotionExplainEnd
+ *		Called before ExecutorEnd to finish EXPLAIN ANALYZE reporting.
+ */
+static void
+ExecMotionExplainEnd(PlanState *planstate, struct StringInfoData *buf)
+{
+	EState	   *estate = planstate->state;
+	uint64		bytesBefore;
+	uint64		bytesAfter;
+
+	if (!estate->es_interconnect_is_setup)
+		return;
+
+	GetMotionCompressionStats(estate->interconnect_context,
+							  ((Motion *) planstate->plan)->motionID,
+							  &bytesBefore, &bytesAfter);
+	if (bytesBefore > 0)
+		appendStringInfo(buf, "Interconnect compression: " UINT64_FORMAT
+						 " bytes before, " UINT64_FORMAT " bytes after.",
+						 bytesBefore, bytesAfter);
+}
+
 /* ----------------------------------------------------------------
  *		ExecEndMotion(node)
  * ----------------------------------------------------------------
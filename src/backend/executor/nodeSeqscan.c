@@ -21,12 +21,16 @@
  *		ExecInitSeqScan			creates and initializes a seqscan node.
  *		ExecEndSeqScan			releases any storage allocated.
  *		ExecReScanSeqScan		rescans the relation
+ *		ExecSeqScanAddRuntimeFilter	applies a hash join's runtime filter
  */
 #include "postgres.h"
 
 #include "access/relscan.h"
 #include "executor/execdebug.h"
+#include "executor/instrument.h"
+#include "executor/nodeHash.h"
 #include "executor/nodeSeqscan.h"
+#include "lib/stringinfo.h"
 #include "utils/rel.h"
 
 #include "cdb/cdbappendonlyam.h"
@@ -35,6 +39,8 @@
 
 static void InitScanRelation(SeqScanState *node, EState *estate, int eflags, Relation currentRelation);
 static TupleTableSlot *SeqNext(SeqScanState *node);
+static TupleTableSlot *SeqNextFiltered(SeqScanState *node);
+static void ExecSeqScanExplainEnd(PlanState *planstate, struct StringInfoData *buf);
 
 static void InitAOCSScanOpaque(SeqScanState *scanState, Relation currentRelation);
 
@@ -102,6 +108,50 @@ SeqNext(SeqScanState *node)
 	return slot;
 }
 
+/* ----------------------------------------------------------------
+ *		SeqNextFiltered
+ *
+ *		SeqNext for a scan with runtime filters: skips the tuples that
+ *		some hash join above us is known not to match
+ * ----------------------------------------------------------------
+ */
+static TupleTableSlot *
+SeqNextFiltered(SeqScanState *node)
+{
+	ExprContext *econtext = node->ss.ps.ps_ExprContext;
+	TupleTableSlot *slot;
+
+	for (;;)
+	{
+		MemoryContext oldContext;
+		ListCell   *lc;
+		bool		pass = true;
+
+		slot = SeqNext(node);
+		if (TupIsNull(slot))
+			return slot;
+
+		oldContext = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+		foreach(lc, node->ss_runtimeFilters)
+		{
+			if (!ExecHashRuntimeFilterCheck((HashRuntimeFilter) lfirst(lc),
+											slot))
+			{
+				pass = false;
+				break;
+			}
+		}
+		MemoryContextSwitchTo(oldContext);
+
+		if (pass)
+			return slot;
+
+		node->ss_runtimeFilteredRows += 1;
+		ResetExprContext(econtext);
+		CHECK_FOR_INTERRUPTS();
+	}
+}
+
 /*
  * SeqRecheck -- access method routine to recheck a tuple in EvalPlanQual
  */
@@ -127,6 +177,11 @@ SeqRecheck(SeqScanState *node, TupleTableSlot *slot)
 TupleTableSlot *
 ExecSeqScan(SeqScanState *node)
 {
+	if (node->ss_runtimeFilters != NIL)
+		return ExecScan((ScanState *) node,
+						(ExecScanAccessMtd) SeqNextFiltered,
+						(ExecScanRecheckMtd) SeqRecheck);
+
 	return ExecScan((ScanState *) node,
 					(ExecScanAccessMtd) SeqNext,
 					(ExecScanRecheckMtd) SeqRecheck);
@@ -365,6 +420,38 @@ ExecReScanSeqScan(SeqScanState *node)
 	ExecScanReScan((ScanState *) node);
 }
 
+/* ----------------------------------------------------------------
+ *		ExecSeqScanAddRuntimeFilter
+ *
+ *		Apply the runtime filter of a hash join above us to the scanned
+ *		tuples, see PushdownRuntimeFilter() in nodeHashjoin.c.
+ * ----------------------------------------------------------------
+ */
+void
+ExecSeqScanAddRuntimeFilter(SeqScanState *node, HashRuntimeFilter filter)
+{
+	node->ss_runtimeFilters = lappend(node->ss_runtimeFilters, filter);
+
+	/* CDB: report the filtered rows in EXPLAIN ANALYZE. */
+	if (node->ss.ps.state->es_instrument & INSTRUMENT_CDB)
+		node->ss.ps.cdbexplainfun = ExecSeqScanExplainEnd;
+}
+
+/*
+ * ExecSeqScanExplainEnd
+ *		Called before ExecutorEnd to finish EXPLAIN ANALYZE reporting.
+ */
+static void
+ExecSeqScanExplainEnd(PlanState *planstate, struct StringInfoData *buf)
+{
+	SeqScanState *node = (SeqScanState *) planstate;
+
+	appendStringInfo(buf, "Rows removed by %d runtime filter%s: %.0f.",
+					 list_length(node->ss_runtimeFilters),
+					 list_length(node->ss_runtimeFilters) == 1 ? "" : "s",
+					 node->ss_runtimeFilteredRows);
+}
+
 static void
 InitAOCSScanOpaque(SeqScanState *scanstate, Relation currentRelation)
 {
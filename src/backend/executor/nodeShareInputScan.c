@@ -26,6 +26,9 @@
 
 #include "postgres.h"
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
 #ifdef HAVE_POLL_H
 #include <poll.h>
 #endif
@@ -39,23 +42,66 @@
 #include "executor/executor.h"
 #include "executor/nodeShareInputScan.h"
 #include "miscadmin.h"
+#include "storage/condition_variable.h"
+#include "storage/dsm.h"
+#include "storage/fd.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
 #include "utils/faultinjector.h"
 #include "utils/gp_alloc.h"
+#include "utils/hsearch.h"
 #include "utils/tuplesort.h"
 #include "utils/tuplestorenew.h"
 
+/* Identifies a cross-slice share among all the queries on the segment */
+typedef struct ShareInputTag
+{
+	int			session_id;
+	int			command_count;
+	int			share_id;
+} ShareInputTag;
+
+/* Shared state of a cross-slice share, see "Cross-slice synchronization" */
+typedef struct ShareInputSharedState
+{
+	ShareInputTag tag;			/* hash key, must be first */
+	int			refcount;		/* processes attached to the entry */
+	bool		ready;			/* has the writer produced all the tuples? */
+	int			nacks;			/* readers that saw ready (planner plans) */
+	int			ndone;			/* readers that are done */
+	dsm_handle	handle;			/* tuples in memory, or DSM_HANDLE_INVALID */
+	ConditionVariable cv;		/* broadcast when any of the above change */
+} ShareInputSharedState;
+
+/*
+ * Tuples of a share kept in dynamic shared memory.  The MemTuples follow the
+ * offsets array, each at a MAXALIGNed offset from the start of the segment.
+ */
+typedef struct ShareInputMemStore
+{
+	int			ntuples;
+	Size		offsets[FLEXIBLE_ARRAY_MEMBER];
+} ShareInputMemStore;
+
 typedef struct ShareInput_Lk_Context
 {
-	int readyfd;
-	int donefd;
-	int  zcnt;
-	bool del_ready;
-	bool del_done;
-	char lkname_ready[MAXPGPATH];
-	char lkname_done[MAXPGPATH];
+	ShareInputTag tag;
+	ShareInputSharedState *state;	/* shared entry, once attached */
+	dsm_handle	handle;			/* tuples segment published by the writer */
+	dsm_segment *seg;			/* our mapping of that segment, if any */
+
+	/* FIFO synchronization, used when the hash table is full */
+	bool		use_fifo;
+	int			readyfd;
+	int			donefd;
+	int			zcnt;
+	bool		del_ready;
+	bool		del_done;
+	char		lkname_ready[MAXPGPATH];
+	char		lkname_done[MAXPGPATH];
 } ShareInput_Lk_Context;
 
-static void writer_wait_for_acks(ShareInput_Lk_Context *pctxt, int share_id, int xslice);
+static ShareInputMemStore *shareinput_attach_memory(ShareInput_Lk_Context *pctxt);
 
 static void ExecEagerFreeShareInputScan(ShareInputScanState *node);
 
@@ -91,7 +137,19 @@ init_tuplestore_state(ShareInputScanState *node)
 
 	if(share_type == SHARE_MATERIAL_XSLICE)
 	{
+		/*
+		 * Scan the tuples in shared memory if the writer kept them there.  In
+		 * the writer's own slice, they are mapped through the Material node.
+		 */
+		void	   *lk_ctxt = snState ? ((MaterialState *) snState)->share_lk_ctxt :
+			node->share_lk_ctxt;
+
 		node->ts_state = palloc0(sizeof(GenericTupStore));
+		node->share_memstore = shareinput_attach_memory((ShareInput_Lk_Context *) lk_ctxt);
+		node->share_mem_pos = -1;
+		if (node->share_memstore != NULL)
+			return;
+
 		node->ts_state->matstore = ntuplestore_create_readerwriter(node->share_bufname_prefix, 0, false);
 		node->ts_pos = (void *) ntuplestore_create_accessor(node->ts_state->matstore, false);
 		ntuplestore_acc_seek_bof((NTupleStoreAccessor *)node->ts_pos);
@@ -187,7 +245,26 @@ ExecShareInputScan(ShareInputScanState *node)
 	{
 		bool gotOK = false;
 
-		if(share_type == SHARE_MATERIAL || share_type == SHARE_MATERIAL_XSLICE)
+		if (node->share_memstore != NULL)
+		{
+			ShareInputMemStore *memstore = (ShareInputMemStore *) node->share_memstore;
+
+			node->share_mem_pos += forward ? 1 : -1;
+			if (node->share_mem_pos < 0)
+				node->share_mem_pos = -1;
+			else if (node->share_mem_pos >= memstore->ntuples)
+				node->share_mem_pos = memstore->ntuples;
+			else
+			{
+				ExecStoreMinimalTuple((MemTuple) ((char *) memstore +
+												  memstore->offsets[node->share_mem_pos]),
+									  slot, false);
+				gotOK = true;
+			}
+			if (!gotOK)
+				ExecClearTuple(slot);
+		}
+		else if(share_type == SHARE_MATERIAL || share_type == SHARE_MATERIAL_XSLICE)
 		{
 			ntuplestore_acc_advance((NTupleStoreAccessor *) node->ts_pos, forward ? 1 : -1);
 			gotOK = ntuplestore_acc_current_tupleslot((NTupleStoreAccessor *) node->ts_pos, slot);
@@ -233,6 +310,8 @@ ExecInitShareInputScan(ShareInputScan *node, EState *estate, int eflags)
 
 	sisstate->share_lk_ctxt = NULL;
 	sisstate->freed = false;
+	sisstate->share_memstore = NULL;
+	sisstate->share_mem_pos = -1;
 
 	if (node->share_type == SHARE_MATERIAL_XSLICE || node->share_type == SHARE_SORT_XSLICE)
 	{
@@ -295,11 +374,9 @@ ExecInitShareInputScan(ShareInputScan *node, EState *estate, int eflags)
 
 	/*
 	 * `PrepareTempTablespaces()` should be called when initializing ShareInputScanState.
-	 * The shareinput-reader will open/create the named pipe file in
-	 * ExecSliceDependencyShareInputScan() which is called at the begining of ExecutePlan().
-	 * The shareinput-writer will open/create the named pipe file when data is ready.
-	 * The READER and the WRITER share the pipe file for communication, so the pipe file
-	 * must be in the same tablespace.
+	 * The shareinput-writer creates the named workfiles when it spills or
+	 * flushes its tuplestore, and the shareinput-readers open them by name, so
+	 * they must agree on the tablespace.
 	 *
 	 * We can't call PrepareTempTablespaces() under ExecShareInputScan()/ExecProcNode()
 	 * like other callers, because it's too late for the READER.
@@ -368,6 +445,13 @@ ExecReScanShareInputScan(ShareInputScanState *node)
 	ShareInputScan *sisc = (ShareInputScan *) node->ss.ps.plan;
 
 	ExecClearTuple(node->ss.ps.ps_ResultTupleSlot);
+
+	if (node->share_memstore != NULL)
+	{
+		node->share_mem_pos = -1;
+		return;
+	}
+
 	Assert(NULL != node->ts_pos);
 
 	if(sisc->share_type == SHARE_MATERIAL || sisc->share_type == SHARE_MATERIAL_XSLICE)
@@ -387,35 +471,63 @@ ExecReScanShareInputScan(ShareInputScanState *node)
 }
 
 /*************************************************************************
- * XXX
- * we need some IPC mechanism for shareinput_read_wait/writer_notify.  Semaphore is
- * the first thing come to mind but it turns out postgres is very picky about
- * how to use semaphore and we do not want to mess up with it.
+ * Cross-slice synchronization.
  *
- * Here we used FIFO (named pipe).  mkfifo is Posix.1 and should be available on any
- * reasonable Unix like system.
+ * The writer and the readers of a cross-slice share meet in an entry of a
+ * shared memory hash table, keyed by session, command and share id.  The
+ * entry records whether the writer is ready, how many readers acknowledged
+ * that (planner-generated plans only) and how many readers are done, and
+ * everyone waits on the entry's condition variable for those to change.
+ * Each process holds a reference on the entry while it takes part in the
+ * share; the last one to let go removes it.
  *
- * When we open fifo, we open it with O_RDWR.  So the fifo has both reader and writer.
- * That also means, for write, it will not block, but reader will until writer writes
- * something.
+ * If the writer's tuplestore fits in gp_shared_scan_memory_limit and never
+ * spilled, the writer copies the tuples into a dynamic shared memory segment
+ * and publishes its handle in the entry, and the readers scan the segment
+ * directly.  Otherwise, or if no segment can be created, the writer flushes
+ * the tuplestore to the named workfiles, and the readers open those.  The
+ * writer keeps the segment mapped until all the readers are done.
  *
- * At first, I used postgres File to manage the FIFO.  It turns out this is not
- * correct because when postgres run out of file descriptors, it will try to close
- * some file descriptors using an LRU algorithm.  Later when the File is used again,
- * postgres will reopen it. The FIFO here is used for synchronization so it is simply
- * wrong.  Here we use the file descriptor directly, and use a XCallBack to cleanup
- * the resource at the end of transaction (commit or abort).
+ * If the hash table is full, the first participant of a share to find out
+ * creates the share's FIFOs (named pipes) in the temp directory instead, and
+ * the share is synchronized through them, as it was before the hash table
+ * existed.  Participants that come later find the FIFOs while holding
+ * ShareInputScanLock, so all the participants of a share agree on the
+ * mechanism.  The FIFOs are opened with O_RDWR, so opening doesn't block,
+ * and we use the file descriptors directly rather than postgres Files, which
+ * may be closed and reopened behind our back.  See "FIFO synchronization".
  *
- * XXX However, it is always better to have this kind of stuff abstracted out
- * by the system.
+ * For optimizer-generated plans, the writer does not wait for readers to
+ * acknowledge the "ready" notification, as that can cause deadlocks
+ * (OPT-2690).
  **************************************************************************/
 
-#include "fcntl.h"
-#include "unistd.h"
-#include "sys/types.h"
-#include "sys/stat.h"
-#include "storage/fd.h"
-#include "cdb/cdbselect.h"
+#define SHAREINPUT_MAX_ENTRIES	(MaxBackends * 5)
+
+static HTAB *ShareInputHash = NULL;
+
+Size
+ShareInputShmemSize(void)
+{
+	return hash_estimate_size(SHAREINPUT_MAX_ENTRIES, sizeof(ShareInputSharedState));
+}
+
+void
+ShareInputShmemInit(void)
+{
+	HASHCTL		info;
+
+	MemSet(&info, 0, sizeof(info));
+	info.keysize = sizeof(ShareInputTag);
+	info.entrysize = sizeof(ShareInputSharedState);
+	info.hash = tag_hash;
+
+	ShareInputHash = ShmemInitHash("ShareInputScan shared state",
+								   SHAREINPUT_MAX_ENTRIES,
+								   SHAREINPUT_MAX_ENTRIES,
+								   &info,
+								   HASH_ELEM | HASH_FUNCTION);
+}
 
 char *shareinput_create_bufname_prefix(int share_id)
 {
@@ -451,6 +563,15 @@ void *shareinput_init_lk_ctxt(int share_id)
 		ereport(ERROR, (errcode(ERRCODE_OUT_OF_MEMORY),
 			errmsg("Share input reader failed: out of memory")));
 
+	MemSet(&pctxt->tag, 0, sizeof(ShareInputTag));
+	pctxt->tag.session_id = gp_session_id;
+	pctxt->tag.command_count = gp_command_count;
+	pctxt->tag.share_id = share_id;
+	pctxt->state = NULL;
+	pctxt->handle = DSM_HANDLE_INVALID;
+	pctxt->seg = NULL;
+
+	pctxt->use_fifo = false;
 	pctxt->readyfd = -1;
 	pctxt->donefd = -1;
 	pctxt->zcnt = 0;
@@ -463,50 +584,83 @@ void *shareinput_init_lk_ctxt(int share_id)
 	return pctxt;
 }
 
-static void shareinput_clean_lk_ctxt(ShareInput_Lk_Context *lk_ctxt)
+/*
+ * Drop our mapping of the tuples segment and our reference on the shared
+ * entry, removing the entry if we were the last one, or close our FIFOs.
+ */
+static void
+shareinput_release(ShareInput_Lk_Context *pctxt)
 {
-	elog(DEBUG1, "shareinput_clean_lk_ctxt cleanup lk ctxt %p", lk_ctxt);
-	if (!lk_ctxt)
-		return;
+	ShareInputSharedState *state = pctxt->state;
+
+	if (pctxt->seg)
+	{
+		dsm_detach(pctxt->seg);
+		pctxt->seg = NULL;
+	}
 
-	if (lk_ctxt->readyfd >= 0)
+	if (pctxt->readyfd >= 0)
 	{
-		if (gp_retry_close(lk_ctxt->readyfd))
+		if (gp_retry_close(pctxt->readyfd))
 			ereport(WARNING,
 				(errcode(ERRCODE_IO_ERROR),
 				errmsg("shareinput_clean_lk_ctxt cannot close readyfd: %m")));
+		pctxt->readyfd = -1;
 	}
 
-	if (lk_ctxt->donefd >= 0)
+	if (pctxt->donefd >= 0)
 	{
-		if (gp_retry_close(lk_ctxt->donefd))
+		if (gp_retry_close(pctxt->donefd))
 			ereport(WARNING,
 				(errcode(ERRCODE_IO_ERROR),
 				errmsg("shareinput_clean_lk_ctxt cannot close donefd: %m")));
+		pctxt->donefd = -1;
 	}
 
-	if (lk_ctxt->del_ready && lk_ctxt->lkname_ready[0])
+	if (pctxt->del_ready && pctxt->lkname_ready[0])
 	{
-		if (unlink(lk_ctxt->lkname_ready))
+		if (unlink(pctxt->lkname_ready))
 			ereport(WARNING,
 				(errcode(ERRCODE_IO_ERROR),
 				errmsg("shareinput_clean_lk_ctxt cannot unlink \"%s\": %m",
-					lk_ctxt->lkname_ready)));
+					pctxt->lkname_ready)));
+		pctxt->del_ready = false;
 	}
 
-	if (lk_ctxt->del_done && lk_ctxt->lkname_done[0])
+	if (pctxt->del_done && pctxt->lkname_done[0])
 	{
-		if (unlink(lk_ctxt->lkname_done))
+		if (unlink(pctxt->lkname_done))
 			ereport(WARNING,
 				(errcode(ERRCODE_IO_ERROR),
 				errmsg("shareinput_clean_lk_ctxt cannot unlink \"%s\": %m",
-					lk_ctxt->lkname_done)));
+					pctxt->lkname_done)));
+		pctxt->del_done = false;
 	}
 
+	if (!state)
+		return;
+
+	LWLockAcquire(ShareInputScanLock, LW_EXCLUSIVE);
+	Assert(state->refcount > 0);
+	if (--state->refcount == 0)
+		hash_search(ShareInputHash, &pctxt->tag, HASH_REMOVE, NULL);
+	LWLockRelease(ShareInputScanLock);
+
+	pctxt->state = NULL;
+}
+
+static void shareinput_clean_lk_ctxt(ShareInput_Lk_Context *lk_ctxt)
+{
+	elog(DEBUG1, "shareinput_clean_lk_ctxt cleanup lk ctxt %p", lk_ctxt);
+	if (!lk_ctxt)
+		return;
+
+	shareinput_release(lk_ctxt);
+
 	gp_free(lk_ctxt);
 }
 
-static void XCallBack_ShareInput_FIFO(XactEvent ev, void* vp)
+static void XCallBack_ShareInput(XactEvent ev, void* vp)
 {
 	ShareInput_Lk_Context *lk_ctxt = (ShareInput_Lk_Context *) vp;
 	shareinput_clean_lk_ctxt(lk_ctxt);
@@ -524,6 +678,132 @@ create_tmp_fifo(const char *fifoname)
 #endif
 }
 
+/*
+ * Find or create the shared entry of the share, and take a reference on it.
+ * The entry is released at end of transaction if we don't get to it first.
+ *
+ * Returns NULL if the share is synchronized through FIFOs instead, because
+ * the hash table was full when its first participant got here.
+ */
+static ShareInputSharedState *
+shareinput_attach(ShareInput_Lk_Context *pctxt)
+{
+	ShareInputSharedState *state;
+	struct stat st;
+	bool		found;
+	bool		table_full;
+
+	if (pctxt->state)
+		return pctxt->state;
+	if (pctxt->use_fifo)
+		return NULL;
+
+	RegisterXactCallbackOnce(XCallBack_ShareInput, pctxt);
+
+	table_full = false;
+#ifdef FAULT_INJECTOR
+	if (SIMPLE_FAULT_INJECTOR("shareinput_hash_full") == FaultInjectorTypeSkip)
+		table_full = true;
+#endif
+
+	LWLockAcquire(ShareInputScanLock, LW_EXCLUSIVE);
+	state = (ShareInputSharedState *)
+		hash_search(ShareInputHash, &pctxt->tag, HASH_FIND, &found);
+	if (!state)
+	{
+		/*
+		 * Another participant found the table full and created the FIFOs;
+		 * so did we if we can't create the entry.  Both are decided while
+		 * holding the lock, so that all the participants agree.
+		 */
+		if (stat(pctxt->lkname_ready, &st) == 0)
+			pctxt->use_fifo = true;
+		else
+		{
+			if (!table_full)
+				state = (ShareInputSharedState *)
+					hash_search(ShareInputHash, &pctxt->tag, HASH_ENTER_NULL, &found);
+			if (!state)
+			{
+				create_tmp_fifo(pctxt->lkname_done);
+				create_tmp_fifo(pctxt->lkname_ready);
+				pctxt->use_fifo = true;
+			}
+		}
+
+		if (pctxt->use_fifo)
+		{
+			LWLockRelease(ShareInputScanLock);
+
+			elog(DEBUG1, "SISC (shareid=%d, slice=%d): synchronizing through FIFOs",
+				 pctxt->tag.share_id, currentSliceId);
+			return NULL;
+		}
+	}
+	if (!found)
+	{
+		state->refcount = 0;
+		state->ready = false;
+		state->nacks = 0;
+		state->ndone = 0;
+		state->handle = DSM_HANDLE_INVALID;
+		ConditionVariableInit(&state->cv);
+	}
+	state->refcount++;
+	LWLockRelease(ShareInputScanLock);
+
+	pctxt->state = state;
+	return state;
+}
+
+/*
+ * Wait until the counter of the shared entry pointed to by 'counter'
+ * reaches 'target'.
+ */
+static void
+shareinput_wait_for_count(ShareInputSharedState *state, int *counter, int target)
+{
+	ConditionVariablePrepareToSleep(&state->cv);
+	for (;;)
+	{
+		int			count;
+
+		LWLockAcquire(ShareInputScanLock, LW_SHARED);
+		count = *counter;
+		LWLockRelease(ShareInputScanLock);
+
+		if (count >= target)
+			break;
+
+		ConditionVariableSleep(&state->cv);
+	}
+	ConditionVariableCancelSleep();
+}
+
+/*************************************************************************
+ * FIFO synchronization.
+ *
+ * For readiness, the shared node will write xslice of 'a' into the pipe.
+ * For each share, there is just one ready writer.  Once sharer starts write
+ * it need to write all xslice copies of 'a', even if we are interrupted, that
+ * is, we should not call CHECK_FOR_INTERRUPTS.
+ *
+ * For sharer, it need to check for ready to read (using poll), because read
+ * is blocking.  Otherwise if shared is cancelled before write, then we will be
+ * blocked here forever.  Once shared has write at least one 'a', it will write
+ * all xslice of 'a', so once poll succeed, read will eventually succeed.  Once
+ * sharer got 'a', it write 'b' back to shared.
+ *
+ * Done (b and z) synchronization.
+ * For done, the shared is the only reader.  sharer will not block for writing,
+ * but shared may block for read, therefore, we much call poll before shared
+ * calling read.  Because there is only one shared, nobody can steal char from
+ * the pipe, therefore, if poll succeed, read will not block forever.
+ *
+ * One thing to note is that some 'z' may comeback before all 'b' come back.
+ * So, need to handle this in notifyready.
+ **************************************************************************/
+
 /*
  * As all other read/write in postgres, we may be interrupted so retry is needed.
  */
@@ -563,280 +843,215 @@ write_retry:
 	return 0;
 }
 
-#ifdef FAULT_INJECTOR
-/**
- * create and open many tmp files, so the next fd number is bigger.
- **/
-static void fi_create_many_fds(int *fds, char *file_prefix, int num)
+/*
+ * Wait until one byte can be read from the given FIFO, and read it.
+ */
+static char
+fifo_wait_read(int fd, int share_id, const char *what)
 {
-	for (int i = 0; i < num; i++)
-	{
-		char filepath[1024];
-		snprintf(filepath, sizeof(filepath), "%s/si_%d", file_prefix, i);
-		fds[i] = open(filepath, O_RDWR | O_CREAT, 0666);
-	}
-	if (fds[num-1] > 0)
-		Assert(fds[num-1] > num);
-}
+	struct pollfd fds[1];
+	char		c;
 
-/**
- * close opened fds and delete the tmp files
- **/
-static void fi_close_created_fds(int *fds, char *file_prefix, int num)
-{
-	for (int i = 0; i < num; i++)
+	fds[0].fd = fd;
+	fds[0].events = POLLIN;
+	while (1)
 	{
-		char filepath[1024];
-		snprintf(filepath, sizeof(filepath), "%s/si_%d", file_prefix, i);
-		if (fds[i] > 0) {
-			close(fds[i]);
-			unlink(filepath);
-		}
-	}
-}
-#endif
+		int			nready;
+		int			poll_timeout = 1000; // unit: ms
 
-/*
- * Readiness (a) synchronization.
- *
- * For readiness, the shared node will write xslice of 'a' into the pipe.
- * For each share, there is just one ready writer.  Once sharer starts write
- * it need to write all xslice copies of 'a', even if we are interrupted, that
- * is, we should not call CHECK_FOR_INTERRUPTS.
- *
- * For sharer, it need to check for ready to read (using select), because read
- * is blocking.  Otherwise if shared is cancelled before write, then we will be
- * blocked here forever.  Once shared has write at least one 'a', it will write
- * all xslice of 'a', so once select succeed, read will eventually succeed.  Once
- * sharer got 'a', it write 'b' back to shared.
- *
- * Done (b and z) synchronization.
- * For done, the shared is the only reader.  sharer will not block for writing,
- * but shared may block for read, therefore, we much call select before shared
- * calling read.  Because there is only one shared, nobody can steal char from
- * the pipe, therefore, if select succeed, read will not block forever.
- *
- * One thing to note is that some 'z' may comeback before all 'b' come back.
- * So, need to handle this in notifyready.
- *
- * For optimizer-generated plans, we skip the 'b' synchronization. The writer
- * does not wait for readers to acknowledge the "ready" handshake anymore, as
- * that can cause deadlocks (OPT-2690).
- */
+		CHECK_FOR_INTERRUPTS();
 
-/*
- * shareinput_reader_waitready
- *
- *  Called by the reader (consumer) to wait for the writer (producer) to produce
- *  all the tuples and write them to disk.
- *
- *  This is a blocking operation.
- */
-void
-shareinput_reader_waitready(void *ctxt, int share_id, PlanGenerator planGen)
-{
-	struct pollfd fds[1];
-	int nfds = 0;
-	char a;
-	ShareInput_Lk_Context *pctxt = (ShareInput_Lk_Context *) ctxt;
-	RegisterXactCallbackOnce(XCallBack_ShareInput_FIFO, pctxt);
+		nready = poll(fds, 1, poll_timeout);
+		if (nready == 1)
+			break;
 
-#ifdef FAULT_INJECTOR
-	/**
-	 * In preivous code, use MPP_FD_SET(call select() internally) to operate FIFO,
-	 * so the FIFO's fd number cannot exceed 65536.
-	 *
-	 * After using poll() instead of select(), it can overcome this limit.
-	 * Using FAULT_INJECTOR here to test whether it works normally in this
-	 * scenario (already opened many fds).
-	 **/
-	// we should use 70000(>65536) to test here, but the test env (docker)'s open files
-	// is not very big, so only using a smaller value instead.
-	// const int num = 70000;
-	const int num = 40000;
-	int tmp_fds[num];
-	memset(tmp_fds, 0, sizeof(tmp_fds));
-	char tmpfile_prefix[] = "/tmp/_gpdb_fault_inject_tmp_dir/"; // need create the dir first
-	if (SIMPLE_FAULT_INJECTOR("inject_many_fds_for_shareinputscan") == FaultInjectorTypeSkip)
-		fi_create_many_fds(tmp_fds, tmpfile_prefix, num);
-#endif
+		elog(DEBUG1, "SISC (shareid=%d, slice=%d): %s time out once, errno %d",
+			 share_id, currentSliceId, what, nready < 0 ? errno : 0);
+	}
 
+	retry_read(fd, &c, 1);
+
+	return c;
+}
+
+static void
+fifo_open(ShareInput_Lk_Context *pctxt, bool writer)
+{
 	create_tmp_fifo(pctxt->lkname_ready);
+	pctxt->del_ready = writer;
 	pctxt->readyfd = open(pctxt->lkname_ready, O_RDWR, 0600);
 	if(pctxt->readyfd < 0)
 		elog(ERROR, "could not open fifo \"%s\": %m", pctxt->lkname_ready);
 
 	create_tmp_fifo(pctxt->lkname_done);
+	pctxt->del_done = writer;
 	pctxt->donefd = open(pctxt->lkname_done, O_RDWR, 0600);
 	if(pctxt->donefd < 0)
 		elog(ERROR, "could not open fifo \"%s\": %m", pctxt->lkname_done);
+}
 
-#ifdef FAULT_INJECTOR
-	/* close opened fds */
-	fi_close_created_fds(tmp_fds, tmpfile_prefix, num);
-#endif
+static void
+fifo_reader_waitready(ShareInput_Lk_Context *pctxt, int share_id, PlanGenerator planGen)
+{
+	char		a;
 
-	fds[0].fd = pctxt->readyfd;
-	fds[0].events = POLLIN;
-	nfds++;
-	while(1)
-	{
-		CHECK_FOR_INTERRUPTS();
+	fifo_open(pctxt, false);
 
-		int nready = 0;
-		int poll_timeout = 1000; // unit: ms
+	a = fifo_wait_read(pctxt->readyfd, share_id, "Wait ready");
+	Assert(a == 'a');
 
-		nready = poll(fds, nfds, poll_timeout);
+	elog(DEBUG1, "SISC READER (shareid=%d, slice=%d): Wait ready got writer's handshake",
+			share_id, currentSliceId);
 
-		if (nready == 1)
-		{
-#if USE_ASSERT_CHECKING
-			int rwsize =
-#endif
-			retry_read(pctxt->readyfd, &a, 1);
-			Assert(rwsize == 1 && a == 'a');
+	if (planGen == PLANGEN_PLANNER)
+	{
+		/* For planner-generated plans, we send ack back after receiving the handshake */
+		retry_write(pctxt->donefd, "b", 1);
+	}
+}
 
-			elog(DEBUG1, "SISC READER (shareid=%d, slice=%d): Wait ready got writer's handshake",
-					share_id, currentSliceId);
+static void
+fifo_writer_notifyready(ShareInput_Lk_Context *pctxt, int share_id, int xslice, PlanGenerator planGen)
+{
+	int			n;
 
-			if (planGen == PLANGEN_PLANNER)
-			{
-				/* For planner-generated plans, we send ack back after receiving the handshake */
-				elog(DEBUG1, "SISC READER (shareid=%d, slice=%d): Wait ready writing ack back to writer",
-						share_id, currentSliceId);
+	fifo_open(pctxt, true);
 
-#if USE_ASSERT_CHECKING
-				rwsize =
-#endif
-				retry_write(pctxt->donefd, "b", 1);
-				Assert(rwsize == 1);
-			}
+	for(n=0; n<xslice; ++n)
+		retry_write(pctxt->readyfd, "a", 1);
 
-			break;
-		}
-		else if (nready == 0)
-		{
-			elog(DEBUG1, "SISC READER (shareid=%d, slice=%d): Wait ready time out once",
-					share_id, currentSliceId);
-		}
-		else
+	elog(DEBUG1, "SISC WRITER (shareid=%d, slice=%d): wrote notify_ready to %d xslice readers",
+						share_id, currentSliceId, xslice);
+
+	if (planGen == PLANGEN_PLANNER)
+	{
+		/* For planner-generated plans, we wait for acks from all the readers */
+		int			ack_needed = xslice;
+
+		while (ack_needed > 0)
 		{
-			int save_errno = errno;
-			elog(DEBUG1, "SISC READER (shareid=%d, slice=%d): Wait ready try again, errno %d ... ",
-					share_id, currentSliceId, save_errno);
+			char		b = fifo_wait_read(pctxt->donefd, share_id, "Notify ready");
+
+			if (b == 'z')
+				++pctxt->zcnt;
+			else
+			{
+				Assert(b == 'b');
+				--ack_needed;
+			}
 		}
 	}
 }
 
+static void
+fifo_writer_waitdone(ShareInput_Lk_Context *pctxt, int share_id, int nsharer_xslice)
+{
+	int			ack_needed = nsharer_xslice - pctxt->zcnt;
+
+	while (ack_needed > 0)
+	{
+		char		z PG_USED_FOR_ASSERTS_ONLY;
+
+		z = fifo_wait_read(pctxt->donefd, share_id, "Wait done");
+		Assert(z == 'z');
+		--ack_needed;
+	}
+}
+
 /*
- * shareinput_writer_notifyready
- *
- *  Called by the writer (producer) once it is done producing all tuples and
- *  writing them to disk. It notifies all the readers (consumers) that tuples
- *  are ready to be read from disk.
+ * shareinput_reader_waitready
  *
- *  For planner-generated plans we wait for acks from all the readers before
- *  proceedings. It is a blocking operation.
+ *  Called by the reader (consumer) to wait for the writer (producer) to produce
+ *  all the tuples and make them available.
  *
- *	For optimizer-generated plans we don't wait for acks, we proceed immediately.
- *  It is a non-blocking operation.
+ *  This is a blocking operation.
  */
 void
-shareinput_writer_notifyready(void *ctxt, int share_id, int xslice, PlanGenerator planGen)
+shareinput_reader_waitready(void *ctxt, int share_id, PlanGenerator planGen)
 {
-	int n;
 	ShareInput_Lk_Context *pctxt = (ShareInput_Lk_Context *) ctxt;
-	RegisterXactCallbackOnce(XCallBack_ShareInput_FIFO, pctxt);
+	ShareInputSharedState *state = shareinput_attach(pctxt);
 
-	create_tmp_fifo(pctxt->lkname_ready);
-	pctxt->del_ready = true;
-	pctxt->readyfd = open(pctxt->lkname_ready, O_RDWR, 0600);
-	if(pctxt->readyfd < 0)
-		elog(ERROR, "could not open fifo \"%s\": %m", pctxt->lkname_ready);
-
-	create_tmp_fifo(pctxt->lkname_done);
-	pctxt->del_done = true;
-	pctxt->donefd = open(pctxt->lkname_done, O_RDWR, 0600);
-	if(pctxt->donefd < 0)
-		elog(ERROR, "could not open fifo \"%s\": %m", pctxt->lkname_done);
+	if (!state)
+	{
+		fifo_reader_waitready(pctxt, share_id, planGen);
+		return;
+	}
 
-	for(n=0; n<xslice; ++n)
+	ConditionVariablePrepareToSleep(&state->cv);
+	for (;;)
 	{
-#if USE_ASSERT_CHECKING
-		int rwsize =
-#endif
-		retry_write(pctxt->readyfd, "a", 1);
-		Assert(rwsize == 1);
+		LWLockAcquire(ShareInputScanLock, LW_EXCLUSIVE);
+		if (state->ready)
+			break;
+		LWLockRelease(ShareInputScanLock);
+
+		elog(DEBUG1, "SISC READER (shareid=%d, slice=%d): Wait ready sleeping",
+				share_id, currentSliceId);
+		ConditionVariableSleep(&state->cv);
 	}
-	elog(DEBUG1, "SISC WRITER (shareid=%d, slice=%d): wrote notify_ready to %d xslice readers",
-						share_id, currentSliceId, xslice);
+
+	/* the lock is still held here */
+	pctxt->handle = state->handle;
+	if (planGen == PLANGEN_PLANNER)
+		state->nacks++;
+	LWLockRelease(ShareInputScanLock);
+	ConditionVariableCancelSleep();
+
+	elog(DEBUG1, "SISC READER (shareid=%d, slice=%d): Wait ready got writer's handshake",
+			share_id, currentSliceId);
 
 	if (planGen == PLANGEN_PLANNER)
 	{
-		/* For planner-generated plans, we wait for acks from all the readers */
-		writer_wait_for_acks(pctxt, share_id, xslice);
+		/* For planner-generated plans, we send ack back after the handshake */
+		ConditionVariableBroadcast(&state->cv);
 	}
 }
 
 /*
- * writer_wait_for_acks
+ * shareinput_writer_notifyready
+ *
+ *  Called by the writer (producer) once it is done producing all tuples and
+ *  making them available. It notifies all the readers (consumers) that tuples
+ *  are ready to be read.
  *
- * After sending the handshake to all the reader, the writer waits for acks
- * from all the readers.
+ *  For planner-generated plans we wait for acks from all the readers before
+ *  proceedings. It is a blocking operation.
  *
- * This is a blocking operation.
+ *	For optimizer-generated plans we don't wait for acks, we proceed immediately.
+ *  It is a non-blocking operation.
  */
-static void
-writer_wait_for_acks(ShareInput_Lk_Context *pctxt, int share_id, int xslice)
+void
+shareinput_writer_notifyready(void *ctxt, int share_id, int xslice, PlanGenerator planGen)
 {
-	int ack_needed = xslice;
-	struct pollfd fds[1];
-	int nfds = 0;
-	char b;
+	ShareInput_Lk_Context *pctxt = (ShareInput_Lk_Context *) ctxt;
+	ShareInputSharedState *state = shareinput_attach(pctxt);
 
-	fds[0].fd = pctxt->donefd;
-	fds[0].events = POLLIN;
-	nfds++;
-	while(ack_needed > 0)
+	if (!state)
 	{
-		CHECK_FOR_INTERRUPTS();
+		Assert(pctxt->handle == DSM_HANDLE_INVALID);
+		fifo_writer_notifyready(pctxt, share_id, xslice, planGen);
+		return;
+	}
 
-		int nready = 0;
-		int poll_timeout = 1000; // unit: ms
+	LWLockAcquire(ShareInputScanLock, LW_EXCLUSIVE);
+	state->handle = pctxt->handle;
+	state->ready = true;
+	LWLockRelease(ShareInputScanLock);
 
-		nready = poll(fds, nfds, poll_timeout);
+	ConditionVariableBroadcast(&state->cv);
 
-		if (nready == 1)
-		{
-#if USE_ASSERT_CHECKING
-			int rwsize =
-#endif
-			retry_read(pctxt->donefd, &b, 1);
-			Assert(rwsize == 1);
+	elog(DEBUG1, "SISC WRITER (shareid=%d, slice=%d): notified %d xslice readers, %s",
+						share_id, currentSliceId, xslice,
+						pctxt->handle != DSM_HANDLE_INVALID ? "in memory" : "on disk");
 
-			if(b == 'z')
-			{
-				++pctxt->zcnt;
-			}
-			else
-			{
-				Assert(b == 'b');
-				--ack_needed;
-				elog(DEBUG1, "SISC WRITER (shareid=%d, slice=%d): notify ready succeed 1, xslice remaining %d",
-						share_id, currentSliceId, ack_needed);
-			}
-		}
-		else if (nready == 0)
-		{
-			elog(DEBUG1, "SISC WRITER (shareid=%d, slice=%d): Notify ready time out once ... ",
-					share_id, currentSliceId);
-		}
-		else
-		{
-			int save_errno = errno;
-			elog(DEBUG1, "SISC WRITER (shareid=%d, slice=%d): notify still wait for an answer, errno %d",
-					share_id, currentSliceId, save_errno);
-		}
+	if (planGen == PLANGEN_PLANNER)
+	{
+		/* For planner-generated plans, we wait for acks from all the readers */
+		shareinput_wait_for_count(state, &state->nacks, xslice);
+
+		elog(DEBUG1, "SISC WRITER (shareid=%d, slice=%d): got acks from %d xslice readers",
+				share_id, currentSliceId, xslice);
 	}
 }
 
@@ -844,7 +1059,7 @@ writer_wait_for_acks(ShareInput_Lk_Context *pctxt, int share_id, int xslice)
  * shareinput_reader_notifydone
  *
  *  Called by the reader (consumer) to notify the writer (producer) that
- *  it is done reading tuples from disk.
+ *  it is done reading tuples.
  *
  *  This is a non-blocking operation.
  */
@@ -852,18 +1067,29 @@ void
 shareinput_reader_notifydone(void *ctxt, int share_id)
 {
 	ShareInput_Lk_Context *pctxt = (ShareInput_Lk_Context *) ctxt;
+	ShareInputSharedState *state = pctxt->state;
 
-	if (pctxt->donefd < 0)
-		return;
+	if (pctxt->use_fifo)
+	{
+		if (pctxt->donefd < 0)
+			return;
 
-#if USE_ASSERT_CHECKING
-	int rwsize  =
-#endif
-	retry_write(pctxt->donefd, "z", 1);
-	Assert(rwsize == 1);
+		retry_write(pctxt->donefd, "z", 1);
+	}
+	else
+	{
+		if (!state)
+			return;
+
+		LWLockAcquire(ShareInputScanLock, LW_EXCLUSIVE);
+		state->ndone++;
+		LWLockRelease(ShareInputScanLock);
+
+		ConditionVariableBroadcast(&state->cv);
+	}
 
 	shareinput_clean_lk_ctxt(pctxt);
-	UnregisterXactCallbackOnce(XCallBack_ShareInput_FIFO, (void *) ctxt);
+	UnregisterXactCallbackOnce(XCallBack_ShareInput, (void *) ctxt);
 }
 
 /*
@@ -878,60 +1104,140 @@ void
 shareinput_writer_waitdone(void *ctxt, int share_id, int nsharer_xslice)
 {
 	ShareInput_Lk_Context *pctxt = (ShareInput_Lk_Context *) ctxt;
-	struct pollfd fds[1];
-	int nfds = 0;
+	ShareInputSharedState *state = pctxt->state;
 
-	if (pctxt->donefd < 0)
+	if (pctxt->use_fifo ? pctxt->donefd < 0 : !state)
 		return;
 
-	char z;
-	int ack_needed = nsharer_xslice - pctxt->zcnt;
-
 	elog(DEBUG1, "SISC WRITER (shareid=%d, slice=%d): waiting for DONE message from %d readers",
-							share_id, currentSliceId, ack_needed);
+							share_id, currentSliceId, nsharer_xslice);
 
-	fds[0].fd = pctxt->donefd;
-	fds[0].events = POLLIN;
-	nfds++;
-	while(ack_needed > 0)
-	{
-		CHECK_FOR_INTERRUPTS();
+	if (pctxt->use_fifo)
+		fifo_writer_waitdone(pctxt, share_id, nsharer_xslice);
+	else
+		shareinput_wait_for_count(state, &state->ndone, nsharer_xslice);
 
-		int nready = 0;
-		int poll_timeout = 1000; // unit: ms
+	elog(DEBUG1, "SISC WRITER (shareid=%d, slice=%d): Writer received all %d reader done notifications",
+			share_id, currentSliceId, nsharer_xslice);
 
-		nready = poll(fds, nfds, poll_timeout);
+	shareinput_clean_lk_ctxt(ctxt);
+	UnregisterXactCallbackOnce(XCallBack_ShareInput, (void *) ctxt);
+}
 
-		if (nready == 1)
-		{
-#if USE_ASSERT_CHECKING
-			int rwsize =
-#endif
-			retry_read(pctxt->donefd, &z, 1);
-			Assert(rwsize == 1 && z == 'z');
+/*
+ * shareinput_writer_store_in_memory
+ *
+ *  Called by the writer (producer) before notifying the readers, to copy the
+ *  tuples of its tuplestore into dynamic shared memory.  Returns false if the
+ *  tuples don't fit in gp_shared_scan_memory_limit, the tuplestore has
+ *  already spilled, the share is synchronized through FIFOs or all the
+ *  dynamic shared memory segments are in use; the caller then flushes the
+ *  tuplestore to disk instead.
+ */
+bool
+shareinput_writer_store_in_memory(void *ctxt, NTupleStore *ts)
+{
+	ShareInput_Lk_Context *pctxt = (ShareInput_Lk_Context *) ctxt;
+	NTupleStoreAccessor *acc;
+	ShareInputMemStore *memstore;
+	Size		limit = (Size) gp_shared_scan_memory_limit * 1024L;
+	Size		header_size;
+	Size		data_size = 0;
+	Size		offset;
+	int			ntuples = 0;
+	void	   *data;
+	int			len;
+
+	if (limit == 0 || dynamic_shared_memory_type == DSM_IMPL_NONE ||
+		ntuplestore_is_spilled(ts))
+		return false;
+
+	/* First pass: size up the tuples */
+	acc = ntuplestore_create_accessor(ts, false);
+	ntuplestore_acc_seek_bof(acc);
+	while (ntuplestore_acc_advance(acc, 1))
+	{
+		if (!ntuplestore_acc_current_data(acc, &data, &len))
+			break;
 
-			elog(DEBUG1, "SISC WRITER (shareid=%d, slice=%d): wait done get 1 notification",
-					share_id, currentSliceId);
-			--ack_needed;
-		}
-		else if (nready == 0)
-		{
-			elog(DEBUG1, "SISC WRITER (shareid=%d, slice=%d): wait done timeout once",
-					share_id, currentSliceId);
-		}
-		else
+		ntuples++;
+		data_size += MAXALIGN(len);
+		if (data_size > limit)
 		{
-			int save_errno = errno;
-			elog(DEBUG1, "SISC WRITER (shareid=%d, slice=%d): wait done time out once, errno %d",
-					share_id, currentSliceId, save_errno);
+			ntuplestore_destroy_accessor(acc);
+			return false;
 		}
 	}
 
-	elog(DEBUG1, "SISC WRITER (shareid=%d, slice=%d): Writer received all %d reader done notifications",
-			share_id, currentSliceId, nsharer_xslice - pctxt->zcnt);
+	header_size = MAXALIGN(offsetof(ShareInputMemStore, offsets) +
+						   ntuples * sizeof(Size));
+	if (header_size + data_size > limit || shareinput_attach(pctxt) == NULL)
+	{
+		ntuplestore_destroy_accessor(acc);
+		return false;
+	}
 
-	shareinput_clean_lk_ctxt(ctxt);
-	UnregisterXactCallbackOnce(XCallBack_ShareInput_FIFO, (void *) ctxt);
+	pctxt->seg = NULL;
+#ifdef FAULT_INJECTOR
+	if (SIMPLE_FAULT_INJECTOR("shareinput_dsm_segments_exhausted") != FaultInjectorTypeSkip)
+#endif
+		pctxt->seg = dsm_create(header_size + data_size,
+								DSM_CREATE_NULL_IF_MAXSEGMENTS);
+	if (pctxt->seg == NULL)
+	{
+		elog(DEBUG1, "SISC WRITER (shareid=%d, slice=%d): no dynamic shared memory segment left",
+			 pctxt->tag.share_id, currentSliceId);
+		ntuplestore_destroy_accessor(acc);
+		return false;
+	}
+	dsm_pin_mapping(pctxt->seg);
+	pctxt->handle = dsm_segment_handle(pctxt->seg);
+
+	/* Second pass: copy them */
+	memstore = (ShareInputMemStore *) dsm_segment_address(pctxt->seg);
+	memstore->ntuples = 0;
+	offset = header_size;
+
+	ntuplestore_acc_seek_bof(acc);
+	while (ntuplestore_acc_advance(acc, 1))
+	{
+		if (!ntuplestore_acc_current_data(acc, &data, &len))
+			break;
+
+		memcpy((char *) memstore + offset, data, len);
+		memstore->offsets[memstore->ntuples++] = offset;
+		offset += MAXALIGN(len);
+	}
+	Assert(memstore->ntuples == ntuples);
+
+	ntuplestore_destroy_accessor(acc);
+
+	SIMPLE_FAULT_INJECTOR("shareinput_writer_in_memory");
+
+	return true;
+}
+
+/*
+ * Map the tuples the writer stored in dynamic shared memory, if it did.
+ * The mapping lasts until the context is cleaned up.
+ */
+static ShareInputMemStore *
+shareinput_attach_memory(ShareInput_Lk_Context *pctxt)
+{
+	if (pctxt->seg == NULL)
+	{
+		if (pctxt->handle == DSM_HANDLE_INVALID)
+			return NULL;
+
+		pctxt->seg = dsm_attach(pctxt->handle);
+		if (pctxt->seg == NULL)
+			ereport(ERROR,
+					(errcode(ERRCODE_INTERNAL_ERROR),
+					 errmsg("could not map shared scan tuples")));
+		dsm_pin_mapping(pctxt->seg);
+	}
+
+	return (ShareInputMemStore *) dsm_segment_address(pctxt->seg);
 }
 
 /*
@@ -990,6 +1296,9 @@ ExecEagerFreeShareInputScan(ShareInputScanState *node)
 	node->ts_pos = NULL;
 	node->ts_markpos = NULL;
 
+	/* the mapping itself goes away with share_lk_ctxt */
+	node->share_memstore = NULL;
+
 	/* This can be called more than once */
 	if (!node->freed &&
 			(sisc->share_type == SHARE_MATERIAL || sisc->share_type == SHARE_SORT))
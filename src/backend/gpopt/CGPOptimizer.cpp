@@ -15,8 +15,11 @@
 
 #include "gpopt/CGPOptimizer.h"
 
+#include "gpopt/utils/CMemoryPoolArenaManager.h"
 #include "gpopt/utils/CMemoryPoolPalloc.h"
 #include "gpopt/utils/CMemoryPoolPallocManager.h"
+#include "gpopt/utils/COptPlanCache.h"
+#include "gpopt/utils/COptProfile.h"
 #include "gpopt/utils/COptTasks.h"
 
 // the following headers are needed to reference optimizer library initializers
@@ -25,9 +28,11 @@
 
 #include "gpopt/gpdbwrappers.h"
 #include "gpopt/init.h"
+#include "gpopt/xforms/CXformFactory.h"
 #include "naucrates/exception.h"
 #include "naucrates/init.h"
 extern "C" {
+#include "nodes/pg_list.h"
 #include "utils/guc.h"
 #include "utils/memutils.h"
 }
@@ -185,7 +190,14 @@ CGPOptimizer::InitGPOPT()
 {
 	if (optimizer_use_gpdb_allocators)
 	{
-		CMemoryPoolPallocManager::Init();
+		if (optimizer_use_arena_allocators)
+		{
+			CMemoryPoolArenaManager::Init();
+		}
+		else
+		{
+			CMemoryPoolPallocManager::Init();
+		}
 	}
 
 	struct gpos_init_params params = {gpdb::IsAbortRequested};
@@ -193,6 +205,8 @@ CGPOptimizer::InitGPOPT()
 	gpos_init(&params);
 	gpdxl_init();
 	gpopt_init();
+
+	gpdb::RegisterMDCacheInvalidationCallbacks();
 }
 
 //---------------------------------------------------------------------------
@@ -243,6 +257,120 @@ SerializeDXLPlan(Query *query)
 }
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		GetGPOPTPlanCacheStats
+//
+//	@doc:
+//		Report the lookups served and missed by the session's plan cache
+//
+//---------------------------------------------------------------------------
+extern "C" {
+void
+GetGPOPTPlanCacheStats(uint64 *hits, uint64 *misses)
+{
+	*hits = gpopt::COptPlanCache::ULLGetCacheHits();
+	*misses = gpopt::COptPlanCache::ULLGetCacheMisses();
+}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		GetGPOPTProfile
+//
+//	@doc:
+//		Describe the profile of the last optimization as a list of summary
+//		lines and a list of lines for the most expensive xforms; both lists
+//		are NIL if no profile was recorded
+//
+//---------------------------------------------------------------------------
+extern "C" {
+void
+GetGPOPTProfile(List **summary, List **xforms)
+{
+	*summary = NIL;
+	*xforms = NIL;
+
+	const gpopt::COptProfile::SProfile *profile =
+		gpopt::COptProfile::Pprofile();
+	if (NULL == profile)
+	{
+		return;
+	}
+
+	const gpopt::SOptimizerMetrics &metrics = profile->m_metrics;
+	*summary = lappend(*summary,
+					   psprintf("time=%.3f ms",
+								(double) profile->m_optimization_time / 1000));
+	if (profile->m_is_cached_plan)
+	{
+		*summary = lappend(*summary, pstrdup("plan cache hit"));
+	}
+	else
+	{
+		StringInfoData stages;
+		initStringInfo(&stages);
+		appendStringInfo(&stages, "stages=%u", metrics.m_ulSearchStages);
+		for (ULONG ul = 0; ul < metrics.m_ulSearchStages &&
+						   ul < gpopt::SOptimizerMetrics::MaxStages;
+			 ul++)
+		{
+			appendStringInfo(&stages, "%s%u ms", (0 == ul) ? " (" : ", ",
+							 metrics.m_rgulStageTime[ul]);
+		}
+		if (0 < metrics.m_ulSearchStages)
+		{
+			appendStringInfoChar(&stages, ')');
+		}
+
+		*summary = lappend(*summary, stages.data);
+		*summary = lappend(*summary,
+						   psprintf("groups=%u (%u duplicates) "
+									"group expressions=%u jobs=" UINT64_FORMAT,
+									metrics.m_ulGroups,
+									metrics.m_ulDuplicateGroups,
+									metrics.m_ulGroupExprs,
+									(uint64) metrics.m_ullJobs));
+		*summary = lappend(
+			*summary,
+			psprintf("xforms filtered by operator=" UINT64_FORMAT
+					 " by pattern=" UINT64_FORMAT,
+					 (uint64) metrics.m_ullXformsFiltered,
+					 (uint64) metrics.m_ullPatternMismatches));
+		if (metrics.m_fDegraded)
+		{
+			*summary = lappend(
+				*summary,
+				psprintf("search degraded in stage %u at " UINT64_FORMAT
+						 " kB (optimizer_memo_memory_budget)",
+						 metrics.m_ulDegradedStage,
+						 (uint64)(metrics.m_ullDegradedMemory + 1023) / 1024));
+		}
+	}
+	*summary = lappend(
+		*summary, psprintf("peak memory=" UINT64_FORMAT " kB",
+						   (uint64)(profile->m_peak_memory + 1023) / 1024));
+
+	// the xforms taking most of the time
+	ULONG xform_ids[10];
+	ULONG num_xforms = gpopt::COptProfile::UlSortedXforms(
+		xform_ids, GPOS_ARRAY_SIZE(xform_ids));
+	for (ULONG ul = 0; ul < num_xforms; ul++)
+	{
+		ULONG id = xform_ids[ul];
+		gpopt::CXform *xform = gpopt::CXformFactory::Pxff()->Pxf(
+			(gpopt::CXform::EXformId) id);
+		*xforms = lappend(
+			*xforms,
+			psprintf("%s: calls=" UINT64_FORMAT
+					 " time=%.3f ms alternatives=" UINT64_FORMAT,
+					 xform->SzId(), (uint64) metrics.m_rgullXformCalls[id],
+					 (double) metrics.m_rgullXformTime[id] / 1000,
+					 (uint64) metrics.m_rgullXformResults[id]));
+	}
+}
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		InitGPOPT()
@@ -80,6 +80,11 @@ CConfigParamMapping::SConfigMappingElem CConfigParamMapping::m_elements[] = {
 	 false,	 // m_negate_param
 	 GPOS_WSZ_LIT("Prints optimization stats.")},
 
+	{EopttraceCollectOptimizationStatistics,
+	 &optimizer_collect_optimization_stats,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT("Collects optimization stats for the optimizer profile.")},
+
 	{EopttraceMinidump,
 	 // GPDB_91_MERGE_FIXME: I turned optimizer_minidump from bool into
 	 // an enum-type GUC. It's a bit dirty to cast it like this..
@@ -283,6 +288,10 @@ CConfigParamMapping::SConfigMappingElem CConfigParamMapping::m_elements[] = {
 	 true,	// m_negate_param
 	 GPOS_WSZ_LIT(
 		 "Penalize a hash join with a skewed redistribute as a child.")},
+	{EopttracePenalizeHeavyHitters, &optimizer_penalize_heavy_hitters,
+	 false,	 // m_negate_param
+	 GPOS_WSZ_LIT(
+		 "Cost a hash redistribute by the rows of its most frequent value.")},
 	{EopttraceTranslateUnusedColrefs, &optimizer_prune_unused_columns,
 	 true,	// m_negate_param
 	 GPOS_WSZ_LIT("Prune unused columns from the query.")},
@@ -486,6 +495,9 @@ CConfigParamMapping::PackConfigParamInBitset(
 		case JOIN_ORDER_EXHAUSTIVE2_SEARCH:
 			join_heuristic_bitset = CXform::PbsJoinOrderOnExhaustive2Xforms(mp);
 			break;
+		case JOIN_ORDER_HYPERGRAPH_SEARCH:
+			join_heuristic_bitset = CXform::PbsJoinOrderOnHypergraphXforms(mp);
+			break;
 		default:
 			elog(ERROR,
 				 "Invalid value for optimizer_join_order, must \
@@ -31,6 +31,8 @@
 extern "C" {
 #include "catalog/pg_collation.h"
 #include "catalog/pg_inherits_fn.h"
+#include "utils/hyperloglog/gp_hyperloglog.h"
+#include "utils/mdsharedcache.h"
 #include "utils/memutils.h"
 }
 #define GP_WRAP_START                                            \
@@ -351,6 +353,17 @@ gpdb::BmsAddMember(Bitmapset *a, int x)
 	return NULL;
 }
 
+bool
+gpdb::BmsIsMember(int x, const Bitmapset *a)
+{
+	GP_WRAP_START;
+	{
+		return bms_is_member(x, a);
+	}
+	GP_WRAP_END;
+	return false;
+}
+
 void *
 gpdb::CopyObject(void *from)
 {
@@ -695,6 +708,19 @@ gpdb::GetAttrStatsSlot(AttStatsSlot *sslot, HeapTuple statstuple, int reqkind,
 	return false;
 }
 
+char *
+gpdb::GetHLLRegisters(Datum counter, int *precision)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: pg_statistic */
+		return gp_hyperloglog_get_registers(
+			(GpHLLCounter) DatumGetByteaP(counter), precision);
+	}
+	GP_WRAP_END;
+	return NULL;
+}
+
 HeapTuple
 gpdb::GetAttStats(Oid relid, AttrNumber attnum)
 {
@@ -2406,6 +2432,20 @@ gpdb::EvaluateExpr(Expr *expr, Oid result_type, int32 typmod)
 	return NULL;
 }
 
+// Evaluates the constant expressions of 'exprs' and returns the results as
+// a list of Consts. Caller keeps ownership of 'exprs' and takes ownership of
+// the result
+List *
+gpdb::EvaluateExprList(List *exprs)
+{
+	GP_WRAP_START;
+	{
+		return evaluate_expr_list(exprs);
+	}
+	GP_WRAP_END;
+	return NIL;
+}
+
 // interpret the value of "With oids" option from a list of defelems
 bool
 gpdb::InterpretOidsOption(List *options, bool allowOids)
@@ -2493,11 +2533,12 @@ gpdb::CountLeafPartTables(Oid rel_oid)
  * We register a callback to a cache on all the catalog tables that contain
  * information that's contained in the ORCA metadata cache.
 
- * There is no fine-grained mechanism in the metadata cache for invalidating
- * individual entries ATM, so we just blow the whole cache whenever anything
- * changes. The callback simply increments a counter. Whenever we start
- * planning a query, we check the counter to see if it has changed since the
- * last planned query, and reset the whole cache if it has.
+ * The callbacks record the invalidated relation OIDs and syscache hash
+ * values. Whenever we start planning a query, the recorded changes are
+ * handed to COptTasks, which evicts only the metadata cache objects they
+ * refer to. Changes that cannot be mapped to individual objects (partition
+ * and operator family catalogs, invalidation of a whole cache, or more
+ * changes than we are willing to remember) reset the whole cache instead.
  *
  * To make sure we've covered all catalog tables that contain information
  * that's stored in the metadata cache, there are "catalog tables: xxx"
@@ -2506,25 +2547,80 @@ gpdb::CountLeafPartTables(Oid rel_oid)
  * anything fetched via the wrapper functions in this file can end up in the
  * metadata cache and hence need to have an invalidation callback registered.
  */
-static bool mdcache_invalidation_counter_registered = false;
-static int64 mdcache_invalidation_counter = 0;
-static int64 last_mdcache_invalidation_counter = 0;
+#define MDCACHE_MAX_PENDING_INVALIDATIONS 1024
+
+static bool mdcache_reset_pending = false;
+
+/*
+ * Changes recorded since the last planned query, and the changes handed out
+ * for the current one. The latter are kept apart so that invalidations
+ * arriving while the cache is being cleaned up are not lost.
+ */
+static gpdb::SMDCacheInvalidation
+	mdcache_pending_invalidations[MDCACHE_MAX_PENDING_INVALIDATIONS];
+static int mdcache_num_pending_invalidations = 0;
+static gpdb::SMDCacheInvalidation
+	mdcache_current_invalidations[MDCACHE_MAX_PENDING_INVALIDATIONS];
+
+static void
+record_mdcache_invalidation(int cacheid, uint32 hashvalue, Oid relid)
+{
+	gpdb::SMDCacheInvalidation *inval;
+
+	if (mdcache_num_pending_invalidations >= MDCACHE_MAX_PENDING_INVALIDATIONS)
+	{
+		mdcache_reset_pending = true;
+		return;
+	}
+
+	inval = &mdcache_pending_invalidations[mdcache_num_pending_invalidations++];
+	inval->m_cacheid = cacheid;
+	inval->m_hashvalue = hashvalue;
+	inval->m_relid = relid;
+}
 
 static void
 mdsyscache_invalidation_counter_callback(Datum arg, int cacheid,
 										 uint32 hashvalue)
 {
-	mdcache_invalidation_counter++;
+	/* the shared metadata cache doesn't track individual objects */
+	MDSharedCacheInvalidate();
+
+	/*
+	 * A zero hash value invalidates the whole syscache. Partitioning and
+	 * operator family information is spread over many cached objects, so
+	 * we don't try to track it down.
+	 */
+	if (0 == hashvalue || PARTOID == cacheid || PARTRULEOID == cacheid ||
+		AMOPOPID == cacheid || OPFAMILYOID == cacheid)
+	{
+		mdcache_reset_pending = true;
+		return;
+	}
+
+	record_mdcache_invalidation(cacheid, hashvalue, InvalidOid);
 }
 
 static void
 mdrelcache_invalidation_counter_callback(Datum arg, Oid relid)
 {
-	mdcache_invalidation_counter++;
+	MDSharedCacheInvalidate();
+
+	/* InvalidOid means the whole relcache is being reset */
+	if (!OidIsValid(relid))
+	{
+		mdcache_reset_pending = true;
+		return;
+	}
+
+	record_mdcache_invalidation(-1, 0, relid);
 }
 
-static void
-register_mdcache_invalidation_callbacks(void)
+// Register the invalidation callbacks of the metadata cache. This is done
+// once at backend start, so that the callbacks see every catalog change
+// made after that, including the ones preceding the first optimization.
+void
+gpdb::RegisterMDCacheInvalidationCallbacks(void)
 {
 	/* These are all the catalog tables that we care about. */
 	int metadata_caches[] = {
@@ -2579,42 +2675,105 @@ register_mdcache_invalidation_callbacks(void)
 	};
 	unsigned int i;
 
-	for (i = 0; i < lengthof(metadata_caches); i++)
+	GP_WRAP_START;
 	{
-		CacheRegisterSyscacheCallback(metadata_caches[i],
-									  &mdsyscache_invalidation_counter_callback,
-									  (Datum) 0);
-	}
+		for (i = 0; i < lengthof(metadata_caches); i++)
+		{
+			CacheRegisterSyscacheCallback(
+				metadata_caches[i], &mdsyscache_invalidation_counter_callback,
+				(Datum) 0);
+		}
 
-	/* also register the relcache callback */
-	CacheRegisterRelcacheCallback(&mdrelcache_invalidation_counter_callback,
-								  (Datum) 0);
+		/* also register the relcache callback */
+		CacheRegisterRelcacheCallback(
+			&mdrelcache_invalidation_counter_callback, (Datum) 0);
+		return;
+	}
+	GP_WRAP_END;
 }
 
-// Has there been any catalog changes since last call?
+// Has there been any catalog changes since last call that require a reset?
 bool
-gpdb::MDCacheNeedsReset(void)
+gpdb::MDCacheNeedsReset(const SMDCacheInvalidation **invalidations,
+						gpos::ULONG *num_invalidations)
 {
+	*invalidations = mdcache_current_invalidations;
+	*num_invalidations = 0;
+
 	GP_WRAP_START;
 	{
-		if (!mdcache_invalidation_counter_registered)
+		bool reset = mdcache_reset_pending;
+		if (!reset)
 		{
-			register_mdcache_invalidation_callbacks();
-			mdcache_invalidation_counter_registered = true;
-		}
-		if (last_mdcache_invalidation_counter == mdcache_invalidation_counter)
-			return false;
-		else
-		{
-			last_mdcache_invalidation_counter = mdcache_invalidation_counter;
-			return true;
+			memcpy(mdcache_current_invalidations,
+				   mdcache_pending_invalidations,
+				   mdcache_num_pending_invalidations *
+					   sizeof(SMDCacheInvalidation));
+			*num_invalidations = mdcache_num_pending_invalidations;
 		}
+
+		mdcache_reset_pending = false;
+		mdcache_num_pending_invalidations = 0;
+
+		return reset;
 	}
 	GP_WRAP_END;
 
 	return true;
 }
 
+uint32
+gpdb::GetSysCacheHashValue(int cache_id, Datum key1, Datum key2, Datum key3)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: none, only hashes the key */
+		return ::GetSysCacheHashValue(cache_id, key1, key2, key3, 0);
+	}
+	GP_WRAP_END;
+
+	return 0;
+}
+
+uint64
+gpdb::MDSharedCacheGeneration(void)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: none */
+		return ::MDSharedCacheGeneration();
+	}
+	GP_WRAP_END;
+
+	return 0;
+}
+
+char *
+gpdb::MDSharedCacheLookup(const char *key, uint32 key_len, uint32 *data_len)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: none */
+		return ::MDSharedCacheLookup(key, key_len, data_len);
+	}
+	GP_WRAP_END;
+
+	return NULL;
+}
+
+void
+gpdb::MDSharedCacheInsert(const char *key, uint32 key_len, const char *data,
+						  uint32 data_len, uint64 generation)
+{
+	GP_WRAP_START;
+	{
+		/* catalog tables: none */
+		::MDSharedCacheInsert(key, key_len, data, data_len, generation);
+		return;
+	}
+	GP_WRAP_END;
+}
+
 // returns true if a query cancel is requested in GPDB
 bool
 gpdb::IsAbortRequested(void)
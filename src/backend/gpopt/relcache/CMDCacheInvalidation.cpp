@@ -0,0 +1,431 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMDCacheInvalidation.cpp
+//
+//	@doc:
+//		Targeted eviction of metadata cache objects affected by catalog
+//		invalidation messages.
+//
+//---------------------------------------------------------------------------
+
+#include "gpopt/relcache/CMDCacheInvalidation.h"
+
+#include "gpopt/mdcache/CMDCache.h"
+#include "naucrates/md/CMDIdCast.h"
+#include "naucrates/md/CMDIdColStats.h"
+#include "naucrates/md/CMDIdExtStats.h"
+#include "naucrates/md/CMDIdGPDB.h"
+#include "naucrates/md/CMDIdRelStats.h"
+#include "naucrates/md/IMDColumn.h"
+#include "naucrates/md/IMDRelation.h"
+
+using namespace gpopt;
+using namespace gpmd;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCacheInvalidation::CMDCacheInvalidation
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CMDCacheInvalidation::CMDCacheInvalidation(
+	CMemoryPool *mp, const gpdb::SMDCacheInvalidation *invalidations,
+	ULONG num_invalidations)
+	: m_mp(mp),
+	  m_invalidations(invalidations),
+	  m_num_invalidations(num_invalidations),
+	  m_invalidated_rels(NULL),
+	  m_stats_rels(NULL),
+	  m_cached_rels(NULL)
+{
+	GPOS_ASSERT(NULL != invalidations);
+
+	m_invalidated_rels = GPOS_NEW(mp) OidHashSet(mp);
+	m_stats_rels = GPOS_NEW(mp) OidHashSet(mp);
+	m_cached_rels = GPOS_NEW(mp) OidHashSet(mp);
+
+	for (ULONG ul = 0; ul < SysCacheSize; ul++)
+	{
+		m_has_syscache_inval[ul] = false;
+	}
+
+	for (ULONG ul = 0; ul < num_invalidations; ul++)
+	{
+		const gpdb::SMDCacheInvalidation *inval = &invalidations[ul];
+		if (0 > inval->m_cacheid)
+		{
+			AddOid(m_invalidated_rels, inval->m_relid);
+		}
+		else
+		{
+			GPOS_ASSERT(inval->m_cacheid < SysCacheSize);
+			m_has_syscache_inval[inval->m_cacheid] = true;
+		}
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCacheInvalidation::~CMDCacheInvalidation
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CMDCacheInvalidation::~CMDCacheInvalidation()
+{
+	m_invalidated_rels->Release();
+	m_stats_rels->Release();
+	m_cached_rels->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCacheInvalidation::AddOid
+//
+//	@doc:
+//		Add an oid to the given set
+//
+//---------------------------------------------------------------------------
+void
+CMDCacheInvalidation::AddOid(OidHashSet *oid_set, OID oid) const
+{
+	ULONG *value = GPOS_NEW(m_mp) ULONG(oid);
+	if (!oid_set->Insert(value))
+	{
+		GPOS_DELETE(value);
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCacheInvalidation::FHashInvalidated
+//
+//	@doc:
+//		Is the given hash value invalidated in the given syscache?
+//
+//---------------------------------------------------------------------------
+BOOL
+CMDCacheInvalidation::FHashInvalidated(int cache_id, uint32 hash_value) const
+{
+	for (ULONG ul = 0; ul < m_num_invalidations; ul++)
+	{
+		if (m_invalidations[ul].m_cacheid == cache_id &&
+			m_invalidations[ul].m_hashvalue == hash_value)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCacheInvalidation::FKeyInvalidated
+//
+//	@doc:
+//		Is the syscache entry with the given key invalidated?
+//
+//---------------------------------------------------------------------------
+BOOL
+CMDCacheInvalidation::FKeyInvalidated(int cache_id, Datum key1, Datum key2,
+									  Datum key3) const
+{
+	if (!m_has_syscache_inval[cache_id])
+	{
+		return false;
+	}
+
+	return FHashInvalidated(
+		cache_id, gpdb::GetSysCacheHashValue(cache_id, key1, key2, key3));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCacheInvalidation::FColStatsInvalidated
+//
+//	@doc:
+//		Did pg_statistic change for any column of the given relation?
+//
+//---------------------------------------------------------------------------
+BOOL
+CMDCacheInvalidation::FColStatsInvalidated(OID rel_oid,
+										   const IMDCacheObject *md_obj) const
+{
+	if (!m_has_syscache_inval[STATRELATTINH])
+	{
+		return false;
+	}
+
+	const IMDRelation *md_rel = dynamic_cast<const IMDRelation *>(md_obj);
+	GPOS_ASSERT(NULL != md_rel);
+
+	const ULONG num_cols = md_rel->ColumnCount();
+	for (ULONG ul = 0; ul < num_cols; ul++)
+	{
+		Datum attno = Int16GetDatum((AttrNumber) md_rel->GetMdCol(ul)->AttrNum());
+		if (FKeyInvalidated(STATRELATTINH, ObjectIdGetDatum(rel_oid), attno,
+							BoolGetDatum(false)) ||
+			FKeyInvalidated(STATRELATTINH, ObjectIdGetDatum(rel_oid), attno,
+							BoolGetDatum(true)))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCacheInvalidation::GetCatalogKeys
+//
+//	@doc:
+//		Catalog entries the given object is built from
+//
+//---------------------------------------------------------------------------
+ULONG
+CMDCacheInvalidation::GetCatalogKeys(
+	const IMDId *mdid, const IMDCacheObject *md_obj,
+	SCatalogKey keys[GPOPT_MDCACHE_MAX_CATALOG_KEYS])
+{
+	for (ULONG ul = 0; ul < GPOPT_MDCACHE_MAX_CATALOG_KEYS; ul++)
+	{
+		keys[ul].m_cache_id = -1;
+		keys[ul].m_keys[0] = keys[ul].m_keys[1] = keys[ul].m_keys[2] = 0;
+		keys[ul].m_any = false;
+	}
+
+	switch (md_obj->MDType())
+	{
+		case IMDCacheObject::EmdtRel:
+		case IMDCacheObject::EmdtInd:
+			keys[0].m_keys[0] =
+				ObjectIdGetDatum(CMDIdGPDB::CastMdid(mdid)->Oid());
+			return 1;
+
+		case IMDCacheObject::EmdtTrigger:
+			// triggers are reported through the relcache of their table
+			keys[0].m_any = true;
+			return 1;
+
+		case IMDCacheObject::EmdtType:
+			keys[0].m_cache_id = TYPEOID;
+			keys[0].m_keys[0] =
+				ObjectIdGetDatum(CMDIdGPDB::CastMdid(mdid)->Oid());
+			return 1;
+
+		case IMDCacheObject::EmdtOp:
+			keys[0].m_cache_id = OPEROID;
+			keys[0].m_keys[0] =
+				ObjectIdGetDatum(CMDIdGPDB::CastMdid(mdid)->Oid());
+			return 1;
+
+		case IMDCacheObject::EmdtFunc:
+			keys[0].m_cache_id = PROCOID;
+			keys[0].m_keys[0] =
+				ObjectIdGetDatum(CMDIdGPDB::CastMdid(mdid)->Oid());
+			return 1;
+
+		case IMDCacheObject::EmdtAgg:
+			keys[0].m_cache_id = AGGFNOID;
+			keys[0].m_keys[0] =
+				ObjectIdGetDatum(CMDIdGPDB::CastMdid(mdid)->Oid());
+			keys[1].m_cache_id = PROCOID;
+			keys[1].m_keys[0] = keys[0].m_keys[0];
+			return 2;
+
+		case IMDCacheObject::EmdtCheckConstraint:
+			keys[0].m_cache_id = CONSTROID;
+			keys[0].m_keys[0] =
+				ObjectIdGetDatum(CMDIdGPDB::CastMdid(mdid)->Oid());
+			return 1;
+
+		case IMDCacheObject::EmdtCastFunc:
+		{
+			const CMDIdCast *mdid_cast = CMDIdCast::CastMdid(mdid);
+			keys[0].m_cache_id = CASTSOURCETARGET;
+			keys[0].m_keys[0] = ObjectIdGetDatum(
+				CMDIdGPDB::CastMdid(mdid_cast->MdidSrc())->Oid());
+			keys[0].m_keys[1] = ObjectIdGetDatum(
+				CMDIdGPDB::CastMdid(mdid_cast->MdidDest())->Oid());
+			return 1;
+		}
+
+		case IMDCacheObject::EmdtScCmp:
+			// comparisons are looked up through operators and their families
+			keys[0].m_cache_id = OPEROID;
+			keys[0].m_any = true;
+			return 1;
+
+		case IMDCacheObject::EmdtRelStats:
+		case IMDCacheObject::EmdtColStats:
+		case IMDCacheObject::EmdtExtStats:
+			return 0;
+
+		default:
+			return gpos::ulong_max;
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCacheInvalidation::FObjInvalidated
+//
+//	@doc:
+//		Is the given object invalidated directly by its own catalog row?
+//		Objects of unknown kind are conservatively considered invalidated.
+//		Statistics are handled in the second pass.
+//
+//---------------------------------------------------------------------------
+BOOL
+CMDCacheInvalidation::FObjInvalidated(const IMDId *mdid,
+									  const IMDCacheObject *md_obj) const
+{
+	SCatalogKey keys[GPOPT_MDCACHE_MAX_CATALOG_KEYS];
+	const ULONG num_keys = GetCatalogKeys(mdid, md_obj, keys);
+	if (gpos::ulong_max == num_keys)
+	{
+		return true;
+	}
+
+	for (ULONG ul = 0; ul < num_keys; ul++)
+	{
+		const SCatalogKey *key = &keys[ul];
+		if (0 > key->m_cache_id)
+		{
+			ULONG oid = DatumGetObjectId(key->m_keys[0]);
+			if ((key->m_any && 0 < m_invalidated_rels->Size()) ||
+				(!key->m_any && m_invalidated_rels->Contains(&oid)))
+			{
+				return true;
+			}
+		}
+		else if ((key->m_any && m_has_syscache_inval[key->m_cache_id]) ||
+				 (!key->m_any &&
+				  FKeyInvalidated(key->m_cache_id, key->m_keys[0],
+								  key->m_keys[1], key->m_keys[2])))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCacheInvalidation::FEvictObject
+//
+//	@doc:
+//		First pass predicate; selects relations, indexes and objects keyed by
+//		their own catalog row, and remembers the relations whose statistics
+//		must go in the second pass
+//
+//---------------------------------------------------------------------------
+BOOL
+CMDCacheInvalidation::FEvictObject(CMDKey *const &mdkey,
+								   IMDCacheObject *md_obj, void *arg)
+{
+	CMDCacheInvalidation *inval = static_cast<CMDCacheInvalidation *>(arg);
+	const IMDId *mdid = mdkey->MDId();
+
+	if (IMDCacheObject::EmdtRel == md_obj->MDType())
+	{
+		OID rel_oid = CMDIdGPDB::CastMdid(mdid)->Oid();
+		inval->AddOid(inval->m_cached_rels, rel_oid);
+
+		if (inval->FObjInvalidated(mdid, md_obj) ||
+			inval->FColStatsInvalidated(rel_oid, md_obj))
+		{
+			inval->AddOid(inval->m_stats_rels, rel_oid);
+			return true;
+		}
+
+		return false;
+	}
+
+	return inval->FObjInvalidated(mdid, md_obj);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCacheInvalidation::FEvictStats
+//
+//	@doc:
+//		Second pass predicate; selects statistics of the relations evicted
+//		in the first pass. If pg_statistic changed, column statistics whose
+//		relation is not cached cannot be matched and are evicted as well.
+//		Column groups may be stored with any column of the relation, so
+//		they are evicted on any change of pg_statistic.
+//
+//---------------------------------------------------------------------------
+BOOL
+CMDCacheInvalidation::FEvictStats(CMDKey *const &mdkey, IMDCacheObject *md_obj,
+								  void *arg)
+{
+	CMDCacheInvalidation *inval = static_cast<CMDCacheInvalidation *>(arg);
+	const IMDId *mdid = mdkey->MDId();
+
+	ULONG rel_oid = 0;
+	switch (md_obj->MDType())
+	{
+		case IMDCacheObject::EmdtRelStats:
+			rel_oid = CMDIdGPDB::CastMdid(
+						  CMDIdRelStats::CastMdid(mdid)->GetRelMdId())
+						  ->Oid();
+			break;
+
+		case IMDCacheObject::EmdtColStats:
+			rel_oid = CMDIdGPDB::CastMdid(
+						  CMDIdColStats::CastMdid(mdid)->GetRelMdId())
+						  ->Oid();
+			if (inval->m_has_syscache_inval[STATRELATTINH] &&
+				!inval->m_cached_rels->Contains(&rel_oid))
+			{
+				return true;
+			}
+			break;
+
+		case IMDCacheObject::EmdtExtStats:
+			if (inval->m_has_syscache_inval[STATRELATTINH])
+			{
+				return true;
+			}
+			rel_oid = CMDIdGPDB::CastMdid(
+						  CMDIdExtStats::CastMdid(mdid)->GetRelMdId())
+						  ->Oid();
+			break;
+
+		default:
+			return false;
+	}
+
+	return inval->m_stats_rels->Contains(&rel_oid) ||
+		   inval->m_invalidated_rels->Contains(&rel_oid);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCacheInvalidation::Evict
+//
+//	@doc:
+//		Evict affected objects from the metadata cache; returns their number
+//
+//---------------------------------------------------------------------------
+ULONG
+CMDCacheInvalidation::Evict()
+{
+	ULONG num_evicted = CMDCache::Evict(FEvictObject, this);
+	num_evicted += CMDCache::Evict(FEvictStats, this);
+
+	return num_evicted;
+}
+
+// EOF
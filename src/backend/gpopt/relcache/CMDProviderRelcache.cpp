@@ -16,7 +16,13 @@
 
 extern "C" {
 #include "postgres.h"
+
+#include "utils/guc.h"
 }
+#include "gpos/common/CAutoRg.h"
+#include "gpos/common/CWallClock.h"
+
+#include "gpopt/gpdbwrappers.h"
 #include "gpopt/mdcache/CMDAccessor.h"
 #include "gpopt/relcache/CMDProviderRelcache.h"
 #include "gpopt/translate/CTranslatorRelcacheToDXL.h"
@@ -27,9 +33,239 @@ using namespace gpos;
 using namespace gpdxl;
 using namespace gpmd;
 
-CMDProviderRelcache::CMDProviderRelcache(CMemoryPool *mp) : m_mp(mp)
+// encodings of DXL strings in the shared metadata cache; DXL is mostly
+// ASCII, which is stored one byte per character
+#define GPOPT_SHARED_MDCACHE_ASCII 'a'
+#define GPOPT_SHARED_MDCACHE_WIDE 'w'
+
+// names of the object types in the retrieval stats
+static const CHAR *rgszObjectTypes[] = {
+	"relation",		  "index",		  "function",	"aggregate",
+	"operator",		  "type",		  "trigger",	"check constraint",
+	"relation stats", "column stats", "cast",		"comparison",
+	"extended stats", "other"};
+GPOS_CPL_ASSERT(IMDCacheObject::EmdtSentinel + 1 ==
+				GPOS_ARRAY_SIZE(rgszObjectTypes));
+
+CMDProviderRelcache::CMDProviderRelcache(CMemoryPool *mp)
+	: m_mp(mp),
+	  m_shared_cache_generation(gpdb::MDSharedCacheGeneration()),
+	  m_rel_num_rows(NULL)
 {
 	GPOS_ASSERT(NULL != m_mp);
+
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(m_retrieval_stats); ul++)
+	{
+		m_retrieval_stats[ul].m_num_objects = 0;
+		m_retrieval_stats[ul].m_total_us = 0;
+		m_retrieval_stats[ul].m_max_us = 0;
+		m_retrieval_stats[ul].m_max_mdid = NULL;
+	}
+
+	m_rel_num_rows = GPOS_NEW(m_mp) UlongToDoubleMap(m_mp);
+}
+
+CMDProviderRelcache::~CMDProviderRelcache()
+{
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(m_retrieval_stats); ul++)
+	{
+		CRefCount::SafeRelease(m_retrieval_stats[ul].m_max_mdid);
+	}
+
+	m_rel_num_rows->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDProviderRelcache::RecordRetrieval
+//
+//	@doc:
+//		Record the time it took to retrieve an object from the relcache
+//
+//---------------------------------------------------------------------------
+void
+CMDProviderRelcache::RecordRetrieval(IMDId *mdid,
+									 IMDCacheObject::Emdtype mdtype,
+									 ULONG elapsed_us) const
+{
+	GPOS_ASSERT(IMDCacheObject::EmdtSentinel >= mdtype);
+
+	SRetrievalStats *stats = &m_retrieval_stats[mdtype];
+	stats->m_num_objects++;
+	stats->m_total_us += elapsed_us;
+	if (NULL == stats->m_max_mdid || elapsed_us > stats->m_max_us)
+	{
+		mdid->AddRef();
+		CRefCount::SafeRelease(stats->m_max_mdid);
+		stats->m_max_mdid = mdid;
+		stats->m_max_us = elapsed_us;
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDProviderRelcache::OsPrintRetrievalStats
+//
+//	@doc:
+//		Print the number of objects of each type retrieved from the relcache,
+//		the time it took, and the slowest object
+//
+//---------------------------------------------------------------------------
+IOstream &
+CMDProviderRelcache::OsPrintRetrievalStats(IOstream &os) const
+{
+	ULONG num_objects = 0;
+	ULLONG total_us = 0;
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(m_retrieval_stats); ul++)
+	{
+		const SRetrievalStats *stats = &m_retrieval_stats[ul];
+		if (0 == stats->m_num_objects)
+		{
+			continue;
+		}
+
+		num_objects += stats->m_num_objects;
+		total_us += stats->m_total_us;
+
+		os << "[OPT]: Metadata retrieval: " << rgszObjectTypes[ul] << ": "
+		   << stats->m_num_objects << " objects in " << stats->m_total_us
+		   << " us, slowest ";
+		stats->m_max_mdid->OsPrint(os);
+		os << " in " << stats->m_max_us << " us" << std::endl;
+	}
+
+	os << "[OPT]: Metadata retrieval: total: " << num_objects
+	   << " objects in " << total_us << " us" << std::endl;
+
+	return os;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDProviderRelcache::SharedCacheKey
+//
+//	@doc:
+//		Returns the key of the given object in the shared metadata cache, or
+//		NULL if the object cannot be shared. The key includes the settings
+//		that the translation of the object depends on.
+//
+//---------------------------------------------------------------------------
+CHAR *
+CMDProviderRelcache::SharedCacheKey(CMemoryPool *mp, IMDId *mdid,
+									ULONG *key_len)
+{
+	// CTAS objects have a fixed id, see CMDAccessor::GetImdObj
+	if (IMDId::EmdidGPDBCtas == mdid->MdidType())
+	{
+		return NULL;
+	}
+
+	const WCHAR *mdid_str = mdid->GetBuffer();
+	const ULONG mdid_len = GPOS_WSZ_LENGTH(mdid_str);
+
+	CHAR *key = GPOS_NEW_ARRAY(mp, CHAR, mdid_len + 1);
+	key[0] = optimizer_multilevel_partitioning ? 'm' : 's';
+	for (ULONG ul = 0; ul < mdid_len; ul++)
+	{
+		if (0x80 <= mdid_str[ul])
+		{
+			GPOS_DELETE_ARRAY(key);
+			return NULL;
+		}
+		key[ul + 1] = (CHAR) mdid_str[ul];
+	}
+
+	*key_len = mdid_len + 1;
+	return key;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDProviderRelcache::LookupSharedCache
+//
+//	@doc:
+//		Returns the DXL of an object from the shared metadata cache, or NULL
+//		if it is not there
+//
+//---------------------------------------------------------------------------
+CWStringBase *
+CMDProviderRelcache::LookupSharedCache(const CHAR *key, ULONG key_len) const
+{
+	uint32 data_len = 0;
+	CHAR *data = gpdb::MDSharedCacheLookup(key, key_len, &data_len);
+	if (NULL == data)
+	{
+		return NULL;
+	}
+
+	GPOS_ASSERT(0 < data_len);
+
+	ULONG length = 0;
+	CAutoRg<WCHAR> a_wsz;
+	if (GPOPT_SHARED_MDCACHE_ASCII == data[0])
+	{
+		length = data_len - 1;
+		a_wsz = GPOS_NEW_ARRAY(m_mp, WCHAR, length + 1);
+		for (ULONG ul = 0; ul < length; ul++)
+		{
+			a_wsz[ul] = (WCHAR) data[ul + 1];
+		}
+	}
+	else
+	{
+		GPOS_ASSERT(GPOPT_SHARED_MDCACHE_WIDE == data[0]);
+
+		length = (data_len - 1) / GPOS_SIZEOF(WCHAR);
+		a_wsz = GPOS_NEW_ARRAY(m_mp, WCHAR, length + 1);
+		clib::Memcpy(a_wsz.Rgt(), data + 1, length * GPOS_SIZEOF(WCHAR));
+	}
+	a_wsz[length] = WCHAR_EOS;
+	gpdb::GPDBFree(data);
+
+	return GPOS_NEW(m_mp) CWStringDynamic(m_mp, a_wsz.Rgt());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDProviderRelcache::PublishSharedCache
+//
+//	@doc:
+//		Publishes the DXL of an object in the shared metadata cache
+//
+//---------------------------------------------------------------------------
+void
+CMDProviderRelcache::PublishSharedCache(const CHAR *key, ULONG key_len,
+										const CWStringBase *str) const
+{
+	const WCHAR *wsz = str->GetBuffer();
+	const ULONG length = str->Length();
+
+	BOOL is_ascii = true;
+	for (ULONG ul = 0; is_ascii && ul < length; ul++)
+	{
+		is_ascii = 0x80 > wsz[ul];
+	}
+
+	const ULONG data_len =
+		1 + (is_ascii ? length : length * GPOS_SIZEOF(WCHAR));
+	CAutoRg<CHAR> a_data;
+	a_data = GPOS_NEW_ARRAY(m_mp, CHAR, data_len);
+	if (is_ascii)
+	{
+		a_data[0] = GPOPT_SHARED_MDCACHE_ASCII;
+		for (ULONG ul = 0; ul < length; ul++)
+		{
+			a_data[ul + 1] = (CHAR) wsz[ul];
+		}
+	}
+	else
+	{
+		a_data[0] = GPOPT_SHARED_MDCACHE_WIDE;
+		clib::Memcpy(a_data.Rgt() + 1, wsz, length * GPOS_SIZEOF(WCHAR));
+	}
+
+	gpdb::MDSharedCacheInsert(key, key_len, a_data.Rgt(), data_len,
+							  m_shared_cache_generation);
 }
 
 //---------------------------------------------------------------------------
@@ -37,7 +273,10 @@ CMDProviderRelcache::CMDProviderRelcache(CMemoryPool *mp) : m_mp(mp)
 //		CMDProviderRelcache::GetMDObjDXLStr
 //
 //	@doc:
-//		Returns the DXL of the requested object in the provided memory pool
+//		Returns the DXL of the requested object in the provided memory pool.
+//		The shared metadata cache, if enabled, is consulted before the
+//		relcache, and objects retrieved from the relcache are published in
+//		it.
 //
 //---------------------------------------------------------------------------
 CWStringBase *
@@ -45,8 +284,26 @@ CMDProviderRelcache::GetMDObjDXLStr(CMemoryPool *mp, CMDAccessor *md_accessor,
 									IMDId *md_id,
 									IMDCacheObject::Emdtype mdtype) const
 {
+	ULONG key_len = 0;
+	CAutoRg<CHAR> a_key;
+	if (0 != m_shared_cache_generation)
+	{
+		a_key = SharedCacheKey(m_mp, md_id, &key_len);
+	}
+
+	if (NULL != a_key.Rgt())
+	{
+		CWStringBase *str = LookupSharedCache(a_key.Rgt(), key_len);
+		if (NULL != str)
+		{
+			return str;
+		}
+	}
+
+	CWallClock timer;
 	IMDCacheObject *md_obj = CTranslatorRelcacheToDXL::RetrieveObject(
-		mp, md_accessor, md_id, mdtype);
+		mp, md_accessor, md_id, mdtype, m_rel_num_rows);
+	RecordRetrieval(md_id, mdtype, timer.ElapsedUS());
 
 	GPOS_ASSERT(NULL != md_obj);
 
@@ -56,6 +313,11 @@ CMDProviderRelcache::GetMDObjDXLStr(CMemoryPool *mp, CMDAccessor *md_accessor,
 	// cleanup DXL object
 	md_obj->Release();
 
+	if (NULL != a_key.Rgt())
+	{
+		PublishSharedCache(a_key.Rgt(), key_len, str);
+	}
+
 	return str;
 }
 
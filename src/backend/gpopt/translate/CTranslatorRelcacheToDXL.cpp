@@ -49,11 +49,13 @@ extern "C" {
 #include "naucrates/dxl/xml/dxltokens.h"
 #include "naucrates/exception.h"
 #include "naucrates/md/CDXLColStats.h"
+#include "naucrates/md/CDXLExtStats.h"
 #include "naucrates/md/CDXLRelStats.h"
 #include "naucrates/md/CMDArrayCoerceCastGPDB.h"
 #include "naucrates/md/CMDCastGPDB.h"
 #include "naucrates/md/CMDIdCast.h"
 #include "naucrates/md/CMDIdColStats.h"
+#include "naucrates/md/CMDIdExtStats.h"
 #include "naucrates/md/CMDIdRelStats.h"
 #include "naucrates/md/CMDIdScCmp.h"
 #include "naucrates/md/CMDIndexGPDB.h"
@@ -65,6 +67,7 @@ extern "C" {
 #include "naucrates/md/CMDTypeInt4GPDB.h"
 #include "naucrates/md/CMDTypeInt8GPDB.h"
 #include "naucrates/md/CMDTypeOidGPDB.h"
+#include "naucrates/statistics/CHLLSketch.h"
 
 using namespace gpdxl;
 using namespace gpopt;
@@ -113,7 +116,8 @@ GetIndexTypeFromOid(OID index_oid)
 IMDCacheObject *
 CTranslatorRelcacheToDXL::RetrieveObject(CMemoryPool *mp,
 										 CMDAccessor *md_accessor, IMDId *mdid,
-										 IMDCacheObject::Emdtype mdtype)
+										 IMDCacheObject::Emdtype mdtype,
+										 UlongToDoubleMap *rel_num_rows)
 {
 	IMDCacheObject *md_obj = NULL;
 	GPOS_ASSERT(NULL != md_accessor);
@@ -129,11 +133,15 @@ CTranslatorRelcacheToDXL::RetrieveObject(CMemoryPool *mp,
 			break;
 
 		case IMDId::EmdidRelStats:
-			md_obj = RetrieveRelStats(mp, mdid);
+			md_obj = RetrieveRelStats(mp, mdid, rel_num_rows);
 			break;
 
 		case IMDId::EmdidColStats:
-			md_obj = RetrieveColStats(mp, md_accessor, mdid);
+			md_obj = RetrieveColStats(mp, md_accessor, mdid, rel_num_rows);
+			break;
+
+		case IMDId::EmdidExtStats:
+			md_obj = RetrieveExtStats(mp, mdid, rel_num_rows);
 			break;
 
 		case IMDId::EmdidCastFunc:
@@ -2265,6 +2273,42 @@ CTranslatorRelcacheToDXL::RetrieveAggIntermediateResultType(CMemoryPool *mp,
 	return GPOS_NEW(mp) CMDIdGPDB(IMDId::EmdidGeneral, intermediate_type_oid);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::EstimateNumRows
+//
+//	@doc:
+//		Estimate the number of rows of a relation. For a partitioned table
+//		without a row count of its own, the estimate sums up the row counts
+//		of all leaf partitions, so it is recorded in the given map, if any,
+//		and reused for every statistics object of the same relation
+//
+//---------------------------------------------------------------------------
+double
+CTranslatorRelcacheToDXL::EstimateNumRows(CMemoryPool *mp, Relation rel,
+										  UlongToDoubleMap *rel_num_rows)
+{
+	ULONG rel_oid = RelationGetRelid(rel);
+	if (NULL != rel_num_rows)
+	{
+		const CDouble *num_rows = rel_num_rows->Find(&rel_oid);
+		if (NULL != num_rows)
+		{
+			return num_rows->Get();
+		}
+	}
+
+	double num_rows = gpdb::CdbEstimatePartitionedNumTuples(rel);
+
+	if (NULL != rel_num_rows)
+	{
+		rel_num_rows->Insert(GPOS_NEW(mp) ULONG(rel_oid),
+							 GPOS_NEW(mp) CDouble(num_rows));
+	}
+
+	return num_rows;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CTranslatorRelcacheToDXL::RetrieveRelStats
@@ -2274,7 +2318,8 @@ CTranslatorRelcacheToDXL::RetrieveAggIntermediateResultType(CMemoryPool *mp,
 //
 //---------------------------------------------------------------------------
 IMDCacheObject *
-CTranslatorRelcacheToDXL::RetrieveRelStats(CMemoryPool *mp, IMDId *mdid)
+CTranslatorRelcacheToDXL::RetrieveRelStats(CMemoryPool *mp, IMDId *mdid,
+										   UlongToDoubleMap *rel_num_rows)
 {
 	CMDIdRelStats *m_rel_stats_mdid = CMDIdRelStats::CastMdid(mdid);
 	IMDId *mdid_rel = m_rel_stats_mdid->GetRelMdId();
@@ -2302,7 +2347,7 @@ CTranslatorRelcacheToDXL::RetrieveRelStats(CMemoryPool *mp, IMDId *mdid)
 		// CMDName ctor created a copy of the string
 		GPOS_DELETE(relname_str);
 
-		num_rows = gpdb::CdbEstimatePartitionedNumTuples(rel);
+		num_rows = EstimateNumRows(mp, rel, rel_num_rows);
 
 		relpages = rel->rd_rel->relpages;
 		relallvisible = rel->rd_rel->relallvisible;
@@ -2334,6 +2379,142 @@ CTranslatorRelcacheToDXL::RetrieveRelStats(CMemoryPool *mp, IMDId *mdid)
 	return dxl_rel_stats;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::RetrieveExtStats
+//
+//	@doc:
+//		Retrieve the extended statistics of a relation: the statistics of the
+//		column groups stored by ANALYZE on the first column of each group
+//
+//---------------------------------------------------------------------------
+IMDCacheObject *
+CTranslatorRelcacheToDXL::RetrieveExtStats(CMemoryPool *mp, IMDId *mdid,
+										   UlongToDoubleMap *rel_num_rows)
+{
+	CMDIdExtStats *ext_stats_mdid = CMDIdExtStats::CastMdid(mdid);
+	IMDId *mdid_rel = ext_stats_mdid->GetRelMdId();
+	OID rel_oid = CMDIdGPDB::CastMdid(mdid_rel)->Oid();
+
+	Relation rel = gpdb::GetRelation(rel_oid);
+	if (NULL == rel)
+	{
+		GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDCacheEntryNotFound,
+				   mdid->GetBuffer());
+	}
+
+	CMDName *mdname = NULL;
+	CDXLColumnGroupStatsArray *column_groups =
+		GPOS_NEW(mp) CDXLColumnGroupStatsArray(mp);
+
+	GPOS_TRY
+	{
+		// get rel name
+		CHAR *relname = NameStr(rel->rd_rel->relname);
+		CWStringDynamic *relname_str =
+			CDXLUtils::CreateDynamicStringFromCharArray(mp, relname);
+		mdname = GPOS_NEW(mp) CMDName(mp, relname_str);
+		// CMDName ctor created a copy of the string
+		GPOS_DELETE(relname_str);
+
+		double num_rows = EstimateNumRows(mp, rel, rel_num_rows);
+
+		for (ULONG ul = 0; ul < (ULONG) rel->rd_att->natts; ul++)
+		{
+			Form_pg_attribute att = rel->rd_att->attrs[ul];
+			if (att->attisdropped)
+			{
+				continue;
+			}
+
+			CDXLColumnGroupStats *column_group =
+				RetrieveColumnGroupStats(mp, rel_oid, att->attnum, num_rows);
+			if (NULL != column_group)
+			{
+				column_groups->Append(column_group);
+			}
+		}
+
+		gpdb::CloseRelation(rel);
+	}
+	GPOS_CATCH_EX(ex)
+	{
+		gpdb::CloseRelation(rel);
+		GPOS_DELETE(mdname);
+		column_groups->Release();
+		GPOS_RETHROW(ex);
+	}
+	GPOS_CATCH_END;
+
+	ext_stats_mdid->AddRef();
+
+	return GPOS_NEW(mp)
+		CDXLExtStats(mp, ext_stats_mdid, mdname, column_groups);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::RetrieveColumnGroupStats
+//
+//	@doc:
+//		Retrieve the statistics of the column group stored on the given
+//		column, NULL if there are none
+//
+//---------------------------------------------------------------------------
+CDXLColumnGroupStats *
+CTranslatorRelcacheToDXL::RetrieveColumnGroupStats(CMemoryPool *mp,
+												   OID rel_oid,
+												   AttrNumber attno,
+												   double num_rows)
+{
+	HeapTuple stats_tup = gpdb::GetAttStats(rel_oid, attno);
+	if (!HeapTupleIsValid(stats_tup))
+	{
+		return NULL;
+	}
+
+	CDXLColumnGroupStats *column_group = NULL;
+	AttStatsSlot group_slot;
+
+	if (gpdb::GetAttrStatsSlot(&group_slot, stats_tup,
+							   STATISTIC_KIND_NDISTINCT_GROUP, InvalidOid,
+							   ATTSTATSSLOT_NUMBERS))
+	{
+		// the numbers are the number of distinct values, the attribute
+		// numbers of the columns and their dependency degrees
+		const int num_cols = (group_slot.nnumbers - 1) / 2;
+		if (2 <= num_cols && group_slot.nnumbers == 2 * num_cols + 1)
+		{
+			IntPtrArray *attnos = GPOS_NEW(mp) IntPtrArray(mp);
+			CDynamicPtrArray<CDouble, CleanupDelete> *dependency_degrees =
+				GPOS_NEW(mp) CDynamicPtrArray<CDouble, CleanupDelete>(mp);
+			for (int i = 0; i < num_cols; i++)
+			{
+				attnos->Append(
+					GPOS_NEW(mp) INT((INT) group_slot.numbers[1 + i]));
+				dependency_degrees->Append(GPOS_NEW(mp) CDouble(
+					group_slot.numbers[1 + num_cols + i]));
+			}
+
+			CDouble num_distinct(group_slot.numbers[0]);
+			if (0 > group_slot.numbers[0])
+			{
+				num_distinct = CDouble(-group_slot.numbers[0]) * num_rows;
+			}
+			num_distinct = std::max(1.0, num_distinct.Ceil().Get());
+
+			column_group = GPOS_NEW(mp)
+				CDXLColumnGroupStats(attnos, num_distinct, dependency_degrees);
+		}
+
+		gpdb::FreeAttrStatsSlot(&group_slot);
+	}
+
+	gpdb::FreeHeapTuple(stats_tup);
+
+	return column_group;
+}
+
 // Retrieve column statistics from relcache
 // If all statistics are missing, create dummy statistics
 // Also, if the statistics are broken, create dummy statistics
@@ -2342,7 +2523,8 @@ CTranslatorRelcacheToDXL::RetrieveRelStats(CMemoryPool *mp, IMDId *mdid)
 IMDCacheObject *
 CTranslatorRelcacheToDXL::RetrieveColStats(CMemoryPool *mp,
 										   CMDAccessor *md_accessor,
-										   IMDId *mdid)
+										   IMDId *mdid,
+										   UlongToDoubleMap *rel_num_rows)
 {
 	CMDIdColStats *mdid_col_stats = CMDIdColStats::CastMdid(mdid);
 	IMDId *mdid_rel = mdid_col_stats->GetRelMdId();
@@ -2363,7 +2545,7 @@ CTranslatorRelcacheToDXL::RetrieveColStats(CMemoryPool *mp,
 	// number of rows from pg_class
 	double num_rows;
 
-	num_rows = gpdb::CdbEstimatePartitionedNumTuples(rel);
+	num_rows = EstimateNumRows(mp, rel, rel_num_rows);
 
 	// extract column name and type
 	CMDName *md_colname =
@@ -2561,14 +2743,16 @@ CTranslatorRelcacheToDXL::RetrieveColStats(CMemoryPool *mp,
 	gpdb::FreeAttrStatsSlot(&mcv_slot);
 	gpdb::FreeAttrStatsSlot(&hist_slot);
 
+	CHLLSketch *hll_sketch = RetrieveHLLSketch(mp, stats_tup);
+
 	gpdb::FreeHeapTuple(stats_tup);
 
 	// create col stats object
 	mdid_col_stats->AddRef();
 	CDXLColStats *dxl_col_stats = GPOS_NEW(mp) CDXLColStats(
 		mp, mdid_col_stats, md_colname, width, null_freq, distinct_remaining,
-		freq_remaining, dxl_stats_bucket_array, false /* is_col_stats_missing */
-	);
+		freq_remaining, dxl_stats_bucket_array, false /* is_col_stats_missing */,
+		hll_sketch);
 
 	return dxl_col_stats;
 }
@@ -2642,7 +2826,72 @@ CTranslatorRelcacheToDXL::GenerateStatsForSystemCols(
 
 	return GPOS_NEW(mp) CDXLColStats(
 		mp, mdid_col_stats, md_colname, width, null_freq, distinct_remaining,
-		freq_remaining, dxl_stats_bucket_array, is_col_stats_missing);
+		freq_remaining, dxl_stats_bucket_array, is_col_stats_missing,
+		NULL /* hll_sketch */);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorRelcacheToDXL::RetrieveHLLSketch
+//
+//	@doc:
+//		Retrieve the HyperLogLog counter that ANALYZE stores for leaf
+//		partitions and partitioned tables, preferring the counter of a full
+//		scan over the counter of the sample. The registers are folded to
+//		CHLLSketch::DefaultPrecision to keep the metadata small. Returns NULL
+//		if the column has no counter.
+//
+//---------------------------------------------------------------------------
+CHLLSketch *
+CTranslatorRelcacheToDXL::RetrieveHLLSketch(CMemoryPool *mp,
+											HeapTuple stats_tup)
+{
+	AttStatsSlot hll_slot;
+
+	(void) gpdb::GetAttrStatsSlot(&hll_slot, stats_tup, STATISTIC_KIND_FULLHLL,
+								  InvalidOid, ATTSTATSSLOT_VALUES);
+	if (0 == hll_slot.nvalues)
+	{
+		gpdb::FreeAttrStatsSlot(&hll_slot);
+		(void) gpdb::GetAttrStatsSlot(&hll_slot, stats_tup,
+									  STATISTIC_KIND_HLL, InvalidOid,
+									  ATTSTATSSLOT_VALUES);
+	}
+
+	if (0 == hll_slot.nvalues)
+	{
+		gpdb::FreeAttrStatsSlot(&hll_slot);
+		return NULL;
+	}
+
+	int precision = 0;
+	char *registers = gpdb::GetHLLRegisters(hll_slot.values[0], &precision);
+	gpdb::FreeAttrStatsSlot(&hll_slot);
+
+	if ((int) CHLLSketch::MinPrecision > precision ||
+		(int) CHLLSketch::MaxPrecision < precision)
+	{
+		gpdb::GPDBFree(registers);
+		return NULL;
+	}
+
+	const ULONG size = ULONG(1) << precision;
+	BYTE *sketch_registers = GPOS_NEW_ARRAY(mp, BYTE, size);
+	clib::Memcpy(sketch_registers, registers, size);
+	gpdb::GPDBFree(registers);
+
+	CHLLSketch *hll_sketch =
+		GPOS_NEW(mp) CHLLSketch(mp, (ULONG) precision, sketch_registers);
+	if (CHLLSketch::DefaultPrecision < hll_sketch->Precision())
+	{
+		CHLLSketch *folded_sketch =
+			hll_sketch->MakeSketchFolded(mp, CHLLSketch::DefaultPrecision);
+		hll_sketch->Release();
+		hll_sketch = folded_sketch;
+	}
+
+	return hll_sketch;
 }
 
 
@@ -52,25 +52,16 @@ CConstExprEvaluatorProxy::CEmptyMappingColIdVar::VarFromDXLNodeScId(
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CConstExprEvaluatorProxy::EvaluateExpr
+//		CConstExprEvaluatorProxy::TranslateResultToDXL
 //
 //	@doc:
-//		Evaluate 'expr', assumed to be a constant expression, and return the DXL representation
-// 		of the result. Caller keeps ownership of 'expr' and takes ownership of the returned pointer.
+//		Translate the result of evaluating a constant expression to DXL.
+//		Raises an exception if the result is not a Const.
 //
 //---------------------------------------------------------------------------
 CDXLNode *
-CConstExprEvaluatorProxy::EvaluateExpr(const CDXLNode *dxl_expr)
+CConstExprEvaluatorProxy::TranslateResultToDXL(Expr *result)
 {
-	// Translate DXL -> GPDB Expr
-	Expr *expr = m_dxl2scalar_translator.TranslateDXLToScalar(
-		dxl_expr, &m_emptymapcidvar);
-	GPOS_ASSERT(NULL != expr);
-
-	// Evaluate the expression
-	Expr *result = gpdb::EvaluateExpr(expr, gpdb::ExprType((Node *) expr),
-									  gpdb::ExprTypeMod((Node *) expr));
-
 	if (!IsA(result, Const))
 	{
 #ifdef GPOS_DEBUG
@@ -85,12 +76,86 @@ CConstExprEvaluatorProxy::EvaluateExpr(const CDXLNode *dxl_expr)
 	Const *const_result = (Const *) result;
 	CDXLDatum *datum_dxl = CTranslatorScalarToDXL::TranslateConstToDXL(
 		m_mp, m_md_accessor, const_result);
-	CDXLNode *dxl_result = GPOS_NEW(m_mp)
+	return GPOS_NEW(m_mp)
 		CDXLNode(m_mp, GPOS_NEW(m_mp) CDXLScalarConstValue(m_mp, datum_dxl));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorProxy::EvaluateExpr
+//
+//	@doc:
+//		Evaluate 'expr', assumed to be a constant expression, and return the DXL representation
+// 		of the result. Caller keeps ownership of 'expr' and takes ownership of the returned pointer.
+//
+//---------------------------------------------------------------------------
+CDXLNode *
+CConstExprEvaluatorProxy::EvaluateExpr(const CDXLNode *dxl_expr)
+{
+	// Translate DXL -> GPDB Expr
+	Expr *expr = m_dxl2scalar_translator.TranslateDXLToScalar(
+		dxl_expr, &m_emptymapcidvar);
+	GPOS_ASSERT(NULL != expr);
+
+	// Evaluate the expression
+	Expr *result = gpdb::EvaluateExpr(expr, gpdb::ExprType((Node *) expr),
+									  gpdb::ExprTypeMod((Node *) expr));
+
+	CDXLNode *dxl_result = TranslateResultToDXL(result);
 	gpdb::GPDBFree(result);
 	gpdb::GPDBFree(expr);
 
 	return dxl_result;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorProxy::EvaluateExprs
+//
+//	@doc:
+//		Evaluate the constant expressions of 'dxl_exprs' with a single
+//		executor state, and return the DXL representations of the results in
+//		the order of the input. Caller keeps ownership of 'dxl_exprs' and
+//		takes ownership of the returned array.
+//
+//---------------------------------------------------------------------------
+CDXLNodeArray *
+CConstExprEvaluatorProxy::EvaluateExprs(const CDXLNodeArray *dxl_exprs)
+{
+	GPOS_ASSERT(NULL != dxl_exprs);
+
+	// Translate DXL -> GPDB Exprs
+	List *exprs = NIL;
+	const ULONG size = dxl_exprs->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		Expr *expr = m_dxl2scalar_translator.TranslateDXLToScalar(
+			(*dxl_exprs)[ul], &m_emptymapcidvar);
+		GPOS_ASSERT(NULL != expr);
+		exprs = gpdb::LAppend(exprs, expr);
+	}
+
+	// Evaluate the expressions in one executor call
+	List *results = gpdb::EvaluateExprList(exprs);
+	GPOS_ASSERT(gpdb::ListLength(results) == size);
+
+	CDXLNodeArray *dxl_results = GPOS_NEW(m_mp) CDXLNodeArray(m_mp);
+	ListCell *lc = NULL;
+	ForEach(lc, results)
+	{
+		Expr *result = (Expr *) lfirst(lc);
+		dxl_results->Append(TranslateResultToDXL(result));
+		gpdb::GPDBFree(result);
+	}
+
+	ForEach(lc, exprs)
+	{
+		gpdb::GPDBFree(lfirst(lc));
+	}
+	gpdb::ListFree(results);
+	gpdb::ListFree(exprs);
+
+	return dxl_results;
+}
+
 // EOF
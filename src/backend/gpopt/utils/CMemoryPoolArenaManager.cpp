@@ -0,0 +1,62 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMemoryPoolArenaManager.cpp
+//
+//	@doc:
+//		MemoryPoolManager implementation that creates
+//		CMemoryPoolPallocArena memory pools
+//
+//---------------------------------------------------------------------------
+
+extern "C" {
+#include "postgres.h"
+
+#include "utils/memutils.h"
+}
+
+#include "gpos/memory/CMemoryPoolArena.h"
+
+#include "gpopt/utils/CMemoryPoolArenaManager.h"
+#include "gpopt/utils/CMemoryPoolPallocArena.h"
+
+using namespace gpos;
+
+// ctor
+CMemoryPoolArenaManager::CMemoryPoolArenaManager(CMemoryPool *internal,
+												 EMemoryPoolType)
+	: CMemoryPoolManager(internal, EMemoryPoolExternal)
+{
+}
+
+// create new memory pool
+CMemoryPool *
+CMemoryPoolArenaManager::NewMemoryPool()
+{
+	return GPOS_NEW(GetInternalMemoryPool()) CMemoryPoolPallocArena();
+}
+
+void
+CMemoryPoolArenaManager::DeleteImpl(void *ptr,
+									CMemoryPool::EAllocationType eat)
+{
+	CMemoryPoolArena::DeleteImpl(ptr, eat);
+}
+
+// get user requested size of allocation
+ULONG
+CMemoryPoolArenaManager::UserSizeOfAlloc(const void *ptr)
+{
+	return CMemoryPoolArena::UserSizeOfAlloc(ptr);
+}
+
+void
+CMemoryPoolArenaManager::Init()
+{
+	CMemoryPoolManager::SetupGlobalMemoryPoolManager<CMemoryPoolArenaManager,
+													 CMemoryPoolPallocArena>();
+}
+
+// EOF
@@ -0,0 +1,62 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMemoryPoolPallocArena.cpp
+//
+//	@doc:
+//		Arena memory pool whose slabs are taken from a PostgreSQL memory
+//		context.
+//
+//---------------------------------------------------------------------------
+
+extern "C" {
+#include "postgres.h"
+
+#include "utils/memutils.h"
+}
+
+#include "gpopt/gpdbwrappers.h"
+#include "gpopt/utils/CMemoryPoolPallocArena.h"
+
+using namespace gpos;
+
+// ctor
+CMemoryPoolPallocArena::CMemoryPoolPallocArena() : m_cxt(NULL)
+{
+	m_cxt = gpdb::GPDBAllocSetContextCreate();
+}
+
+// allocate a block from the memory context
+void *
+CMemoryPoolPallocArena::AllocateBlock(ULONG size)
+{
+	return gpdb::GPDBMemoryContextAlloc(m_cxt, size);
+}
+
+// return a block to the memory context
+void
+CMemoryPoolPallocArena::FreeBlock(void *block)
+{
+	gpdb::GPDBFree(block);
+}
+
+// Prepare the memory pool to be deleted
+void
+CMemoryPoolPallocArena::TearDown()
+{
+	const CMemoryPoolStatistics &stats = GetStatistics();
+
+	elog(DEBUG1,
+		 "GPORCA arena memory pool: " UINT64_FORMAT " allocations, " UINT64_FORMAT
+		 " frees, %u slabs, " UINT64_FORMAT " bytes live",
+		 (uint64) stats.GetNumSuccessfulAllocations(),
+		 (uint64) stats.GetNumFree(), NumSlabs(),
+		 (uint64) stats.LiveObjTotalSize());
+
+	CMemoryPoolArena::TearDown();
+	gpdb::GPDBMemoryContextDelete(m_cxt);
+}
+
+// EOF
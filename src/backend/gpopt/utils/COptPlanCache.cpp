@@ -0,0 +1,553 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		COptPlanCache.cpp
+//
+//	@doc:
+//		Session-local cache of plans produced by the optimizer
+//
+//---------------------------------------------------------------------------
+
+#include "gpopt/utils/COptPlanCache.h"
+
+#include "gpos/common/CAutoRef.h"
+#include "gpos/io/COstreamString.h"
+#include "gpos/memory/CCacheFactory.h"
+#include "gpos/string/CWStringConst.h"
+#include "gpos/task/CAutoTraceFlag.h"
+
+#include "gpopt/minidump/CSerializableOptimizerConfig.h"
+#include "gpopt/relcache/CMDCacheInvalidation.h"
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/md/CMDIdColStats.h"
+#include "naucrates/md/CMDIdExtStats.h"
+#include "naucrates/md/CMDIdGPDB.h"
+#include "naucrates/md/CMDIdRelStats.h"
+#include "naucrates/md/IMDColumn.h"
+#include "naucrates/md/IMDRelation.h"
+
+using namespace gpopt;
+using namespace gpmd;
+using namespace gpdxl;
+
+// global instance of the plan cache
+COptPlanCache::PlanCache *COptPlanCache::m_pcache = NULL;
+
+// maximum size of the cache
+ULLONG COptPlanCache::m_ullCacheQuota = UNLIMITED_CACHE_QUOTA;
+
+// cache counters
+ULLONG COptPlanCache::m_ullCacheHits = 0;
+ULLONG COptPlanCache::m_ullCacheMisses = 0;
+ULLONG COptPlanCache::m_ullInvalidations = 0;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptPlanCache::CEntry::CEntry
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+COptPlanCache::CEntry::CEntry(CMemoryPool *mp, const CHAR *plan_dxl,
+							  const SDependency *deps, ULONG num_deps)
+	: m_mp(mp), m_plan_dxl(NULL), m_deps(NULL), m_num_deps(num_deps)
+{
+	GPOS_ASSERT(NULL != plan_dxl);
+
+	const ULONG length = clib::Strlen(plan_dxl);
+	m_plan_dxl = GPOS_NEW_ARRAY(mp, CHAR, length + 1);
+	clib::Memcpy(m_plan_dxl, plan_dxl, length + 1);
+
+	if (0 < num_deps)
+	{
+		m_deps = GPOS_NEW_ARRAY(mp, SDependency, num_deps);
+		clib::Memcpy(m_deps, deps, num_deps * GPOS_SIZEOF(SDependency));
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptPlanCache::CEntry::~CEntry
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+COptPlanCache::CEntry::~CEntry()
+{
+	GPOS_DELETE_ARRAY(m_plan_dxl);
+	GPOS_DELETE_ARRAY(m_deps);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptPlanCache::CEntry::FInvalidated
+//
+//	@doc:
+//		Is the plan affected by any of the given invalidations?
+//
+//---------------------------------------------------------------------------
+BOOL
+COptPlanCache::CEntry::FInvalidated(
+	const gpdb::SMDCacheInvalidation *invalidations,
+	ULONG num_invalidations) const
+{
+	for (ULONG ul = 0; ul < num_invalidations; ul++)
+	{
+		const gpdb::SMDCacheInvalidation *inval = &invalidations[ul];
+		for (ULONG ulDep = 0; ulDep < m_num_deps; ulDep++)
+		{
+			const SDependency *dep = &m_deps[ulDep];
+			if (dep->m_cache_id != inval->m_cacheid)
+			{
+				continue;
+			}
+
+			if (0 > dep->m_cache_id)
+			{
+				if (InvalidOid == dep->m_relid ||
+					dep->m_relid == inval->m_relid)
+				{
+					return true;
+				}
+			}
+			else if (0 == dep->m_hash_value ||
+					 dep->m_hash_value == inval->m_hashvalue)
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptPlanCache::UlHashKey
+//
+//	@doc:
+//		Hash function for keys
+//
+//---------------------------------------------------------------------------
+ULONG
+COptPlanCache::UlHashKey(CWStringBase *const &key)
+{
+	return gpos::HashByteArray((const BYTE *) key->GetBuffer(),
+							   key->Length() * GPOS_SIZEOF(WCHAR));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptPlanCache::FEqualKeys
+//
+//	@doc:
+//		Equality function for keys
+//
+//---------------------------------------------------------------------------
+BOOL
+COptPlanCache::FEqualKeys(CWStringBase *const &key1, CWStringBase *const &key2)
+{
+	return key1->Equals(key2);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptPlanCache::Init
+//
+//	@doc:
+//		Initializes global instance
+//
+//---------------------------------------------------------------------------
+void
+COptPlanCache::Init()
+{
+	GPOS_ASSERT(NULL == m_pcache && "Plan cache was already created");
+
+	m_pcache = CCacheFactory::CreateCache<CEntry *, CWStringBase *>(
+		true /*fUnique*/, m_ullCacheQuota, UlHashKey, FEqualKeys);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptPlanCache::Shutdown
+//
+//	@doc:
+//		Cleans up the underlying cache
+//
+//---------------------------------------------------------------------------
+void
+COptPlanCache::Shutdown()
+{
+	GPOS_DELETE(m_pcache);
+	m_pcache = NULL;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptPlanCache::Reset
+//
+//	@doc:
+//		Reset plan cache
+//
+//---------------------------------------------------------------------------
+void
+COptPlanCache::Reset()
+{
+	CAutoTraceFlag atf1(EtraceSimulateOOM, false);
+	CAutoTraceFlag atf2(EtraceSimulateAbort, false);
+	CAutoTraceFlag atf3(EtraceSimulateIOError, false);
+	CAutoTraceFlag atf4(EtraceSimulateNetError, false);
+
+	Shutdown();
+	Init();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptPlanCache::SetCacheQuota
+//
+//	@doc:
+//		Set the maximum size of the cache
+//
+//---------------------------------------------------------------------------
+void
+COptPlanCache::SetCacheQuota(ULLONG ullCacheQuota)
+{
+	GPOS_ASSERT(NULL != m_pcache && "Plan cache was not created");
+	m_ullCacheQuota = ullCacheQuota;
+	m_pcache->SetCacheQuota(ullCacheQuota);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptPlanCache::FEvictPlan
+//
+//	@doc:
+//		Eviction predicate; selects the plans affected by the invalidations
+//		passed as argument
+//
+//---------------------------------------------------------------------------
+BOOL
+COptPlanCache::FEvictPlan(CWStringBase *const &,  // key
+						  CEntry *entry, void *arg)
+{
+	SInvalidations *invals = static_cast<SInvalidations *>(arg);
+
+	return entry->FInvalidated(invals->m_invalidations,
+							   invals->m_num_invalidations);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptPlanCache::Invalidate
+//
+//	@doc:
+//		Evict the plans affected by the given invalidations; returns their
+//		number
+//
+//---------------------------------------------------------------------------
+ULONG
+COptPlanCache::Invalidate(const gpdb::SMDCacheInvalidation *invalidations,
+						  ULONG num_invalidations)
+{
+	GPOS_ASSERT(NULL != m_pcache && "Plan cache was not created");
+
+	CAutoTraceFlag atf1(EtraceSimulateOOM, false);
+	CAutoTraceFlag atf2(EtraceSimulateAbort, false);
+	CAutoTraceFlag atf3(EtraceSimulateIOError, false);
+	CAutoTraceFlag atf4(EtraceSimulateNetError, false);
+
+	SInvalidations invals;
+	invals.m_invalidations = invalidations;
+	invals.m_num_invalidations = num_invalidations;
+
+	ULONG ulEvicted = m_pcache->EvictMatchingEntries(FEvictPlan, &invals);
+	m_ullInvalidations += ulEvicted;
+
+	return ulEvicted;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptPlanCache::PstrKey
+//
+//	@doc:
+//		Build the cache key of a query: the query DXL, the optimizer
+//		configuration including the trace flags currently set, the segment
+//		counts and the search strategy
+//
+//---------------------------------------------------------------------------
+CWStringDynamic *
+COptPlanCache::PstrKey(CMemoryPool *mp, const CDXLNode *query_dxl,
+					   const CDXLNodeArray *query_output_dxlnode_array,
+					   const CDXLNodeArray *cte_producers,
+					   COptimizerConfig *optimizer_config, ULONG num_segments,
+					   ULONG num_segments_for_costing,
+					   const CHAR *search_strategy_path)
+{
+	CWStringDynamic *key = GPOS_NEW(mp) CWStringDynamic(mp);
+	COstreamString oss(key);
+
+	CDXLUtils::SerializeQuery(mp, oss, query_dxl, query_output_dxlnode_array,
+							  cte_producers, false /*serialize_header_footer*/,
+							  false /*indentation*/);
+
+	CSerializableOptimizerConfig serializable_config(mp, optimizer_config);
+	serializable_config.Serialize(oss);
+
+	oss << num_segments << "," << num_segments_for_costing << ",";
+	if (NULL != search_strategy_path)
+	{
+		oss << search_strategy_path;
+	}
+
+	return key;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptPlanCache::PszLookup
+//
+//	@doc:
+//		Look up the plan cached for the given key; returns a copy allocated
+//		in the given pool, or NULL
+//
+//---------------------------------------------------------------------------
+CHAR *
+COptPlanCache::PszLookup(CMemoryPool *mp, const CWStringBase *key)
+{
+	GPOS_ASSERT(NULL != m_pcache && "Plan cache was not created");
+
+	PlanCacheAccessor accessor(m_pcache);
+	accessor.Lookup(const_cast<CWStringBase *>(key));
+
+	CEntry *entry = accessor.Val();
+	if (NULL == entry)
+	{
+		m_ullCacheMisses++;
+		return NULL;
+	}
+
+	m_ullCacheHits++;
+
+	const ULONG length = clib::Strlen(entry->PlanDXL());
+	CHAR *plan_dxl = GPOS_NEW_ARRAY(mp, CHAR, length + 1);
+	clib::Memcpy(plan_dxl, entry->PlanDXL(), length + 1);
+
+	// release the reference handed out by the lookup
+	entry->Release();
+
+	return plan_dxl;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptPlanCache::AddDependency
+//
+//	@doc:
+//		Append a dependency to the given array
+//
+//---------------------------------------------------------------------------
+void
+COptPlanCache::AddDependency(CMemoryPool *mp, SDependencyArray *deps,
+							 INT cache_id, ULONG hash_value, OID relid)
+{
+	SDependency *dep = GPOS_NEW(mp) SDependency;
+	dep->m_cache_id = cache_id;
+	dep->m_hash_value = hash_value;
+	dep->m_relid = relid;
+	deps->Append(dep);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptPlanCache::FCollectDependencies
+//
+//	@doc:
+//		Collect the catalog entries of the objects retrieved through the
+//		given accessor. Returns false if the plan depends on objects that
+//		cannot be tracked, i.e. CTAS targets and objects of unknown kind.
+//
+//---------------------------------------------------------------------------
+BOOL
+COptPlanCache::FCollectDependencies(CMemoryPool *mp, CMDAccessor *md_accessor,
+									SDependencyArray *deps)
+{
+	CAutoRef<IMDCacheObjectArray> md_obj_array(GPOS_NEW(mp)
+												   IMDCacheObjectArray(mp));
+	md_accessor->AppendObjects(md_obj_array.Value());
+
+	// lookups of casts and comparisons that do not exist are not recorded
+	// by the accessor, so creating one must evict the plan
+	AddDependency(mp, deps, CASTSOURCETARGET, 0, InvalidOid);
+	AddDependency(mp, deps, OPEROID, 0, InvalidOid);
+
+	const ULONG num_objs = md_obj_array->Size();
+	for (ULONG ul = 0; ul < num_objs; ul++)
+	{
+		const IMDCacheObject *md_obj = (*md_obj_array)[ul];
+		const IMDId *mdid = md_obj->MDId();
+		if (IMDId::EmdidGPDBCtas == mdid->MdidType())
+		{
+			return false;
+		}
+
+		CMDCacheInvalidation::SCatalogKey
+			keys[GPOPT_MDCACHE_MAX_CATALOG_KEYS];
+		const ULONG num_keys =
+			CMDCacheInvalidation::GetCatalogKeys(mdid, md_obj, keys);
+		if (gpos::ulong_max == num_keys)
+		{
+			return false;
+		}
+
+		for (ULONG ulKey = 0; ulKey < num_keys; ulKey++)
+		{
+			const CMDCacheInvalidation::SCatalogKey *key = &keys[ulKey];
+			if (0 > key->m_cache_id)
+			{
+				AddDependency(
+					mp, deps, -1, 0,
+					key->m_any ? InvalidOid : DatumGetObjectId(key->m_keys[0]));
+			}
+			else
+			{
+				AddDependency(
+					mp, deps, key->m_cache_id,
+					key->m_any ? 0
+							   : gpdb::GetSysCacheHashValue(
+									 key->m_cache_id, key->m_keys[0],
+									 key->m_keys[1], key->m_keys[2]),
+					InvalidOid);
+			}
+		}
+
+		switch (md_obj->MDType())
+		{
+			case IMDCacheObject::EmdtRel:
+			{
+				// the statistics of a partitioned table are derived from
+				// its partitions, which are not retrieved by the optimizer
+				const IMDRelation *md_rel =
+					dynamic_cast<const IMDRelation *>(md_obj);
+				if (md_rel->IsPartitioned())
+				{
+					AddDependency(mp, deps, -1, 0, InvalidOid);
+				}
+				break;
+			}
+
+			case IMDCacheObject::EmdtRelStats:
+				AddDependency(mp, deps, -1, 0,
+							  CMDIdGPDB::CastMdid(
+								  CMDIdRelStats::CastMdid(mdid)->GetRelMdId())
+								  ->Oid());
+				break;
+
+			case IMDCacheObject::EmdtColStats:
+			{
+				const CMDIdColStats *mdid_col_stats =
+					CMDIdColStats::CastMdid(mdid);
+				IMDId *rel_mdid = mdid_col_stats->GetRelMdId();
+				OID rel_oid = CMDIdGPDB::CastMdid(rel_mdid)->Oid();
+				const IMDRelation *md_rel = md_accessor->RetrieveRel(rel_mdid);
+				Datum attno = Int16GetDatum((AttrNumber) md_rel
+												->GetMdCol(mdid_col_stats->Position())
+												->AttrNum());
+
+				AddDependency(mp, deps, -1, 0, rel_oid);
+				AddDependency(mp, deps, STATRELATTINH,
+							  gpdb::GetSysCacheHashValue(
+								  STATRELATTINH, ObjectIdGetDatum(rel_oid),
+								  attno, BoolGetDatum(false)),
+							  InvalidOid);
+				AddDependency(mp, deps, STATRELATTINH,
+							  gpdb::GetSysCacheHashValue(
+								  STATRELATTINH, ObjectIdGetDatum(rel_oid),
+								  attno, BoolGetDatum(true)),
+							  InvalidOid);
+				break;
+			}
+
+			case IMDCacheObject::EmdtExtStats:
+				// the column groups are stored in the pg_statistic rows of
+				// any of the columns of the relation
+				AddDependency(mp, deps, -1, 0,
+							  CMDIdGPDB::CastMdid(
+								  CMDIdExtStats::CastMdid(mdid)->GetRelMdId())
+								  ->Oid());
+				AddDependency(mp, deps, STATRELATTINH, 0, InvalidOid);
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptPlanCache::Insert
+//
+//	@doc:
+//		Cache the plan DXL produced for the given key. The plan is kept as a
+//		narrow string, so plans with non-ASCII characters are not cached.
+//
+//---------------------------------------------------------------------------
+void
+COptPlanCache::Insert(CMemoryPool *mp, CMDAccessor *md_accessor,
+					  const CWStringBase *key, const CWStringBase *plan_str)
+{
+	GPOS_ASSERT(NULL != m_pcache && "Plan cache was not created");
+
+	const ULONG length = plan_str->Length();
+	const WCHAR *wsz = plan_str->GetBuffer();
+	CAutoRg<CHAR> a_plan_dxl;
+	a_plan_dxl = GPOS_NEW_ARRAY(mp, CHAR, length + 1);
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		if (0x80 <= (ULONG) wsz[ul])
+		{
+			return;
+		}
+		a_plan_dxl[ul] = (CHAR) wsz[ul];
+	}
+	a_plan_dxl[length] = '\0';
+
+	CAutoRef<SDependencyArray> deps(GPOS_NEW(mp) SDependencyArray(mp));
+	if (!FCollectDependencies(mp, md_accessor, deps.Value()))
+	{
+		return;
+	}
+
+	const ULONG num_deps = deps->Size();
+	GPOS_ASSERT(0 < num_deps);
+	CAutoRg<SDependency> a_deps;
+	a_deps = GPOS_NEW_ARRAY(mp, SDependency, num_deps);
+	for (ULONG ul = 0; ul < num_deps; ul++)
+	{
+		a_deps[ul] = *(*deps)[ul];
+	}
+
+	PlanCacheAccessor accessor(m_pcache);
+	CMemoryPool *entry_mp = accessor.Pmp();
+
+	CWStringBase *entry_key =
+		GPOS_NEW(entry_mp) CWStringConst(entry_mp, key->GetBuffer());
+	CEntry *entry = GPOS_NEW(entry_mp)
+		CEntry(entry_mp, a_plan_dxl.Rgt(), a_deps.Rgt(), num_deps);
+
+	// the cache holds its own reference to an inserted entry; if a plan was
+	// cached for the same key in the meantime, releasing ours drops the new
+	// entry, and the accessor destroys its memory pool
+	(void) accessor.Insert(entry_key, entry);
+	entry->Release();
+}
+
+// EOF
@@ -0,0 +1,142 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		COptProfile.cpp
+//
+//	@doc:
+//		Profile of the last optimization run in the session
+//
+//---------------------------------------------------------------------------
+
+#include "gpopt/utils/COptProfile.h"
+
+using namespace gpopt;
+
+// profile of the last optimization
+COptProfile::SProfile COptProfile::m_profile;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptProfile::Reset
+//
+//	@doc:
+//		Forget the last profile, so that a query that is not optimized to
+//		the end does not show the profile of an earlier one
+//
+//---------------------------------------------------------------------------
+void
+COptProfile::Reset()
+{
+	m_profile.m_is_valid = false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptProfile::Record
+//
+//	@doc:
+//		Record the profile of an optimization
+//
+//---------------------------------------------------------------------------
+void
+COptProfile::Record(const SOptimizerMetrics *metrics,
+					ULLONG optimization_time, ULLONG peak_memory)
+{
+	m_profile.m_is_valid = true;
+	m_profile.m_is_cached_plan = (NULL == metrics);
+	m_profile.m_optimization_time = optimization_time;
+	m_profile.m_peak_memory = peak_memory;
+
+	if (NULL == metrics)
+	{
+		m_profile.m_metrics = SOptimizerMetrics();
+	}
+	else
+	{
+		m_profile.m_metrics = *metrics;
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptProfile::Pprofile
+//
+//	@doc:
+//		Profile of the last optimization, NULL if there is none
+//
+//---------------------------------------------------------------------------
+const COptProfile::SProfile *
+COptProfile::Pprofile()
+{
+	if (!m_profile.m_is_valid)
+	{
+		return NULL;
+	}
+
+	return &m_profile;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptProfile::UlSortedXforms
+//
+//	@doc:
+//		Fill the given array with the ids of the applied xforms, ordered by
+//		decreasing time and then by decreasing number of applications. At
+//		most the given number of ids is returned
+//
+//---------------------------------------------------------------------------
+ULONG
+COptProfile::UlSortedXforms(ULONG *xform_ids, ULONG size)
+{
+	const SOptimizerMetrics &metrics = m_profile.m_metrics;
+
+	ULONG num_xforms = 0;
+	for (ULONG ul = 0; m_profile.m_is_valid && ul < CXform::ExfSentinel; ul++)
+	{
+		if (0 == metrics.m_rgullXformCalls[ul])
+		{
+			continue;
+		}
+
+		// insertion into the sorted prefix; there are at most a few hundred
+		// xforms
+		ULONG pos = num_xforms;
+		while (0 < pos)
+		{
+			ULONG prev = xform_ids[pos - 1];
+			BOOL is_before =
+				metrics.m_rgullXformTime[ul] > metrics.m_rgullXformTime[prev] ||
+				(metrics.m_rgullXformTime[ul] ==
+					 metrics.m_rgullXformTime[prev] &&
+				 metrics.m_rgullXformCalls[ul] >
+					 metrics.m_rgullXformCalls[prev]);
+			if (!is_before)
+			{
+				break;
+			}
+
+			if (pos < size)
+			{
+				xform_ids[pos] = prev;
+			}
+			pos--;
+		}
+
+		if (pos < size)
+		{
+			xform_ids[pos] = ul;
+		}
+
+		if (num_xforms < size)
+		{
+			num_xforms++;
+		}
+	}
+
+	return num_xforms;
+}
+
+// EOF
@@ -21,6 +21,7 @@
 #include "gpopt/config/CConfigParamMapping.h"
 #include "gpopt/engine/CHint.h"
 #include "gpopt/eval/CConstExprEvaluatorDXL.h"
+#include "gpopt/relcache/CMDCacheInvalidation.h"
 #include "gpopt/relcache/CMDProviderRelcache.h"
 #include "gpopt/translate/CContextDXLToPlStmt.h"
 #include "gpopt/translate/CTranslatorDXLToExpr.h"
@@ -30,6 +31,8 @@
 #include "gpopt/translate/CTranslatorRelcacheToDXL.h"
 #include "gpopt/translate/CTranslatorUtils.h"
 #include "gpopt/utils/CConstExprEvaluatorProxy.h"
+#include "gpopt/utils/COptPlanCache.h"
+#include "gpopt/utils/COptProfile.h"
 #include "gpopt/utils/gpdbdefs.h"
 
 #include "cdb/cdbvars.h"
@@ -39,6 +42,8 @@
 
 #include "gpos/_api.h"
 #include "gpos/common/CAutoP.h"
+#include "gpos/common/CWallClock.h"
+#include "gpos/error/CAutoTrace.h"
 #include "gpos/io/COstreamFile.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/memory/CAutoMemoryPool.h"
@@ -67,6 +72,7 @@
 #include "naucrates/exception.h"
 #include "naucrates/init.h"
 #include "naucrates/md/CMDIdCast.h"
+#include "naucrates/md/CMDIdColStats.h"
 #include "naucrates/md/CMDIdRelStats.h"
 #include "naucrates/md/CMDIdScCmp.h"
 #include "naucrates/md/CSystemId.h"
@@ -387,6 +393,7 @@ COptTasks::CreateOptimizerConfig(CMemoryPool *mp, ICostModel *cost_model)
 		(ULONG) optimizer_push_group_by_below_setop_threshold;
 	ULONG xform_bind_threshold = (ULONG) optimizer_xform_bind_threshold;
 	ULONG skew_factor = (ULONG) optimizer_skew_factor;
+	ULONG memo_memory_budget = (ULONG) optimizer_memo_memory_budget;
 
 	return GPOS_NEW(mp) COptimizerConfig(
 		GPOS_NEW(mp)
@@ -402,7 +409,7 @@ COptTasks::CreateOptimizerConfig(CMemoryPool *mp, ICostModel *cost_model)
 				  false, /* don't create Assert nodes for constraints, we'll
 								      * enforce them ourselves in the executor */
 				  push_group_by_below_setop_threshold, xform_bind_threshold,
-				  skew_factor),
+				  skew_factor, memo_memory_budget),
 		GPOS_NEW(mp) CWindowOids(OID(F_WINDOW_ROW_NUMBER), OID(F_WINDOW_RANK)));
 }
 
@@ -489,9 +496,12 @@ COptTasks::OptimizeTask(void *ptr)
 	//
 	// On the first call, before the cache has been initialized, we
 	// don't care about the return value of MDCacheNeedsReset(). But
-	// we need to call it anyway, to give it a chance to initialize
-	// the invalidation mechanism.
-	bool reset_mdcache = gpdb::MDCacheNeedsReset();
+	// we need to call it anyway, to discard the changes recorded since
+	// the backend started.
+	const gpdb::SMDCacheInvalidation *invalidations = NULL;
+	ULONG num_invalidations = 0;
+	bool reset_mdcache =
+		gpdb::MDCacheNeedsReset(&invalidations, &num_invalidations);
 
 	// initialize metadata cache, or purge if needed, or change size if requested
 	if (!CMDCache::FInitialized())
@@ -503,13 +513,63 @@ COptTasks::OptimizeTask(void *ptr)
 	{
 		CMDCache::Reset();
 		CMDCache::SetCacheQuota(optimizer_mdcache_size * 1024L);
+		if (COptPlanCache::FInitialized())
+		{
+			COptPlanCache::Reset();
+			COptPlanCache::SetCacheQuota(optimizer_plan_cache_size * 1024L);
+		}
 	}
-	else if (CMDCache::ULLGetCacheQuota() !=
-			 (ULLONG) optimizer_mdcache_size * 1024L)
+	else
 	{
-		CMDCache::SetCacheQuota(optimizer_mdcache_size * 1024L);
+		// evict only the objects and plans affected by the catalog changes
+		// seen since the last optimization
+		if (0 < num_invalidations)
+		{
+			GPOS_TRY
+			{
+				CMDCacheInvalidation mdcache_inval(mp, invalidations,
+												   num_invalidations);
+				mdcache_inval.Evict();
+
+				if (COptPlanCache::FInitialized())
+				{
+					COptPlanCache::Invalidate(invalidations,
+											  num_invalidations);
+				}
+			}
+			GPOS_CATCH_EX(ex)
+			{
+				// leave no stale entries behind
+				CMDCache::Reset();
+				COptPlanCache::Shutdown();
+				GPOS_RETHROW(ex);
+			}
+			GPOS_CATCH_END;
+		}
+
+		if (CMDCache::ULLGetCacheQuota() !=
+			(ULLONG) optimizer_mdcache_size * 1024L)
+		{
+			CMDCache::SetCacheQuota(optimizer_mdcache_size * 1024L);
+		}
 	}
 
+	// the plan cache is only kept while it is enabled; it relies on the
+	// invalidations applied to a metadata cache that outlives the query
+	if (0 == optimizer_plan_cache_size || !optimizer_metadata_caching)
+	{
+		COptPlanCache::Shutdown();
+	}
+	else if (!COptPlanCache::FInitialized())
+	{
+		COptPlanCache::Init();
+		COptPlanCache::SetCacheQuota(optimizer_plan_cache_size * 1024L);
+	}
+	else if (COptPlanCache::ULLGetCacheQuota() !=
+			 (ULLONG) optimizer_plan_cache_size * 1024L)
+	{
+		COptPlanCache::SetCacheQuota(optimizer_plan_cache_size * 1024L);
+	}
 
 	// load search strategy
 	CSearchStageArray *search_strategy_arr =
@@ -519,6 +579,7 @@ COptTasks::OptimizeTask(void *ptr)
 	CBitSet *enabled_trace_flags = NULL;
 	CBitSet *disabled_trace_flags = NULL;
 	CDXLNode *plan_dxl = NULL;
+	CWStringDynamic *plan_cache_key = NULL;
 
 	IMdIdArray *col_stats = NULL;
 	MdidHashSet *rel_stats = NULL;
@@ -531,6 +592,17 @@ COptTasks::OptimizeTask(void *ptr)
 		SetTraceflags(mp, trace_flags, &enabled_trace_flags,
 					  &disabled_trace_flags);
 
+		// profile the optimization, unless the query reads the profile
+		// of the previous one
+		BOOL should_profile =
+			GPOS_FTRACE(EopttraceCollectOptimizationStatistics) &&
+			!ReadsProfileWalker((Node *) opt_ctxt->m_query, NULL);
+		if (should_profile)
+		{
+			COptProfile::Reset();
+		}
+		CWallClock profile_timer;
+
 		// set up relcache MD provider
 		CMDProviderRelcache *relcache_provider =
 			GPOS_NEW(mp) CMDProviderRelcache(mp);
@@ -578,10 +650,67 @@ COptTasks::OptimizeTask(void *ptr)
 			CAutoTraceFlag atf2(EopttraceUseLegacyOpfamilies,
 								use_legacy_opfamilies);
 
-			plan_dxl = COptimizer::PdxlnOptimize(
-				mp, &mda, query_dxl, query_output_dxlnode_array,
-				cte_dxlnode_array, expr_evaluator, num_segments, gp_session_id,
-				gp_command_count, search_strategy_arr, optimizer_config);
+			// reuse the plan cached for an identical query, if any
+			if (COptPlanCache::FInitialized())
+			{
+				plan_cache_key = COptPlanCache::PstrKey(
+					mp, query_dxl, query_output_dxlnode_array,
+					cte_dxlnode_array, optimizer_config, num_segments,
+					num_segments_for_costing, optimizer_search_strategy_path);
+
+				CAutoRg<CHAR> cached_plan;
+				cached_plan = COptPlanCache::PszLookup(mp, plan_cache_key);
+				if (NULL != cached_plan.Rgt())
+				{
+					ULLONG plan_id = 0;
+					ULLONG plan_space_size = 0;
+					plan_dxl = CDXLUtils::GetPlanDXLNode(
+						mp, cached_plan.Rgt(), NULL /*xsd_file_path*/,
+						&plan_id, &plan_space_size);
+				}
+			}
+
+			if (NULL != plan_dxl && should_profile)
+			{
+				COptProfile::Record(NULL /*metrics*/,
+									profile_timer.ElapsedUS(),
+									mp->PeakAllocatedSize());
+			}
+
+			if (NULL == plan_dxl)
+			{
+				if (optimizer_prefetch_metadata)
+				{
+					PrefetchStats(mp, &mda, (Query *) opt_ctxt->m_query);
+				}
+
+				SOptimizerMetrics metrics;
+				plan_dxl = COptimizer::PdxlnOptimize(
+					mp, &mda, query_dxl, query_output_dxlnode_array,
+					cte_dxlnode_array, expr_evaluator, num_segments,
+					gp_session_id, gp_command_count, search_strategy_arr,
+					optimizer_config, NULL /*szMinidumpFileName*/,
+					should_profile ? &metrics : NULL);
+
+				if (should_profile)
+				{
+					COptProfile::Record(&metrics, profile_timer.ElapsedUS(),
+										mp->PeakAllocatedSize());
+				}
+
+				if (NULL != plan_cache_key)
+				{
+					CWStringDynamic plan_str(mp);
+					COstreamString oss(&plan_str);
+					CDXLUtils::SerializePlan(
+						mp, oss, plan_dxl,
+						optimizer_config->GetEnumeratorCfg()->GetPlanId(),
+						optimizer_config->GetEnumeratorCfg()->GetPlanSpaceSize(),
+						true /*serialize_header_footer*/,
+						false /*indentation*/);
+					COptPlanCache::Insert(mp, &mda, plan_cache_key, &plan_str);
+				}
+			}
 
 			if (opt_ctxt->m_should_serialize_plan_dxl)
 			{
@@ -609,6 +738,12 @@ COptTasks::OptimizeTask(void *ptr)
 						query_to_dxl_translator->GetDistributionHashOpsKind()));
 			}
 
+			if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
+			{
+				CAutoTrace at(mp);
+				relcache_provider->OsPrintRetrievalStats(at.Os());
+			}
+
 			CStatisticsConfig *stats_conf = optimizer_config->GetStatsConf();
 			col_stats = GPOS_NEW(mp) IMdIdArray(mp);
 			stats_conf->CollectMissingStatsColumns(col_stats);
@@ -634,7 +769,9 @@ COptTasks::OptimizeTask(void *ptr)
 		CRefCount::SafeRelease(disabled_trace_flags);
 		CRefCount::SafeRelease(trace_flags);
 		CRefCount::SafeRelease(plan_dxl);
+		GPOS_DELETE(plan_cache_key);
 		CMDCache::Shutdown();
+		COptPlanCache::Shutdown();
 
 		IErrorContext *errctxt = CTask::Self()->GetErrCtxt();
 
@@ -649,6 +786,7 @@ COptTasks::OptimizeTask(void *ptr)
 
 	// cleanup
 	ResetTraceflags(enabled_trace_flags, disabled_trace_flags);
+	GPOS_DELETE(plan_cache_key);
 	CRefCount::SafeRelease(enabled_trace_flags);
 	CRefCount::SafeRelease(disabled_trace_flags);
 	CRefCount::SafeRelease(trace_flags);
@@ -734,6 +872,168 @@ COptTasks::PrintMissingStatsWarning(CMemoryPool *mp, CMDAccessor *md_accessor,
 	}
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::PrefetchRelStats
+//
+//	@doc:
+//		Prefetch the statistics of a relation and of the columns the query
+//		selects from it. A whole-row reference selects all columns
+//
+//---------------------------------------------------------------------------
+void
+COptTasks::PrefetchRelStats(SPrefetchContext *context,
+							const RangeTblEntry *rte)
+{
+	CMemoryPool *mp = context->m_mp;
+	CMDAccessor *md_accessor = context->m_md_accessor;
+
+	CMDIdGPDB *rel_mdid =
+		GPOS_NEW(mp) CMDIdGPDB(IMDId::EmdidRel, rte->relid);
+	const IMDRelation *md_rel = md_accessor->RetrieveRel(rel_mdid);
+
+	rel_mdid->AddRef();
+	CMDIdRelStats *rel_stats_mdid = GPOS_NEW(mp) CMDIdRelStats(rel_mdid);
+	(void) md_accessor->Pmdrelstats(rel_stats_mdid);
+	rel_stats_mdid->Release();
+	context->m_num_rels++;
+
+	BOOL is_whole_row = gpdb::BmsIsMember(
+		InvalidAttrNumber - FirstLowInvalidHeapAttributeNumber,
+		rte->selectedCols);
+
+	const ULONG num_cols = md_rel->ColumnCount();
+	for (ULONG ul = 0; ul < num_cols; ul++)
+	{
+		const IMDColumn *md_col = md_rel->GetMdCol(ul);
+		INT attno = md_col->AttrNum();
+		if (md_col->IsDropped() || md_col->IsSystemColumn() ||
+			(!is_whole_row &&
+			 !gpdb::BmsIsMember(attno - FirstLowInvalidHeapAttributeNumber,
+								rte->selectedCols)))
+		{
+			continue;
+		}
+
+		rel_mdid->AddRef();
+		CMDIdColStats *col_stats_mdid =
+			GPOS_NEW(mp) CMDIdColStats(rel_mdid, ul);
+		(void) md_accessor->Pmdcolstats(col_stats_mdid);
+		col_stats_mdid->Release();
+		context->m_num_cols++;
+	}
+
+	rel_mdid->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::PrefetchStatsWalker
+//
+//	@doc:
+//		Walker prefetching the statistics of the relations in a query,
+//		including those of subqueries, sublinks and CTEs
+//
+//---------------------------------------------------------------------------
+BOOL
+COptTasks::PrefetchStatsWalker(Node *node, SPrefetchContext *context)
+{
+	if (NULL == node)
+	{
+		return false;
+	}
+
+	if (IsA(node, RangeTblEntry))
+	{
+		RangeTblEntry *rte = (RangeTblEntry *) node;
+		if (RTE_RELATION == rte->rtekind)
+		{
+			PrefetchRelStats(context, rte);
+		}
+
+		return false;
+	}
+
+	if (IsA(node, Query))
+	{
+		return gpdb::WalkQueryTree(
+			(Query *) node, (BOOL(*)()) COptTasks::PrefetchStatsWalker,
+			context, QTW_EXAMINE_RTES);
+	}
+
+	return gpdb::WalkExpressionTree(
+		node, (BOOL(*)()) COptTasks::PrefetchStatsWalker, context);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::ReadsProfileWalker
+//
+//	@doc:
+//		Walker checking if a query calls gp_optimizer_profile(). Such a
+//		query is not profiled, so that it reports the optimization of the
+//		query before it rather than its own
+//
+//---------------------------------------------------------------------------
+BOOL
+COptTasks::ReadsProfileWalker(Node *node, void *context)
+{
+	if (NULL == node)
+	{
+		return false;
+	}
+
+	if (IsA(node, FuncExpr) &&
+		F_GP_OPTIMIZER_PROFILE == ((FuncExpr *) node)->funcid)
+	{
+		return true;
+	}
+
+	if (IsA(node, Query))
+	{
+		return gpdb::WalkQueryTree(
+			(Query *) node, (BOOL(*)()) COptTasks::ReadsProfileWalker,
+			context, 0 /*flags*/);
+	}
+
+	return gpdb::WalkExpressionTree(
+		node, (BOOL(*)()) COptTasks::ReadsProfileWalker, context);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::PrefetchStats
+//
+//	@doc:
+//		Prefetch the statistics of the relations and columns referenced in
+//		a query into the metadata accessor, so that they are retrieved in
+//		one pass, before optimization, instead of on demand during
+//		statistics derivation
+//
+//---------------------------------------------------------------------------
+void
+COptTasks::PrefetchStats(CMemoryPool *mp, CMDAccessor *md_accessor,
+						 Query *query)
+{
+	CWallClock timer;
+
+	SPrefetchContext context;
+	context.m_mp = mp;
+	context.m_md_accessor = md_accessor;
+	context.m_num_rels = 0;
+	context.m_num_cols = 0;
+
+	(void) PrefetchStatsWalker((Node *) query, &context);
+
+	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
+	{
+		CAutoTrace at(mp);
+		at.Os() << "[OPT]: Metadata prefetch: " << context.m_num_rels
+				<< " relations, " << context.m_num_cols << " columns in "
+				<< timer.ElapsedUS() << " us";
+	}
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		COptTasks::Optimize
@@ -25,8 +25,10 @@ extern "C" {
 #include "gpos/_api.h"
 
 #include "gpopt/gpdbwrappers.h"
+#include "gpopt/utils/COptProfile.h"
 #include "gpopt/utils/COptTasks.h"
 #include "gpopt/utils/funcs.h"
+#include "gpopt/xforms/CXformFactory.h"
 
 #include "xercesc/util/XercesVersion.hpp"
 
@@ -116,3 +118,115 @@ LibraryVersion()
 	PG_RETURN_TEXT_P(result);
 }
 }
+
+//---------------------------------------------------------------------------
+//	@function:
+//		AddProfileRow
+//
+//	@doc:
+//		Add a row of the optimizer profile to the tuple store; a negative
+//		count, time or number of alternatives is returned as NULL
+//
+//---------------------------------------------------------------------------
+static void
+AddProfileRow(Tuplestorestate *tupstore, TupleDesc tupdesc,
+			  const char *category, const char *name, LINT count,
+			  double time_ms, LINT alternatives)
+{
+	Datum values[5];
+	bool nulls[5];
+
+	values[0] = CStringGetTextDatum(category);
+	nulls[0] = false;
+	values[1] = CStringGetTextDatum(name);
+	nulls[1] = false;
+	values[2] = Int64GetDatum(count);
+	nulls[2] = (0 > count);
+	values[3] = Float8GetDatum(time_ms);
+	nulls[3] = (0 > time_ms);
+	values[4] = Int64GetDatum(alternatives);
+	nulls[4] = (0 > alternatives);
+
+	tuplestore_putvalues(tupstore, tupdesc, values, nulls);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		OptimizerProfile
+//
+//	@doc:
+//		Fill the tuple store with the profile of the last optimization: the
+//		summary of the optimization, the time of each search stage and the
+//		statistics of each applied xform, the most expensive first
+//
+//---------------------------------------------------------------------------
+extern "C" {
+void
+OptimizerProfile(Tuplestorestate *tupstore, TupleDesc tupdesc)
+{
+	const COptProfile::SProfile *profile = COptProfile::Pprofile();
+	if (NULL == profile)
+	{
+		return;
+	}
+
+	const SOptimizerMetrics &metrics = profile->m_metrics;
+	AddProfileRow(tupstore, tupdesc, "summary", "optimization", -1,
+				  (double) profile->m_optimization_time / 1000, -1);
+	AddProfileRow(tupstore, tupdesc, "summary", "plan cache hit",
+				  profile->m_is_cached_plan ? 1 : 0, -1, -1);
+	AddProfileRow(tupstore, tupdesc, "summary", "peak memory bytes",
+				  (LINT) profile->m_peak_memory, -1, -1);
+	if (profile->m_is_cached_plan)
+	{
+		return;
+	}
+
+	AddProfileRow(tupstore, tupdesc, "summary", "groups", metrics.m_ulGroups,
+				  -1, -1);
+	AddProfileRow(tupstore, tupdesc, "summary", "duplicate groups",
+				  metrics.m_ulDuplicateGroups, -1, -1);
+	AddProfileRow(tupstore, tupdesc, "summary", "group expressions",
+				  metrics.m_ulGroupExprs, -1, -1);
+	AddProfileRow(tupstore, tupdesc, "summary", "jobs",
+				  (LINT) metrics.m_ullJobs, -1, -1);
+	AddProfileRow(tupstore, tupdesc, "summary", "xforms filtered by operator",
+				  (LINT) metrics.m_ullXformsFiltered, -1, -1);
+	AddProfileRow(tupstore, tupdesc, "summary", "xforms filtered by pattern",
+				  (LINT) metrics.m_ullPatternMismatches, -1, -1);
+	if (metrics.m_fDegraded)
+	{
+		AddProfileRow(tupstore, tupdesc, "summary", "degraded in stage",
+					  metrics.m_ulDegradedStage, -1, -1);
+		AddProfileRow(tupstore, tupdesc, "summary",
+					  "degraded at memory bytes",
+					  (LINT) metrics.m_ullDegradedMemory, -1, -1);
+	}
+
+	for (ULONG ul = 0;
+		 ul < metrics.m_ulSearchStages && ul < SOptimizerMetrics::MaxStages;
+		 ul++)
+	{
+		char name[NAMEDATALEN];
+		snprintf(name, sizeof(name), "stage %u", ul);
+		AddProfileRow(tupstore, tupdesc, "stage", name, -1,
+					  metrics.m_rgulStageTime[ul], -1);
+	}
+
+	ULONG xform_ids[CXform::ExfSentinel];
+	ULONG num_xforms =
+		COptProfile::UlSortedXforms(xform_ids, GPOS_ARRAY_SIZE(xform_ids));
+	for (ULONG ul = 0; ul < num_xforms; ul++)
+	{
+		ULONG id = xform_ids[ul];
+		AddProfileRow(
+			tupstore, tupdesc, "xform",
+			CXformFactory::Pxff()->Pxf((CXform::EXformId) id)->SzId(),
+			(LINT) metrics.m_rgullXformCalls[id],
+			(double) metrics.m_rgullXformTime[id] / 1000,
+			(LINT) metrics.m_rgullXformResults[id]);
+	}
+}
+}
+
+// EOF
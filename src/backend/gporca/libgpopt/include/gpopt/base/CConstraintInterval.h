@@ -66,6 +66,15 @@ private:
 	// append the given range to the array or extend the last element
 	void AppendOrExtend(CMemoryPool *mp, CRangeArray *pdrgprng, CRange *prange);
 
+	// does the array only contain point ranges [x, x]
+	static BOOL FPointRanges(CRangeArray *pdrgprng);
+
+	// union or intersection of two arrays of point ranges
+	static CRangeArray *PdrgprngMergePoints(CMemoryPool *mp,
+											CRangeArray *pdrgprngFst,
+											CRangeArray *pdrgprngSnd,
+											BOOL fUnion);
+
 	// difference between two ranges on the left side only -
 	// any difference on the right side is reported as residual range
 	CRange *PrangeDiffWithRightResidual(CMemoryPool *mp, CRange *prangeFirst,
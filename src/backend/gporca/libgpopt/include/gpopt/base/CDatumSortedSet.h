@@ -4,6 +4,7 @@
 #ifndef GPOPT_CDatumSortedSet_H
 #define GPOPT_CDatumSortedSet_H
 
+#include "gpos/common/CHashSet.h"
 #include "gpos/memory/CMemoryPool.h"
 
 #include "gpopt/base/IComparator.h"
@@ -14,11 +15,30 @@ namespace gpopt
 {
 // A sorted and uniq'd array of pointers to datums
 // It facilitates the construction of CConstraintInterval
+//
+// Arrays of integers are sorted on their values, without going through the
+// comparator. Other arrays are first de-duplicated with a hash set on the
+// datum bytes, so that the comparator only sees distinct values, which keeps
+// IN lists of many thousands of constants cheap.
 class CDatumSortedSet : public IDatumArray
 {
 private:
 	BOOL m_fIncludesNull;
 
+	// hash and equality of datums on their bytes
+	static ULONG UlHashDatum(const IDatum *datum);
+	static BOOL FMatchDatums(const IDatum *datum1, const IDatum *datum2);
+
+	typedef CHashSet<IDatum, UlHashDatum, FMatchDatums, CleanupNULL<IDatum> >
+		DatumHashSet;
+
+	// sort and de-duplicate integer datums on their values
+	void SortIntDatums(CMemoryPool *mp, IDatumArray *pdrgpdatum);
+
+	// sort and de-duplicate datums using the comparator
+	void SortDatums(CMemoryPool *mp, IDatumArray *pdrgpdatum,
+					const IComparator *pcomp);
+
 public:
 	CDatumSortedSet(CMemoryPool *mp, CExpression *pexprArray,
 					const IComparator *pcomp);
@@ -43,6 +43,7 @@ using namespace gpnaucrates;
 using namespace gpos;
 
 // fwd declarations
+class CExpression;
 class IConstExprEvaluator;
 
 //---------------------------------------------------------------------------
@@ -63,11 +64,22 @@ private:
 	// disabled copy constructor
 	CDefaultComparator(const CDefaultComparator &);
 
+	// construct a comparison expression from the given components
+	static CExpression *PexprComparison(CMemoryPool *mp, const IDatum *datum1,
+										const IDatum *datum2,
+										IMDType::ECmpType cmp_type);
+
+	// value of the boolean constant an evaluated comparison results in
+	static BOOL FComparisonResult(CExpression *pexprResult);
+
 	// construct a comparison expression from the given components and evaluate it
 	BOOL FEvalComparison(CMemoryPool *mp, const IDatum *datum1,
 						 const IDatum *datum2,
 						 IMDType::ECmpType cmp_type) const;
 
+	// does testing the two arguments for equality need the evaluator
+	static BOOL FEqualsNeedsEval(const IDatum *datum1, const IDatum *datum2);
+
 	// return true iff we use built-in evaluation for integers
 	static BOOL
 	FUseBuiltinIntEvaluators()
@@ -104,6 +116,12 @@ public:
 	virtual BOOL IsGreaterThanOrEqual(const IDatum *datum1,
 									  const IDatum *datum2) const;
 
+	// tests the pairs of datums of the two arrays for equality, evaluating
+	// all the comparisons that need the evaluator in one batch
+	virtual void EqualsBatch(const IDatumArray *pdrgpdatumFst,
+							 const IDatumArray *pdrgpdatumSnd,
+							 BOOL *rgfEqual) const;
+
 };	// CDefaultComparator
 }  // namespace gpopt
 
@@ -20,15 +20,12 @@
 
 #include "gpos/base.h"
 
-namespace gpnaucrates
-{
-// fwd declarations
-class IDatum;
-}  // namespace gpnaucrates
+#include "naucrates/base/IDatum.h"
 
 namespace gpopt
 {
 using gpnaucrates::IDatum;
+using gpnaucrates::IDatumArray;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -64,6 +61,13 @@ public:
 	// tests if the first argument is greater or equal to the second
 	virtual gpos::BOOL IsGreaterThanOrEqual(const IDatum *datum1,
 											const IDatum *datum2) const = 0;
+
+	// tests the datums at the same positions of the two arrays for equality
+	// and stores the results in rgfEqual, which must have room for one
+	// result per pair
+	virtual void EqualsBatch(const IDatumArray *pdrgpdatumFst,
+							 const IDatumArray *pdrgpdatumSnd,
+							 gpos::BOOL *rgfEqual) const = 0;
 };
 }  // namespace gpopt
 
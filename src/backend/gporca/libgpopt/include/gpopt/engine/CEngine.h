@@ -33,6 +33,7 @@ class COptimizationContext;
 class CReqdPropPlan;
 class CReqdPropRelational;
 class CEnumeratorConfig;
+struct SOptimizerMetrics;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -68,10 +69,10 @@ private:
 	// set of activated xforms
 	CXformSet *m_xforms;
 
-	// number of calls to each xform
+	// number of applications of each xform to a binding
 	UlongPtrArray *m_pdrgpulpXformCalls;
 
-	// time consumed by each xform
+	// user time consumed by each xform in usec
 	UlongPtrArray *m_pdrgpulpXformTimes;
 
 	// number of bindings for each xform
@@ -80,6 +81,34 @@ private:
 	// number of alternatives generated by each xform
 	UlongPtrArray *m_pdrgpulpXformResults;
 
+	// number of jobs completed by the scheduler over all search stages
+	ULONG_PTR m_ulpJobsCompleted;
+
+	// user time of each completed search stage
+	ULongPtrArray *m_pdrgpulStageTimes;
+
+	// number of candidate xforms dropped before scheduling because their
+	// pattern cannot be rooted at the operator of the group expression
+	ULONG_PTR m_ulpXformsFiltered;
+
+	// number of candidate xforms dropped before scheduling because their
+	// pattern does not match the arity of the group expression
+	ULONG_PTR m_ulpPatternMismatches;
+
+	// memory of the engine's pool in bytes at which the search is degraded,
+	// 0 if there is no budget
+	ULLONG m_ullMemoryBudget;
+
+	// xforms that are not scheduled any more once the search is degraded,
+	// NULL while the search is not degraded
+	CXformSet *m_pxfsDegraded;
+
+	// search stage in which the search was degraded
+	ULONG m_ulDegradedStage;
+
+	// memory of the engine's pool in bytes when the search was degraded
+	ULLONG m_ullDegradedMemory;
+
 #ifdef GPOS_DEBUG
 
 	// a set of internal debugging function used for recursive
@@ -159,10 +188,16 @@ private:
 	BOOL
 	FSearchTerminated() const
 	{
-		// at least one stage has completed and achieved required cost
-		return (NULL != PssPrevious() && PssPrevious()->FAchievedReqdCost());
+		// at least one stage has completed and achieved required cost, or
+		// found a plan after the memory budget was reached
+		return (NULL != PssPrevious() &&
+				(PssPrevious()->FAchievedReqdCost() ||
+				 (FDegraded() && NULL != PssPrevious()->PexprBest())));
 	}
 
+	// degrade the search if the memory budget is reached
+	void CheckMemoryBudget();
+
 	// generate random plan id
 	ULLONG UllRandomPlanId(ULONG *seed);
 
@@ -360,6 +395,17 @@ public:
 		return (*m_search_stage_array)[m_ulCurrSearchStage]->GetXformSet();
 	}
 
+	// was the search degraded because of the memory budget
+	BOOL
+	FDegraded() const
+	{
+		return NULL != m_pxfsDegraded;
+	}
+
+	// xforms of current stage that can bind to the given group expression
+	CXformSet *PxfsApplicable(CMemoryPool *mp, CGroupExpression *pgexpr,
+							  BOOL fImplementation);
+
 	// return array of child optimization contexts corresponding to handle requirements
 	COptimizationContextArray *PdrgpocChildren(CMemoryPool *mp,
 											   CExpressionHandle &exprhdl);
@@ -387,6 +433,9 @@ public:
 	// print
 	IOstream &OsPrint(IOstream &) const;
 
+	// report search space and scheduler metrics of the last optimization
+	void CollectMetrics(SOptimizerMetrics *metrics) const;
+
 #ifdef GPOS_DEBUG
 	// print root group
 	void PrintRoot();
@@ -21,6 +21,7 @@
 #include "gpos/base.h"
 
 #include "gpopt/base/CColRef.h"
+#include "gpopt/base/CUtils.h"
 #include "gpopt/eval/IConstExprEvaluator.h"
 #include "gpopt/translate/CTranslatorDXLToExpr.h"
 #include "gpopt/translate/CTranslatorExprToDXL.h"
@@ -50,6 +51,15 @@ class IConstDXLNodeEvaluator;
 class CConstExprEvaluatorDXL : public IConstExprEvaluator
 {
 private:
+	// map of evaluated expressions to their results
+	typedef CHashMap<CExpression, CExpression, CExpression::HashValue,
+					 CUtils::Equals, CleanupRelease<CExpression>,
+					 CleanupRelease<CExpression> >
+		ExprToResultMap;
+
+	// memory pool
+	CMemoryPool *m_mp;
+
 	// evaluates expressions represented as DXL, not owned
 	IConstDXLNodeEvaluator *m_pconstdxleval;
 
@@ -59,6 +69,11 @@ private:
 	// translates DXL coming from the evaluator back to CExpression
 	CTranslatorDXLToExpr m_trdxl2expr;
 
+	// results of the expressions evaluated so far; the evaluator lives as
+	// long as an optimization, so identical expressions are evaluated once
+	// per optimization
+	ExprToResultMap *m_phmexprResult;
+
 	// private copy ctor
 	CConstExprEvaluatorDXL(const CConstExprEvaluatorDXL &);
 
@@ -74,6 +89,12 @@ public:
 	// caller takes ownership of returned expression
 	virtual CExpression *PexprEval(CExpression *pexpr);
 
+	// evaluate the given expressions that have not been evaluated before in
+	// a single call to the DXL evaluator, and return the results in the order
+	// of the input. caller takes ownership of returned array
+	virtual CExpressionArray *PdrgpexprEval(CMemoryPool *mp,
+											CExpressionArray *pdrgpexpr);
+
 	// Returns true iff the evaluator can evaluate expressions
 	virtual BOOL FCanEvalExpressions();
 };
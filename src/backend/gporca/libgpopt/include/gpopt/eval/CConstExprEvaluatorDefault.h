@@ -51,6 +51,10 @@ public:
 	// Evaluate the given expression and return the result as a new expression
 	virtual CExpression *PexprEval(CExpression *pexpr);
 
+	// Evaluate the given expressions and return the results as new expressions
+	virtual CExpressionArray *PdrgpexprEval(CMemoryPool *mp,
+											CExpressionArray *pdrgpexpr);
+
 	// Returns true iff the evaluator can evaluate constant expressions
 	virtual BOOL FCanEvalExpressions();
 };
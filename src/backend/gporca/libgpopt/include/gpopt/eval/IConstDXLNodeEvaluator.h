@@ -20,11 +20,7 @@
 
 #include "gpos/base.h"
 
-// forward declaration
-namespace gpdxl
-{
-class CDXLNode;
-}
+#include "naucrates/dxl/operators/CDXLNode.h"
 
 namespace gpopt
 {
@@ -48,6 +44,12 @@ public:
 	// caller takes ownership of returned DXL node
 	virtual gpdxl::CDXLNode *EvaluateExpr(const gpdxl::CDXLNode *pdxlnExpr) = 0;
 
+	// evaluate the given DXL nodes representing expressions in one batch and
+	// return the results as DXL, in the order of the input.
+	// caller takes ownership of returned array
+	virtual gpdxl::CDXLNodeArray *EvaluateExprs(
+		const gpdxl::CDXLNodeArray *pdrgpdxlnExpr) = 0;
+
 	// returns true iff the evaluator can evaluate constant expressions without subqueries
 	virtual gpos::BOOL FCanEvalExpressions() = 0;
 };
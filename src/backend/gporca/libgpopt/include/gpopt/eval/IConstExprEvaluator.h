@@ -19,6 +19,7 @@
 #define GPOPT_IConstExprEvaluator_H
 
 #include "gpos/base.h"
+#include "gpos/common/CDynamicPtrArray.h"
 #include "gpos/common/CRefCount.h"
 
 namespace gpopt
@@ -26,6 +27,7 @@ namespace gpopt
 using namespace gpos;
 
 class CExpression;	// forward declaration
+typedef CDynamicPtrArray<CExpression, CleanupRelease> CExpressionArray;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -49,6 +51,13 @@ public:
 	// caller takes ownership of returned expression
 	virtual CExpression *PexprEval(CExpression *pexpr) = 0;
 
+	// evaluate the given expressions and return the results as new
+	// expressions, in the order of the input; evaluators that call out to
+	// the database do this in a single round trip.
+	// caller takes ownership of returned array
+	virtual CExpressionArray *PdrgpexprEval(CMemoryPool *mp,
+											CExpressionArray *pdrgpexpr) = 0;
+
 	// returns true iff the evaluator can evaluate constant expressions without subqueries
 	virtual BOOL FCanEvalExpressions() = 0;
 };
@@ -47,6 +47,7 @@ class IMDProvider;
 class CMDProviderGeneric;
 class IMDColStats;
 class IMDRelStats;
+class IMDExtStats;
 class CDXLBucket;
 class IMDCast;
 class IMDScCmp;
@@ -57,6 +58,7 @@ namespace gpnaucrates
 class CHistogram;
 class CBucket;
 class IStatistics;
+class CStatistics;
 }  // namespace gpnaucrates
 
 namespace gpopt
@@ -222,6 +224,12 @@ private:
 	// this time is currently dominated by serialization time
 	CDouble m_dFetchTime;
 
+	// number of lookups served by the MD cache
+	ULONG m_ulCacheHits;
+
+	// number of lookups that had to go to the MD provider
+	ULONG m_ulCacheMisses;
+
 	// private copy ctor
 	CMDAccessor(const CMDAccessor &);
 
@@ -258,6 +266,11 @@ private:
 						   UlongToDoubleMap *colid_width_mapping,
 						   CStatisticsConfig *stats_config);
 
+	// add the column groups of the given relation whose columns all have
+	// histograms to a statistics object
+	void AddColumnGroups(CMemoryPool *mp, IMDId *rel_mdid,
+						 CColRefSet *pcrsHist, CStatistics *stats);
+
 	// construct a stats histogram from an MD column stats object
 	CHistogram *GetHistogram(CMemoryPool *mp, IMDId *mdid_type,
 							 const IMDColStats *pmdcolstats);
@@ -349,6 +362,9 @@ public:
 	// retrieve a relation stats object from the cache
 	const IMDRelStats *Pmdrelstats(IMDId *mdid);
 
+	// retrieve an extended relation stats object from the cache
+	const IMDExtStats *Pmdextstats(IMDId *mdid);
+
 	// retrieve a cast object from the cache
 	const IMDCast *Pmdcast(IMDId *mdid_src, IMDId *mdid_dest);
 
@@ -370,6 +386,9 @@ public:
 
 	// serialize system ids to passed stream
 	void SerializeSysid(COstream &oos);
+
+	// append all objects retrieved through this accessor to the given array
+	void AppendObjects(IMDCacheObjectArray *md_obj_array);
 };
 }  // namespace gpopt
 
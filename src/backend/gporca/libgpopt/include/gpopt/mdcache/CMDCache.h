@@ -44,6 +44,18 @@ private:
 	// the maximum size of the cache
 	static ULLONG m_ullCacheQuota;
 
+	// number of lookups served by the cache
+	static ULLONG m_ullCacheHits;
+
+	// number of lookups that had to go to the metadata provider
+	static ULLONG m_ullCacheMisses;
+
+	// number of objects evicted individually because of invalidations
+	static ULLONG m_ullTargetedEvictions;
+
+	// number of times the whole cache was reset
+	static ULLONG m_ullResets;
+
 	// private ctor
 	CMDCache(){};
 
@@ -79,6 +91,52 @@ public:
 	// reset global instance
 	static void Reset();
 
+	// evict all objects satisfying the given predicate
+	static ULONG Evict(CMDAccessor::MDCache::MatchFuncPtr pfnMatch,
+					   void *pvArg);
+
+	// record a lookup served by the cache
+	static void
+	RecordHit()
+	{
+		m_ullCacheHits++;
+	}
+
+	// record a lookup that missed the cache
+	static void
+	RecordMiss()
+	{
+		m_ullCacheMisses++;
+	}
+
+	// number of lookups served by the cache
+	static ULLONG
+	ULLGetCacheHits()
+	{
+		return m_ullCacheHits;
+	}
+
+	// number of lookups that missed the cache
+	static ULLONG
+	ULLGetCacheMisses()
+	{
+		return m_ullCacheMisses;
+	}
+
+	// number of objects evicted individually because of invalidations
+	static ULLONG
+	ULLGetTargetedEvictions()
+	{
+		return m_ullTargetedEvictions;
+	}
+
+	// number of times the whole cache was reset
+	static ULLONG
+	ULLGetResets()
+	{
+		return m_ullResets;
+	}
+
 	// global accessor
 	static CMDAccessor::MDCache *
 	Pcache()
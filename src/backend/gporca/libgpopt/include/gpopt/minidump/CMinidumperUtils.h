@@ -25,6 +25,7 @@ class ICostModel;
 class CMiniDumperDXL;
 class COptimizerConfig;
 class IConstExprEvaluator;
+struct SOptimizerMetrics;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -57,20 +58,18 @@ public:
 										  IConstExprEvaluator *pceeval = NULL);
 
 	// execute the given minidump
-	static CDXLNode *PdxlnExecuteMinidump(CMemoryPool *mp,
-										  CDXLMinidump *pdxlmdp,
-										  const CHAR *file_name,
-										  ULONG ulSegments, ULONG ulSessionId,
-										  ULONG ulCmdId,
-										  COptimizerConfig *optimizer_config,
-										  IConstExprEvaluator *pceeval = NULL);
+	static CDXLNode *PdxlnExecuteMinidump(
+		CMemoryPool *mp, CDXLMinidump *pdxlmdp, const CHAR *file_name,
+		ULONG ulSegments, ULONG ulSessionId, ULONG ulCmdId,
+		COptimizerConfig *optimizer_config, IConstExprEvaluator *pceeval = NULL,
+		SOptimizerMetrics *metrics = NULL);
 
 	// execute the given minidump using the given MD accessor
 	static CDXLNode *PdxlnExecuteMinidump(
 		CMemoryPool *mp, CMDAccessor *md_accessor, CDXLMinidump *pdxlmd,
 		const CHAR *file_name, ULONG ulSegments, ULONG ulSessionId,
 		ULONG ulCmdId, COptimizerConfig *optimizer_config,
-		IConstExprEvaluator *pceeval);
+		IConstExprEvaluator *pceeval, SOptimizerMetrics *metrics = NULL);
 
 };	// class CMinidumperUtils
 
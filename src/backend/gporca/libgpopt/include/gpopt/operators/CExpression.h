@@ -237,6 +237,9 @@ public:
 	// reset expression stats
 	void ResetStats();
 
+	// attach stats derived for an equivalent expression
+	void InitStats(IStatistics *stats);
+
 	// compute required plan properties of all expression nodes
 	CReqdPropPlan *PrppCompute(CMemoryPool *mp, CReqdPropPlan *prppInput);
 
@@ -333,6 +333,10 @@ public:
 	// helper to compute skew estimate based on given stats and distribution spec
 	static CDouble GetSkew(IStatistics *stats, CDistributionSpec *pds);
 
+	// helper to estimate the fraction of the rows that a hashed distribution
+	// puts on its most loaded segment because of a single frequent value
+	static CDouble GetMaxValueFreq(IStatistics *stats, CDistributionSpec *pds);
+
 	// type of operator
 	virtual BOOL
 	FPhysical() const
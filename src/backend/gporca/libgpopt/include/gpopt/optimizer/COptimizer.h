@@ -15,6 +15,7 @@
 
 #include "gpopt/eval/CConstExprEvaluatorDefault.h"
 #include "gpopt/search/CSearchStage.h"
+#include "gpopt/xforms/CXform.h"
 #include "naucrates/dxl/operators/CDXLNode.h"
 
 namespace gpdxl
@@ -39,6 +40,92 @@ class COptimizerConfig;
 class CQueryContext;
 class CEnumeratorConfig;
 
+//---------------------------------------------------------------------------
+//	@struct:
+//		SOptimizerMetrics
+//
+//	@doc:
+//		Size of the search space explored by a single optimization, filled
+//		in on request of the caller. Stage and xform times are only filled
+//		in when optimization statistics are collected
+//
+//---------------------------------------------------------------------------
+struct SOptimizerMetrics
+{
+	// number of search stages whose time is reported
+	static const ULONG MaxStages = 16;
+
+	// number of groups in the memo
+	ULONG m_ulGroups;
+
+	// number of groups found to be duplicates of other groups
+	ULONG m_ulDuplicateGroups;
+
+	// number of group expressions in the memo
+	ULONG m_ulGroupExprs;
+
+	// number of jobs completed by the scheduler
+	ULLONG m_ullJobs;
+
+	// number of candidate xforms dropped by the operator index of the xform
+	// factory before scheduling
+	ULLONG m_ullXformsFiltered;
+
+	// number of candidate xforms dropped by the pattern pre-check before
+	// scheduling
+	ULLONG m_ullPatternMismatches;
+
+	// number of search stages run
+	ULONG m_ulSearchStages;
+
+	// was the search degraded because of the memory budget
+	BOOL m_fDegraded;
+
+	// search stage in which the search was degraded
+	ULONG m_ulDegradedStage;
+
+	// memory of the optimizer in bytes when the search was degraded
+	ULLONG m_ullDegradedMemory;
+
+	// user time of each of the first MaxStages search stages in msec
+	ULONG m_rgulStageTime[MaxStages];
+
+	// number of times each xform was applied to a binding
+	ULLONG m_rgullXformCalls[CXform::ExfSentinel];
+
+	// user time spent in each xform in usec
+	ULLONG m_rgullXformTime[CXform::ExfSentinel];
+
+	// number of alternatives generated by each xform
+	ULLONG m_rgullXformResults[CXform::ExfSentinel];
+
+	// ctor
+	SOptimizerMetrics()
+		: m_ulGroups(0),
+		  m_ulDuplicateGroups(0),
+		  m_ulGroupExprs(0),
+		  m_ullJobs(0),
+		  m_ullXformsFiltered(0),
+		  m_ullPatternMismatches(0),
+		  m_ulSearchStages(0),
+		  m_fDegraded(false),
+		  m_ulDegradedStage(0),
+		  m_ullDegradedMemory(0)
+	{
+		for (ULONG ul = 0; ul < MaxStages; ul++)
+		{
+			m_rgulStageTime[ul] = 0;
+		}
+
+		for (ULONG ul = 0; ul < CXform::ExfSentinel; ul++)
+		{
+			m_rgullXformCalls[ul] = 0;
+			m_rgullXformTime[ul] = 0;
+			m_rgullXformResults[ul] = 0;
+		}
+	}
+};
+
 //---------------------------------------------------------------------------
 //	@class:
 //		COptimizer
@@ -55,7 +142,8 @@ private:
 
 	// optimize query in the given query context
 	static CExpression *PexprOptimize(CMemoryPool *mp, CQueryContext *pqc,
-									  CSearchStageArray *search_stage_array);
+									  CSearchStageArray *search_stage_array,
+									  SOptimizerMetrics *metrics);
 
 	// translate an optimizer expression into a DXL tree
 	static CDXLNode *CreateDXLNode(CMemoryPool *mp, CMDAccessor *md_accessor,
@@ -97,7 +185,9 @@ public:
 		CSearchStageArray *search_stage_array,	// search strategy
 		COptimizerConfig *optimizer_config,		// optimizer configurations
 		const CHAR *szMinidumpFileName =
-			NULL  // name of minidump file to be created
+			NULL,  // name of minidump file to be created
+		SOptimizerMetrics *metrics =
+			NULL  // if given, receives the size of the search space
 	);
 };	// class COptimizer
 }  // namespace gpopt
@@ -185,6 +185,13 @@ public:
 	// resume suspended job
 	void Resume(CJob *pj);
 
+	// number of jobs completed so far
+	ULONG_PTR
+	UlpJobsCompleted() const
+	{
+		return m_ulpStatsCompleted;
+	}
+
 	// print statistics
 	void PrintStats() const;
 
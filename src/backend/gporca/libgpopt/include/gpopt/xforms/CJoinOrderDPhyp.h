@@ -0,0 +1,256 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CJoinOrderDPhyp.h
+//
+//	@doc:
+//		Join order generation using dynamic programming over the join
+//		hypergraph (DPhyp)
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CJoinOrderDPhyp_H
+#define GPOPT_CJoinOrderDPhyp_H
+
+#include "gpos/base.h"
+#include "gpos/common/CBitSet.h"
+#include "gpos/common/CHashMap.h"
+#include "gpos/common/DbgPrintMixin.h"
+#include "gpos/io/IOstream.h"
+
+#include "gpopt/base/CKHeap.h"
+#include "gpopt/base/CUtils.h"
+#include "gpopt/operators/CExpression.h"
+#include "gpopt/xforms/CJoinOrder.h"
+
+// sets of atoms are kept as bit masks, which limits the number of atoms
+#define GPOPT_DPHYP_MAX_ATOMS 64
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CJoinOrderDPhyp
+//
+//	@doc:
+//		Helper class for creating join orders using dynamic programming over
+//		the join hypergraph, following "Dynamic Programming Strikes Back"
+//		(Moerkotte, Neumann, SIGMOD 2008).
+//
+//		The atoms (children of the NAry join) are the nodes of the graph,
+//		the join predicates are its (hyper)edges. Instead of enumerating all
+//		pairs of sets of atoms and discarding the ones that are not
+//		connected, like CJoinOrderDP and CJoinOrderDPv2 do, the enumeration
+//		only visits pairs of a connected subgraph and a connected complement
+//		that are joined by an edge (csg-cmp pairs). Every such pair is visited
+//		exactly once, and all pairs of a set are visited before the set is
+//		used to build a larger one. For sparse graphs, like chains, stars of
+//		moderate size and snowflakes, this is a small fraction of the pairs
+//		visited by the other enumerators.
+//
+//		Non-inner joins (NIJs) follow the rules of CJoinOrderDPv2: the right
+//		child of an NIJ can only appear as the right side of a join whose
+//		left side contains all the atoms referenced in its ON predicate.
+//		Cross products are only considered between the connected components
+//		of the graph.
+//
+//		The number of visited pairs is limited to the number of pairs of an
+//		exhaustive search of a clique of optimizer_join_order_threshold
+//		atoms. When that budget is exceeded, or when the graph has no valid
+//		plan for all atoms, the join order is completed greedily.
+//
+//---------------------------------------------------------------------------
+class CJoinOrderDPhyp : public CJoinOrder,
+						public gpos::DbgPrintMixin<CJoinOrderDPhyp>
+{
+private:
+	//---------------------------------------------------------------------------
+	//	@struct:
+	//		SPlanInfo
+	//
+	//	@doc:
+	//		Best plan found for a set of atoms
+	//
+	//---------------------------------------------------------------------------
+	struct SPlanInfo : public CRefCount
+	{
+		// join expression, with derived stats for the plans of the DP table
+		CExpression *m_expr;
+
+		// cardinality of the set of atoms
+		CDouble m_rows;
+
+		// cost of the expression
+		CDouble m_cost;
+
+		// inner join and ON predicates (indexes into m_rgpedge) used in
+		// the expression
+		CBitSet *m_edges;
+
+		// ctor
+		SPlanInfo(CExpression *expr, CDouble rows, CDouble cost,
+				  CBitSet *edges)
+			: m_expr(expr), m_rows(rows), m_cost(cost), m_edges(edges)
+		{
+		}
+
+		// dtor
+		virtual ~SPlanInfo()
+		{
+			m_expr->Release();
+			m_edges->Release();
+		}
+
+		// cost used to find the top k plans
+		CDouble
+		GetCostForHeap() const
+		{
+			return m_cost;
+		}
+	};
+
+	typedef CDynamicPtrArray<SPlanInfo, CleanupRelease<SPlanInfo> >
+		SPlanInfoArray;
+
+	// DP table, mapping a set of atoms to its best plan
+	typedef CHashMap<ULLONG, SPlanInfo, gpos::HashValue<ULLONG>,
+					 gpos::Equals<ULLONG>, CleanupDelete<ULLONG>,
+					 CleanupRelease<SPlanInfo> >
+		AtomSetToPlanMap;
+
+	// best plan of every set of atoms that has a valid plan
+	AtomSetToPlanMap *m_plans;
+
+	// plans producing all atoms
+	CKHeap<SPlanInfoArray, SPlanInfo> *m_top_k_plans;
+
+	// set of all atoms
+	ULLONG m_all_atoms;
+
+	// atoms covered by each edge
+	ULLONG *m_edge_atoms;
+
+	// hyperedges of the graph: edges covering two atoms or more, and the
+	// edges added between connected components for cross products
+	ULLONG *m_hyperedges;
+
+	// number of hyperedges
+	ULONG m_num_hyperedges;
+
+	// atoms that are the right child of an NIJ
+	ULLONG m_nij_right_children;
+
+	// for the right child of an NIJ, the atoms needed on the left side
+	ULLONG *m_nij_dependencies;
+
+	// ON predicates of the NIJs
+	CExpressionArray *m_on_pred_conjuncts;
+
+	// for each atom, 0 for inner joins, or the 1-based index of the ON
+	// predicate if the atom is the right child of an NIJ
+	ULongPtrArray *m_child_pred_indexes;
+
+	// number of csg-cmp pairs visited so far
+	ULLONG m_num_pairs;
+
+	// maximum number of csg-cmp pairs to visit
+	ULLONG m_pair_budget;
+
+	// was the enumeration stopped because of the budget
+	BOOL m_budget_exceeded;
+
+	// penalty factor for joins that can't use a hash join
+	CDouble m_cross_prod_penalty;
+
+	// private copy ctor
+	CJoinOrderDPhyp(const CJoinOrderDPhyp &);
+
+	// add a hyperedge, unless it is already in the graph
+	void AddHyperedge(ULLONG edge);
+
+	// add edges between the connected components of the graph
+	void AddCrossProductEdges();
+
+	// the atoms that can be added to the given set, one per hyperedge
+	ULLONG Neighborhood(ULLONG atoms, ULLONG excluded) const;
+
+	// is there an edge joining the two sets
+	BOOL IsConnected(ULLONG atoms1, ULLONG atoms2) const;
+
+	// is the given set a single atom that is the right child of an NIJ
+	BOOL IsRightChildOfNIJ(ULLONG atoms) const;
+
+	// can the two sets be joined in the given order
+	BOOL IsValidJoin(ULLONG left_atoms, ULLONG right_atoms) const;
+
+	// best plan of the given set, NULL if there is none yet
+	SPlanInfo *LookupPlan(ULLONG atoms) const;
+
+	// build the predicate of an inner join of two sets
+	CExpression *PexprBuildInnerJoinPred(ULLONG left_atoms,
+										 ULLONG right_atoms, CBitSet *edges);
+
+	// join the best plans of two sets and update the DP table
+	SPlanInfo *JoinPlans(ULLONG left_atoms, ULLONG right_atoms);
+
+	// enumeration of csg-cmp pairs
+	void EnumerateCsgRec(ULLONG atoms, ULLONG excluded);
+	void EmitCsg(ULLONG atoms);
+	void EnumerateCmpRec(ULLONG atoms1, ULLONG atoms2, ULLONG excluded);
+	void EmitCsgCmp(ULLONG atoms1, ULLONG atoms2);
+
+	// complete the join order greedily
+	void EnumerateGreedy();
+
+	// add a select node with the predicates not used in the join tree
+	CExpression *AddSelectNodeForRemainingEdges(CExpression *join_expr,
+												CBitSet *used_edges);
+
+	// number of csg-cmp pairs of a clique of the given size
+	static ULLONG NumCsgCmpPairsOfClique(ULONG num_atoms);
+
+protected:
+	// derive stats on a given expression
+	virtual void DeriveStats(CExpression *pexpr);
+
+public:
+	// ctor
+	CJoinOrderDPhyp(CMemoryPool *mp, CExpressionArray *pdrgpexprAtoms,
+					CExpressionArray *innerJoinConjuncts,
+					CExpressionArray *onPredConjuncts,
+					ULongPtrArray *childPredIndexes);
+
+	// dtor
+	virtual ~CJoinOrderDPhyp();
+
+	// main handler
+	void PexprExpand();
+
+	// next of the top k join orders, NULL if there are no more
+	CExpression *GetNextOfTopK();
+
+	// number of csg-cmp pairs visited
+	ULLONG
+	NumPairs() const
+	{
+		return m_num_pairs;
+	}
+
+	// print function
+	virtual IOstream &OsPrint(IOstream &) const;
+
+	virtual CXform::EXformId
+	EOriginXForm() const
+	{
+		return CXform::ExfExpandNAryJoinDPhyp;
+	}
+
+};	// class CJoinOrderDPhyp
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_CJoinOrderDPhyp_H
+
+// EOF
@@ -410,6 +410,13 @@ private:
 						 CleanupRelease<CBitSet>, CleanupRelease<SGroupInfo> >
 		BitSetToGroupInfoMapIter;
 
+	// map from a set of atoms to the stats of their join; the predicates
+	// applied to a set of atoms are determined by the set itself, so the
+	// atoms alone identify the stats
+	typedef CHashMap<CBitSet, IStatistics, UlHashBitSet, FEqualBitSet,
+					 CleanupRelease<CBitSet>, CleanupStats>
+		BitSetToStatsMap;
+
 	// dynamic array of SLevelInfos, where each index represents the level
 	typedef CDynamicPtrArray<SLevelInfo, CleanupRelease<SLevelInfo> >
 		DPv2Levels;
@@ -424,6 +431,16 @@ private:
 	// map to check whether a DPv2 group already exists
 	BitSetToGroupInfoMap *m_bitset_to_group_info_map;
 
+	// stats derived so far, kept for groups that get pruned and are later
+	// recreated by another enumeration algorithm
+	BitSetToStatsMap *m_bitset_to_stats_map;
+
+	// number of group stats found in m_bitset_to_stats_map
+	ULONG m_stats_cache_hits;
+
+	// number of group stats that had to be derived
+	ULONG m_stats_cache_misses;
+
 	// ON predicates for NIJs (non-inner joins, e.g. LOJs)
 	// currently NIJs are LOJs only, this may change in the future
 	// if/when we add semijoins, anti-semijoins and relatives
@@ -482,6 +499,10 @@ private:
 
 	virtual void DeriveStats(CExpression *pexpr);
 
+	// derive stats of an expression joining the given atoms, reusing the
+	// stats derived earlier for the same atoms
+	void DeriveStatsForAtoms(CBitSet *atoms, CExpression *pexpr);
+
 	// create a CLogicalJoin and a CExpression to join two groups, for a required property
 	SExpressionInfo *GetJoinExprForProperties(
 		SGroupInfo *left_child, SGroupInfo *right_child,
@@ -555,6 +576,27 @@ public:
 
 	CExpression *GetNextOfTopK();
 
+	// number of group stats found in the stats cache
+	ULONG
+	StatsCacheHits() const
+	{
+		return m_stats_cache_hits;
+	}
+
+	// number of group stats that had to be derived
+	ULONG
+	StatsCacheMisses() const
+	{
+		return m_stats_cache_misses;
+	}
+
+	// number of sets of atoms in the stats cache
+	ULONG
+	StatsCacheEntries() const
+	{
+		return m_bitset_to_stats_map->Size();
+	}
+
 	// check for NIJs
 	BOOL IsRightChildOfNIJ(SGroupInfo *groupInfo,
 						   CExpression **onPredToUse = NULL,
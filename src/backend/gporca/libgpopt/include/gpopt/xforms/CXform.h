@@ -31,6 +31,11 @@
 #define GPOPT_FENABLED_XFORM(x) !GPOS_FTRACE(GPOPT_DISABLE_XFORM_TF(x))
 #define GPOPT_FDISABLED_XFORM(x) GPOS_FTRACE(GPOPT_DISABLE_XFORM_TF(x))
 
+// Macro for checking if xform statistics are collected
+#define GPOPT_FCOLLECT_XFORM_STATS()                      \
+	(GPOS_FTRACE(EopttracePrintOptimizationStatistics) || \
+	 GPOS_FTRACE(EopttraceCollectOptimizationStatistics))
+
 
 namespace gpopt
 {
@@ -224,6 +229,7 @@ public:
 		ExfLeftJoin2RightJoin,
 		ExfRightOuterJoin2HashJoin,
 		ExfImplementInnerJoin,
+		ExfExpandNAryJoinDPhyp,
 		ExfInvalid,
 		ExfSentinel = ExfInvalid
 	};
@@ -341,6 +347,9 @@ public:
 	// returns a set containing xforms to use for exhaustive2 join order
 	static CBitSet *PbsJoinOrderOnExhaustive2Xforms(CMemoryPool *mp);
 
+	// returns a set containing xforms to use for hypergraph join ordering
+	static CBitSet *PbsJoinOrderOnHypergraphXforms(CMemoryPool *mp);
+
 	// return true if xform should be applied only once.
 	// for expression of type CPatternTree, in deep trees, the number
 	// of expressions generated for group expression can be significantly
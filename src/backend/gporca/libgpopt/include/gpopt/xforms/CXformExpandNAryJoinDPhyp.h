@@ -0,0 +1,82 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CXformExpandNAryJoinDPhyp.h
+//
+//	@doc:
+//		Expand n-ary join into series of binary joins using dynamic
+//		programming over the join hypergraph
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformExpandNAryJoinDPhyp_H
+#define GPOPT_CXformExpandNAryJoinDPhyp_H
+
+#include "gpos/base.h"
+
+#include "gpopt/xforms/CXformExploration.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformExpandNAryJoinDPhyp
+//
+//	@doc:
+//		Expand n-ary join into series of binary joins using dynamic
+//		programming over the join hypergraph, see CJoinOrderDPhyp
+//
+//---------------------------------------------------------------------------
+class CXformExpandNAryJoinDPhyp : public CXformExploration
+{
+private:
+	// private copy ctor
+	CXformExpandNAryJoinDPhyp(const CXformExpandNAryJoinDPhyp &);
+
+public:
+	// ctor
+	explicit CXformExpandNAryJoinDPhyp(CMemoryPool *mp);
+
+	// dtor
+	virtual ~CXformExpandNAryJoinDPhyp()
+	{
+	}
+
+	// ident accessors
+	virtual EXformId
+	Exfid() const
+	{
+		return ExfExpandNAryJoinDPhyp;
+	}
+
+	// return a string for xform name
+	virtual const CHAR *
+	SzId() const
+	{
+		return "CXformExpandNAryJoinDPhyp";
+	}
+
+	// compute xform promise for a given expression handle
+	virtual EXformPromise Exfp(CExpressionHandle &exprhdl) const;
+
+	// do stats need to be computed before applying xform?
+	virtual BOOL
+	FNeedsStats() const
+	{
+		return true;
+	}
+
+	// actual transform
+	void Transform(CXformContext *pxfctxt, CXformResult *pxfres,
+				   CExpression *pexpr) const;
+
+};	// class CXformExpandNAryJoinDPhyp
+
+}  // namespace gpopt
+
+
+#endif	// !GPOPT_CXformExpandNAryJoinDPhyp_H
+
+// EOF
@@ -13,6 +13,7 @@
 
 #include "gpos/base.h"
 
+#include "gpopt/operators/COperator.h"
 #include "gpopt/xforms/CXform.h"
 
 namespace gpopt
@@ -50,6 +51,10 @@ private:
 	// bitset of implementation xforms
 	CXformSet *m_pxfsImplementation;
 
+	// bitsets of the xforms whose pattern can match an expression rooted
+	// at a given operator, indexed by operator id
+	CXformSet *m_rgpxfsOperator[COperator::EopSentinel];
+
 	// ensure that xforms are inserted in order
 	ULONG m_lastAddedOrSkippedXformId;
 
@@ -65,6 +70,9 @@ private:
 	// actual adding of xform
 	void Add(CXform *pxform);
 
+	// index the xforms by the operators their patterns can match
+	void IndexByOperator();
+
 	// skip unused xforms that have been removed, preserving
 	// xform ids of the remaining ones
 	void
@@ -100,6 +108,16 @@ public:
 		return m_pxfsImplementation;
 	}
 
+	// accessor of the xforms whose pattern can match an expression rooted
+	// at the given operator
+	CXformSet *
+	PxfsOperator(COperator::EOperatorId eopid) const
+	{
+		GPOS_ASSERT(COperator::EopSentinel > eopid);
+
+		return m_rgpxfsOperator[eopid];
+	}
+
 	// is this xform id still used?
 	BOOL IsXformIdUsed(CXform::EXformId exfid);
 
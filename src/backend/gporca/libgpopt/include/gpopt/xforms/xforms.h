@@ -35,6 +35,7 @@
 #include "gpopt/xforms/CXformExpandFullOuterJoin.h"
 #include "gpopt/xforms/CXformExpandNAryJoin.h"
 #include "gpopt/xforms/CXformExpandNAryJoinDP.h"
+#include "gpopt/xforms/CXformExpandNAryJoinDPhyp.h"
 #include "gpopt/xforms/CXformExpandNAryJoinDPv2.h"
 #include "gpopt/xforms/CXformExpandNAryJoinGreedy.h"
 #include "gpopt/xforms/CXformExpandNAryJoinMinCard.h"
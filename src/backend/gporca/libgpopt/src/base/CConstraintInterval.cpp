@@ -1067,6 +1067,16 @@ CConstraintInterval::PciIntersect(CMemoryPool *mp, CConstraintInterval *pci)
 
 	CRangeArray *pdrgprngOther = pci->Pdrgprng();
 
+	if (FPointRanges(m_pdrgprng) && FPointRanges(pdrgprngOther))
+	{
+		// intersection of two IN lists
+		return GPOS_NEW(mp) CConstraintInterval(
+			mp, m_pcr,
+			PdrgprngMergePoints(mp, m_pdrgprng, pdrgprngOther,
+								false /*fUnion*/),
+			m_fIncludesNull && pci->FIncludesNull());
+	}
+
 	CRangeArray *pdrgprngNew = GPOS_NEW(mp) CRangeArray(mp);
 
 	ULONG ulFst = 0;
@@ -1116,6 +1126,16 @@ CConstraintInterval::PciUnion(CMemoryPool *mp, CConstraintInterval *pci)
 
 	CRangeArray *pdrgprngOther = pci->Pdrgprng();
 
+	if (FPointRanges(m_pdrgprng) && FPointRanges(pdrgprngOther))
+	{
+		// union of two IN lists, or of the disjuncts of an expanded IN list
+		return GPOS_NEW(mp) CConstraintInterval(
+			mp, m_pcr,
+			PdrgprngMergePoints(mp, m_pdrgprng, pdrgprngOther,
+								true /*fUnion*/),
+			m_fIncludesNull || pci->FIncludesNull());
+	}
+
 	CRangeArray *pdrgprngNew = GPOS_NEW(mp) CRangeArray(mp);
 
 	ULONG ulFst = 0;
@@ -1453,6 +1473,140 @@ CConstraintInterval::AppendOrExtend(CMemoryPool *mp, CRangeArray *pdrgprng,
 	}
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintInterval::FPointRanges
+//
+//	@doc:
+//		Does the array only contain point ranges [x, x] with the same datum
+//		on both ends, like the ranges built for IN lists and equalities.
+//		This does not call the comparator
+//
+//---------------------------------------------------------------------------
+BOOL
+CConstraintInterval::FPointRanges(CRangeArray *pdrgprng)
+{
+	const ULONG length = pdrgprng->Size();
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		CRange *prange = (*pdrgprng)[ul];
+		if (NULL == prange->PdatumLeft() ||
+			prange->PdatumLeft() != prange->PdatumRight() ||
+			CRange::EriIncluded != prange->EriLeft() ||
+			CRange::EriIncluded != prange->EriRight())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintInterval::PdrgprngMergePoints
+//
+//	@doc:
+//		Union or intersection of two sorted arrays of point ranges. Points
+//		cannot be extended into larger ranges, so the arrays are merged with
+//		a single comparison of their points per step, and the ranges of the
+//		inputs are shared with the result. Integer points of the same type
+//		are compared on their values
+//
+//---------------------------------------------------------------------------
+CRangeArray *
+CConstraintInterval::PdrgprngMergePoints(CMemoryPool *mp,
+										 CRangeArray *pdrgprngFst,
+										 CRangeArray *pdrgprngSnd,
+										 BOOL fUnion)
+{
+	GPOS_ASSERT(FPointRanges(pdrgprngFst) && FPointRanges(pdrgprngSnd));
+
+	const IComparator *pcomp = COptCtxt::PoctxtFromTLS()->Pcomp();
+	const ULONG ulNumRangesFst = pdrgprngFst->Size();
+	const ULONG ulNumRangesSnd = pdrgprngSnd->Size();
+
+	BOOL fIntPoints = false;
+	if (0 < ulNumRangesFst && 0 < ulNumRangesSnd)
+	{
+		IMDId *mdid = (*pdrgprngFst)[0]->MDId();
+		fIntPoints = mdid->Equals((*pdrgprngSnd)[0]->MDId()) &&
+					 CUtils::FIntType(mdid);
+	}
+
+	CRangeArray *pdrgprngNew = GPOS_NEW(mp) CRangeArray(mp);
+
+	ULONG ulFst = 0;
+	ULONG ulSnd = 0;
+	while (ulFst < ulNumRangesFst && ulSnd < ulNumRangesSnd)
+	{
+		CRange *prangeFst = (*pdrgprngFst)[ulFst];
+		CRange *prangeSnd = (*pdrgprngSnd)[ulSnd];
+		IDatum *pdatumFst = prangeFst->PdatumLeft();
+		IDatum *pdatumSnd = prangeSnd->PdatumLeft();
+
+		BOOL fLess = false;
+		BOOL fEqual = false;
+		if (fIntPoints)
+		{
+			LINT lFst = pdatumFst->GetLINTMapping();
+			LINT lSnd = pdatumSnd->GetLINTMapping();
+			fLess = lFst < lSnd;
+			fEqual = lFst == lSnd;
+		}
+		else
+		{
+			fLess = pcomp->IsLessThan(pdatumFst, pdatumSnd);
+			fEqual = !fLess && pcomp->Equals(pdatumFst, pdatumSnd);
+		}
+
+		if (fEqual)
+		{
+			prangeFst->AddRef();
+			pdrgprngNew->Append(prangeFst);
+			ulFst++;
+			ulSnd++;
+		}
+		else if (fLess)
+		{
+			if (fUnion)
+			{
+				prangeFst->AddRef();
+				pdrgprngNew->Append(prangeFst);
+			}
+			ulFst++;
+		}
+		else
+		{
+			if (fUnion)
+			{
+				prangeSnd->AddRef();
+				pdrgprngNew->Append(prangeSnd);
+			}
+			ulSnd++;
+		}
+	}
+
+	if (fUnion)
+	{
+		for (; ulFst < ulNumRangesFst; ulFst++)
+		{
+			CRange *prange = (*pdrgprngFst)[ulFst];
+			prange->AddRef();
+			pdrgprngNew->Append(prange);
+		}
+
+		for (; ulSnd < ulNumRangesSnd; ulSnd++)
+		{
+			CRange *prange = (*pdrgprngSnd)[ulSnd];
+			prange->AddRef();
+			pdrgprngNew->Append(prange);
+		}
+	}
+
+	return pdrgprngNew;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CConstraintInterval::OsPrint
@@ -693,14 +693,28 @@ CCostContext::DRowsPerHost() const
 												 pdrgpul, NULL /*keys*/);
 		pdrgpul->Release();
 
+		DOUBLE dRowsPerHost = rows / ulHosts;
 		if (dNDVs < ulHosts)
 		{
 			// estimated number of distinct values of distribution columns is smaller than number of hosts.
 			// We assume data is distributed across a subset of hosts in this case. This results in a larger
 			// number of rows per host compared to the uniform case, allowing us to capture data skew in
 			// cost computation
-			return CDouble(rows / dNDVs.Get());
+			dRowsPerHost = rows / dNDVs.Get();
 		}
+
+		if (GPOS_FTRACE(EopttracePenalizeHeavyHitters) &&
+			!GPOS_FTRACE(EopttracePenalizeSkewedHashJoin))
+		{
+			// all the rows of a heavy hitter, a value more frequent than a
+			// host's share of the rows, end up on the same host, which
+			// then processes more rows than the others; cost for that host
+			DOUBLE dMaxValueFreq =
+				CPhysical::GetMaxValueFreq(Pstats(), pds).Get();
+			dRowsPerHost = std::max(dRowsPerHost, rows * dMaxValueFreq);
+		}
+
+		return CDouble(dRowsPerHost);
 	}
 
 	return CDouble(rows / ulHosts);
@@ -4,13 +4,80 @@
 #include "gpopt/base/CDatumSortedSet.h"
 
 #include "gpos/common/CAutoRef.h"
+#include "gpos/common/CAutoRg.h"
 
+#include "gpopt/base/COptCtxt.h"
 #include "gpopt/base/CUtils.h"
 #include "gpopt/operators/COperator.h"
 #include "gpopt/operators/CScalarConst.h"
 
 using namespace gpopt;
 
+// integer datum with its value, used to sort integer arrays
+struct SIntDatum
+{
+	LINT m_value;
+	IDatum *m_datum;
+};
+
+// compare integer datums on their values
+static INT
+IIntDatumCmp(const void *val1, const void *val2)
+{
+	const SIntDatum *pintdatum1 = (const SIntDatum *) val1;
+	const SIntDatum *pintdatum2 = (const SIntDatum *) val2;
+
+	if (pintdatum1->m_value < pintdatum2->m_value)
+	{
+		return -1;
+	}
+
+	if (pintdatum1->m_value > pintdatum2->m_value)
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+// compare datums using the comparator; the datums are distinct in most
+// cases, so this tests for less than first and needs a single evaluation for
+// half of the pairs, where CUtils::IDatumCmp always needs two
+static INT
+IDistinctDatumCmp(const void *val1, const void *val2)
+{
+	const IDatum *dat1 = *(IDatum **) (val1);
+	const IDatum *dat2 = *(IDatum **) (val2);
+
+	const IComparator *pcomp = COptCtxt::PoctxtFromTLS()->Pcomp();
+
+	if (pcomp->IsLessThan(dat1, dat2))
+	{
+		return -1;
+	}
+
+	if (pcomp->IsLessThan(dat2, dat1))
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+// hash of a datum on its bytes
+ULONG
+CDatumSortedSet::UlHashDatum(const IDatum *datum)
+{
+	return datum->HashValue();
+}
+
+// equality of datums on their bytes
+BOOL
+CDatumSortedSet::FMatchDatums(const IDatum *datum1, const IDatum *datum2)
+{
+	return datum1->Matches(datum2);
+}
+
 CDatumSortedSet::CDatumSortedSet(CMemoryPool *mp, CExpression *pexprArray,
 								 const IComparator *pcomp)
 	: IDatumArray(mp), m_fIncludesNull(false)
@@ -21,6 +88,8 @@ CDatumSortedSet::CDatumSortedSet(CMemoryPool *mp, CExpression *pexprArray,
 	GPOS_ASSERT(0 < ulArrayExprArity);
 
 	gpos::CAutoRef<IDatumArray> aprngdatum(GPOS_NEW(mp) IDatumArray(mp));
+	BOOL fIntDatums = true;
+	IMDId *mdid = NULL;
 	for (ULONG ul = 0; ul < ulArrayExprArity; ul++)
 	{
 		CScalarConst *popScConst =
@@ -34,22 +103,115 @@ CDatumSortedSet::CDatumSortedSet(CMemoryPool *mp, CExpression *pexprArray,
 		{
 			datum->AddRef();
 			aprngdatum->Append(datum);
+
+			// integers can be sorted on their values if they are all of the
+			// same type
+			if (NULL == mdid)
+			{
+				mdid = datum->MDId();
+				fIntDatums = CUtils::FIntType(mdid);
+			}
+			else if (fIntDatums)
+			{
+				fIntDatums = mdid->Equals(datum->MDId());
+			}
 		}
 	}
-	aprngdatum->Sort(&CUtils::IDatumCmp);
+
+	if (0 == aprngdatum->Size())
+	{
+		return;
+	}
+
+	if (fIntDatums)
+	{
+		SortIntDatums(mp, aprngdatum.Value());
+	}
+	else
+	{
+		SortDatums(mp, aprngdatum.Value(), pcomp);
+	}
+}
+
+// sort and de-duplicate integer datums on their values
+void
+CDatumSortedSet::SortIntDatums(CMemoryPool *mp, IDatumArray *pdrgpdatum)
+{
+	const ULONG size = pdrgpdatum->Size();
+	SIntDatum *rgintdatum = GPOS_NEW_ARRAY(mp, SIntDatum, size);
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		IDatum *datum = (*pdrgpdatum)[ul];
+		GPOS_ASSERT(datum->IsDatumMappableToLINT());
+
+		rgintdatum[ul].m_value = datum->GetLINTMapping();
+		rgintdatum[ul].m_datum = datum;
+	}
+	clib::Qsort(rgintdatum, size, sizeof(SIntDatum), IIntDatumCmp);
 
 	// de-duplicate
-	const ULONG ulRangeArrayArity = aprngdatum->Size();
-	IDatum *pdatumPrev = (*aprngdatum)[0];
-	pdatumPrev->AddRef();
-	Append(pdatumPrev);
-	for (ULONG ul = 1; ul < ulRangeArrayArity; ul++)
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		if (0 == ul || rgintdatum[ul].m_value != rgintdatum[ul - 1].m_value)
+		{
+			rgintdatum[ul].m_datum->AddRef();
+			Append(rgintdatum[ul].m_datum);
+		}
+	}
+
+	GPOS_DELETE_ARRAY(rgintdatum);
+}
+
+// sort and de-duplicate datums using the comparator
+void
+CDatumSortedSet::SortDatums(CMemoryPool *mp, IDatumArray *pdrgpdatum,
+							const IComparator *pcomp)
+{
+	// remove datums with the same bytes before sorting, so that repeated
+	// constants do not go through the comparator
+	const ULONG size = pdrgpdatum->Size();
+	DatumHashSet *phsdatum = GPOS_NEW(mp) DatumHashSet(mp, size);
+	gpos::CAutoRef<IDatumArray> apdrgpdatumDistinct(GPOS_NEW(mp)
+														IDatumArray(mp));
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		IDatum *datum = (*pdrgpdatum)[ul];
+		if (phsdatum->Insert(datum))
+		{
+			datum->AddRef();
+			apdrgpdatumDistinct->Append(datum);
+		}
+	}
+	phsdatum->Release();
+
+	apdrgpdatumDistinct->Sort(&IDistinctDatumCmp);
+
+	// de-duplicate values that are equal but have different bytes; in the
+	// sorted array a datum equals the last one kept iff it equals its
+	// predecessor, so all the tests are independent and go to the comparator
+	// in one batch
+	const ULONG ulDistinct = apdrgpdatumDistinct->Size();
+	gpos::CAutoRef<IDatumArray> apdrgpdatumPrev(GPOS_NEW(mp) IDatumArray(mp));
+	gpos::CAutoRef<IDatumArray> apdrgpdatumNext(GPOS_NEW(mp) IDatumArray(mp));
+	for (ULONG ul = 1; ul < ulDistinct; ul++)
+	{
+		(*apdrgpdatumDistinct)[ul - 1]->AddRef();
+		apdrgpdatumPrev->Append((*apdrgpdatumDistinct)[ul - 1]);
+		(*apdrgpdatumDistinct)[ul]->AddRef();
+		apdrgpdatumNext->Append((*apdrgpdatumDistinct)[ul]);
+	}
+
+	CAutoRg<BOOL> argfEqual(GPOS_NEW_ARRAY(mp, BOOL, ulDistinct));
+	pcomp->EqualsBatch(apdrgpdatumPrev.Value(), apdrgpdatumNext.Value(),
+					   argfEqual.Rgt());
+
+	for (ULONG ul = 0; ul < ulDistinct; ul++)
 	{
-		if (!pcomp->Equals((*aprngdatum)[ul], pdatumPrev))
+		if (0 == ul || !argfEqual[ul - 1])
 		{
-			pdatumPrev = (*aprngdatum)[ul];
-			pdatumPrev->AddRef();
-			Append(pdatumPrev);
+			IDatum *datum = (*apdrgpdatumDistinct)[ul];
+			datum->AddRef();
+			Append(datum);
 		}
 	}
 }
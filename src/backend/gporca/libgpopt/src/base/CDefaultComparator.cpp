@@ -50,42 +50,101 @@ CDefaultComparator::CDefaultComparator(IConstExprEvaluator *pceeval)
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CDefaultComparator::PexprEvalComparison
+//		CDefaultComparator::PexprComparison
 //
 //	@doc:
-//		Constructs a comparison expression of type cmp_type between the two given
-//		data and evaluates it.
+//		Constructs a comparison expression of type cmp_type between the two
+//		given data
 //
 //---------------------------------------------------------------------------
-BOOL
-CDefaultComparator::FEvalComparison(CMemoryPool *mp, const IDatum *datum1,
+CExpression *
+CDefaultComparator::PexprComparison(CMemoryPool *mp, const IDatum *datum1,
 									const IDatum *datum2,
-									IMDType::ECmpType cmp_type) const
+									IMDType::ECmpType cmp_type)
 {
-	GPOS_ASSERT(m_pceeval->FCanEvalExpressions());
-
 	IDatum *pdatum1Copy = datum1->MakeCopy(mp);
 	CExpression *pexpr1 = GPOS_NEW(mp)
 		CExpression(mp, GPOS_NEW(mp) CScalarConst(mp, pdatum1Copy));
 	IDatum *pdatum2Copy = datum2->MakeCopy(mp);
 	CExpression *pexpr2 = GPOS_NEW(mp)
 		CExpression(mp, GPOS_NEW(mp) CScalarConst(mp, pdatum2Copy));
-	CExpression *pexprComp =
-		CUtils::PexprScalarCmp(mp, pexpr1, pexpr2, cmp_type);
 
-	CExpression *pexprResult = m_pceeval->PexprEval(pexprComp);
-	pexprComp->Release();
+	return CUtils::PexprScalarCmp(mp, pexpr1, pexpr2, cmp_type);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDefaultComparator::FComparisonResult
+//
+//	@doc:
+//		Value of the boolean constant an evaluated comparison results in
+//
+//---------------------------------------------------------------------------
+BOOL
+CDefaultComparator::FComparisonResult(CExpression *pexprResult)
+{
 	CScalarConst *popScalarConst = CScalarConst::PopConvert(pexprResult->Pop());
 	IDatum *datum = popScalarConst->GetDatum();
 
 	GPOS_ASSERT(IMDType::EtiBool == datum->GetDatumType());
 	IDatumBool *pdatumBool = dynamic_cast<IDatumBool *>(datum);
-	BOOL result = pdatumBool->GetValue();
+
+	return pdatumBool->GetValue();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDefaultComparator::FEvalComparison
+//
+//	@doc:
+//		Constructs a comparison expression of type cmp_type between the two given
+//		data and evaluates it.
+//
+//---------------------------------------------------------------------------
+BOOL
+CDefaultComparator::FEvalComparison(CMemoryPool *mp, const IDatum *datum1,
+									const IDatum *datum2,
+									IMDType::ECmpType cmp_type) const
+{
+	GPOS_ASSERT(m_pceeval->FCanEvalExpressions());
+
+	CExpression *pexprComp = PexprComparison(mp, datum1, datum2, cmp_type);
+	CExpression *pexprResult = m_pceeval->PexprEval(pexprComp);
+	pexprComp->Release();
+	BOOL result = FComparisonResult(pexprResult);
 	pexprResult->Release();
 
 	return result;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDefaultComparator::FEqualsNeedsEval
+//
+//	@doc:
+//		Does Equals need the evaluator for the two arguments, or can it
+//		answer on its own
+//
+//---------------------------------------------------------------------------
+BOOL
+CDefaultComparator::FEqualsNeedsEval(const IDatum *datum1,
+									 const IDatum *datum2)
+{
+	if (!CUtils::FConstrainableType(datum1->MDId()) ||
+		!CUtils::FConstrainableType(datum2->MDId()))
+	{
+		return false;
+	}
+
+	if (FUseBuiltinIntEvaluators() && CUtils::FIntType(datum1->MDId()) &&
+		CUtils::FIntType(datum2->MDId()))
+	{
+		return false;
+	}
+
+	return !(datum1->IsNull() && datum2->IsNull());
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDefaultComparator::Equals
@@ -278,4 +337,61 @@ CDefaultComparator::IsGreaterThanOrEqual(const IDatum *datum1,
 	return FEvalComparison(amp.Pmp(), datum1, datum2, IMDType::EcmptGEq);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDefaultComparator::EqualsBatch
+//
+//	@doc:
+//		Tests the datums at the same positions of the two arrays for
+//		equality. The comparisons that need the evaluator are sent to it in
+//		one batch, instead of one round trip per pair.
+//
+//---------------------------------------------------------------------------
+void
+CDefaultComparator::EqualsBatch(const IDatumArray *pdrgpdatumFst,
+								const IDatumArray *pdrgpdatumSnd,
+								BOOL *rgfEqual) const
+{
+	GPOS_ASSERT(pdrgpdatumFst->Size() == pdrgpdatumSnd->Size());
+
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	const ULONG size = pdrgpdatumFst->Size();
+	CExpressionArray *pdrgpexprComp = GPOS_NEW(mp) CExpressionArray(mp);
+	ULONG *rgulPos = GPOS_NEW_ARRAY(mp, ULONG, size);
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		const IDatum *datum1 = (*pdrgpdatumFst)[ul];
+		const IDatum *datum2 = (*pdrgpdatumSnd)[ul];
+		if (!FEqualsNeedsEval(datum1, datum2))
+		{
+			rgfEqual[ul] = Equals(datum1, datum2);
+			continue;
+		}
+
+		rgulPos[pdrgpexprComp->Size()] = ul;
+		pdrgpexprComp->Append(
+			PexprComparison(mp, datum1, datum2, IMDType::EcmptEq));
+	}
+
+	const ULONG ulComp = pdrgpexprComp->Size();
+	if (0 < ulComp)
+	{
+		GPOS_ASSERT(m_pceeval->FCanEvalExpressions());
+
+		CExpressionArray *pdrgpexprResult =
+			m_pceeval->PdrgpexprEval(mp, pdrgpexprComp);
+		GPOS_ASSERT(ulComp == pdrgpexprResult->Size());
+		for (ULONG ul = 0; ul < ulComp; ul++)
+		{
+			rgfEqual[rgulPos[ul]] = FComparisonResult((*pdrgpexprResult)[ul]);
+		}
+		pdrgpexprResult->Release();
+	}
+
+	GPOS_DELETE_ARRAY(rgulPos);
+	pdrgpexprComp->Release();
+}
+
 // EOF
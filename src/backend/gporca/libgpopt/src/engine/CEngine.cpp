@@ -39,6 +39,7 @@
 #include "gpopt/operators/CPhysicalAgg.h"
 #include "gpopt/operators/CPhysicalMotionGather.h"
 #include "gpopt/operators/CPhysicalSort.h"
+#include "gpopt/optimizer/COptimizer.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
 #include "gpopt/search/CBinding.h"
 #include "gpopt/search/CGroup.h"
@@ -85,7 +86,15 @@ CEngine::CEngine(CMemoryPool *mp)
 	  m_pdrgpulpXformCalls(NULL),
 	  m_pdrgpulpXformTimes(NULL),
 	  m_pdrgpulpXformBindings(NULL),
-	  m_pdrgpulpXformResults(NULL)
+	  m_pdrgpulpXformResults(NULL),
+	  m_ulpJobsCompleted(0),
+	  m_pdrgpulStageTimes(NULL),
+	  m_ulpXformsFiltered(0),
+	  m_ulpPatternMismatches(0),
+	  m_ullMemoryBudget(0),
+	  m_pxfsDegraded(NULL),
+	  m_ulDegradedStage(0),
+	  m_ullDegradedMemory(0)
 {
 	m_pmemo = GPOS_NEW(mp) CMemo(mp);
 	m_pexprEnforcerPattern =
@@ -95,6 +104,7 @@ CEngine::CEngine(CMemoryPool *mp)
 	m_pdrgpulpXformTimes = GPOS_NEW(mp) UlongPtrArray(mp);
 	m_pdrgpulpXformBindings = GPOS_NEW(mp) UlongPtrArray(mp);
 	m_pdrgpulpXformResults = GPOS_NEW(mp) UlongPtrArray(mp);
+	m_pdrgpulStageTimes = GPOS_NEW(mp) ULongPtrArray(mp);
 }
 
 
@@ -118,6 +128,8 @@ CEngine::~CEngine()
 	m_pdrgpulpXformTimes->Release();
 	m_pdrgpulpXformBindings->Release();
 	m_pdrgpulpXformResults->Release();
+	m_pdrgpulStageTimes->Release();
+	CRefCount::SafeRelease(m_pxfsDegraded);
 	m_pexprEnforcerPattern->Release();
 	CRefCount::SafeRelease(m_search_stage_array);
 #endif	// GPOS_DEBUG
@@ -169,7 +181,7 @@ CEngine::Init(CQueryContext *pqc, CSearchStageArray *search_stage_array)
 	}
 	GPOS_ASSERT(0 < m_search_stage_array->Size());
 
-	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
+	if (GPOPT_FCOLLECT_XFORM_STATS())
 	{
 		// initialize per-stage xform calls array
 		const ULONG ulStages = m_search_stage_array->Size();
@@ -355,7 +367,7 @@ void
 CEngine::InsertXformResult(
 	CGroup *pgroupOrigin, CXformResult *pxfres, CXform::EXformId exfidOrigin,
 	CGroupExpression *pgexprOrigin,
-	ULONG ulXformTime,	// time consumed by transformation in msec
+	ULONG ulXformTime,	// time consumed by transformation in usec
 	ULONG ulNumberOfBindings)
 {
 	GPOS_ASSERT(NULL != pxfres);
@@ -363,8 +375,9 @@ CEngine::InsertXformResult(
 	GPOS_ASSERT(CXform::ExfInvalid != exfidOrigin);
 	GPOS_ASSERT(NULL != pgexprOrigin);
 
-	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics) &&
-		0 < pxfres->Pdrgpexpr()->Size())
+	// record every application of the xform to a binding, including the
+	// ones that generated no alternative
+	if (GPOPT_FCOLLECT_XFORM_STATS() && 0 < ulNumberOfBindings)
 	{
 		(void) m_xforms->ExchangeSet(exfidOrigin);
 		(*m_pdrgpulpXformCalls)[m_ulCurrSearchStage][exfidOrigin] += 1;
@@ -781,20 +794,9 @@ CEngine::TransitionGroupExpression(CMemoryPool *pmpLocal,
 		GPOS_CHECK_ABORT;
 	}
 
-	// find which set of xforms should be used
-	CXformSet *xform_set = CXformFactory::Pxff()->PxfsExploration();
-	if (CGroupExpression::estImplemented == estTarget)
-	{
-		xform_set = CXformFactory::Pxff()->PxfsImplementation();
-	}
-
-	// get all applicable xforms
-	COperator *pop = pgexpr->Pop();
-	CXformSet *pxfsCandidates = CLogical::PopConvert(pop)->PxfsCandidates(m_mp);
-
-	// intersect them with the required set of xforms, then apply transformations
-	pxfsCandidates->Intersection(xform_set);
-	pxfsCandidates->Intersection(PxfsCurrentStage());
+	// get all applicable xforms, then apply transformations
+	CXformSet *pxfsCandidates = PxfsApplicable(
+		m_mp, pgexpr, CGroupExpression::estImplemented == estTarget);
 	ApplyTransformations(pmpLocal, pxfsCandidates, pgexpr);
 	pxfsCandidates->Release();
 
@@ -1570,7 +1572,8 @@ CEngine::PrintActivatedXforms(IOstream &os) const
 				*m_pdrgpulpXformResults)[m_ulCurrSearchStage][pxform->Exfid()];
 			os << pxform->SzId() << ": " << ulCalls << " calls, " << ulBindings
 			   << " total bindings, " << ulResults
-			   << " alternatives generated, " << ulTime << "ms" << std::endl;
+			   << " alternatives generated, " << (DOUBLE) ulTime / 1000
+			   << "ms" << std::endl;
 		}
 		os << "[OPT]: <End Xforms - stage " << m_ulCurrSearchStage << ">"
 		   << std::endl;
@@ -1643,7 +1646,10 @@ CEngine::ProcessTraceFlags()
 				<< (ULONG)(m_pmemo->UlpGroups()) << " groups"
 				<< ", " << m_pmemo->UlDuplicateGroups() << " duplicate groups"
 				<< ", " << m_pmemo->UlGrpExprs() << " group expressions"
-				<< ", " << m_xforms->Size() << " activated xforms]";
+				<< ", " << m_xforms->Size() << " activated xforms"
+				<< ", " << m_ulpXformsFiltered << " xforms filtered by operator"
+				<< ", " << m_ulpPatternMismatches
+				<< " xforms filtered by pattern]";
 
 		at.Os() << std::endl
 				<< "[OPT]: stage " << m_ulCurrSearchStage << " completed in "
@@ -1686,6 +1692,9 @@ CEngine::Optimize()
 	GPOS_ASSERT(NULL != PgroupRoot());
 	GPOS_ASSERT(NULL != COptCtxt::PoctxtFromTLS());
 
+	m_ullMemoryBudget =
+		(ULLONG) optimizer_config->GetHint()->UlMemoMemoryBudget() * 1024;
+
 	const ULONG ulJobs =
 		std::min((ULONG) GPOPT_JOBS_CAP,
 				 (ULONG)(m_pmemo->UlpGroups() * GPOPT_JOBS_PER_GROUP));
@@ -1700,6 +1709,12 @@ CEngine::Optimize()
 	{
 		PssCurrent()->RestartTimer();
 
+		CTimerUser timerStage;
+		if (GPOPT_FCOLLECT_XFORM_STATS())
+		{
+			timerStage.Restart();
+		}
+
 		// optimize root group
 		m_pqc->Prpp()->AddRef();
 		COptimizationContext *poc = GPOS_NEW(m_mp) COptimizationContext(
@@ -1724,9 +1739,16 @@ CEngine::Optimize()
 			m_search_stage_array->Size());
 		PssCurrent()->SetBestExpr(pexprPlan);
 
+		if (GPOPT_FCOLLECT_XFORM_STATS())
+		{
+			m_pdrgpulStageTimes->Append(GPOS_NEW(m_mp)
+											ULONG(timerStage.ElapsedMS()));
+		}
+
 		FinalizeSearchStage();
 	}
 
+	m_ulpJobsCompleted = sched.UlpJobsCompleted();
 
 	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
 	{
@@ -1744,6 +1766,194 @@ CEngine::Optimize()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::PxfsApplicable
+//
+//	@doc:
+//		Xforms of the current stage that can bind to the given group
+//		expression: the candidates of its operator for exploration or for
+//		implementation, less the ones whose pattern cannot match the
+//		operator or the arity of the group expression. The dropped xforms
+//		are counted, each of them saves a transformation job, a promise
+//		computation and a binding attempt
+//
+//---------------------------------------------------------------------------
+CXformSet *
+CEngine::PxfsApplicable(CMemoryPool *mp, CGroupExpression *pgexpr,
+						BOOL fImplementation)
+{
+	CheckMemoryBudget();
+
+	CXformFactory *pxff = CXformFactory::Pxff();
+	COperator *pop = pgexpr->Pop();
+
+	// intersect the candidates of the operator with the required xforms
+	CXformSet *xform_set = CLogical::PopConvert(pop)->PxfsCandidates(mp);
+	if (fImplementation)
+	{
+		xform_set->Intersection(pxff->PxfsImplementation());
+	}
+	else
+	{
+		xform_set->Intersection(pxff->PxfsExploration());
+	}
+	xform_set->Intersection(PxfsCurrentStage());
+	if (FDegraded())
+	{
+		xform_set->Difference(m_pxfsDegraded);
+	}
+
+	// drop the xforms whose pattern cannot be rooted at the operator
+	const ULONG ulCandidates = xform_set->Size();
+	xform_set->Intersection(pxff->PxfsOperator(pop->Eopid()));
+	m_ulpXformsFiltered += ulCandidates - xform_set->Size();
+
+	// drop the xforms whose pattern fails the shallow match done first
+	// thing by binding extraction
+	CXformSet *pxfsMismatches = NULL;
+	CXformSetIter xsi(*xform_set);
+	while (xsi.Advance())
+	{
+		CXform *pxform = pxff->Pxf(xsi.TBit());
+		if (!pxform->PexprPattern()->FMatchPattern(pgexpr))
+		{
+			if (NULL == pxfsMismatches)
+			{
+				pxfsMismatches = GPOS_NEW(mp) CXformSet(mp);
+			}
+			(void) pxfsMismatches->ExchangeSet(pxform->Exfid());
+		}
+	}
+
+	if (NULL != pxfsMismatches)
+	{
+		m_ulpPatternMismatches += pxfsMismatches->Size();
+		xform_set->Difference(pxfsMismatches);
+		pxfsMismatches->Release();
+	}
+
+	return xform_set;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::CheckMemoryBudget
+//
+//	@doc:
+//		Degrade the search once the engine's pool reaches the memory budget:
+//		from then on, the exploration xforms that multiply the alternatives
+//		in the memo without being needed for a plan are not scheduled, join
+//		orders are only generated by the cheaper expansions of n-ary joins
+//		that are enabled, and the search ends with the first stage that
+//		finds a plan. This keeps the memo from growing until the optimizer
+//		runs out of memory and falls back to the planner
+//
+//---------------------------------------------------------------------------
+void
+CEngine::CheckMemoryBudget()
+{
+	if (FDegraded() || 0 == m_ullMemoryBudget)
+	{
+		return;
+	}
+
+	ULLONG ullMemory = m_mp->TotalAllocatedSize();
+	if (ullMemory < m_ullMemoryBudget)
+	{
+		return;
+	}
+
+	m_ulDegradedStage = m_ulCurrSearchStage;
+	m_ullDegradedMemory = ullMemory;
+
+	m_pxfsDegraded = GPOS_NEW(m_mp) CXformSet(m_mp);
+	(void) m_pxfsDegraded->ExchangeSet(CXform::ExfJoinCommutativity);
+	(void) m_pxfsDegraded->ExchangeSet(CXform::ExfJoinAssociativity);
+	(void) m_pxfsDegraded->ExchangeSet(CXform::ExfLeftJoin2RightJoin);
+	(void) m_pxfsDegraded->ExchangeSet(CXform::ExfPushGbBelowJoin);
+	(void) m_pxfsDegraded->ExchangeSet(CXform::ExfPushGbDedupBelowJoin);
+	(void) m_pxfsDegraded->ExchangeSet(CXform::ExfPushGbWithHavingBelowJoin);
+	(void) m_pxfsDegraded->ExchangeSet(CXform::ExfEagerAgg);
+	(void) m_pxfsDegraded->ExchangeSet(CXform::ExfJoin2IndexGetApply);
+	(void) m_pxfsDegraded->ExchangeSet(CXform::ExfJoin2BitmapIndexGetApply);
+	(void) m_pxfsDegraded->ExchangeSet(
+		CXform::ExfInnerJoin2PartialDynamicIndexGetApply);
+	(void) m_pxfsDegraded->ExchangeSet(
+		CXform::ExfInnerJoinWithInnerSelect2PartialDynamicIndexGetApply);
+
+	// the dynamic programming join orders are only dropped if a cheaper
+	// expansion of n-ary joins is enabled, as n-ary joins have no
+	// implementation
+	if (GPOPT_FENABLED_XFORM(CXform::ExfExpandNAryJoin) ||
+		GPOPT_FENABLED_XFORM(CXform::ExfExpandNAryJoinGreedy) ||
+		GPOPT_FENABLED_XFORM(CXform::ExfExpandNAryJoinMinCard))
+	{
+		(void) m_pxfsDegraded->ExchangeSet(CXform::ExfExpandNAryJoinDP);
+		(void) m_pxfsDegraded->ExchangeSet(CXform::ExfExpandNAryJoinDPv2);
+		(void) m_pxfsDegraded->ExchangeSet(CXform::ExfExpandNAryJoinDPhyp);
+	}
+
+	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
+	{
+		CAutoTrace at(m_mp);
+		at.Os() << "[OPT]: Memory budget of " << m_ullMemoryBudget / 1024
+				<< " kB reached in stage " << m_ulCurrSearchStage
+				<< ", degrading the search";
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::CollectMetrics
+//
+//	@doc:
+//		Report the size of the memo and the number of jobs run by the
+//		last call to Optimize
+//
+//---------------------------------------------------------------------------
+void
+CEngine::CollectMetrics(SOptimizerMetrics *metrics) const
+{
+	GPOS_ASSERT(NULL != metrics);
+
+	metrics->m_ulGroups = (ULONG) m_pmemo->UlpGroups();
+	metrics->m_ulDuplicateGroups = m_pmemo->UlDuplicateGroups();
+	metrics->m_ulGroupExprs = m_pmemo->UlGrpExprs();
+	metrics->m_ullJobs = m_ulpJobsCompleted;
+	metrics->m_ullXformsFiltered = m_ulpXformsFiltered;
+	metrics->m_ullPatternMismatches = m_ulpPatternMismatches;
+	metrics->m_ulSearchStages = m_ulCurrSearchStage;
+	metrics->m_fDegraded = FDegraded();
+	metrics->m_ulDegradedStage = m_ulDegradedStage;
+	metrics->m_ullDegradedMemory = m_ullDegradedMemory;
+
+	// xform and stage statistics are only there if they were collected
+	const ULONG ulStages = m_pdrgpulStageTimes->Size();
+	for (ULONG ul = 0; ul < ulStages && ul < SOptimizerMetrics::MaxStages;
+		 ul++)
+	{
+		metrics->m_rgulStageTime[ul] = *(*m_pdrgpulStageTimes)[ul];
+	}
+
+	const ULONG ulXformStages = m_pdrgpulpXformCalls->Size();
+	for (ULONG ulStage = 0; ulStage < ulXformStages; ulStage++)
+	{
+		for (ULONG ul = 0; ul < CXform::ExfSentinel; ul++)
+		{
+			metrics->m_rgullXformCalls[ul] +=
+				(*m_pdrgpulpXformCalls)[ulStage][ul];
+			metrics->m_rgullXformTime[ul] +=
+				(*m_pdrgpulpXformTimes)[ulStage][ul];
+			metrics->m_rgullXformResults[ul] +=
+				(*m_pdrgpulpXformResults)[ulStage][ul];
+		}
+	}
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CEngine::CEngine
@@ -17,6 +17,8 @@
 
 #include "gpopt/eval/CConstExprEvaluatorDXL.h"
 
+#include "gpos/common/CAutoRef.h"
+
 #include "gpopt/base/CDrvdPropScalar.h"
 #include "gpopt/eval/IConstDXLNodeEvaluator.h"
 #include "gpopt/exception.h"
@@ -40,11 +42,14 @@ using namespace gpos;
 CConstExprEvaluatorDXL::CConstExprEvaluatorDXL(
 	CMemoryPool *mp, CMDAccessor *md_accessor,
 	IConstDXLNodeEvaluator *pconstdxleval)
-	: m_pconstdxleval(pconstdxleval),
+	: m_mp(mp),
+	  m_pconstdxleval(pconstdxleval),
 	  m_trexpr2dxl(mp, md_accessor, NULL /*pdrgpiSegments*/,
 				   false /*fInitColumnFactory*/),
-	  m_trdxl2expr(mp, md_accessor, false /*fInitColumnFactory*/)
+	  m_trdxl2expr(mp, md_accessor, false /*fInitColumnFactory*/),
+	  m_phmexprResult(NULL)
 {
+	m_phmexprResult = GPOS_NEW(mp) ExprToResultMap(mp);
 }
 
 //---------------------------------------------------------------------------
@@ -57,6 +62,7 @@ CConstExprEvaluatorDXL::CConstExprEvaluatorDXL(
 //---------------------------------------------------------------------------
 CConstExprEvaluatorDXL::~CConstExprEvaluatorDXL()
 {
+	m_phmexprResult->Release();
 }
 
 //---------------------------------------------------------------------------
@@ -73,22 +79,125 @@ CConstExprEvaluatorDXL::PexprEval(CExpression *pexpr)
 {
 	GPOS_ASSERT(NULL != pexpr);
 
-	if (!CPredicateUtils::FCompareConstToConstIgnoreCast(pexpr))
+	CAutoRef<CExpressionArray> apdrgpexpr(GPOS_NEW(m_mp)
+											  CExpressionArray(m_mp));
+	pexpr->AddRef();
+	apdrgpexpr->Append(pexpr);
+
+	CExpressionArray *pdrgpexprResult =
+		PdrgpexprEval(m_mp, apdrgpexpr.Value());
+	CExpression *pexprResult = (*pdrgpexprResult)[0];
+	pexprResult->AddRef();
+	pdrgpexprResult->Release();
+
+	return pexprResult;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorDXL::PdrgpexprEval
+//
+//	@doc:
+//		Evaluate the given expressions and return the results as new
+//		expressions, in the order of the input. Results of earlier
+//		evaluations are reused, and the remaining distinct expressions are
+//		sent to the DXL evaluator in one batch. Caller takes ownership of
+//		returned array
+//
+//---------------------------------------------------------------------------
+CExpressionArray *
+CConstExprEvaluatorDXL::PdrgpexprEval(CMemoryPool *mp,
+									  CExpressionArray *pdrgpexpr)
+{
+	GPOS_ASSERT(NULL != pdrgpexpr);
+
+	const ULONG size = pdrgpexpr->Size();
+	for (ULONG ul = 0; ul < size; ul++)
 	{
-		GPOS_RAISE(gpopt::ExmaGPOPT, gpopt::ExmiEvalUnsupportedScalarExpr);
+		if (!CPredicateUtils::FCompareConstToConstIgnoreCast((*pdrgpexpr)[ul]))
+		{
+			GPOS_RAISE(gpopt::ExmaGPOPT, gpopt::ExmiEvalUnsupportedScalarExpr);
+		}
 	}
-	CDXLNode *pdxlnExpr = m_trexpr2dxl.PdxlnScalar(pexpr);
-	CDXLNode *pdxlnResult = m_pconstdxleval->EvaluateExpr(pdxlnExpr);
 
-	GPOS_ASSERT(EdxloptypeScalar ==
-				pdxlnResult->GetOperator()->GetDXLOperatorType());
+	// collect the distinct expressions that were not evaluated before
+	CAutoRef<ExprHashSet> aphsexpr(GPOS_NEW(m_mp) ExprHashSet(m_mp));
+	CAutoRef<CExpressionArray> apdrgpexprPending(GPOS_NEW(m_mp)
+													 CExpressionArray(m_mp));
+	CAutoRef<CDXLNodeArray> apdrgpdxlnPending(GPOS_NEW(m_mp)
+												  CDXLNodeArray(m_mp));
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		CExpression *pexpr = (*pdrgpexpr)[ul];
+		if (NULL != m_phmexprResult->Find(pexpr))
+		{
+			continue;
+		}
 
-	CExpression *pexprResult =
-		m_trdxl2expr.PexprTranslateScalar(pdxlnResult, NULL /*colref_array*/);
-	pdxlnResult->Release();
-	pdxlnExpr->Release();
+		pexpr->AddRef();
+		if (aphsexpr->Insert(pexpr))
+		{
+			pexpr->AddRef();
+			apdrgpexprPending->Append(pexpr);
+			apdrgpdxlnPending->Append(m_trexpr2dxl.PdxlnScalar(pexpr));
+		}
+		else
+		{
+			pexpr->Release();
+		}
+	}
 
-	return pexprResult;
+	// evaluate them in one batch; the results of this batch are looked up
+	// on the input expressions, the memo on copies of them that are owned by
+	// the evaluator, since the input may come from a shorter lived pool
+	CAutoRef<ExprToResultMap> aphmexprBatch(GPOS_NEW(m_mp)
+												ExprToResultMap(m_mp));
+	const ULONG ulPending = apdrgpexprPending->Size();
+	if (0 < ulPending)
+	{
+		CAutoRef<CDXLNodeArray> apdrgpdxlnResult(
+			m_pconstdxleval->EvaluateExprs(apdrgpdxlnPending.Value()));
+		GPOS_ASSERT(ulPending == apdrgpdxlnResult->Size());
+
+		for (ULONG ul = 0; ul < ulPending; ul++)
+		{
+			CDXLNode *pdxlnResult = (*apdrgpdxlnResult)[ul];
+			GPOS_ASSERT(EdxloptypeScalar ==
+						pdxlnResult->GetOperator()->GetDXLOperatorType());
+
+			CExpression *pexprResult = m_trdxl2expr.PexprTranslateScalar(
+				pdxlnResult, NULL /*colref_array*/);
+			CExpression *pexpr = (*apdrgpexprPending)[ul];
+			pexpr->AddRef();
+			pexprResult->AddRef();
+			(void) aphmexprBatch->Insert(pexpr, pexprResult);
+
+			CExpression *pexprKey = m_trdxl2expr.PexprTranslateScalar(
+				(*apdrgpdxlnPending)[ul], NULL /*colref_array*/);
+			if (!m_phmexprResult->Insert(pexprKey, pexprResult))
+			{
+				pexprKey->Release();
+				pexprResult->Release();
+			}
+		}
+	}
+
+	CExpressionArray *pdrgpexprResult = GPOS_NEW(mp) CExpressionArray(mp);
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		CExpression *pexpr = (*pdrgpexpr)[ul];
+		CExpression *pexprResult = aphmexprBatch->Find(pexpr);
+		if (NULL == pexprResult)
+		{
+			pexprResult = m_phmexprResult->Find(pexpr);
+		}
+		GPOS_ASSERT(NULL != pexprResult);
+
+		pexprResult->AddRef();
+		pdrgpexprResult->Append(pexprResult);
+	}
+
+	return pdrgpexprResult;
 }
 
 //---------------------------------------------------------------------------
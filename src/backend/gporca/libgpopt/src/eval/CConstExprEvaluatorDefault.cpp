@@ -49,6 +49,28 @@ CConstExprEvaluatorDefault::PexprEval(CExpression *pexpr)
 	return pexpr;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorDefault::PdrgpexprEval
+//
+//	@doc:
+//		Returns a copy of the given array of expressions
+//
+//---------------------------------------------------------------------------
+CExpressionArray *
+CConstExprEvaluatorDefault::PdrgpexprEval(CMemoryPool *mp,
+										  CExpressionArray *pdrgpexpr)
+{
+	CExpressionArray *pdrgpexprResult = GPOS_NEW(mp) CExpressionArray(mp);
+	const ULONG size = pdrgpexpr->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		pdrgpexprResult->Append(PexprEval((*pdrgpexpr)[ul]));
+	}
+
+	return pdrgpexprResult;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CConstExprEvaluatorDefault::FCanEvalFunctions
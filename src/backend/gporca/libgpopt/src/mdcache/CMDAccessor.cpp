@@ -23,10 +23,12 @@
 #include "gpopt/base/CColRefTable.h"
 #include "gpopt/exception.h"
 #include "gpopt/mdcache/CMDAccessorUtils.h"
+#include "gpopt/mdcache/CMDCache.h"
 #include "naucrates/dxl/CDXLUtils.h"
 #include "naucrates/exception.h"
 #include "naucrates/md/CMDIdCast.h"
 #include "naucrates/md/CMDIdColStats.h"
+#include "naucrates/md/CMDIdExtStats.h"
 #include "naucrates/md/CMDIdRelStats.h"
 #include "naucrates/md/CMDIdScCmp.h"
 #include "naucrates/md/CMDProviderGeneric.h"
@@ -35,6 +37,7 @@
 #include "naucrates/md/IMDCast.h"
 #include "naucrates/md/IMDCheckConstraint.h"
 #include "naucrates/md/IMDColStats.h"
+#include "naucrates/md/IMDExtStats.h"
 #include "naucrates/md/IMDFunction.h"
 #include "naucrates/md/IMDIndex.h"
 #include "naucrates/md/IMDProvider.h"
@@ -45,6 +48,7 @@
 #include "naucrates/md/IMDScalarOp.h"
 #include "naucrates/md/IMDTrigger.h"
 #include "naucrates/md/IMDType.h"
+#include "naucrates/statistics/CStatistics.h"
 #include "naucrates/traceflags/traceflags.h"
 
 using namespace gpos;
@@ -240,7 +244,12 @@ CMDAccessor::SMDProviderElem::HashValue(const SMDProviderElem &mdpelem)
 //
 //---------------------------------------------------------------------------
 CMDAccessor::CMDAccessor(CMemoryPool *mp, MDCache *pcache)
-	: m_mp(mp), m_pcache(pcache), m_dLookupTime(0.0), m_dFetchTime(0.0)
+	: m_mp(mp),
+	  m_pcache(pcache),
+	  m_dLookupTime(0.0),
+	  m_dFetchTime(0.0),
+	  m_ulCacheHits(0),
+	  m_ulCacheMisses(0)
 {
 	GPOS_ASSERT(NULL != m_mp);
 	GPOS_ASSERT(NULL != m_pcache);
@@ -260,7 +269,12 @@ CMDAccessor::CMDAccessor(CMemoryPool *mp, MDCache *pcache)
 //---------------------------------------------------------------------------
 CMDAccessor::CMDAccessor(CMemoryPool *mp, MDCache *pcache, CSystemId sysid,
 						 IMDProvider *pmdp)
-	: m_mp(mp), m_pcache(pcache), m_dLookupTime(0.0), m_dFetchTime(0.0)
+	: m_mp(mp),
+	  m_pcache(pcache),
+	  m_dLookupTime(0.0),
+	  m_dFetchTime(0.0),
+	  m_ulCacheHits(0),
+	  m_ulCacheMisses(0)
 {
 	GPOS_ASSERT(NULL != m_mp);
 	GPOS_ASSERT(NULL != m_pcache);
@@ -284,7 +298,12 @@ CMDAccessor::CMDAccessor(CMemoryPool *mp, MDCache *pcache, CSystemId sysid,
 CMDAccessor::CMDAccessor(CMemoryPool *mp, MDCache *pcache,
 						 const CSystemIdArray *pdrgpsysid,
 						 const CMDProviderArray *pdrgpmdp)
-	: m_mp(mp), m_pcache(pcache), m_dLookupTime(0.0), m_dFetchTime(0.0)
+	: m_mp(mp),
+	  m_pcache(pcache),
+	  m_dLookupTime(0.0),
+	  m_dFetchTime(0.0),
+	  m_ulCacheHits(0),
+	  m_ulCacheMisses(0)
 {
 	GPOS_ASSERT(NULL != m_mp);
 	GPOS_ASSERT(NULL != m_pcache);
@@ -382,6 +401,14 @@ CMDAccessor::~CMDAccessor()
 				<< std::endl;
 		at.Os() << "[OPT]: Total metadata lookup time (including fetch time): "
 				<< m_dLookupTime << "ms" << std::endl;
+		at.Os() << "[OPT]: Metadata cache hits: " << m_ulCacheHits
+				<< ", misses: " << m_ulCacheMisses << std::endl;
+		at.Os() << "[OPT]: Metadata cache totals: hits: "
+				<< CMDCache::ULLGetCacheHits()
+				<< ", misses: " << CMDCache::ULLGetCacheMisses()
+				<< ", targeted evictions: "
+				<< CMDCache::ULLGetTargetedEvictions()
+				<< ", resets: " << CMDCache::ULLGetResets() << std::endl;
 	}
 }
 
@@ -509,8 +536,16 @@ CMDAccessor::GetImdObj(IMDId *mdid, IMDCacheObject::Emdtype mdtype)
 		a_pmdcacc = GPOS_NEW(m_mp) CacheAccessorMD(m_pcache);
 		a_pmdcacc->Lookup(&mdkey);
 		IMDCacheObject *pmdobjNew = a_pmdcacc->Val();
-		if (NULL == pmdobjNew)
+		if (NULL != pmdobjNew)
 		{
+			m_ulCacheHits++;
+			CMDCache::RecordHit();
+		}
+		else
+		{
+			m_ulCacheMisses++;
+			CMDCache::RecordMiss();
+
 			// object not found in MD cache: retrieve it from MD provider
 			CTimerUser timerFetch;
 			if (fPrintOptStats)
@@ -918,6 +953,30 @@ CMDAccessor::Pmdrelstats(IMDId *mdid)
 	return dynamic_cast<const IMDRelStats *>(pmdobj);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::Pmdextstats
+//
+//	@doc:
+//		Retrieves the extended statistics of a relation from the md cache,
+//		possibly retrieving them from the external metadata provider and
+//		storing them in the cache first.
+//
+//---------------------------------------------------------------------------
+const IMDExtStats *
+CMDAccessor::Pmdextstats(IMDId *mdid)
+{
+	const IMDCacheObject *pmdobj =
+		GetImdObj(mdid, IMDCacheObject::EmdtExtStats);
+	if (IMDCacheObject::EmdtExtStats != pmdobj->MDType())
+	{
+		GPOS_RAISE(gpdxl::ExmaMD, gpdxl::ExmiMDCacheEntryNotFound,
+				   mdid->GetBuffer());
+	}
+
+	return dynamic_cast<const IMDExtStats *>(pmdobj);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDAccessor::Pmdcast
@@ -1121,10 +1180,81 @@ CMDAccessor::Pstats(CMemoryPool *mp, IMDId *rel_mdid, CColRefSet *pcrsHist,
 
 	CDouble rows = std::max(DOUBLE(1.0), pmdRelStats->Rows().Get());
 
-	return GPOS_NEW(mp) CStatistics(
+	CStatistics *stats = GPOS_NEW(mp) CStatistics(
 		mp, col_histogram_mapping, colid_width_mapping, rows, fEmptyTable,
 		pmdRelStats->RelPages(), pmdRelStats->RelAllVisible(),
 		1.0 /* default rebinds */, 0 /* default predicates*/);
+
+	// column groups only matter for estimates over two columns or more
+	if (!fEmptyTable && 1 < pcrsHist->Size())
+	{
+		AddColumnGroups(mp, rel_mdid, pcrsHist, stats);
+	}
+
+	return stats;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::AddColumnGroups
+//
+//	@doc:
+//		Add the column groups of the given relation whose columns all have
+//		histograms to a statistics object
+//
+//---------------------------------------------------------------------------
+void
+CMDAccessor::AddColumnGroups(CMemoryPool *mp, IMDId *rel_mdid,
+							 CColRefSet *pcrsHist, CStatistics *stats)
+{
+	rel_mdid->AddRef();
+	CMDIdExtStats *ext_stats_mdid =
+		GPOS_NEW(mp) CMDIdExtStats(CMDIdGPDB::CastMdid(rel_mdid));
+	const IMDExtStats *pmdextstats = Pmdextstats(ext_stats_mdid);
+	ext_stats_mdid->Release();
+
+	const ULONG num_column_groups = pmdextstats->Size();
+	for (ULONG ul = 0; ul < num_column_groups; ul++)
+	{
+		const CDXLColumnGroupStats *column_group_stats =
+			pmdextstats->GetColumnGroupStats(ul);
+		const IntPtrArray *attnos = column_group_stats->GetAttnos();
+
+		// map the attribute numbers of the group to the columns of the
+		// relation that have histograms
+		ULongPtrArray *colids = GPOS_NEW(mp) ULongPtrArray(mp);
+		const ULONG size = attnos->Size();
+		for (ULONG pos = 0; pos < size; pos++)
+		{
+			const INT attno = *(*attnos)[pos];
+			CColRefSetIter crsi(*pcrsHist);
+			while (crsi.Advance())
+			{
+				CColRefTable *pcrtable = CColRefTable::PcrConvert(crsi.Pcr());
+				if (attno == pcrtable->AttrNum())
+				{
+					colids->Append(GPOS_NEW(mp) ULONG(pcrtable->Id()));
+					break;
+				}
+			}
+		}
+
+		if (size != colids->Size())
+		{
+			colids->Release();
+			continue;
+		}
+
+		CDoubleArray *dependency_degrees = GPOS_NEW(mp) CDoubleArray(mp);
+		for (ULONG pos = 0; pos < size; pos++)
+		{
+			dependency_degrees->Append(GPOS_NEW(mp) CDouble(
+				column_group_stats->GetDependencyDegree(pos)));
+		}
+
+		stats->AddColumnGroup(GPOS_NEW(mp) CStatsColGroup(
+			colids, column_group_stats->GetNumDistinct(), dependency_degrees));
+	}
 }
 
 
@@ -1171,6 +1301,14 @@ CMDAccessor::GetHistogram(CMemoryPool *mp, IMDId *mdid_type,
 	GPOS_ASSERT_IMP(fBoolType,
 					3 >= histogram->GetNumDistinct() - CStatistics::Epsilon);
 
+	// the sketch lives in the MD cache, make a copy in the optimizer's
+	// memory pool
+	const CHLLSketch *hll_sketch = pmdcolstats->GetHLLSketch();
+	if (NULL != hll_sketch)
+	{
+		histogram->SetHLLSketch(hll_sketch->CopySketch(mp));
+	}
+
 	return histogram;
 }
 
@@ -1295,5 +1433,48 @@ CMDAccessor::SerializeSysid(COstream &oos)
 	}
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDAccessor::AppendObjects
+//
+//	@doc:
+//		Append all objects retrieved through this accessor to the given
+//		array; the array holds a reference to each of them
+//
+//---------------------------------------------------------------------------
+void
+CMDAccessor::AppendObjects(IMDCacheObjectArray *md_obj_array)
+{
+	GPOS_ASSERT(NULL != md_obj_array);
+
+	ULONG nentries = m_shtCacheAccessors.Size();
+	IMDCacheObject **cacheEntries;
+	CAutoRg<IMDCacheObject *> aCacheEntries;
+	ULONG ul;
+
+	// as in Serialize(), collect the entries first since we must not
+	// allocate memory while the iterator holds the hash table lock
+	cacheEntries = GPOS_NEW_ARRAY(m_mp, IMDCacheObject *, nentries);
+	aCacheEntries = cacheEntries;
+	{
+		MDHTIter mdhtit(m_shtCacheAccessors);
+		ul = 0;
+		while (mdhtit.Advance())
+		{
+			MDHTIterAccessor mdhtitacc(mdhtit);
+			SMDAccessorElem *pmdaccelem = mdhtitacc.Value();
+			GPOS_ASSERT(NULL != pmdaccelem);
+			cacheEntries[ul++] = pmdaccelem->GetImdObj();
+		}
+		GPOS_ASSERT(ul == nentries);
+	}
+
+	for (ul = 0; ul < nentries; ul++)
+	{
+		cacheEntries[ul]->AddRef();
+		md_obj_array->Append(cacheEntries[ul]);
+	}
+}
+
 
 // EOF
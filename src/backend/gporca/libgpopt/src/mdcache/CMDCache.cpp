@@ -24,6 +24,12 @@ CMDAccessor::MDCache *CMDCache::m_pcache = NULL;
 // maximum size of the cache
 ULLONG CMDCache::m_ullCacheQuota = UNLIMITED_CACHE_QUOTA;
 
+// cache counters
+ULLONG CMDCache::m_ullCacheHits = 0;
+ULLONG CMDCache::m_ullCacheMisses = 0;
+ULLONG CMDCache::m_ullTargetedEvictions = 0;
+ULLONG CMDCache::m_ullResets = 0;
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDCache::Init
@@ -127,6 +133,33 @@ CMDCache::Reset()
 
 	Shutdown();
 	Init();
+
+	m_ullResets++;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCache::Evict
+//
+//	@doc:
+//		Evict all cached objects satisfying the given predicate, leaving the
+//		rest of the cache intact; returns the number of evicted objects
+//
+//---------------------------------------------------------------------------
+ULONG
+CMDCache::Evict(CMDAccessor::MDCache::MatchFuncPtr pfnMatch, void *pvArg)
+{
+	GPOS_ASSERT(NULL != m_pcache && "Metadata cache was not created");
+
+	CAutoTraceFlag atf1(EtraceSimulateOOM, false);
+	CAutoTraceFlag atf2(EtraceSimulateAbort, false);
+	CAutoTraceFlag atf3(EtraceSimulateIOError, false);
+	CAutoTraceFlag atf4(EtraceSimulateNetError, false);
+
+	ULONG ulEvicted = m_pcache->EvictMatchingEntries(pfnMatch, pvArg);
+	m_ullTargetedEvictions += ulEvicted;
+
+	return ulEvicted;
 }
 
 // EOF
@@ -270,7 +270,8 @@ CMinidumperUtils::PdxlnExecuteMinidump(CMemoryPool *mp, CDXLMinidump *pdxlmd,
 									   const CHAR *file_name, ULONG ulSegments,
 									   ULONG ulSessionId, ULONG ulCmdId,
 									   COptimizerConfig *optimizer_config,
-									   IConstExprEvaluator *pceeval)
+									   IConstExprEvaluator *pceeval,
+									   SOptimizerMetrics *metrics)
 {
 	GPOS_ASSERT(NULL != file_name);
 
@@ -281,7 +282,7 @@ CMinidumperUtils::PdxlnExecuteMinidump(CMemoryPool *mp, CDXLMinidump *pdxlmd,
 
 	CDXLNode *result = CMinidumperUtils::PdxlnExecuteMinidump(
 		mp, factory.Pmda(), pdxlmd, file_name, ulSegments, ulSessionId, ulCmdId,
-		optimizer_config, pceeval);
+		optimizer_config, pceeval, metrics);
 
 	return result;
 }
@@ -299,7 +300,8 @@ CDXLNode *
 CMinidumperUtils::PdxlnExecuteMinidump(
 	CMemoryPool *mp, CMDAccessor *md_accessor, CDXLMinidump *pdxlmd,
 	const CHAR *file_name, ULONG ulSegments, ULONG ulSessionId, ULONG ulCmdId,
-	COptimizerConfig *optimizer_config, IConstExprEvaluator *pceeval)
+	COptimizerConfig *optimizer_config, IConstExprEvaluator *pceeval,
+	SOptimizerMetrics *metrics)
 {
 	GPOS_ASSERT(NULL != md_accessor);
 	GPOS_ASSERT(NULL != pdxlmd->GetQueryDXLRoot() &&
@@ -336,7 +338,7 @@ CMinidumperUtils::PdxlnExecuteMinidump(
 			pdxlmd->PdrgpdxlnQueryOutput(), pdxlmd->GetCTEProducerDXLArray(),
 			pceeval, ulSegments, ulSessionId, ulCmdId,
 			NULL,  // search_stage_array
-			optimizer_config, file_name);
+			optimizer_config, file_name, metrics);
 	}
 	GPOS_CATCH_EX(ex)
 	{
@@ -714,6 +714,25 @@ CExpression::ResetStats()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CExpression::InitStats
+//
+//	@doc:
+//		Initialize expression's stats with stats derived elsewhere for an
+//		equivalent expression; takes ownership of the given stats
+//
+//---------------------------------------------------------------------------
+void
+CExpression::InitStats(IStatistics *stats)
+{
+	GPOS_ASSERT(NULL == m_pstats);
+	GPOS_ASSERT(NULL != stats);
+
+	m_pstats = stats;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CExpression::HasOuterRefs
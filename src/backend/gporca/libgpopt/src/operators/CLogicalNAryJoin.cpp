@@ -213,6 +213,7 @@ CLogicalNAryJoin::PxfsCandidates(CMemoryPool *mp) const
 	(void) xform_set->ExchangeSet(CXform::ExfExpandNAryJoinDP);
 	(void) xform_set->ExchangeSet(CXform::ExfExpandNAryJoinGreedy);
 	(void) xform_set->ExchangeSet(CXform::ExfExpandNAryJoinDPv2);
+	(void) xform_set->ExchangeSet(CXform::ExfExpandNAryJoinDPhyp);
 
 	return xform_set;
 }
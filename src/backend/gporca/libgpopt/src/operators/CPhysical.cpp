@@ -1198,6 +1198,52 @@ CPhysical::GetSkew(IStatistics *stats, CDistributionSpec *pds)
 	return CDouble(dSkew);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysical::GetMaxValueFreq
+//
+//	@doc:
+//		Helper to estimate the frequency of the most frequent value of the
+//		distribution columns of a hashed distribution spec; all the rows
+//		with that value are hashed to the same segment. A combination of
+//		values is never more frequent than any of its values, so the estimate
+//		is the smallest of the column estimates. Returns 0 if some
+//		distribution expression is not a column, or has no statistics.
+//
+//---------------------------------------------------------------------------
+CDouble
+CPhysical::GetMaxValueFreq(IStatistics *stats, CDistributionSpec *pds)
+{
+	if (CDistributionSpec::EdtHashed != pds->Edt())
+	{
+		return CDouble(0.0);
+	}
+
+	CDistributionSpecHashed *pdshashed =
+		CDistributionSpecHashed::PdsConvert(pds);
+	const CExpressionArray *pdrgpexpr = pdshashed->Pdrgpexpr();
+	const ULONG size = pdrgpexpr->Size();
+	CDouble dMaxValueFreq = 1.0;
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		CExpression *pexpr = (*pdrgpexpr)[ul];
+		if (COperator::EopScalarIdent != pexpr->Pop()->Eopid())
+		{
+			return CDouble(0.0);
+		}
+
+		CScalarIdent *popScId = CScalarIdent::PopConvert(pexpr->Pop());
+		CDouble dMaxValueFreqCol =
+			stats->GetMaxValueFreq(popScId->Pcr()->Id());
+		if (dMaxValueFreqCol < dMaxValueFreq)
+		{
+			dMaxValueFreq = dMaxValueFreqCol;
+		}
+	}
+
+	return dMaxValueFreq;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CPhysical::FChildrenHaveCompatibleDistributions
@@ -233,7 +233,8 @@ COptimizer::PdxlnOptimize(
 	ULONG ulHosts,	// actual number of data nodes in the system
 	ULONG ulSessionId, ULONG ulCmdId, CSearchStageArray *search_stage_array,
 	COptimizerConfig *optimizer_config,
-	const CHAR *szMinidumpFileName	// name of minidump file to be created
+	const CHAR *szMinidumpFileName,	 // name of minidump file to be created
+	SOptimizerMetrics *metrics		 // if given, receives search space size
 )
 {
 	GPOS_ASSERT(NULL != md_accessor);
@@ -314,7 +315,8 @@ COptimizer::PdxlnOptimize(
 
 			GPOS_CHECK_ABORT;
 			// optimize logical expression tree into physical expression tree.
-			CExpression *pexprPlan = PexprOptimize(mp, pqc, search_stage_array);
+			CExpression *pexprPlan =
+				PexprOptimize(mp, pqc, search_stage_array, metrics);
 			GPOS_CHECK_ABORT;
 
 			// translate plan into DXL
@@ -414,7 +416,8 @@ COptimizer::CheckCTEConsistency(CMemoryPool *mp, CExpression *pexpr)
 //---------------------------------------------------------------------------
 CExpression *
 COptimizer::PexprOptimize(CMemoryPool *mp, CQueryContext *pqc,
-						  CSearchStageArray *search_stage_array)
+						  CSearchStageArray *search_stage_array,
+						  SOptimizerMetrics *metrics)
 {
 	CEngine eng(mp);
 	eng.Init(pqc, search_stage_array);
@@ -422,6 +425,11 @@ COptimizer::PexprOptimize(CMemoryPool *mp, CQueryContext *pqc,
 
 	GPOS_CHECK_ABORT;
 
+	if (NULL != metrics)
+	{
+		eng.CollectMetrics(metrics);
+	}
+
 	CExpression *pexprPlan = eng.PexprExtractPlan();
 	(void) pexprPlan->PrppCompute(mp, pqc->Prpp());
 
@@ -769,15 +769,15 @@ void
 CGroupExpression::Transform(
 	CMemoryPool *mp, CMemoryPool *pmpLocal, CXform *pxform,
 	CXformResult *pxfres,
-	ULONG *pulElapsedTime,	// output: elapsed time in millisecond
+	ULONG *pulElapsedTime,	// output: elapsed time in microseconds
 	ULONG *pulNumberOfBindings)
 {
 	GPOS_ASSERT(NULL != pulElapsedTime);
 	GPOS_CHECK_ABORT;
 
-	BOOL fPrintOptStats = GPOS_FTRACE(EopttracePrintOptimizationStatistics);
+	BOOL fCollectOptStats = GPOPT_FCOLLECT_XFORM_STATS();
 	CTimerUser timer;
-	if (fPrintOptStats)
+	if (fCollectOptStats)
 	{
 		timer.Restart();
 	}
@@ -787,9 +787,9 @@ CGroupExpression::Transform(
 	if (GPOPT_FDISABLED_XFORM(pxform->Exfid()) ||
 		!pxform->FCompatible(m_exfidOrigin))
 	{
-		if (fPrintOptStats)
+		if (fCollectOptStats)
 		{
-			*pulElapsedTime = timer.ElapsedMS();
+			*pulElapsedTime = timer.ElapsedUS();
 		}
 		return;
 	}
@@ -800,9 +800,9 @@ CGroupExpression::Transform(
 	exprhdl.DeriveProps(NULL /*pdpctxt*/);
 	if (CXform::ExfpNone == pxform->Exfp(exprhdl))
 	{
-		if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
+		if (fCollectOptStats)
 		{
-			*pulElapsedTime = timer.ElapsedMS();
+			*pulElapsedTime = timer.ElapsedUS();
 		}
 		return;
 	}
@@ -850,9 +850,9 @@ CGroupExpression::Transform(
 	// post-prcoessing before applying xform to group expression
 	PostprocessTransform(pmpLocal, mp, pxform);
 
-	if (fPrintOptStats)
+	if (fCollectOptStats)
 	{
-		*pulElapsedTime = timer.ElapsedMS();
+		*pulElapsedTime = timer.ElapsedUS();
 	}
 }
 
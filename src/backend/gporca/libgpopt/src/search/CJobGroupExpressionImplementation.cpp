@@ -171,14 +171,9 @@ CJobGroupExpressionImplementation::ScheduleApplicableTransformations(
 {
 	GPOS_ASSERT(!FXformsScheduled());
 
-	// get all applicable xforms
-	COperator *pop = m_pgexpr->Pop();
-	CXformSet *xform_set =
-		CLogical::PopConvert(pop)->PxfsCandidates(psc->GetGlobalMemoryPool());
-
-	// intersect them with required xforms and schedule jobs
-	xform_set->Intersection(CXformFactory::Pxff()->PxfsImplementation());
-	xform_set->Intersection(psc->Peng()->PxfsCurrentStage());
+	// get all applicable xforms and schedule jobs
+	CXformSet *xform_set = psc->Peng()->PxfsApplicable(
+		psc->GetGlobalMemoryPool(), m_pgexpr, true /*fImplementation*/);
 	ScheduleTransformations(psc, xform_set);
 	xform_set->Release();
 
@@ -0,0 +1,983 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CJoinOrderDPhyp.cpp
+//
+//	@doc:
+//		Implementation of join order generation using dynamic programming
+//		over the join hypergraph
+//---------------------------------------------------------------------------
+
+#include "gpopt/xforms/CJoinOrderDPhyp.h"
+
+#include "gpos/base.h"
+#include "gpos/common/CBitSet.h"
+#include "gpos/common/CBitSetIter.h"
+#include "gpos/error/CAutoTrace.h"
+
+#include "gpopt/base/COptCtxt.h"
+#include "gpopt/base/CUtils.h"
+#include "gpopt/engine/CHint.h"
+#include "gpopt/operators/CLogicalInnerJoin.h"
+#include "gpopt/operators/CLogicalLeftOuterJoin.h"
+#include "gpopt/operators/CLogicalSelect.h"
+#include "gpopt/operators/CPredicateUtils.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
+#include "naucrates/statistics/CJoinStatsProcessor.h"
+
+using namespace gpopt;
+
+// how many expressions will we return at the end of the enumeration?
+#define GPOPT_DPHYP_JOIN_ORDERING_TOPK 10
+// cost penalty (a factor) for joins that can't use a hash join, same as
+// in CJoinOrderDPv2
+#define GPOPT_DPHYP_CROSS_JOIN_DEFAULT_PENALTY 1024
+
+// the set containing only the given atom
+#define GPOPT_DPHYP_ATOM(atom) (((ULLONG) 1) << (atom))
+
+// the set of atoms up to and including the given atom
+#define GPOPT_DPHYP_ATOMS_UP_TO(atom)                        \
+	((GPOPT_DPHYP_MAX_ATOMS - 1 == (atom)) ? gpos::ullong_max \
+										   : GPOPT_DPHYP_ATOM((atom) + 1) - 1)
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::CJoinOrderDPhyp
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CJoinOrderDPhyp::CJoinOrderDPhyp(CMemoryPool *mp,
+								 CExpressionArray *pdrgpexprAtoms,
+								 CExpressionArray *innerJoinConjuncts,
+								 CExpressionArray *onPredConjuncts,
+								 ULongPtrArray *childPredIndexes)
+	: CJoinOrder(mp, pdrgpexprAtoms, innerJoinConjuncts, onPredConjuncts,
+				 childPredIndexes),
+	  m_plans(NULL),
+	  m_top_k_plans(NULL),
+	  m_all_atoms(0),
+	  m_edge_atoms(NULL),
+	  m_hyperedges(NULL),
+	  m_num_hyperedges(0),
+	  m_nij_right_children(0),
+	  m_nij_dependencies(NULL),
+	  m_on_pred_conjuncts(onPredConjuncts),
+	  m_child_pred_indexes(childPredIndexes),
+	  m_num_pairs(0),
+	  m_pair_budget(0),
+	  m_budget_exceeded(false),
+	  m_cross_prod_penalty(GPOPT_DPHYP_CROSS_JOIN_DEFAULT_PENALTY)
+{
+	GPOS_ASSERT(0 < m_ulComps && m_ulComps <= GPOPT_DPHYP_MAX_ATOMS);
+
+	m_plans = GPOS_NEW(mp) AtomSetToPlanMap(mp);
+	m_top_k_plans = GPOS_NEW(mp) CKHeap<SPlanInfoArray, SPlanInfo>(
+		mp, GPOPT_DPHYP_JOIN_ORDERING_TOPK);
+
+	m_all_atoms = GPOPT_DPHYP_ATOMS_UP_TO(m_ulComps - 1);
+
+	// translate the edge covers into sets of atoms
+	m_edge_atoms = GPOS_NEW_ARRAY(mp, ULLONG, m_ulEdges);
+	for (ULONG ul = 0; ul < m_ulEdges; ul++)
+	{
+		m_edge_atoms[ul] = 0;
+		CBitSetIter bsi(*m_rgpedge[ul]->m_pbs);
+		while (bsi.Advance())
+		{
+			m_edge_atoms[ul] |= GPOPT_DPHYP_ATOM(bsi.Bit());
+		}
+	}
+
+	// compute the dependencies of the NIJ right children, these are the
+	// atoms referenced in their ON predicate
+	m_nij_dependencies = GPOS_NEW_ARRAY(mp, ULLONG, m_ulComps);
+	for (ULONG atom = 0; atom < m_ulComps; atom++)
+	{
+		m_nij_dependencies[atom] = 0;
+		if (NULL != m_child_pred_indexes &&
+			0 < *(*m_child_pred_indexes)[atom])
+		{
+			m_nij_right_children |= GPOPT_DPHYP_ATOM(atom);
+		}
+	}
+
+	for (ULONG ul = 0; ul < m_ulEdges; ul++)
+	{
+		ULONG loj_num = m_rgpedge[ul]->m_loj_num;
+		if (0 == loj_num)
+		{
+			continue;
+		}
+
+		for (ULONG atom = 0; atom < m_ulComps; atom++)
+		{
+			if (loj_num == *(*m_child_pred_indexes)[atom])
+			{
+				m_nij_dependencies[atom] =
+					m_edge_atoms[ul] & ~GPOPT_DPHYP_ATOM(atom);
+				break;
+			}
+		}
+	}
+
+	// the hyperedges are the edges joining two atoms or more, plus the
+	// edges for the cross products between each pair of connected
+	// components
+	m_hyperedges = GPOS_NEW_ARRAY(
+		mp, ULLONG, m_ulEdges + m_ulComps * (m_ulComps - 1) / 2);
+	for (ULONG ul = 0; ul < m_ulEdges; ul++)
+	{
+		if (1 < CBitSet::CountSetBits(m_edge_atoms[ul]))
+		{
+			AddHyperedge(m_edge_atoms[ul]);
+		}
+	}
+	AddCrossProductEdges();
+
+	// the budget is the number of pairs visited by an exhaustive search of
+	// a clique of the size that DP may search exhaustively
+	COptimizerConfig *optimizer_config =
+		COptCtxt::PoctxtFromTLS()->GetOptimizerConfig();
+	m_pair_budget = NumCsgCmpPairsOfClique(
+		optimizer_config->GetHint()->UlJoinOrderDPLimit());
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::~CJoinOrderDPhyp
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CJoinOrderDPhyp::~CJoinOrderDPhyp()
+{
+#ifdef GPOS_DEBUG
+	// in optimized build, we flush-down memory pools without leak checking,
+	// we can save time in optimized build by skipping all de-allocations here,
+	// we still have all de-allocations enabled in debug-build to detect any possible leaks
+	m_plans->Release();
+	m_top_k_plans->Release();
+	GPOS_DELETE_ARRAY(m_edge_atoms);
+	GPOS_DELETE_ARRAY(m_hyperedges);
+	GPOS_DELETE_ARRAY(m_nij_dependencies);
+	m_on_pred_conjuncts->Release();
+	CRefCount::SafeRelease(m_child_pred_indexes);
+#endif	// GPOS_DEBUG
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::AddHyperedge
+//
+//	@doc:
+//		Add a hyperedge to the graph, unless it is already there; several
+//		predicates often join the same atoms
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderDPhyp::AddHyperedge(ULLONG edge)
+{
+	for (ULONG ul = 0; ul < m_num_hyperedges; ul++)
+	{
+		if (edge == m_hyperedges[ul])
+		{
+			return;
+		}
+	}
+
+	m_hyperedges[m_num_hyperedges++] = edge;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::AddCrossProductEdges
+//
+//	@doc:
+//		The enumeration only visits connected sets of atoms, so the graph
+//		needs to be connected. Find its connected components, considering
+//		only edges between two atoms, and add a hyperedge for each pair of
+//		components, joining the complete components. This allows cross
+//		products on top of the joins within the components only.
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderDPhyp::AddCrossProductEdges()
+{
+	const ULONG num_edges = m_num_hyperedges;
+	ULLONG components[GPOPT_DPHYP_MAX_ATOMS];
+	ULONG num_components = 0;
+
+	ULLONG unassigned = m_all_atoms;
+	while (0 != unassigned)
+	{
+		ULLONG component =
+			GPOPT_DPHYP_ATOM(CBitSet::LowestSetBit(unassigned));
+
+		// grow the component until there are no more atoms to add
+		ULLONG previous = 0;
+		while (previous != component)
+		{
+			previous = component;
+			for (ULONG ul = 0; ul < num_edges; ul++)
+			{
+				ULLONG edge = m_hyperedges[ul];
+				if (2 == CBitSet::CountSetBits(edge) && 0 != (edge & component))
+				{
+					component |= edge;
+				}
+			}
+		}
+
+		components[num_components++] = component;
+		unassigned &= ~component;
+	}
+
+	for (ULONG ul1 = 0; ul1 < num_components; ul1++)
+	{
+		for (ULONG ul2 = ul1 + 1; ul2 < num_components; ul2++)
+		{
+			AddHyperedge(components[ul1] | components[ul2]);
+		}
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::NumCsgCmpPairsOfClique
+//
+//	@doc:
+//		Number of csg-cmp pairs of a clique of n atoms, (3^n - 2^(n+1) + 1) / 2
+//
+//---------------------------------------------------------------------------
+ULLONG
+CJoinOrderDPhyp::NumCsgCmpPairsOfClique(ULONG num_atoms)
+{
+	// 3^41 does not fit into 64 bits
+	if (40 < num_atoms)
+	{
+		return gpos::ullong_max;
+	}
+
+	if (2 > num_atoms)
+	{
+		return 0;
+	}
+
+	ULLONG pow3 = 1;
+	for (ULONG ul = 0; ul < num_atoms; ul++)
+	{
+		pow3 *= 3;
+	}
+
+	return (pow3 - GPOPT_DPHYP_ATOM(num_atoms + 1) + 1) / 2;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::Neighborhood
+//
+//	@doc:
+//		The atoms that can be added to the given set to grow it, excluding
+//		the given atoms. For every hyperedge reaching out of the set, only
+//		the lowest atom outside of the set is added; the other atoms of the
+//		hyperedge are added while growing the set further.
+//
+//---------------------------------------------------------------------------
+ULLONG
+CJoinOrderDPhyp::Neighborhood(ULLONG atoms, ULLONG excluded) const
+{
+	ULLONG neighborhood = 0;
+
+	for (ULONG ul = 0; ul < m_num_hyperedges; ul++)
+	{
+		ULLONG edge = m_hyperedges[ul];
+		if (0 == (edge & atoms))
+		{
+			continue;
+		}
+
+		ULLONG outside = edge & ~atoms & ~excluded;
+		if (0 != outside)
+		{
+			// lowest atom of the hyperedge outside of the set
+			neighborhood |= outside & (~outside + 1);
+		}
+	}
+
+	return neighborhood;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::IsConnected
+//
+//	@doc:
+//		Is there a hyperedge between the two given sets that is covered by
+//		their union
+//
+//---------------------------------------------------------------------------
+BOOL
+CJoinOrderDPhyp::IsConnected(ULLONG atoms1, ULLONG atoms2) const
+{
+	ULLONG atoms = atoms1 | atoms2;
+
+	for (ULONG ul = 0; ul < m_num_hyperedges; ul++)
+	{
+		ULLONG edge = m_hyperedges[ul];
+		if (0 == (edge & ~atoms) && 0 != (edge & atoms1) &&
+			0 != (edge & atoms2))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::IsRightChildOfNIJ
+//
+//	@doc:
+//		Is the given set a single atom that is the right child of an NIJ
+//
+//---------------------------------------------------------------------------
+BOOL
+CJoinOrderDPhyp::IsRightChildOfNIJ(ULLONG atoms) const
+{
+	return 0 != (atoms & m_nij_right_children) &&
+		   1 == CBitSet::CountSetBits(atoms);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::IsValidJoin
+//
+//	@doc:
+//		Can the two given sets be joined, with the first one as the left
+//		side. The right child of an NIJ can't be on the left side of a join,
+//		and it can only be on the right side if the left side contains the
+//		atoms referenced in its ON predicate.
+//
+//---------------------------------------------------------------------------
+BOOL
+CJoinOrderDPhyp::IsValidJoin(ULLONG left_atoms, ULLONG right_atoms) const
+{
+	if (IsRightChildOfNIJ(left_atoms))
+	{
+		return false;
+	}
+
+	if (IsRightChildOfNIJ(right_atoms))
+	{
+		ULLONG required_on_left =
+			m_nij_dependencies[CBitSet::LowestSetBit(right_atoms)];
+
+		return required_on_left == (left_atoms & required_on_left);
+	}
+
+	return true;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::LookupPlan
+//
+//	@doc:
+//		Best plan of the given set of atoms, NULL if there is none yet
+//
+//---------------------------------------------------------------------------
+CJoinOrderDPhyp::SPlanInfo *
+CJoinOrderDPhyp::LookupPlan(ULLONG atoms) const
+{
+	return m_plans->Find(&atoms);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::PexprBuildInnerJoinPred
+//
+//	@doc:
+//		Build the predicate of an inner join between the two given sets from
+//		the inner join edges covered by the join, and add those edges to the
+//		given set of used edges. Return NULL for a cross product.
+//
+//---------------------------------------------------------------------------
+CExpression *
+CJoinOrderDPhyp::PexprBuildInnerJoinPred(ULLONG left_atoms, ULLONG right_atoms,
+										 CBitSet *edges)
+{
+	GPOS_ASSERT(0 == (left_atoms & right_atoms));
+
+	ULLONG atoms = left_atoms | right_atoms;
+	CExpressionArray *pdrgpexpr = NULL;
+
+	for (ULONG ul = 0; ul < m_ulEdges; ul++)
+	{
+		ULLONG edge = m_edge_atoms[ul];
+		if (
+			// edge represents an inner join pred
+			0 == m_rgpedge[ul]->m_loj_num &&
+			// all columns referenced in the edge pred are provided
+			0 == (edge & ~atoms) &&
+			// the edge represents a true join predicate between the two sets
+			0 != (edge & left_atoms) && 0 != (edge & right_atoms))
+		{
+			if (NULL == pdrgpexpr)
+			{
+				pdrgpexpr = GPOS_NEW(m_mp) CExpressionArray(m_mp);
+			}
+
+			m_rgpedge[ul]->m_pexpr->AddRef();
+			pdrgpexpr->Append(m_rgpedge[ul]->m_pexpr);
+			(void) edges->ExchangeSet(ul);
+		}
+	}
+
+	if (NULL == pdrgpexpr)
+	{
+		return NULL;
+	}
+
+	return CPredicateUtils::PexprConjunction(m_mp, pdrgpexpr);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::DeriveStats
+//
+//	@doc:
+//		Derive stats on a join expression, with the join selectivity
+//		computed from the histogram buckets, as in CJoinOrderDPv2
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderDPhyp::DeriveStats(CExpression *pexpr)
+{
+	try
+	{
+		CJoinStatsProcessor::SetComputeScaleFactorFromHistogramBuckets(true);
+		CJoinOrder::DeriveStats(pexpr);
+		CJoinStatsProcessor::SetComputeScaleFactorFromHistogramBuckets(false);
+	}
+	catch (...)
+	{
+		CJoinStatsProcessor::SetComputeScaleFactorFromHistogramBuckets(false);
+		throw;
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::JoinPlans
+//
+//	@doc:
+//		Join the best plans of the two given sets, the first one being the
+//		left side, and keep the join if it is the best plan of the union of
+//		the sets. Stats are derived once per set. Plans producing all atoms
+//		are also added to the top k plans. Return the best plan of the union.
+//
+//		Cost of a join is the "internal data flow" of the join tree, the
+//		sum of all the rows flowing from the leaf nodes up to the root, with
+//		a penalty for joins that can't use a hash join, like in DPv2.
+//
+//---------------------------------------------------------------------------
+CJoinOrderDPhyp::SPlanInfo *
+CJoinOrderDPhyp::JoinPlans(ULLONG left_atoms, ULLONG right_atoms)
+{
+	GPOS_ASSERT(IsValidJoin(left_atoms, right_atoms));
+
+	SPlanInfo *left_plan = LookupPlan(left_atoms);
+	SPlanInfo *right_plan = LookupPlan(right_atoms);
+	GPOS_ASSERT(NULL != left_plan && NULL != right_plan);
+
+	CBitSet *edges = GPOS_NEW(m_mp) CBitSet(m_mp, *left_plan->m_edges);
+	edges->Union(right_plan->m_edges);
+
+	left_plan->m_expr->AddRef();
+	right_plan->m_expr->AddRef();
+
+	CExpression *join_expr = NULL;
+	if (IsRightChildOfNIJ(right_atoms))
+	{
+		// the ON predicate is the last edge of the NIJ
+		ULONG on_pred_index =
+			*(*m_child_pred_indexes)[CBitSet::LowestSetBit(right_atoms)] - 1;
+		CExpression *on_pred = (*m_on_pred_conjuncts)[on_pred_index];
+
+		on_pred->AddRef();
+		(void) edges->ExchangeSet(m_ulEdges - m_on_pred_conjuncts->Size() +
+								  on_pred_index);
+		join_expr = CUtils::PexprLogicalJoin<CLogicalLeftOuterJoin>(
+			m_mp, left_plan->m_expr, right_plan->m_expr, on_pred);
+	}
+	else
+	{
+		CExpression *pred =
+			PexprBuildInnerJoinPred(left_atoms, right_atoms, edges);
+		if (NULL == pred)
+		{
+			// generate a TRUE boolean expression as the join predicate of
+			// the cross product
+			pred = CUtils::PexprScalarConstBool(m_mp, true);
+		}
+		join_expr = CUtils::PexprLogicalJoin<CLogicalInnerJoin>(
+			m_mp, left_plan->m_expr, right_plan->m_expr, pred);
+	}
+
+	ULLONG atoms = left_atoms | right_atoms;
+	SPlanInfo *plan = LookupPlan(atoms);
+	CDouble rows(0.0);
+	if (NULL == plan)
+	{
+		DeriveStats(join_expr);
+		rows = join_expr->Pstats()->Rows();
+	}
+	else
+	{
+		rows = plan->m_rows;
+	}
+
+	CDouble cost = rows + left_plan->m_cost + right_plan->m_cost;
+	if (!CUtils::IsHashJoinPossible(m_mp, join_expr))
+	{
+		cost = cost * m_cross_prod_penalty;
+	}
+
+	if (atoms == m_all_atoms)
+	{
+		join_expr->AddRef();
+		edges->AddRef();
+		m_top_k_plans->Insert(
+			GPOS_NEW(m_mp) SPlanInfo(join_expr, rows, cost, edges));
+	}
+
+	if (NULL == plan)
+	{
+		plan = GPOS_NEW(m_mp) SPlanInfo(join_expr, rows, cost, edges);
+		m_plans->Insert(GPOS_NEW(m_mp) ULLONG(atoms), plan);
+	}
+	else if (cost < plan->m_cost)
+	{
+		// keep the stats of the set with the new best plan
+		IStatistics *stats = const_cast<IStatistics *>(plan->m_expr->Pstats());
+		stats->AddRef();
+		join_expr->InitStats(stats);
+
+		plan->m_expr->Release();
+		plan->m_edges->Release();
+		plan->m_expr = join_expr;
+		plan->m_edges = edges;
+		plan->m_cost = cost;
+	}
+	else
+	{
+		join_expr->Release();
+		edges->Release();
+	}
+
+	return plan;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::EmitCsgCmp
+//
+//	@doc:
+//		Join a connected set and a connected complement, in the order
+//		allowed by the NIJs. Inner joins are only generated in one order,
+//		the other one is left to the join commutativity rule.
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderDPhyp::EmitCsgCmp(ULLONG atoms1, ULLONG atoms2)
+{
+	m_num_pairs++;
+	if (m_pair_budget < m_num_pairs)
+	{
+		m_budget_exceeded = true;
+		return;
+	}
+
+	if (IsValidJoin(atoms1, atoms2))
+	{
+		(void) JoinPlans(atoms1, atoms2);
+	}
+	else if (IsValidJoin(atoms2, atoms1))
+	{
+		(void) JoinPlans(atoms2, atoms1);
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::EnumerateCmpRec
+//
+//	@doc:
+//		Grow the complement of the given connected set, and join the set
+//		with each connected complement that has a plan
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderDPhyp::EnumerateCmpRec(ULLONG atoms1, ULLONG atoms2, ULLONG excluded)
+{
+	GPOS_CHECK_STACK_SIZE;
+
+	ULLONG neighborhood = Neighborhood(atoms2, excluded);
+	if (0 == neighborhood)
+	{
+		return;
+	}
+
+	// visit the non-empty subsets of the neighborhood
+	for (ULLONG subset = (0 - neighborhood) & neighborhood;
+		 0 != subset && !m_budget_exceeded;
+		 subset = (subset - neighborhood) & neighborhood)
+	{
+		if (NULL != LookupPlan(atoms2 | subset) &&
+			IsConnected(atoms1, atoms2 | subset))
+		{
+			EmitCsgCmp(atoms1, atoms2 | subset);
+		}
+	}
+
+	for (ULLONG subset = (0 - neighborhood) & neighborhood;
+		 0 != subset && !m_budget_exceeded;
+		 subset = (subset - neighborhood) & neighborhood)
+	{
+		EnumerateCmpRec(atoms1, atoms2 | subset, excluded | neighborhood);
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::EmitCsg
+//
+//	@doc:
+//		Join the given connected set with all of its connected complements.
+//		Complements may only contain atoms greater than the lowest atom of
+//		the set, so that each pair is visited once.
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderDPhyp::EmitCsg(ULLONG atoms)
+{
+	ULLONG excluded =
+		atoms | GPOPT_DPHYP_ATOMS_UP_TO(CBitSet::LowestSetBit(atoms));
+	ULLONG neighborhood = Neighborhood(atoms, excluded);
+
+	// start the complements at each atom of the neighborhood, in descending
+	// order
+	for (ULONG ul = GPOPT_DPHYP_MAX_ATOMS; 0 < ul && !m_budget_exceeded; ul--)
+	{
+		ULONG atom = ul - 1;
+		if (0 == (neighborhood & GPOPT_DPHYP_ATOM(atom)))
+		{
+			continue;
+		}
+
+		ULLONG atoms2 = GPOPT_DPHYP_ATOM(atom);
+		if (IsConnected(atoms, atoms2))
+		{
+			EmitCsgCmp(atoms, atoms2);
+		}
+
+		EnumerateCmpRec(
+			atoms, atoms2,
+			excluded | (neighborhood & GPOPT_DPHYP_ATOMS_UP_TO(atom)));
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::EnumerateCsgRec
+//
+//	@doc:
+//		Grow the given connected set, emitting each connected set that has
+//		a plan
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderDPhyp::EnumerateCsgRec(ULLONG atoms, ULLONG excluded)
+{
+	GPOS_CHECK_STACK_SIZE;
+
+	ULLONG neighborhood = Neighborhood(atoms, excluded);
+	if (0 == neighborhood)
+	{
+		return;
+	}
+
+	// visit the non-empty subsets of the neighborhood
+	for (ULLONG subset = (0 - neighborhood) & neighborhood;
+		 0 != subset && !m_budget_exceeded;
+		 subset = (subset - neighborhood) & neighborhood)
+	{
+		if (NULL != LookupPlan(atoms | subset))
+		{
+			EmitCsg(atoms | subset);
+		}
+	}
+
+	for (ULLONG subset = (0 - neighborhood) & neighborhood;
+		 0 != subset && !m_budget_exceeded;
+		 subset = (subset - neighborhood) & neighborhood)
+	{
+		EnumerateCsgRec(atoms | subset, excluded | neighborhood);
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::EnumerateGreedy
+//
+//	@doc:
+//		Build a join order bottom up, always joining the two sets with the
+//		lowest cardinality result, preferring connected sets over cross
+//		products. Used when the DP enumeration exceeds its budget or finds
+//		no plan for all atoms. Reuses the plans of the DP table.
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderDPhyp::EnumerateGreedy()
+{
+	ULLONG groups[GPOPT_DPHYP_MAX_ATOMS];
+	ULONG num_groups = m_ulComps;
+
+	for (ULONG atom = 0; atom < m_ulComps; atom++)
+	{
+		groups[atom] = GPOPT_DPHYP_ATOM(atom);
+	}
+
+	while (1 < num_groups)
+	{
+		BOOL found = false;
+		BOOL best_is_connected = false;
+		CDouble best_rows(0.0);
+		ULONG best_left = 0;
+		ULONG best_right = 0;
+
+		for (ULONG left = 0; left < num_groups; left++)
+		{
+			for (ULONG right = 0; right < num_groups; right++)
+			{
+				if (left == right ||
+					!IsValidJoin(groups[left], groups[right]))
+				{
+					continue;
+				}
+
+				BOOL is_connected = IsConnected(groups[left], groups[right]);
+				if (best_is_connected && !is_connected)
+				{
+					continue;
+				}
+
+				SPlanInfo *plan = JoinPlans(groups[left], groups[right]);
+				if (!found || (is_connected && !best_is_connected) ||
+					plan->m_rows < best_rows)
+				{
+					found = true;
+					best_is_connected = is_connected;
+					best_rows = plan->m_rows;
+					best_left = left;
+					best_right = right;
+				}
+			}
+		}
+
+		if (!found)
+		{
+			// the NIJs don't allow joining any of the remaining sets
+			GPOS_ASSERT(!"no valid join order");
+			return;
+		}
+
+		groups[best_left] |= groups[best_right];
+		groups[best_right] = groups[num_groups - 1];
+		num_groups--;
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::PexprExpand
+//
+//	@doc:
+//		Main driver for join order enumeration, called by xform
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderDPhyp::PexprExpand()
+{
+	// the atoms are the plans of the single atom sets, they all have stats
+	for (ULONG atom = 0; atom < m_ulComps; atom++)
+	{
+		CExpression *pexpr_atom = m_rgpcomp[atom]->m_pexpr;
+		CJoinOrder::DeriveStats(pexpr_atom);
+
+		CDouble rows = pexpr_atom->Pstats()->Rows();
+		pexpr_atom->AddRef();
+		m_plans->Insert(GPOS_NEW(m_mp) ULLONG(GPOPT_DPHYP_ATOM(atom)),
+						GPOS_NEW(m_mp) SPlanInfo(pexpr_atom, rows, rows,
+												 GPOS_NEW(m_mp) CBitSet(m_mp)));
+	}
+
+	// enumerate the connected sets starting at each atom, from the highest
+	// to the lowest, each one growing only with atoms above its start
+	for (ULONG ul = m_ulComps; 0 < ul && !m_budget_exceeded; ul--)
+	{
+		ULONG atom = ul - 1;
+
+		EmitCsg(GPOPT_DPHYP_ATOM(atom));
+		EnumerateCsgRec(GPOPT_DPHYP_ATOM(atom), GPOPT_DPHYP_ATOMS_UP_TO(atom));
+	}
+
+	if (m_budget_exceeded || NULL == LookupPlan(m_all_atoms))
+	{
+		EnumerateGreedy();
+	}
+
+	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
+	{
+		CAutoTrace at(m_mp);
+		at.Os() << "[OPT]: DPhyp csg-cmp pairs: " << m_num_pairs
+				<< ", budget: " << m_pair_budget
+				<< ", plans: " << m_plans->Size()
+				<< (m_budget_exceeded ? ", completed greedily" : "");
+	}
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::AddSelectNodeForRemainingEdges
+//
+//	@doc:
+//		Add a select node with the inner join predicates that were not used
+//		in the join tree, like predicates on a single atom, predicates with
+//		outer references, or predicates on the right child of an NIJ that
+//		are covered by the NIJ itself
+//
+//---------------------------------------------------------------------------
+CExpression *
+CJoinOrderDPhyp::AddSelectNodeForRemainingEdges(CExpression *join_expr,
+												CBitSet *used_edges)
+{
+	CExpressionArray *exprArray = GPOS_NEW(m_mp) CExpressionArray(m_mp);
+
+	for (ULONG en = 0; en < m_ulEdges; en++)
+	{
+		if (!used_edges->Get(en))
+		{
+			GPOS_ASSERT(0 == m_rgpedge[en]->m_loj_num);
+			m_rgpedge[en]->m_pexpr->AddRef();
+			exprArray->Append(m_rgpedge[en]->m_pexpr);
+		}
+	}
+
+	if (0 < exprArray->Size())
+	{
+		CExpression *conj = CPredicateUtils::PexprConjunction(m_mp, exprArray);
+
+		return GPOS_NEW(m_mp) CExpression(
+			m_mp, GPOS_NEW(m_mp) CLogicalSelect(m_mp), join_expr, conj);
+	}
+
+	exprArray->Release();
+
+	return join_expr;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::GetNextOfTopK
+//
+//	@doc:
+//		Return the next of the plans producing all atoms, in the order of
+//		increasing cost. Return NULL if there are no more alternatives.
+//
+//---------------------------------------------------------------------------
+CExpression *
+CJoinOrderDPhyp::GetNextOfTopK()
+{
+	SPlanInfo *plan = m_top_k_plans->RemoveBestElement();
+	if (NULL == plan)
+	{
+		return NULL;
+	}
+
+	CExpression *join_expr = plan->m_expr;
+	join_expr->AddRef();
+	join_expr = AddSelectNodeForRemainingEdges(join_expr, plan->m_edges);
+	plan->Release();
+
+	return join_expr;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::OsPrint
+//
+//	@doc:
+//		Print the best plans found
+//
+//---------------------------------------------------------------------------
+IOstream &
+CJoinOrderDPhyp::OsPrint(IOstream &os) const
+{
+	CHashMapIter<ULLONG, SPlanInfo, gpos::HashValue<ULLONG>,
+				 gpos::Equals<ULLONG>, CleanupDelete<ULLONG>,
+				 CleanupRelease<SPlanInfo> >
+		iter(m_plans);
+	CPrintPrefix pref(NULL, "      ");
+
+	os << "DPhyp csg-cmp pairs: " << m_num_pairs << std::endl;
+	while (iter.Advance())
+	{
+		os << "Atoms: {";
+		ULLONG atoms = *iter.Key();
+		for (ULONG atom = 0; atom < m_ulComps; atom++)
+		{
+			if (0 != (atoms & GPOPT_DPHYP_ATOM(atom)))
+			{
+				os << " " << atom;
+			}
+		}
+		os << " }" << std::endl
+		   << "Rows: " << iter.Value()->m_rows << ", Cost: "
+		   << iter.Value()->m_cost << std::endl
+		   << "Best expression: " << std::endl;
+		iter.Value()->m_expr->OsPrintExpression(os, &pref);
+	}
+
+	return os;
+}
+
+// EOF
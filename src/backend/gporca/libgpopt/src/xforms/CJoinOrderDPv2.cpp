@@ -66,6 +66,9 @@ CJoinOrderDPv2::CJoinOrderDPv2(CMemoryPool *mp,
 	: CJoinOrder(mp, pdrgpexprAtoms, innerJoinConjuncts, onPredConjuncts,
 				 childPredIndexes),
 	  m_expression_to_edge_map(NULL),
+	  m_bitset_to_stats_map(NULL),
+	  m_stats_cache_hits(0),
+	  m_stats_cache_misses(0),
 	  m_on_pred_conjuncts(onPredConjuncts),
 	  m_child_pred_indexes(childPredIndexes),
 	  m_non_inner_join_dependencies(NULL),
@@ -83,6 +86,7 @@ CJoinOrderDPv2::CJoinOrderDPv2(CMemoryPool *mp,
 	}
 
 	m_bitset_to_group_info_map = GPOS_NEW(mp) BitSetToGroupInfoMap(mp);
+	m_bitset_to_stats_map = GPOS_NEW(mp) BitSetToStatsMap(mp);
 
 	// Contains top k expressions for a general DP algorithm, without considering cost of motions/PS
 	m_top_k_expressions =
@@ -152,6 +156,7 @@ CJoinOrderDPv2::~CJoinOrderDPv2()
 	CRefCount::SafeRelease(m_non_inner_join_dependencies);
 	CRefCount::SafeRelease(m_child_pred_indexes);
 	m_bitset_to_group_info_map->Release();
+	m_bitset_to_stats_map->Release();
 	CRefCount::SafeRelease(m_expression_to_edge_map);
 	m_top_k_expressions->Release();
 	m_top_k_part_expressions->Release();
@@ -287,6 +292,45 @@ CJoinOrderDPv2::DeriveStats(CExpression *pexpr)
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPv2::DeriveStatsForAtoms
+//
+//	@doc:
+//		Derive stats of a join expression producing the given set of atoms.
+//		Groups that don't make the top k of their level are discarded, and
+//		the later enumeration algorithms often create them again, so keep
+//		the stats of every set of atoms for the lifetime of the enumeration.
+//
+//---------------------------------------------------------------------------
+void
+CJoinOrderDPv2::DeriveStatsForAtoms(CBitSet *atoms, CExpression *pexpr)
+{
+	if (NULL != pexpr->Pstats())
+	{
+		return;
+	}
+
+	IStatistics *stats = m_bitset_to_stats_map->Find(atoms);
+	if (NULL != stats)
+	{
+		m_stats_cache_hits++;
+		stats->AddRef();
+		pexpr->InitStats(stats);
+		return;
+	}
+
+	m_stats_cache_misses++;
+	DeriveStats(pexpr);
+
+	stats = const_cast<IStatistics *>(pexpr->Pstats());
+	GPOS_ASSERT(NULL != stats);
+	atoms->AddRef();
+	stats->AddRef();
+	m_bitset_to_stats_map->Insert(atoms, stats);
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CJoinOrderDPv2::GetJoinExprForProperties
@@ -1216,7 +1260,7 @@ CJoinOrderDPv2::LookupOrCreateGroupInfo(SLevelInfo *levelInfo, CBitSet *atoms,
 				stats_expr_info->m_left_child_expr.m_group_info,
 				stats_expr_info->m_right_child_expr.m_group_info, stats_props);
 
-			DeriveStats(real_expr_info_for_stats->m_expr);
+			DeriveStatsForAtoms(atoms, real_expr_info_for_stats->m_expr);
 		}
 		else
 		{
@@ -1414,6 +1458,13 @@ CJoinOrderDPv2::PexprExpand()
 	EnumerateQuery();
 	EnumerateMinCard();
 	EnumerateGreedyAvoidXProd();
+
+	if (GPOS_FTRACE(EopttracePrintOptimizationStatistics))
+	{
+		CAutoTrace at(m_mp);
+		at.Os() << "[OPT]: DPv2 join stats derived: " << m_stats_cache_misses
+				<< ", reused: " << m_stats_cache_hits;
+	}
 }
 
 
@@ -1923,6 +1974,8 @@ CJoinOrderDPv2::OsPrint(IOstream &os) const
 
 	os << "CJoinOrderDPv2 - total number of groups: " << num_bitsets
 	   << std::endl;
+	os << "CJoinOrderDPv2 - join stats derived: " << m_stats_cache_misses
+	   << ", reused: " << m_stats_cache_hits << std::endl;
 
 	return os;
 }
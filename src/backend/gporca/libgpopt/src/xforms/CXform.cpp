@@ -291,6 +291,18 @@ CXform::PbsJoinOrderOnExhaustive2Xforms(CMemoryPool *mp)
 	return pbs;
 }
 
+CBitSet *
+CXform::PbsJoinOrderOnHypergraphXforms(CMemoryPool *mp)
+{
+	// same as exhaustive2, with DPhyp taking the place of DPv2 for joins
+	// of up to GPOPT_DPHYP_MAX_ATOMS atoms
+	CBitSet *pbs = PbsJoinOrderOnExhaustive2Xforms(mp);
+
+	(void) pbs->ExchangeSet(EopttraceEnableHypergraphJoinOrder);
+
+	return pbs;
+}
+
 BOOL
 CXform::IsApplyOnce()
 {
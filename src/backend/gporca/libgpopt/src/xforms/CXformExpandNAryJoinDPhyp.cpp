@@ -0,0 +1,149 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CXformExpandNAryJoinDPhyp.cpp
+//
+//	@doc:
+//		Implementation of n-ary join expansion using dynamic programming
+//		over the join hypergraph
+//---------------------------------------------------------------------------
+
+#include "gpopt/xforms/CXformExpandNAryJoinDPhyp.h"
+
+#include "gpos/base.h"
+
+#include "gpopt/operators/CLogicalNAryJoin.h"
+#include "gpopt/operators/CNormalizer.h"
+#include "gpopt/operators/CPatternMultiLeaf.h"
+#include "gpopt/operators/CPatternTree.h"
+#include "gpopt/operators/CPredicateUtils.h"
+#include "gpopt/operators/CScalarNAryJoinPredList.h"
+#include "gpopt/xforms/CJoinOrderDPhyp.h"
+#include "gpopt/xforms/CXformUtils.h"
+
+using namespace gpopt;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformExpandNAryJoinDPhyp::CXformExpandNAryJoinDPhyp
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CXformExpandNAryJoinDPhyp::CXformExpandNAryJoinDPhyp(CMemoryPool *mp)
+	: CXformExploration(
+		  // pattern
+		  GPOS_NEW(mp) CExpression(
+			  mp, GPOS_NEW(mp) CLogicalNAryJoin(mp),
+			  GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternMultiLeaf(mp)),
+			  GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternTree(mp))))
+{
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformExpandNAryJoinDPhyp::Exfp
+//
+//	@doc:
+//		Compute xform promise for a given expression handle; the xform is
+//		only used with optimizer_join_order set to 'hypergraph', and for up
+//		to GPOPT_DPHYP_MAX_ATOMS atoms, wider joins are left to DPv2
+//
+//---------------------------------------------------------------------------
+CXform::EXformPromise
+CXformExpandNAryJoinDPhyp::Exfp(CExpressionHandle &exprhdl) const
+{
+	if (!GPOS_FTRACE(EopttraceEnableHypergraphJoinOrder) ||
+		GPOPT_DPHYP_MAX_ATOMS < exprhdl.Arity() - 1)
+	{
+		return CXform::ExfpNone;
+	}
+
+	return CXformUtils::ExfpExpandJoinOrder(exprhdl, this);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformExpandNAryJoinDPhyp::Transform
+//
+//	@doc:
+//		Actual transformation of n-ary join to cluster of inner and left
+//		outer joins using dynamic programming over the join hypergraph
+//
+//---------------------------------------------------------------------------
+void
+CXformExpandNAryJoinDPhyp::Transform(CXformContext *pxfctxt,
+									 CXformResult *pxfres,
+									 CExpression *pexpr) const
+{
+	GPOS_ASSERT(NULL != pxfctxt);
+	GPOS_ASSERT(NULL != pxfres);
+	GPOS_ASSERT(FPromising(pxfctxt->Pmp(), this, pexpr));
+	GPOS_ASSERT(FCheckPattern(pexpr));
+
+	CMemoryPool *mp = pxfctxt->Pmp();
+
+	const ULONG arity = pexpr->Arity();
+	GPOS_ASSERT(arity >= 3);
+
+	// Make an expression array with all the atoms (the logical children)
+	CExpressionArray *pdrgpexpr = GPOS_NEW(mp) CExpressionArray(mp);
+	for (ULONG ul = 0; ul < arity - 1; ul++)
+	{
+		CExpression *pexprChild = (*pexpr)[ul];
+		pexprChild->AddRef();
+		pdrgpexpr->Append(pexprChild);
+	}
+
+	// Split the join predicates into the inner join conjuncts and the ON
+	// predicates of the non-inner joins, as in CXformExpandNAryJoinDPv2
+	CLogicalNAryJoin *naryJoin = CLogicalNAryJoin::PopConvert(pexpr->Pop());
+	CExpression *pexprScalar = (*pexpr)[arity - 1];
+	CExpressionArray *innerJoinPreds = NULL;
+	CExpressionArray *onPreds = GPOS_NEW(mp) CExpressionArray(mp);
+	ULongPtrArray *childPredIndexes = NULL;
+
+	if (NULL != CScalarNAryJoinPredList::PopConvert(pexprScalar->Pop()))
+	{
+		innerJoinPreds =
+			CPredicateUtils::PdrgpexprConjuncts(mp, (*pexprScalar)[0]);
+
+		for (ULONG ul = 1; ul < pexprScalar->Arity(); ul++)
+		{
+			(*pexprScalar)[ul]->AddRef();
+			onPreds->Append((*pexprScalar)[ul]);
+		}
+
+		childPredIndexes = naryJoin->GetLojChildPredIndexes();
+		GPOS_ASSERT(NULL != childPredIndexes);
+		childPredIndexes->AddRef();
+	}
+	else
+	{
+		innerJoinPreds = CPredicateUtils::PdrgpexprConjuncts(mp, pexprScalar);
+	}
+
+	CJoinOrderDPhyp jodp(mp, pdrgpexpr, innerJoinPreds, onPreds,
+						 childPredIndexes);
+	jodp.PexprExpand();
+
+	// Retrieve top K join orders from jodp and add as alternatives
+	CExpression *nextJoinOrder = NULL;
+
+	while (NULL != (nextJoinOrder = jodp.GetNextOfTopK()))
+	{
+		CExpression *pexprNormalized =
+			CNormalizer::PexprNormalize(mp, nextJoinOrder);
+
+		nextJoinOrder->Release();
+		pxfres->Add(pexprNormalized);
+	}
+}
+
+// EOF
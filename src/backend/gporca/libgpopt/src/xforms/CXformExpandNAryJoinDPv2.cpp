@@ -22,6 +22,7 @@
 #include "gpopt/operators/CPredicateUtils.h"
 #include "gpopt/operators/CScalarNAryJoinPredList.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
+#include "gpopt/xforms/CJoinOrderDPhyp.h"
 #include "gpopt/xforms/CJoinOrderDPv2.h"
 #include "gpopt/xforms/CXformUtils.h"
 
@@ -60,6 +61,13 @@ CXformExpandNAryJoinDPv2::CXformExpandNAryJoinDPv2(CMemoryPool *mp)
 CXform::EXformPromise
 CXformExpandNAryJoinDPv2::Exfp(CExpressionHandle &exprhdl) const
 {
+	if (GPOS_FTRACE(EopttraceEnableHypergraphJoinOrder) &&
+		GPOPT_DPHYP_MAX_ATOMS >= exprhdl.Arity() - 1)
+	{
+		// the join is expanded by CXformExpandNAryJoinDPhyp
+		return CXform::ExfpNone;
+	}
+
 	return CXformUtils::ExfpExpandJoinOrder(exprhdl, this);
 }
 
@@ -12,6 +12,7 @@
 #include "gpos/base.h"
 #include "gpos/memory/CMemoryPoolManager.h"
 
+#include "gpopt/operators/CPatternNode.h"
 #include "gpopt/xforms/xforms.h"
 
 using namespace gpopt;
@@ -42,6 +43,10 @@ CXformFactory::CXformFactory(CMemoryPool *mp)
 	{
 		m_rgpxf[i] = NULL;
 	}
+	for (ULONG ul = 0; ul < COperator::EopSentinel; ul++)
+	{
+		m_rgpxfsOperator[ul] = NULL;
+	}
 	m_phmszxform = GPOS_NEW(mp) XformNameToXformMap(mp);
 	m_pxfsExploration = GPOS_NEW(mp) CXformSet(mp);
 	m_pxfsImplementation = GPOS_NEW(mp) CXformSet(mp);
@@ -73,6 +78,11 @@ CXformFactory::~CXformFactory()
 		m_rgpxf[i] = NULL;
 	}
 
+	for (ULONG ul = 0; ul < COperator::EopSentinel; ul++)
+	{
+		CRefCount::SafeRelease(m_rgpxfsOperator[ul]);
+	}
+
 	m_phmszxform->Release();
 	m_pxfsExploration->Release();
 	m_pxfsImplementation->Release();
@@ -296,9 +306,65 @@ CXformFactory::Instantiate()
 	Add(GPOS_NEW(m_mp) CXformLeftJoin2RightJoin(m_mp));
 	Add(GPOS_NEW(m_mp) CXformRightOuterJoin2HashJoin(m_mp));
 	Add(GPOS_NEW(m_mp) CXformImplementInnerJoin(m_mp));
+	Add(GPOS_NEW(m_mp) CXformExpandNAryJoinDPhyp(m_mp));
 
 	GPOS_ASSERT(NULL != m_rgpxf[CXform::ExfSentinel - 1] &&
 				"Not all xforms have been instantiated");
+
+	IndexByOperator();
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformFactory::IndexByOperator
+//
+//	@doc:
+//		Index the xforms by the root operator of their patterns, so that
+//		the xforms that cannot bind to a group expression are dropped
+//		without scheduling them; a pattern rooted at a pattern node is
+//		indexed under each operator the node matches, and a pattern
+//		rooted at a leaf or a tree under all operators
+//
+//---------------------------------------------------------------------------
+void
+CXformFactory::IndexByOperator()
+{
+	for (ULONG ul = 0; ul < COperator::EopSentinel; ul++)
+	{
+		m_rgpxfsOperator[ul] = GPOS_NEW(m_mp) CXformSet(m_mp);
+	}
+
+	for (ULONG ulXform = 0; ulXform < CXform::ExfSentinel; ulXform++)
+	{
+		CXform *pxform = m_rgpxf[ulXform];
+		if (NULL == pxform)
+		{
+			// skipped xform id
+			continue;
+		}
+
+		COperator *popPattern = pxform->PexprPattern()->Pop();
+		for (ULONG ul = 0; ul < COperator::EopSentinel; ul++)
+		{
+			COperator::EOperatorId eopid = (COperator::EOperatorId) ul;
+			BOOL fMatches = (popPattern->Eopid() == eopid);
+			if (COperator::EopPatternNode == popPattern->Eopid())
+			{
+				fMatches =
+					CPatternNode::PopConvert(popPattern)->MatchesOperator(eopid);
+			}
+			else if (popPattern->FPattern())
+			{
+				fMatches = true;
+			}
+
+			if (fMatches)
+			{
+				(void) m_rgpxfsOperator[ul]->ExchangeSet(pxform->Exfid());
+			}
+		}
+	}
 }
 
 
@@ -152,7 +152,8 @@ CXformUtils::ExfpExpandJoinOrder(CExpressionHandle &exprhdl,
 	// when we have outer refs.
 	if (exprhdl.DeriveHasSubquery(exprhdl.Arity() - 1) ||
 		(exprhdl.HasOuterRefs() &&
-		 CXform::ExfExpandNAryJoinDPv2 != xform->Exfid()))
+		 CXform::ExfExpandNAryJoinDPv2 != xform->Exfid() &&
+		 CXform::ExfExpandNAryJoinDPhyp != xform->Exfid()))
 	{
 		// subqueries must be unnested before applying xform
 		return CXform::ExfpNone;
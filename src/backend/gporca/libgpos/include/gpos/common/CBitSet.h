@@ -6,7 +6,7 @@
 //		CBitSet.h
 //
 //	@doc:
-//		Implementation of bitset as linked list of bitvectors
+//		Implementation of bitset as a contiguous array of words
 //---------------------------------------------------------------------------
 #ifndef GPOS_CBitSet_H
 #define GPOS_CBitSet_H
@@ -25,7 +25,11 @@ namespace gpos
 //		CBitSet
 //
 //	@doc:
-//		Linked list of CBitSetLink's
+//		Set of ULONGs stored as a contiguous array of 64-bit words. Small
+//		sets live in words stored inline in the set; the array moves to the
+//		memory pool once a bit beyond the inline words is set and grows as
+//		needed. All set operations are word-wise loops over the arrays, and
+//		the number of elements is maintained with popcounts.
 //
 //---------------------------------------------------------------------------
 class CBitSet : public CRefCount, public DbgPrintMixin<CBitSet>
@@ -33,63 +37,32 @@ class CBitSet : public CRefCount, public DbgPrintMixin<CBitSet>
 	// bitset iter needs to access internals
 	friend class CBitSetIter;
 
-protected:
-	//---------------------------------------------------------------------------
-	//	@class:
-	//		CBitSetLink
-	//
-	//	@doc:
-	//		bit vector + offset + link
-	//
-	//---------------------------------------------------------------------------
-	class CBitSetLink
-	{
-	private:
-		// private copy ctor
-		CBitSetLink(const CBitSetLink &);
-
-		// offset
-		ULONG m_offset;
-
-		// bitvector
-		CBitVector *m_vec;
-
-	public:
-		// ctor
-		explicit CBitSetLink(CMemoryPool *, ULONG offset, ULONG vector_size);
+private:
+	// number of bits in a word
+	static const ULONG BitsPerWord = 64;
 
-		explicit CBitSetLink(CMemoryPool *, const CBitSetLink &);
+	// number of words stored inline
+	static const ULONG InlineWords = 4;
 
-		// dtor
-		~CBitSetLink();
-
-		// accessor
-		ULONG
-		GetOffset() const
-		{
-			return m_offset;
-		}
-
-		// accessor
-		CBitVector *
-		GetVec() const
-		{
-			return m_vec;
-		}
+	// pool to allocate the word array from
+	CMemoryPool *m_mp;
 
-		// list link
-		SLink m_link;
+	// size of the bitvectors the set used to be split into; only
+	// determines the hash value, see HashValue()
+	ULONG m_vector_size;
 
-	};	// class CBitSetLink
+	// words stored inline
+	ULLONG m_inline_words[InlineWords];
 
-	// list of bit set links
-	CList<CBitSetLink> m_bsllist;
+	// word array, either the inline words or allocated from the pool;
+	// words at and beyond m_len are zero
+	ULLONG *m_words;
 
-	// pool to allocate links from
-	CMemoryPool *m_mp;
+	// number of words in the array
+	ULONG m_capacity;
 
-	// size of individual bitvectors
-	ULONG m_vector_size;
+	// number of words in use; the last word in use is not zero
+	ULONG m_len;
 
 	// number of elements
 	ULONG m_size;
@@ -97,18 +70,19 @@ protected:
 	// private copy ctor
 	CBitSet(const CBitSet &);
 
-	// find link with offset less or equal to given value
-	CBitSetLink *FindLinkByOffset(ULONG, CBitSetLink * = NULL) const;
-
-	// reset set
-	void Clear();
+	// make room for the given number of words
+	void EnsureCapacity(ULONG num_words);
 
-	// compute target offset
-	ULONG ComputeOffset(ULONG) const;
+	// drop trailing zero words
+	void Trim();
 
 	// re-compute size of set
 	void RecomputeSize();
 
+	// word containing the given number of bits starting at the given bit,
+	// the bits beyond the set are zero
+	ULLONG GetBits(ULONG pos, ULONG num_bits) const;
+
 public:
 	// ctor
 	CBitSet(CMemoryPool *mp, ULONG vector_size = 256);
@@ -157,6 +131,39 @@ public:
 	// print function
 	virtual IOstream &OsPrint(IOstream &os) const;
 
+	// number of bits set in a word
+	static ULONG
+	CountSetBits(ULLONG word)
+	{
+#ifdef __GNUC__
+		return (ULONG) __builtin_popcountll(word);
+#else
+		ULONG num_bits = 0;
+		for (; 0 != word; num_bits++)
+		{
+			word &= (word - 1);
+		}
+		return num_bits;
+#endif	// __GNUC__
+	}
+
+	// position of the lowest bit set in a non-zero word
+	static ULONG
+	LowestSetBit(ULLONG word)
+	{
+		GPOS_ASSERT(0 != word);
+#ifdef __GNUC__
+		return (ULONG) __builtin_ctzll(word);
+#else
+		ULONG pos = 0;
+		for (; 0 == (word & (ULLONG) 1); pos++)
+		{
+			word >>= 1;
+		}
+		return pos;
+#endif	// __GNUC__
+	}
+
 };	// class CBitSet
 
 
@@ -22,7 +22,7 @@ namespace gpos
 //
 //	@doc:
 //		Iterator for bitset's; defined as friend, ie can access bitset's
-//		internal links
+//		internal words
 //
 //---------------------------------------------------------------------------
 class CBitSetIter
@@ -31,12 +31,9 @@ private:
 	// bitset
 	const CBitSet &m_bs;
 
-	// current cursor position (in current link)
+	// current cursor position
 	ULONG m_cursor;
 
-	// current cursor link
-	CBitSet::CBitSetLink *m_bsl;
-
 	// is iterator active or exhausted
 	BOOL m_active;
 
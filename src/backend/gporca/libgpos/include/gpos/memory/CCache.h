@@ -77,6 +77,9 @@ public:
 	typedef ULONG (*HashFuncPtr)(const K &);
 	typedef BOOL (*EqualFuncPtr)(const K &, const K &);
 
+	// type definition of predicate selecting objects to evict
+	typedef BOOL (*MatchFuncPtr)(const K &, T, void *);
+
 private:
 	typedef CCacheEntry<T, K> CCacheHashTableEntry;
 
@@ -495,6 +498,57 @@ public:
 		return m_eviction_counter;
 	}
 
+	// evict all objects satisfying the given predicate; objects pinned by a
+	// client are marked for deletion and removed once the last client
+	// releases them; returns the number of objects evicted
+	ULONG
+	EvictMatchingEntries(MatchFuncPtr match_func, void *arg)
+	{
+		GPOS_ASSERT(NULL != match_func);
+
+		ULONG num_evicted = 0;
+		CCacheHashtableIter iter(m_hash_table);
+
+		// removing an entry advances the iterator, see EvictEntriesOnePass
+		BOOL advanced = false;
+		while (advanced || iter.Advance())
+		{
+			advanced = false;
+			CCacheHashTableEntry *entry = NULL;
+			BOOL deleted = false;
+
+			// Scope for CCacheHashtableIterAccessor
+			{
+				CCacheHashtableIterAccessor acc(iter);
+
+				if (NULL != (entry = acc.Value()) &&
+					!entry->IsMarkedForDeletion() &&
+					match_func(entry->Key(), entry->Val(), arg))
+				{
+					num_evicted++;
+					if (EXPECTED_REF_COUNT_FOR_DELETE == entry->RefCount())
+					{
+						acc.Remove(entry);
+						deleted = true;
+						advanced = true;
+						m_cache_size -= entry->Pmp()->TotalAllocatedSize();
+					}
+					else
+					{
+						entry->MarkForDeletion();
+					}
+				}
+			}
+
+			if (deleted)
+			{
+				DestroyCacheEntry(entry);
+			}
+		}
+
+		return num_evicted;
+	}
+
 	// sets the cache quota
 	void
 	SetCacheQuota(ULLONG new_quota)
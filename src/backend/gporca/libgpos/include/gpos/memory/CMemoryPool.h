@@ -154,6 +154,14 @@ public:
 		return 0;
 	}
 
+	// return the highest total allocated size of the pool's lifetime
+	virtual ULLONG
+	PeakAllocatedSize() const
+	{
+		GPOS_ASSERT(!"not supported");
+		return 0;
+	}
+
 	// requested size of allocation
 	static ULONG UserSizeOfAlloc(const void *ptr);
 
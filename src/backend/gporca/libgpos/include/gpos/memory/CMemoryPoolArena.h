@@ -0,0 +1,196 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMemoryPoolArena.h
+//
+//	@doc:
+//		Memory pool that carves small allocations out of large slabs
+//
+//---------------------------------------------------------------------------
+#ifndef GPOS_CMemoryPoolArena_H
+#define GPOS_CMemoryPoolArena_H
+
+#include "gpos/base.h"
+#include "gpos/memory/CMemoryPool.h"
+#include "gpos/memory/CMemoryPoolStatistics.h"
+
+// size of a slab requested from the underlying allocator
+#define GPOS_MEM_ARENA_SLAB_SIZE (64 * 1024)
+
+// size-class granularity and largest size served from the small classes
+#define GPOS_MEM_ARENA_CLASS_GRANULARITY (16)
+#define GPOS_MEM_ARENA_SMALL_LIMIT (1024)
+
+// two power-of-two classes (2K, 4K) above the small limit
+#define GPOS_MEM_ARENA_MAX_CLASS_SIZE (4096)
+#define GPOS_MEM_ARENA_NUM_CLASSES \
+	(GPOS_MEM_ARENA_SMALL_LIMIT / GPOS_MEM_ARENA_CLASS_GRANULARITY + 2)
+
+namespace gpos
+{
+// Memory pool that serves allocations from size-classed free lists and a
+// bump pointer over slabs. Only slab refills and allocations larger than the
+// biggest size class go to the underlying allocator, malloc() unless a
+// subclass overrides AllocateBlock() and FreeBlock().
+//
+// Every chunk is preceded by a pointer to the size class it was carved for,
+// so the static DeleteImpl() can return it to the right free list without
+// knowing the pool. Oversized allocations point to the pool's large class
+// and are handed back to the underlying allocator individually.
+class CMemoryPoolArena : public CMemoryPool
+{
+private:
+	// a size class; m_size is 0 for the class of oversized allocations
+	struct SSizeClass
+	{
+		// owning pool
+		CMemoryPoolArena *m_pool;
+
+		// chunk size including the chunk header
+		ULONG m_size;
+
+		// head of the free list, linked through the chunks' user area
+		void *m_free_list;
+	};
+
+	// header preceding every chunk handed out
+	struct SChunkHeader
+	{
+		SSizeClass *m_size_class;
+	};
+
+	// header at the start of every slab
+	struct SSlabHeader
+	{
+		SSlabHeader *m_next;
+	};
+
+	// additional header preceding oversized chunks
+	struct SLargeHeader
+	{
+		SLargeHeader *m_prev;
+
+		SLargeHeader *m_next;
+
+		ULONG m_total_size;
+	};
+
+	// When destroying arrays, we need to call the destructor of each element
+	// To do this, we need the size of the allocation, which we then divide by the
+	// the size of the element to get number of elements to iterate through.
+	// This struct is only used for array allocations (GPOS_NEW_ARRAY())
+	struct SArrayAllocHeader
+	{
+		ULONG m_user_size;
+	};
+
+	// size classes
+	SSizeClass m_size_classes[GPOS_MEM_ARENA_NUM_CLASSES];
+
+	// class of oversized allocations
+	SSizeClass m_large_class;
+
+	// slabs held by the pool, most recent first
+	SSlabHeader *m_slabs;
+
+	// oversized chunks held by the pool
+	SLargeHeader *m_large_chunks;
+
+	// bump pointer into the current slab and its end
+	BYTE *m_slab_cur;
+	BYTE *m_slab_end;
+
+	// number of slabs held by the pool
+	ULONG m_num_slabs;
+
+	// bytes taken from the underlying allocator, and their high-water mark
+	ULLONG m_allocated_size;
+	ULLONG m_peak_allocated_size;
+
+	// allocation statistics
+	CMemoryPoolStatistics m_memory_pool_statistics;
+
+	// private copy ctor
+	CMemoryPoolArena(const CMemoryPoolArena &);
+
+	// map a chunk size to its size class index
+	static ULONG SizeClassIndex(ULONG chunk_size);
+
+	// take a block from the underlying allocator and account for it
+	void *AllocateAccountedBlock(ULONG size);
+
+	// carve a chunk of the given size class, refilling the slab if needed
+	void *CarveChunk(SSizeClass *size_class);
+
+	// allocate a chunk too big for any size class
+	void *AllocateLarge(ULONG chunk_size);
+
+	// return an oversized chunk to the underlying allocator
+	void FreeLarge(SLargeHeader *large_header);
+
+protected:
+	// allocate a block from the underlying allocator
+	virtual void *AllocateBlock(ULONG size);
+
+	// return a block to the underlying allocator
+	virtual void FreeBlock(void *block);
+
+public:
+	// ctor
+	CMemoryPoolArena();
+
+	// dtor
+	virtual ~CMemoryPoolArena();
+
+	// allocate memory
+	virtual void *NewImpl(const ULONG bytes, const CHAR *file, const ULONG line,
+						  CMemoryPool::EAllocationType eat);
+
+	// free memory
+	static void DeleteImpl(void *ptr, CMemoryPool::EAllocationType eat);
+
+	// release all memory of the pool at once; every chunk handed out so far
+	// becomes invalid
+	void Reset();
+
+	// prepare the memory pool to be deleted
+	virtual void TearDown();
+
+	// return total allocated size include management overhead
+	virtual ULLONG
+	TotalAllocatedSize() const
+	{
+		return m_allocated_size;
+	}
+
+	// return the highest total allocated size of the pool's lifetime
+	virtual ULLONG
+	PeakAllocatedSize() const
+	{
+		return m_peak_allocated_size;
+	}
+
+	// get user requested size of allocation
+	static ULONG UserSizeOfAlloc(const void *ptr);
+
+	// allocation statistics of the pool
+	const CMemoryPoolStatistics &
+	GetStatistics() const
+	{
+		return m_memory_pool_statistics;
+	}
+
+	// number of slabs held by the pool
+	ULONG
+	NumSlabs() const
+	{
+		return m_num_slabs;
+	}
+};
+}  // namespace gpos
+
+#endif	// !GPOS_CMemoryPoolArena_H
+
+// EOF
@@ -109,6 +109,13 @@ public:
 		return m_memory_pool_statistics.TotalAllocatedSize();
 	}
 
+	// return the highest total allocated size of the pool's lifetime
+	virtual ULLONG
+	PeakAllocatedSize() const
+	{
+		return m_memory_pool_statistics.PeakAllocatedSize();
+	}
+
 #ifdef GPOS_DEBUG
 
 	// check if the memory pool keeps track of live objects
@@ -50,6 +50,10 @@ private:
 		//key equality function
 		static BOOL FMyEqual(ULONG *const &pvKey, ULONG *const &pvKeySecond);
 
+		// matches objects with an even key
+		static BOOL FMyEvenKey(ULONG *const &pvKey, SSimpleObject *pso,
+							   void *pvArg);
+
 		// equality for object-based comparison
 		BOOL
 		operator==(const SSimpleObject &obj) const
@@ -157,6 +161,7 @@ public:
 	static GPOS_RESULT EresUnittest_DeepObject();
 	static GPOS_RESULT EresUnittest_Iteration();
 	static GPOS_RESULT EresUnittest_IterativeDeletion();
+	static GPOS_RESULT EresUnittest_EvictMatching();
 
 
 };	// class CCacheTest
@@ -0,0 +1,47 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMemoryPoolArenaTest.h
+//
+//	@doc:
+//		Test for CMemoryPoolArena
+//---------------------------------------------------------------------------
+#ifndef GPOS_CMemoryPoolArenaTest_H
+#define GPOS_CMemoryPoolArenaTest_H
+
+#include "gpos/memory/CMemoryPoolArena.h"
+
+namespace gpos
+{
+//---------------------------------------------------------------------------
+//	@class:
+//		CMemoryPoolArenaTest
+//
+//	@doc:
+//		Unittests for the arena memory pool
+//
+//---------------------------------------------------------------------------
+class CMemoryPoolArenaTest
+{
+private:
+	// allocate from the pool directly; the global pool manager does not
+	// know the pool, so GPOS_NEW and GPOS_DELETE cannot be used
+	static void *Allocate(CMemoryPoolArena *mp, ULONG bytes,
+						  CMemoryPool::EAllocationType eat);
+
+public:
+	// unittests
+	static GPOS_RESULT EresUnittest();
+	static GPOS_RESULT EresUnittest_Allocate();
+	static GPOS_RESULT EresUnittest_Alignment();
+	static GPOS_RESULT EresUnittest_Reset();
+	static GPOS_RESULT EresUnittest_LargeAllocation();
+
+};	// class CMemoryPoolArenaTest
+}  // namespace gpos
+
+#endif	// !GPOS_CMemoryPoolArenaTest_H
+
+// EOF
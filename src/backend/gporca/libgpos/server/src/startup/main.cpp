@@ -49,6 +49,7 @@
 #include "unittest/gpos/io/COstreamFileTest.h"
 #include "unittest/gpos/io/COstreamStringTest.h"
 #include "unittest/gpos/memory/CCacheTest.h"
+#include "unittest/gpos/memory/CMemoryPoolArenaTest.h"
 #include "unittest/gpos/memory/CMemoryPoolBasicTest.h"
 #include "unittest/gpos/string/CStringTest.h"
 #include "unittest/gpos/string/CWStringTest.h"
@@ -98,6 +99,7 @@ static gpos::CUnittest rgut[] = {
 	// memory
 	GPOS_UNITTEST_STD(CMemoryPoolBasicTest),
 	GPOS_UNITTEST_STD(CCacheTest),
+	GPOS_UNITTEST_STD(CMemoryPoolArenaTest),
 
 	// string
 	GPOS_UNITTEST_STD(CWStringTest),
@@ -13,6 +13,7 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CBitSet.h"
+#include "gpos/common/CBitSetIter.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/memory/CAutoMemoryPool.h"
 #include "gpos/string/CWStringDynamic.h"
@@ -35,6 +36,7 @@ CBitSetTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Basics),
 		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Removal),
 		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_SetOps),
+		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Growth),
 		GPOS_UNITTEST_FUNC(CBitSetTest::EresUnittest_Performance)};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
@@ -221,6 +223,84 @@ CBitSetTest::EresUnittest_SetOps()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CBitSetTest::EresUnittest_Growth
+//
+//	@doc:
+//		Test for sets growing beyond their inline words, and for set
+//		operations on sets of different lengths
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CBitSetTest::EresUnittest_Growth()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	ULONG rgulBits[] = {0, 63, 64, 255, 256, 1000, 4095, 4096};
+	const ULONG ulBits = GPOS_ARRAY_SIZE(rgulBits);
+
+	CBitSet *pbs = GPOS_NEW(mp) CBitSet(mp);
+	for (ULONG ul = 0; ul < ulBits; ul++)
+	{
+		GPOS_RTL_ASSERT(!pbs->ExchangeSet(rgulBits[ul]));
+		GPOS_RTL_ASSERT(pbs->ExchangeSet(rgulBits[ul]));
+		GPOS_RTL_ASSERT(ul + 1 == pbs->Size());
+	}
+
+	// iteration returns the bits in ascending order
+	CBitSetIter bsiter(*pbs);
+	for (ULONG ul = 0; ul < ulBits; ul++)
+	{
+		GPOS_RTL_ASSERT(bsiter.Advance());
+		GPOS_RTL_ASSERT(rgulBits[ul] == bsiter.Bit());
+	}
+	GPOS_RTL_ASSERT(!bsiter.Advance());
+
+	CBitSet *pbsCopy = GPOS_NEW(mp) CBitSet(mp, *pbs);
+	GPOS_RTL_ASSERT(pbsCopy->Equals(pbs));
+	GPOS_RTL_ASSERT(pbsCopy->HashValue() == pbs->HashValue());
+
+	// a short set against a long one
+	CBitSet *pbsShort = GPOS_NEW(mp) CBitSet(mp);
+	(void) pbsShort->ExchangeSet(63);
+	(void) pbsShort->ExchangeSet(100);
+
+	GPOS_RTL_ASSERT(!pbs->ContainsAll(pbsShort));
+	GPOS_RTL_ASSERT(!pbsShort->ContainsAll(pbs));
+	GPOS_RTL_ASSERT(!pbs->IsDisjoint(pbsShort));
+
+	pbsShort->Intersection(pbs);
+	GPOS_RTL_ASSERT(1 == pbsShort->Size() && pbsShort->Get(63));
+	GPOS_RTL_ASSERT(pbs->ContainsAll(pbsShort));
+
+	pbsCopy->Intersection(pbsShort);
+	GPOS_RTL_ASSERT(pbsCopy->Equals(pbsShort));
+	GPOS_RTL_ASSERT(pbsCopy->HashValue() == pbsShort->HashValue());
+
+	pbs->Difference(pbsShort);
+	GPOS_RTL_ASSERT(ulBits - 1 == pbs->Size());
+	GPOS_RTL_ASSERT(pbs->IsDisjoint(pbsShort));
+
+	// clearing the high bits shrinks the set back to its inline words
+	for (ULONG ul = 0; ul < ulBits; ul++)
+	{
+		(void) pbs->ExchangeClear(rgulBits[ul]);
+	}
+	(void) pbs->ExchangeSet(63);
+	GPOS_RTL_ASSERT(pbs->Equals(pbsShort));
+	GPOS_RTL_ASSERT(pbs->HashValue() == pbsShort->HashValue());
+
+	pbs->Release();
+	pbsCopy->Release();
+	pbsShort->Release();
+
+	return GPOS_OK;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CBitSetTest::EresUnittest_Performance
@@ -47,7 +47,8 @@ CCacheTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_Eviction),
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_Iteration),
 		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_DeepObject),
-		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_IterativeDeletion)};
+		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_IterativeDeletion),
+		GPOS_UNITTEST_FUNC(CCacheTest::EresUnittest_EvictMatching)};
 
 	fUnique = true;
 	GPOS_RESULT eres = CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
@@ -93,6 +94,26 @@ CCacheTest::SSimpleObject::FMyEqual(ULONG *const &pvKey,
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCacheTest::SSimpleObject::FMyEvenKey
+//
+//	@doc:
+//		Eviction predicate selecting objects with an even key
+//
+//---------------------------------------------------------------------------
+BOOL
+CCacheTest::SSimpleObject::FMyEvenKey(ULONG *const &pvKey,
+									  SSimpleObject *pso,
+									  void *	// pvArg
+)
+{
+	GPOS_ASSERT(*pvKey == pso->m_ulKey);
+
+	return 0 == *pvKey % 2;
+}
+
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCacheTest::CDeepObject::UlMyHash
@@ -998,4 +1019,76 @@ CCacheTest::EresUnittest_IterativeDeletion()
 	return GPOS_OK;
 }
 
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCacheTest::EresUnittest_EvictMatching
+//
+//	@doc:
+//		Evict entries selected by a predicate, including one that is
+//		still referenced by an accessor
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CCacheTest::EresUnittest_EvictMatching()
+{
+	CAutoP<CCache<SSimpleObject *, ULONG *> > apcache;
+	apcache = CCacheFactory::CreateCache<SSimpleObject *, ULONG *>(
+		fUnique, UNLIMITED_CACHE_QUOTA, SSimpleObject::UlMyHash,
+		SSimpleObject::FMyEqual);
+
+	CCache<SSimpleObject *, ULONG *> *pcache = apcache.Value();
+
+	CCacheTest::EresInsertDuplicates(pcache);
+
+	ULONG ulDuplicates = 1;
+	if (!pcache->AllowsDuplicateKeys())
+	{
+		ulDuplicates = GPOS_CACHE_DUPLICATES;
+	}
+
+	ULONG ulEvicted = 0;
+	{
+		// keep one of the matching entries pinned during eviction
+		ULONG ulPinned = 0;
+		CSimpleObjectCacheAccessor caPinned(pcache);
+		caPinned.Lookup(&ulPinned);
+		SSimpleObject *psoPinned = caPinned.Val();
+		GPOS_ASSERT(NULL != psoPinned);
+
+		// release object since there is no customer to release it after lookup and before CCache's cleanup
+		psoPinned->Release();
+
+		ulEvicted = pcache->EvictMatchingEntries(SSimpleObject::FMyEvenKey,
+												 NULL /*pvArg*/);
+	}
+
+	if (ulEvicted != ulDuplicates * ((GPOS_CACHE_ELEMENTS + 1) / 2))
+	{
+		return GPOS_FAILED;
+	}
+
+	for (ULONG i = 0; i < GPOS_CACHE_ELEMENTS; i++)
+	{
+		GPOS_CHECK_ABORT;
+
+		CSimpleObjectCacheAccessor ca(pcache);
+		ca.Lookup(&i);
+		SSimpleObject *pso = ca.Val();
+
+		if ((NULL == pso) != (0 == i % 2))
+		{
+			return GPOS_FAILED;
+		}
+
+		if (NULL != pso)
+		{
+			// release object since there is no customer to release it after lookup and before CCache's cleanup
+			pso->Release();
+		}
+	}
+
+	return GPOS_OK;
+}
+
 // EOF
@@ -0,0 +1,253 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMemoryPoolArenaTest.cpp
+//
+//	@doc:
+//		Tests for CMemoryPoolArena
+//---------------------------------------------------------------------------
+
+#include "unittest/gpos/memory/CMemoryPoolArenaTest.h"
+
+#include "gpos/assert.h"
+#include "gpos/common/clibwrapper.h"
+#include "gpos/test/CUnittest.h"
+
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolArenaTest::EresUnittest
+//
+//	@doc:
+//		Unittest for the arena memory pool
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolArenaTest::EresUnittest()
+{
+	CUnittest rgut[] = {
+		GPOS_UNITTEST_FUNC(CMemoryPoolArenaTest::EresUnittest_Allocate),
+		GPOS_UNITTEST_FUNC(CMemoryPoolArenaTest::EresUnittest_Alignment),
+		GPOS_UNITTEST_FUNC(CMemoryPoolArenaTest::EresUnittest_Reset),
+		GPOS_UNITTEST_FUNC(CMemoryPoolArenaTest::EresUnittest_LargeAllocation),
+	};
+
+	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolArenaTest::Allocate
+//
+//	@doc:
+//		Allocate from the given pool
+//
+//---------------------------------------------------------------------------
+void *
+CMemoryPoolArenaTest::Allocate(CMemoryPoolArena *mp, ULONG bytes,
+							   CMemoryPool::EAllocationType eat)
+{
+	return mp->NewImpl(bytes, __FILE__, __LINE__, eat);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolArenaTest::EresUnittest_Allocate
+//
+//	@doc:
+//		Small allocations share a slab, keep their contents and are reused
+//		once freed
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolArenaTest::EresUnittest_Allocate()
+{
+	const ULONG num_allocs = 64;
+	CMemoryPoolArena mp;
+	BYTE *rgptr[num_allocs];
+
+	for (ULONG ul = 0; ul < num_allocs; ul++)
+	{
+		rgptr[ul] = static_cast<BYTE *>(
+			Allocate(&mp, 1 + ul * 13, CMemoryPool::EatSingleton));
+		clib::Memset(rgptr[ul], (INT) ul, 1 + ul * 13);
+	}
+
+	GPOS_RTL_ASSERT(num_allocs == mp.GetStatistics().GetNumLiveObj());
+	GPOS_RTL_ASSERT(1 == mp.NumSlabs());
+	GPOS_RTL_ASSERT(GPOS_MEM_ARENA_SLAB_SIZE == mp.TotalAllocatedSize());
+
+	// no allocation overwrote another one
+	for (ULONG ul = 0; ul < num_allocs; ul++)
+	{
+		GPOS_RTL_ASSERT((BYTE) ul == rgptr[ul][0]);
+		GPOS_RTL_ASSERT((BYTE) ul == rgptr[ul][ul * 13]);
+	}
+
+	// a freed chunk serves the next allocation of its size class
+	BYTE *freed = rgptr[10];
+	CMemoryPoolArena::DeleteImpl(freed, CMemoryPool::EatSingleton);
+	rgptr[10] = static_cast<BYTE *>(
+		Allocate(&mp, 1 + 10 * 13, CMemoryPool::EatSingleton));
+	GPOS_RTL_ASSERT(freed == rgptr[10]);
+
+	for (ULONG ul = 0; ul < num_allocs; ul++)
+	{
+		CMemoryPoolArena::DeleteImpl(rgptr[ul], CMemoryPool::EatSingleton);
+	}
+
+	// the slab is kept until the pool is reset
+	GPOS_RTL_ASSERT(0 == mp.GetStatistics().GetNumLiveObj());
+	GPOS_RTL_ASSERT(num_allocs + 1 == mp.GetStatistics().GetNumFree());
+	GPOS_RTL_ASSERT(1 == mp.NumSlabs());
+
+	mp.TearDown();
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolArenaTest::EresUnittest_Alignment
+//
+//	@doc:
+//		Allocations of any size are aligned, with and without an array
+//		header
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolArenaTest::EresUnittest_Alignment()
+{
+	CMemoryPoolArena mp;
+
+	for (ULONG bytes = 1; bytes <= GPOS_MEM_ARENA_MAX_CLASS_SIZE + 64;
+		 bytes += 7)
+	{
+		void *singleton = Allocate(&mp, bytes, CMemoryPool::EatSingleton);
+		void *array = Allocate(&mp, bytes, CMemoryPool::EatArray);
+
+		GPOS_RTL_ASSERT(0 == (ULONG_PTR) singleton % GPOS_MEM_ARCH);
+		GPOS_RTL_ASSERT(0 == (ULONG_PTR) array % GPOS_MEM_ARCH);
+		GPOS_RTL_ASSERT(bytes == CMemoryPoolArena::UserSizeOfAlloc(array));
+
+		CMemoryPoolArena::DeleteImpl(singleton, CMemoryPool::EatSingleton);
+		CMemoryPoolArena::DeleteImpl(array, CMemoryPool::EatArray);
+	}
+
+	GPOS_RTL_ASSERT(0 == mp.GetStatistics().GetNumLiveObj());
+
+	mp.TearDown();
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolArenaTest::EresUnittest_Reset
+//
+//	@doc:
+//		Reset releases all slabs and oversized chunks, and the pool can be
+//		used again afterwards
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolArenaTest::EresUnittest_Reset()
+{
+	CMemoryPoolArena mp;
+
+	// enough chunks of the biggest size class to fill several slabs
+	for (ULONG ul = 0; ul < 64; ul++)
+	{
+		(void) Allocate(&mp, GPOS_MEM_ARENA_MAX_CLASS_SIZE / 2,
+						CMemoryPool::EatSingleton);
+	}
+	for (ULONG ul = 0; ul < 4; ul++)
+	{
+		(void) Allocate(&mp, 3 * GPOS_MEM_ARENA_MAX_CLASS_SIZE,
+						CMemoryPool::EatSingleton);
+	}
+
+	GPOS_RTL_ASSERT(1 < mp.NumSlabs());
+	GPOS_RTL_ASSERT(68 == mp.GetStatistics().GetNumLiveObj());
+
+	const ULLONG peak_size = mp.PeakAllocatedSize();
+	GPOS_RTL_ASSERT(peak_size == mp.TotalAllocatedSize());
+
+	mp.Reset();
+
+	GPOS_RTL_ASSERT(0 == mp.NumSlabs());
+	GPOS_RTL_ASSERT(0 == mp.TotalAllocatedSize());
+	GPOS_RTL_ASSERT(0 == mp.GetStatistics().GetNumLiveObj());
+	GPOS_RTL_ASSERT(0 == mp.GetStatistics().LiveObjTotalSize());
+	GPOS_RTL_ASSERT(peak_size == mp.PeakAllocatedSize());
+
+	// the pool starts over with a new slab
+	BYTE *ptr =
+		static_cast<BYTE *>(Allocate(&mp, 100, CMemoryPool::EatSingleton));
+	clib::Memset(ptr, 0, 100);
+
+	GPOS_RTL_ASSERT(1 == mp.NumSlabs());
+	GPOS_RTL_ASSERT(1 == mp.GetStatistics().GetNumLiveObj());
+
+	// tearing down releases the live chunk as well
+	mp.TearDown();
+
+	GPOS_RTL_ASSERT(0 == mp.TotalAllocatedSize());
+
+	return GPOS_OK;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMemoryPoolArenaTest::EresUnittest_LargeAllocation
+//
+//	@doc:
+//		Allocations bigger than the biggest size class bypass the slabs and
+//		go back to the underlying allocator when freed
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CMemoryPoolArenaTest::EresUnittest_LargeAllocation()
+{
+	const ULONG bytes = 4 * GPOS_MEM_ARENA_SLAB_SIZE;
+	CMemoryPoolArena mp;
+
+	BYTE *array =
+		static_cast<BYTE *>(Allocate(&mp, bytes, CMemoryPool::EatArray));
+	clib::Memset(array, 0xAB, bytes);
+	void *singleton = Allocate(&mp, GPOS_MEM_ARENA_MAX_CLASS_SIZE + 1,
+							   CMemoryPool::EatSingleton);
+
+	GPOS_RTL_ASSERT(0 == mp.NumSlabs());
+	GPOS_RTL_ASSERT(bytes + GPOS_MEM_ARENA_MAX_CLASS_SIZE <
+					mp.TotalAllocatedSize());
+	GPOS_RTL_ASSERT(bytes == CMemoryPoolArena::UserSizeOfAlloc(array));
+	GPOS_RTL_ASSERT(0xAB == array[bytes - 1]);
+
+	CMemoryPoolArena::DeleteImpl(array, CMemoryPool::EatArray);
+	CMemoryPoolArena::DeleteImpl(singleton, CMemoryPool::EatSingleton);
+
+	GPOS_RTL_ASSERT(0 == mp.TotalAllocatedSize());
+	GPOS_RTL_ASSERT(0 == mp.GetStatistics().GetNumLiveObj());
+	GPOS_RTL_ASSERT(0 == mp.GetStatistics().LiveObjTotalSize());
+
+	// an allocation that still fits the biggest size class uses a slab
+	void *small = Allocate(&mp, GPOS_MEM_ARENA_MAX_CLASS_SIZE - 64,
+						   CMemoryPool::EatSingleton);
+	GPOS_RTL_ASSERT(1 == mp.NumSlabs());
+	CMemoryPoolArena::DeleteImpl(small, CMemoryPool::EatSingleton);
+
+	mp.TearDown();
+
+	return GPOS_OK;
+}
+
+// EOF
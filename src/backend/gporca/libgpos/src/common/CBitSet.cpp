@@ -8,14 +8,14 @@
 //	@doc:
 //		Implementation of bit sets
 //
-//		Underlying assumption: a set contains only a few links of bitvectors
-//		hence, keeping them in a linked list is efficient;
+//		Underlying assumption: most sets contain only small elements, e.g.
+//		column ids of a query, hence the first words are stored inline and
+//		all operations work word-wise on one contiguous array
 //---------------------------------------------------------------------------
 
 #include "gpos/common/CBitSet.h"
 
 #include "gpos/base.h"
-#include "gpos/common/CAutoRef.h"
 #include "gpos/common/CBitSetIter.h"
 
 #ifdef GPOS_DEBUG
@@ -28,158 +28,112 @@ FORCE_GENERATE_DBGSTR(CBitSet);
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CBitSetLink
+//		CBitSet::EnsureCapacity
 //
 //	@doc:
-//		ctor
-//
-//---------------------------------------------------------------------------
-CBitSet::CBitSetLink::CBitSetLink(CMemoryPool *mp, ULONG offset,
-								  ULONG vector_size)
-	: m_offset(offset)
-{
-	m_vec = GPOS_NEW(mp) CBitVector(mp, vector_size);
-}
-
-
-//---------------------------------------------------------------------------
-//	@function:
-//		CBitSetLink
-//
-//	@doc:
-//		copy ctor
-//
-//---------------------------------------------------------------------------
-CBitSet::CBitSetLink::CBitSetLink(CMemoryPool *mp, const CBitSetLink &bsl)
-	: m_offset(bsl.m_offset)
-{
-	m_vec = GPOS_NEW(mp) CBitVector(mp, *bsl.GetVec());
-}
-
-
-//---------------------------------------------------------------------------
-//	@function:
-//		~CBitSetLink
+//		Make room for the given number of words; the array grows at least
+//		by a factor of two, new words are zero
 //
-//	@doc:
-//		ctor
-//
-//---------------------------------------------------------------------------
-CBitSet::CBitSetLink::~CBitSetLink()
-{
-	GPOS_DELETE(m_vec);
-}
-
-
 //---------------------------------------------------------------------------
-//	@function:
-//		CBitSet::FindLinkByOffset
-//
-//	@doc:
-//		Find bit set link for a given offset; if non-existent return previous
-//		link (may be NULL);
-//		By providing a starting link we can implement a number of operations
-//		in one sweep, ie O(N)
-//
-//---------------------------------------------------------------------------
-CBitSet::CBitSetLink *
-CBitSet::FindLinkByOffset(ULONG offset, CBitSetLink *bsl) const
+void
+CBitSet::EnsureCapacity(ULONG num_words)
 {
-	CBitSetLink *found = NULL;
-	CBitSetLink *cursor = bsl;
+	if (num_words <= m_capacity)
+	{
+		return;
+	}
 
-	if (NULL == bsl)
+	ULONG capacity = std::max(num_words, 2 * m_capacity);
+	ULLONG *words = GPOS_NEW_ARRAY(m_mp, ULLONG, capacity);
+	for (ULONG ul = 0; ul < m_len; ul++)
 	{
-		// if no cursor provided start with first element
-		cursor = m_bsllist.First();
+		words[ul] = m_words[ul];
 	}
-	else
+	for (ULONG ul = m_len; ul < capacity; ul++)
 	{
-		GPOS_ASSERT(bsl->GetOffset() <= offset && "invalid start cursor");
-		found = bsl;
+		words[ul] = 0;
 	}
 
-	GPOS_ASSERT_IMP(NULL != cursor,
-					GPOS_OK == m_bsllist.Find(cursor) && "cursor not in list");
-
-	while (1)
+	if (m_words != m_inline_words)
 	{
-		// no more links or we've overshot the target
-		if (NULL == cursor || cursor->GetOffset() > offset)
-		{
-			break;
-		}
-
-		found = cursor;
-		cursor = m_bsllist.Next(cursor);
+		GPOS_DELETE_ARRAY(m_words);
 	}
 
-	GPOS_ASSERT_IMP(found, found->GetOffset() <= offset);
-	return found;
+	m_words = words;
+	m_capacity = capacity;
 }
 
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CBitSet::RecomputeSize
+//		CBitSet::Trim
 //
 //	@doc:
-//		Compute size of set by adding up sizes of links
+//		Drop trailing zero words
 //
 //---------------------------------------------------------------------------
 void
-CBitSet::RecomputeSize()
+CBitSet::Trim()
 {
-	m_size = 0;
-	CBitSetLink *bsl = NULL;
-
-	for (bsl = m_bsllist.First(); bsl != NULL; bsl = m_bsllist.Next(bsl))
+	while (0 < m_len && 0 == m_words[m_len - 1])
 	{
-		m_size += bsl->GetVec()->CountSetBits();
+		m_len--;
 	}
 }
 
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CBitSet::Clear
+//		CBitSet::RecomputeSize
 //
 //	@doc:
-//		release all links
+//		Compute size of set by adding up the bits set in all words
 //
 //---------------------------------------------------------------------------
 void
-CBitSet::Clear()
+CBitSet::RecomputeSize()
 {
-	CBitSetLink *bsl = NULL;
-
-	while (NULL != (bsl = m_bsllist.First()))
+	m_size = 0;
+	for (ULONG ul = 0; ul < m_len; ul++)
 	{
-		CBitSetLink *bsl_to_remove = bsl;
-		bsl = m_bsllist.Next(bsl);
-
-		m_bsllist.Remove(bsl_to_remove);
-		GPOS_DELETE(bsl_to_remove);
+		m_size += CountSetBits(m_words[ul]);
 	}
-
-	RecomputeSize();
 }
 
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CBitSet::GetOffset
+//		CBitSet::GetBits
 //
 //	@doc:
-//		Compute offset
+//		Word containing the given number of bits, at most a word, starting
+//		at the given bit
 //
 //---------------------------------------------------------------------------
-ULONG
-CBitSet::ComputeOffset(ULONG ul) const
+ULLONG
+CBitSet::GetBits(ULONG pos, ULONG num_bits) const
 {
-	return (ul / m_vector_size) * m_vector_size;
-}
+	GPOS_ASSERT(0 < num_bits && num_bits <= BitsPerWord);
 
+	ULONG idx = pos / BitsPerWord;
+	ULONG shift = pos % BitsPerWord;
+
+	ULLONG word = 0;
+	if (idx < m_len)
+	{
+		word = m_words[idx] >> shift;
+	}
+	if (0 != shift && idx + 1 < m_len)
+	{
+		word |= m_words[idx + 1] << (BitsPerWord - shift);
+	}
+	if (num_bits < BitsPerWord)
+	{
+		word &= (((ULLONG) 1) << num_bits) - 1;
+	}
+
+	return word;
+}
 
 
 //---------------------------------------------------------------------------
@@ -191,9 +145,17 @@ CBitSet::ComputeOffset(ULONG ul) const
 //
 //---------------------------------------------------------------------------
 CBitSet::CBitSet(CMemoryPool *mp, ULONG vector_size)
-	: m_mp(mp), m_vector_size(vector_size), m_size(0)
+	: m_mp(mp),
+	  m_vector_size(vector_size),
+	  m_words(m_inline_words),
+	  m_capacity(InlineWords),
+	  m_len(0),
+	  m_size(0)
 {
-	m_bsllist.Init(GPOS_OFFSET(CBitSetLink, m_link));
+	for (ULONG ul = 0; ul < InlineWords; ul++)
+	{
+		m_inline_words[ul] = 0;
+	}
 }
 
 
@@ -206,9 +168,18 @@ CBitSet::CBitSet(CMemoryPool *mp, ULONG vector_size)
 //
 //---------------------------------------------------------------------------
 CBitSet::CBitSet(CMemoryPool *mp, const CBitSet &bs)
-	: m_mp(mp), m_vector_size(bs.m_vector_size), m_size(0)
+	: m_mp(mp),
+	  m_vector_size(bs.m_vector_size),
+	  m_words(m_inline_words),
+	  m_capacity(InlineWords),
+	  m_len(0),
+	  m_size(0)
 {
-	m_bsllist.Init(GPOS_OFFSET(CBitSetLink, m_link));
+	for (ULONG ul = 0; ul < InlineWords; ul++)
+	{
+		m_inline_words[ul] = 0;
+	}
+
 	Union(&bs);
 }
 
@@ -223,7 +194,10 @@ CBitSet::CBitSet(CMemoryPool *mp, const CBitSet &bs)
 //---------------------------------------------------------------------------
 CBitSet::~CBitSet()
 {
-	Clear();
+	if (m_words != m_inline_words)
+	{
+		GPOS_DELETE_ARRAY(m_words);
+	}
 }
 
 
@@ -238,15 +212,13 @@ CBitSet::~CBitSet()
 BOOL
 CBitSet::Get(ULONG pos) const
 {
-	ULONG offset = ComputeOffset(pos);
-
-	CBitSetLink *bsl = FindLinkByOffset(offset);
-	if (NULL != bsl && bsl->GetOffset() == offset)
+	ULONG idx = pos / BitsPerWord;
+	if (idx >= m_len)
 	{
-		return bsl->GetVec()->Get(pos - offset);
+		return false;
 	}
 
-	return false;
+	return 0 != (m_words[idx] & (((ULLONG) 1) << (pos % BitsPerWord)));
 }
 
 
@@ -255,37 +227,22 @@ CBitSet::Get(ULONG pos) const
 //		CBitSet::ExchangeSet
 //
 //	@doc:
-//		Set given bit; return previous value; allocate new link if necessary
+//		Set given bit; return previous value; grow array if necessary
 //
 //---------------------------------------------------------------------------
 BOOL
 CBitSet::ExchangeSet(ULONG pos)
 {
-	ULONG offset = ComputeOffset(pos);
+	ULONG idx = pos / BitsPerWord;
+	ULLONG mask = ((ULLONG) 1) << (pos % BitsPerWord);
 
-	CBitSetLink *bsl = FindLinkByOffset(offset);
-	if (NULL == bsl || bsl->GetOffset() != offset)
-	{
-		CBitSetLink *pbsl_new =
-			GPOS_NEW(m_mp) CBitSetLink(m_mp, offset, m_vector_size);
-		if (NULL == bsl)
-		{
-			m_bsllist.Prepend(pbsl_new);
-		}
-		else
-		{
-			// insert after found link
-			m_bsllist.Append(pbsl_new, bsl);
-		}
-
-		bsl = pbsl_new;
-	}
+	EnsureCapacity(idx + 1);
+	m_len = std::max(m_len, idx + 1);
 
-	GPOS_ASSERT(bsl->GetOffset() == offset);
-
-	BOOL bit = bsl->GetVec()->ExchangeSet(pos - offset);
+	BOOL bit = (0 != (m_words[idx] & mask));
 	if (!bit)
 	{
+		m_words[idx] |= mask;
 		m_size++;
 	}
 
@@ -304,29 +261,19 @@ CBitSet::ExchangeSet(ULONG pos)
 BOOL
 CBitSet::ExchangeClear(ULONG pos)
 {
-	ULONG offset = ComputeOffset(pos);
+	ULONG idx = pos / BitsPerWord;
+	ULLONG mask = ((ULLONG) 1) << (pos % BitsPerWord);
 
-	CBitSetLink *bsl = FindLinkByOffset(offset);
-	if (NULL != bsl && bsl->GetOffset() == offset)
+	if (idx >= m_len || 0 == (m_words[idx] & mask))
 	{
-		BOOL bit = bsl->GetVec()->ExchangeClear(pos - offset);
-
-		// remove empty link
-		if (bsl->GetVec()->IsEmpty())
-		{
-			m_bsllist.Remove(bsl);
-			GPOS_DELETE(bsl);
-		}
-
-		if (bit)
-		{
-			m_size--;
-		}
-
-		return bit;
+		return false;
 	}
 
-	return false;
+	m_words[idx] &= ~mask;
+	m_size--;
+	Trim();
+
+	return true;
 }
 
 
@@ -335,76 +282,22 @@ CBitSet::ExchangeClear(ULONG pos)
 //		CBitSet::Union
 //
 //	@doc:
-//		Union with given other set;
-//		(1) determine which links need to be allocated before(!) modifying
-//			the set allocate and copy missing links aside
-//		(2) insert the new links into the list
-//		(3) union all links, old and new, on a per-bitvector basis
-//
-//		For clarity step (2) and (3) are separated;
+//		Union with given other set
 //
 //---------------------------------------------------------------------------
 void
 CBitSet::Union(const CBitSet *pbsOther)
 {
-	CBitSetLink *bsl = NULL;
-	CBitSetLink *bsl_other = NULL;
+	const ULONG len_other = pbsOther->m_len;
+	EnsureCapacity(len_other);
 
-	// dynamic array of CBitSetLink
-	typedef CDynamicPtrArray<CBitSetLink, CleanupNULL> CBitSetLinkArray;
-
-	CAutoRef<CBitSetLinkArray> a_drgpbsl;
-	a_drgpbsl = GPOS_NEW(m_mp) CBitSetLinkArray(m_mp);
-
-	// iterate through other's links and copy missing links to array
-	for (bsl_other = pbsOther->m_bsllist.First(); bsl_other != NULL;
-		 bsl_other = pbsOther->m_bsllist.Next(bsl_other))
+	const ULLONG *words_other = pbsOther->m_words;
+	for (ULONG ul = 0; ul < len_other; ul++)
 	{
-		bsl = FindLinkByOffset(bsl_other->GetOffset(), bsl);
-		if (NULL == bsl || bsl->GetOffset() != bsl_other->GetOffset())
-		{
-			// need to copy this link
-			CAutoP<CBitSetLink> a_pbsl;
-			a_pbsl = GPOS_NEW(m_mp) CBitSetLink(m_mp, *bsl_other);
-			a_drgpbsl->Append(a_pbsl.Value());
-
-			a_pbsl.Reset();
-		}
-	}
-
-	// insert all new links
-	bsl = NULL;
-	for (ULONG i = 0; i < a_drgpbsl->Size(); i++)
-	{
-		CBitSetLink *pbslInsert = (*a_drgpbsl)[i];
-		bsl = FindLinkByOffset(pbslInsert->GetOffset(), bsl);
-
-		GPOS_ASSERT_IMP(NULL != bsl,
-						bsl->GetOffset() < pbslInsert->GetOffset());
-		if (NULL == bsl)
-		{
-			m_bsllist.Prepend(pbslInsert);
-		}
-		else
-		{
-			m_bsllist.Append(pbslInsert, bsl);
-		}
-	}
-
-	// iterate through all links and union them up
-	bsl_other = NULL;
-	bsl = m_bsllist.First();
-	while (NULL != bsl)
-	{
-		bsl_other = pbsOther->FindLinkByOffset(bsl->GetOffset(), bsl_other);
-		if (NULL != bsl_other && bsl_other->GetOffset() == bsl->GetOffset())
-		{
-			bsl->GetVec()->Or(bsl_other->GetVec());
-		}
-
-		bsl = m_bsllist.Next(bsl);
+		m_words[ul] |= words_other[ul];
 	}
 
+	m_len = std::max(m_len, len_other);
 	RecomputeSize();
 }
 
@@ -414,7 +307,8 @@ CBitSet::Union(const CBitSet *pbsOther)
 //		CBitSet::Intersection
 //
 //	@doc:
-//		Iterate through all links and intersect them; release unused links
+//		Intersect with given other set; words beyond the other set's are
+//		cleared
 //
 //---------------------------------------------------------------------------
 void
@@ -425,39 +319,19 @@ CBitSet::Intersection(const CBitSet *pbsOther)
 		return;
 	}
 
-	CBitSetLink *bsl_other = NULL;
-	CBitSetLink *bsl = m_bsllist.First();
-
-	while (NULL != bsl)
+	const ULONG len = std::min(m_len, pbsOther->m_len);
+	const ULLONG *words_other = pbsOther->m_words;
+	for (ULONG ul = 0; ul < len; ul++)
 	{
-		CBitSetLink *bsl_to_remove = NULL;
-
-		bsl_other = pbsOther->FindLinkByOffset(bsl->GetOffset(), bsl_other);
-		if (NULL != bsl_other && bsl_other->GetOffset() == bsl->GetOffset())
-		{
-			bsl->GetVec()->And(bsl_other->GetVec());
-			CBitSetLink *bsl_prev = bsl;
-
-			bsl = m_bsllist.Next(bsl);
-			// If vector is empty after "ANDing", remove the vector, otherwise
-			// we can get into a situation where an empty vector exists
-			// and causes wrong results for equals/contains operations later
-			if (bsl_prev->GetVec()->IsEmpty())
-			{
-				m_bsllist.Remove(bsl_prev);
-				GPOS_DELETE(bsl_prev);
-			}
-		}
-		else
-		{
-			bsl_to_remove = bsl;
-			bsl = m_bsllist.Next(bsl);
-
-			m_bsllist.Remove(bsl_to_remove);
-			GPOS_DELETE(bsl_to_remove);
-		}
+		m_words[ul] &= words_other[ul];
+	}
+	for (ULONG ul = len; ul < m_len; ul++)
+	{
+		m_words[ul] = 0;
 	}
 
+	m_len = len;
+	Trim();
 	RecomputeSize();
 }
 
@@ -467,23 +341,21 @@ CBitSet::Intersection(const CBitSet *pbsOther)
 //		CBitSet::Difference
 //
 //	@doc:
-//		Substract other set from this by iterating through other set and
-//		explicit removal of elements;
+//		Substract other set from this
 //
 //---------------------------------------------------------------------------
 void
 CBitSet::Difference(const CBitSet *pbs)
 {
-	if (IsDisjoint(pbs))
+	const ULONG len = std::min(m_len, pbs->m_len);
+	const ULLONG *words_other = pbs->m_words;
+	for (ULONG ul = 0; ul < len; ul++)
 	{
-		return;
+		m_words[ul] &= ~words_other[ul];
 	}
 
-	CBitSetIter bsiter(*pbs);
-	while (bsiter.Advance())
-	{
-		(void) ExchangeClear(bsiter.Bit());
-	}
+	Trim();
+	RecomputeSize();
 }
 
 
@@ -498,23 +370,17 @@ CBitSet::Difference(const CBitSet *pbs)
 BOOL
 CBitSet::ContainsAll(const CBitSet *bs) const
 {
-	// skip iterating if we can already tell by the sizes
-	if (Size() < bs->Size())
+	// skip iterating if we can already tell by the sizes; as the last
+	// word in use is never zero, a longer array has a larger element
+	if (Size() < bs->Size() || m_len < bs->m_len)
 	{
 		return false;
 	}
 
-	CBitSetLink *bsl = NULL;
-	CBitSetLink *bsl_other = NULL;
-
-	// iterate through other's links and check for subsets
-	for (bsl_other = bs->m_bsllist.First(); bsl_other != NULL;
-		 bsl_other = bs->m_bsllist.Next(bsl_other))
+	const ULLONG *words_other = bs->m_words;
+	for (ULONG ul = 0; ul < bs->m_len; ul++)
 	{
-		bsl = FindLinkByOffset(bsl_other->GetOffset(), bsl);
-
-		if (NULL == bsl || bsl->GetOffset() != bsl_other->GetOffset() ||
-			!bsl->GetVec()->ContainsAll(bsl_other->GetVec()))
+		if (words_other[ul] != (m_words[ul] & words_other[ul]))
 		{
 			return false;
 		}
@@ -541,29 +407,13 @@ CBitSet::Equals(const CBitSet *bs) const
 		return true;
 	}
 
-	// skip iterating if we can already tell by the sizes
-	if (Size() != bs->Size())
+	// skip comparing words if we can already tell by the sizes
+	if (Size() != bs->Size() || m_len != bs->m_len)
 	{
 		return false;
 	}
 
-	CBitSetLink *bsl = m_bsllist.First();
-	CBitSetLink *bsl_other = bs->m_bsllist.First();
-
-	while (NULL != bsl)
-	{
-		if (NULL == bsl_other || bsl->GetOffset() != bsl_other->GetOffset() ||
-			!bsl->GetVec()->Equals(bsl_other->GetVec()))
-		{
-			return false;
-		}
-
-		bsl = m_bsllist.Next(bsl);
-		bsl_other = bs->m_bsllist.Next(bsl_other);
-	}
-
-	// same length implies bsl_other must have reached end as well
-	return bsl_other == NULL;
+	return 0 == clib::Memcmp(m_words, bs->m_words, m_len * sizeof(ULLONG));
 }
 
 
@@ -579,17 +429,11 @@ CBitSet::Equals(const CBitSet *bs) const
 BOOL
 CBitSet::IsDisjoint(const CBitSet *bs) const
 {
-	CBitSetLink *bsl = NULL;
-	CBitSetLink *bsl_other = NULL;
-
-	// iterate through other's links an check if disjoint
-	for (bsl_other = bs->m_bsllist.First(); bsl_other != NULL;
-		 bsl_other = bs->m_bsllist.Next(bsl_other))
+	const ULONG len = std::min(m_len, bs->m_len);
+	const ULLONG *words_other = bs->m_words;
+	for (ULONG ul = 0; ul < len; ul++)
 	{
-		bsl = FindLinkByOffset(bsl_other->GetOffset(), bsl);
-
-		if (NULL != bsl && bsl->GetOffset() == bsl_other->GetOffset() &&
-			!bsl->GetVec()->IsDisjoint(bsl_other->GetVec()))
+		if (0 != (m_words[ul] & words_other[ul]))
 		{
 			return false;
 		}
@@ -604,19 +448,53 @@ CBitSet::IsDisjoint(const CBitSet *bs) const
 //		CBitSet::HashValue
 //
 //	@doc:
-//		Compute hash value for set
+//		Compute hash value for set. The set used to be a list of bitvectors
+//		of m_vector_size bits each, and the hash combined the hash values of
+//		the non-empty ones. The same value is computed from the words, so
+//		that hash maps keyed by sets keep their iteration order
 //
 //---------------------------------------------------------------------------
 ULONG
 CBitSet::HashValue() const
 {
 	ULONG ulHash = 0;
+	if (0 == m_size)
+	{
+		return ulHash;
+	}
 
-	CBitSetLink *bsl = m_bsllist.First();
-	while (NULL != bsl)
+	GPOS_ASSERT(0 < m_vector_size);
+
+	const ULONG words_per_vector =
+		(m_vector_size + BitsPerWord - 1) / BitsPerWord;
+	const ULONG num_bits = m_len * BitsPerWord;
+	for (ULONG offset = 0; offset < num_bits; offset += m_vector_size)
 	{
-		ulHash = gpos::CombineHashes(ulHash, bsl->GetVec()->HashValue());
-		bsl = m_bsllist.Next(bsl);
+		// gpos::HashByteArray over the bytes of the vector's words
+		ULONG vector_hash = words_per_vector * sizeof(ULLONG);
+		BOOL is_empty = true;
+		for (ULONG ul = 0; ul < words_per_vector; ul++)
+		{
+			ULONG bits_in_word = m_vector_size - ul * BitsPerWord;
+			if (BitsPerWord < bits_in_word)
+			{
+				bits_in_word = BitsPerWord;
+			}
+			ULLONG word = GetBits(offset + ul * BitsPerWord, bits_in_word);
+			is_empty = is_empty && (0 == word);
+
+			const BYTE *bytes = (const BYTE *) &word;
+			for (ULONG byte = 0; byte < sizeof(ULLONG); byte++)
+			{
+				vector_hash =
+					((vector_hash << 5) ^ (vector_hash >> 27)) ^ bytes[byte];
+			}
+		}
+
+		if (!is_empty)
+		{
+			ulHash = gpos::CombineHashes(ulHash, vector_hash);
+		}
 	}
 
 	return ulHash;
@@ -12,7 +12,6 @@
 #include "gpos/common/CBitSetIter.h"
 
 #include "gpos/base.h"
-#include "gpos/common/CAutoRef.h"
 
 using namespace gpos;
 
@@ -26,7 +25,7 @@ using namespace gpos;
 //
 //---------------------------------------------------------------------------
 CBitSetIter::CBitSetIter(const CBitSet &bs)
-	: m_bs(bs), m_cursor((ULONG) -1), m_bsl(NULL), m_active(true)
+	: m_bs(bs), m_cursor((ULONG) -1), m_active(true)
 {
 }
 
@@ -44,24 +43,28 @@ CBitSetIter::Advance()
 {
 	GPOS_ASSERT(m_active && "called advance on exhausted iterator");
 
-	if (NULL == m_bsl)
-	{
-		m_bsl = m_bs.m_bsllist.First();
-	}
+	// the cursor starts out at (ULONG) -1, so the next position wraps to 0
+	ULONG pos = m_cursor + 1;
+	ULONG idx = pos / CBitSet::BitsPerWord;
 
-	while (NULL != m_bsl)
+	m_active = false;
+	if (idx < m_bs.m_len)
 	{
-		if (m_cursor + 1 <= m_bs.m_vector_size &&
-			m_bsl->GetVec()->GetNextSetBit(m_cursor + 1, m_cursor))
+		// mask out the bits before the next position in the first word
+		ULLONG word = m_bs.m_words[idx] &
+					  (~((ULLONG) 0) << (pos % CBitSet::BitsPerWord));
+		while (0 == word && ++idx < m_bs.m_len)
 		{
-			break;
+			word = m_bs.m_words[idx];
 		}
 
-		m_bsl = m_bs.m_bsllist.Next(m_bsl);
-		m_cursor = (ULONG) -1;
+		if (0 != word)
+		{
+			m_cursor = idx * CBitSet::BitsPerWord + CBitSet::LowestSetBit(word);
+			m_active = true;
+		}
 	}
 
-	m_active = (NULL != m_bsl);
 	return m_active;
 }
 
@@ -77,10 +80,10 @@ CBitSetIter::Advance()
 ULONG
 CBitSetIter::Bit() const
 {
-	GPOS_ASSERT(m_active && NULL != m_bsl && "iterator uninitialized");
-	GPOS_ASSERT(m_bsl->GetVec()->Get(m_cursor));
+	GPOS_ASSERT(m_active && "iterator uninitialized");
+	GPOS_ASSERT(m_bs.Get(m_cursor));
 
-	return m_bsl->GetOffset() + m_cursor;
+	return m_cursor;
 }
 
 // EOF
@@ -0,0 +1,340 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMemoryPoolArena.cpp
+//
+//	@doc:
+//		Implementation of memory pool that carves small allocations out of
+//		large slabs
+//
+//---------------------------------------------------------------------------
+
+#include "gpos/memory/CMemoryPoolArena.h"
+
+#include "gpos/common/clibwrapper.h"
+#include "gpos/error/CException.h"
+
+using namespace gpos;
+
+// ctor
+CMemoryPoolArena::CMemoryPoolArena()
+	: CMemoryPool(),
+	  m_slabs(NULL),
+	  m_large_chunks(NULL),
+	  m_slab_cur(NULL),
+	  m_slab_end(NULL),
+	  m_num_slabs(0),
+	  m_allocated_size(0),
+	  m_peak_allocated_size(0)
+{
+	for (ULONG ul = 0; ul < GPOS_MEM_ARENA_NUM_CLASSES; ul++)
+	{
+		m_size_classes[ul].m_pool = this;
+		m_size_classes[ul].m_free_list = NULL;
+		if (ul < GPOS_MEM_ARENA_SMALL_LIMIT / GPOS_MEM_ARENA_CLASS_GRANULARITY)
+		{
+			m_size_classes[ul].m_size =
+				(ul + 1) * GPOS_MEM_ARENA_CLASS_GRANULARITY;
+		}
+		else
+		{
+			// power-of-two classes above the small limit
+			m_size_classes[ul].m_size =
+				GPOS_MEM_ARENA_SMALL_LIMIT
+				<< (ul + 1 -
+					GPOS_MEM_ARENA_SMALL_LIMIT /
+						GPOS_MEM_ARENA_CLASS_GRANULARITY);
+		}
+	}
+	GPOS_ASSERT(GPOS_MEM_ARENA_MAX_CLASS_SIZE ==
+				m_size_classes[GPOS_MEM_ARENA_NUM_CLASSES - 1].m_size);
+
+	m_large_class.m_pool = this;
+	m_large_class.m_size = 0;
+	m_large_class.m_free_list = NULL;
+}
+
+// dtor; the blocks are released by TearDown(), while the virtual functions
+// of a subclass can still be called
+CMemoryPoolArena::~CMemoryPoolArena()
+{
+	GPOS_ASSERT(NULL == m_slabs);
+	GPOS_ASSERT(NULL == m_large_chunks);
+}
+
+// allocate a block from the underlying allocator
+void *
+CMemoryPoolArena::AllocateBlock(ULONG size)
+{
+	return clib::Malloc(size);
+}
+
+// return a block to the underlying allocator
+void
+CMemoryPoolArena::FreeBlock(void *block)
+{
+	clib::Free(block);
+}
+
+// map a chunk size to its size class index
+ULONG
+CMemoryPoolArena::SizeClassIndex(ULONG chunk_size)
+{
+	GPOS_ASSERT(0 < chunk_size && chunk_size <= GPOS_MEM_ARENA_MAX_CLASS_SIZE);
+
+	if (chunk_size <= GPOS_MEM_ARENA_SMALL_LIMIT)
+	{
+		return (chunk_size + GPOS_MEM_ARENA_CLASS_GRANULARITY - 1) /
+				   GPOS_MEM_ARENA_CLASS_GRANULARITY -
+			   1;
+	}
+
+	ULONG index = GPOS_MEM_ARENA_SMALL_LIMIT / GPOS_MEM_ARENA_CLASS_GRANULARITY;
+	for (ULONG size = 2 * GPOS_MEM_ARENA_SMALL_LIMIT; size < chunk_size;
+		 size <<= 1)
+	{
+		index++;
+	}
+
+	return index;
+}
+
+// take a block from the underlying allocator and account for it
+void *
+CMemoryPoolArena::AllocateAccountedBlock(ULONG size)
+{
+	void *block = AllocateBlock(size);
+
+	GPOS_OOM_CHECK(block);
+
+	m_allocated_size += size;
+	if (m_allocated_size > m_peak_allocated_size)
+	{
+		m_peak_allocated_size = m_allocated_size;
+	}
+
+	return block;
+}
+
+// carve a chunk of the given size class, refilling the slab if needed
+void *
+CMemoryPoolArena::CarveChunk(SSizeClass *size_class)
+{
+	const ULONG chunk_size = size_class->m_size;
+
+	if (m_slab_cur + chunk_size > m_slab_end)
+	{
+		// the tail of the current slab is abandoned; it is less than the
+		// biggest size class and is reclaimed with the slab
+		SSlabHeader *slab = static_cast<SSlabHeader *>(
+			AllocateAccountedBlock(GPOS_MEM_ARENA_SLAB_SIZE));
+		slab->m_next = m_slabs;
+		m_slabs = slab;
+		m_num_slabs++;
+
+		m_slab_cur = reinterpret_cast<BYTE *>(slab) +
+					 GPOS_MEM_ALIGNED_STRUCT_SIZE(SSlabHeader);
+		m_slab_end = reinterpret_cast<BYTE *>(slab) + GPOS_MEM_ARENA_SLAB_SIZE;
+	}
+
+	void *chunk = m_slab_cur;
+	m_slab_cur += chunk_size;
+
+	return chunk;
+}
+
+// allocate a chunk too big for any size class
+void *
+CMemoryPoolArena::AllocateLarge(ULONG chunk_size)
+{
+	const ULONG alloc_size =
+		GPOS_MEM_ALIGNED_STRUCT_SIZE(SLargeHeader) + chunk_size;
+	SLargeHeader *large_header =
+		static_cast<SLargeHeader *>(AllocateAccountedBlock(alloc_size));
+
+	large_header->m_total_size = alloc_size;
+	large_header->m_prev = NULL;
+	large_header->m_next = m_large_chunks;
+	if (NULL != m_large_chunks)
+	{
+		m_large_chunks->m_prev = large_header;
+	}
+	m_large_chunks = large_header;
+
+	return reinterpret_cast<BYTE *>(large_header) +
+		   GPOS_MEM_ALIGNED_STRUCT_SIZE(SLargeHeader);
+}
+
+// return an oversized chunk to the underlying allocator
+void
+CMemoryPoolArena::FreeLarge(SLargeHeader *large_header)
+{
+	if (NULL != large_header->m_prev)
+	{
+		large_header->m_prev->m_next = large_header->m_next;
+	}
+	else
+	{
+		m_large_chunks = large_header->m_next;
+	}
+	if (NULL != large_header->m_next)
+	{
+		large_header->m_next->m_prev = large_header->m_prev;
+	}
+
+	m_allocated_size -= large_header->m_total_size;
+	FreeBlock(large_header);
+}
+
+void *
+CMemoryPoolArena::NewImpl(const ULONG bytes, const CHAR *, const ULONG,
+						  CMemoryPool::EAllocationType eat)
+{
+	GPOS_ASSERT(bytes <= GPOS_MEM_ALLOC_MAX);
+
+	const ULONG array_header_size =
+		(CMemoryPool::EatArray == eat)
+			? GPOS_MEM_ALIGNED_STRUCT_SIZE(SArrayAllocHeader)
+			: 0;
+	const ULONG chunk_size = GPOS_MEM_ALIGNED_STRUCT_SIZE(SChunkHeader) +
+							 array_header_size + GPOS_MEM_ALIGNED_SIZE(bytes);
+
+	SChunkHeader *header = NULL;
+	ULONG total_size = 0;
+	if (chunk_size <= GPOS_MEM_ARENA_MAX_CLASS_SIZE)
+	{
+		SSizeClass *size_class = &m_size_classes[SizeClassIndex(chunk_size)];
+		if (NULL != size_class->m_free_list)
+		{
+			// reuse a freed chunk; its header still points to the class
+			BYTE *user = static_cast<BYTE *>(size_class->m_free_list);
+			size_class->m_free_list = *reinterpret_cast<void **>(user);
+			header = reinterpret_cast<SChunkHeader *>(
+				user - GPOS_MEM_ALIGNED_STRUCT_SIZE(SChunkHeader));
+		}
+		else
+		{
+			header = static_cast<SChunkHeader *>(CarveChunk(size_class));
+		}
+		header->m_size_class = size_class;
+		total_size = size_class->m_size;
+	}
+	else
+	{
+		header = static_cast<SChunkHeader *>(AllocateLarge(chunk_size));
+		header->m_size_class = &m_large_class;
+		total_size = chunk_size;
+	}
+
+	// the requested size is not known when the chunk is freed, so both
+	// sizes are accounted as the size of the chunk
+	m_memory_pool_statistics.RecordAllocation(total_size, total_size);
+
+	BYTE *user = reinterpret_cast<BYTE *>(header) +
+				 GPOS_MEM_ALIGNED_STRUCT_SIZE(SChunkHeader);
+
+	// if it's an array allocation, record the requested size in front of it
+	if (CMemoryPool::EatArray == eat)
+	{
+		SArrayAllocHeader *array_header =
+			reinterpret_cast<SArrayAllocHeader *>(user);
+		array_header->m_user_size = bytes;
+		user += array_header_size;
+	}
+
+	return user;
+}
+
+void
+CMemoryPoolArena::DeleteImpl(void *ptr, CMemoryPool::EAllocationType eat)
+{
+	BYTE *user = static_cast<BYTE *>(ptr);
+	if (CMemoryPool::EatArray == eat)
+	{
+		user -= GPOS_MEM_ALIGNED_STRUCT_SIZE(SArrayAllocHeader);
+	}
+
+	SChunkHeader *header = reinterpret_cast<SChunkHeader *>(
+		user - GPOS_MEM_ALIGNED_STRUCT_SIZE(SChunkHeader));
+	SSizeClass *size_class = header->m_size_class;
+	CMemoryPoolArena *pool = size_class->m_pool;
+
+	if (0 == size_class->m_size)
+	{
+		SLargeHeader *large_header = reinterpret_cast<SLargeHeader *>(
+			reinterpret_cast<BYTE *>(header) -
+			GPOS_MEM_ALIGNED_STRUCT_SIZE(SLargeHeader));
+		const ULONG chunk_size = large_header->m_total_size -
+								 GPOS_MEM_ALIGNED_STRUCT_SIZE(SLargeHeader);
+		pool->m_memory_pool_statistics.RecordFree(chunk_size, chunk_size);
+		pool->FreeLarge(large_header);
+		return;
+	}
+
+	pool->m_memory_pool_statistics.RecordFree(size_class->m_size,
+											  size_class->m_size);
+
+#ifdef GPOS_DEBUG
+	// mark freed memory to catch accesses through dangling pointers
+	clib::Memset(user, GPOS_MEM_FREED_PATTERN_CHAR,
+				 size_class->m_size -
+					 GPOS_MEM_ALIGNED_STRUCT_SIZE(SChunkHeader));
+#endif	// GPOS_DEBUG
+
+	// push chunk to the free list of its size class
+	*reinterpret_cast<void **>(user) = size_class->m_free_list;
+	size_class->m_free_list = user;
+}
+
+// release all memory of the pool at once
+void
+CMemoryPoolArena::Reset()
+{
+	while (NULL != m_large_chunks)
+	{
+		SLargeHeader *next = m_large_chunks->m_next;
+		FreeBlock(m_large_chunks);
+		m_large_chunks = next;
+	}
+
+	while (NULL != m_slabs)
+	{
+		SSlabHeader *next = m_slabs->m_next;
+		FreeBlock(m_slabs);
+		m_slabs = next;
+	}
+
+	for (ULONG ul = 0; ul < GPOS_MEM_ARENA_NUM_CLASSES; ul++)
+	{
+		m_size_classes[ul].m_free_list = NULL;
+	}
+
+	m_slab_cur = NULL;
+	m_slab_end = NULL;
+	m_num_slabs = 0;
+	m_allocated_size = 0;
+	m_memory_pool_statistics.RecordReset();
+}
+
+// prepare the memory pool to be deleted
+void
+CMemoryPoolArena::TearDown()
+{
+	Reset();
+}
+
+// get user requested size of array allocation. Note: this is ONLY called for arrays
+ULONG
+CMemoryPoolArena::UserSizeOfAlloc(const void *ptr)
+{
+	GPOS_ASSERT(ptr != NULL);
+	void *void_header = static_cast<BYTE *>(const_cast<void *>(ptr)) -
+						GPOS_MEM_ALIGNED_STRUCT_SIZE(SArrayAllocHeader);
+	const SArrayAllocHeader *header =
+		static_cast<SArrayAllocHeader *>(void_header);
+	return header->m_user_size;
+}
+
+// EOF
@@ -81,10 +81,25 @@ public:
 	static CParseHandlerDXL *GetParseHandlerForDXLString(
 		CMemoryPool *, const CHAR *dxl_string, const CHAR *xsd_file_path);
 
-	// same as above but with DXL file name specified instead of the file contents
+	// same as above but with DXL file name specified instead of the file
+	// contents; the file may also hold a binary DXL document
 	static CParseHandlerDXL *GetParseHandlerForDXLFile(
 		CMemoryPool *, const CHAR *dxl_filename, const CHAR *xsd_file_path);
 
+	// same as above but for a binary DXL document
+	static CParseHandlerDXL *GetParseHandlerForDXLBinary(CMemoryPool *,
+														 const BYTE *buffer,
+														 ULONG size);
+
+	// convert a DXL document into a binary DXL document
+	static BYTE *ConvertDXLToBinary(CMemoryPool *mp, const CHAR *dxl_string,
+									ULONG *size);
+
+	// convert a binary DXL document into a DXL document
+	static CWStringDynamic *ConvertBinaryToDXL(CMemoryPool *mp,
+											   const BYTE *buffer, ULONG size,
+											   BOOL indentation);
+
 	// parse a DXL document containing a DXL plan
 	static CDXLNode *GetPlanDXLNode(CMemoryPool *, const CHAR *dxl_string,
 									const CHAR *xsd_file_path, ULLONG *plan_id,
@@ -187,6 +202,11 @@ public:
 								  BOOL serialize_document_header_footer,
 								  BOOL indentation);
 
+	// serialize metadata objects into a binary DXL document
+	static BYTE *SerializeMetadataToBinary(
+		CMemoryPool *mp, const IMDCacheObjectArray *imd_obj_array,
+		ULONG *size);
+
 	// serialize metadata ids into a MD request message
 	static void SerializeMDRequest(CMemoryPool *mp, CMDRequest *md_request,
 								   IOstream &os,
@@ -266,6 +286,9 @@ public:
 
 	static CHAR *Read(CMemoryPool *mp, const CHAR *filename);
 
+	// read a given file in a byte buffer
+	static BYTE *ReadBytes(CMemoryPool *mp, const CHAR *filename, ULONG *size);
+
 	// create a multi-byte character string from a wide character string
 	static CHAR *CreateMultiByteCharStringFromWCString(CMemoryPool *mp,
 													   const WCHAR *wc_string);
@@ -22,6 +22,11 @@ namespace gpmd
 class CMDIdColStats;
 }
 
+namespace gpnaucrates
+{
+class CHLLSketch;
+}
+
 namespace gpdxl
 {
 using namespace gpos;
@@ -62,6 +67,12 @@ private:
 	// is the column statistics missing in the database
 	BOOL m_is_column_stats_missing;
 
+	// HyperLogLog sketch of the values of the column, may be NULL
+	CHLLSketch *m_hll_sketch;
+
+	// parse the HyperLogLog sketch of the column, if there is one
+	void ParseHLLSketch(const Attributes &attrs);
+
 	// private copy ctor
 	CParseHandlerColStats(const CParseHandlerColStats &);
 
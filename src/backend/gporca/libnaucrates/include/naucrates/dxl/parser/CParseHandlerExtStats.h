@@ -0,0 +1,89 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CParseHandlerExtStats.h
+//
+//	@doc:
+//		SAX parse handler class for parsing extended relation stats objects
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CParseHandlerExtStats_H
+#define GPDXL_CParseHandlerExtStats_H
+
+#include "gpos/base.h"
+
+#include "naucrates/dxl/parser/CParseHandlerMetadataObject.h"
+#include "naucrates/md/CDXLColumnGroupStats.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+using namespace gpmd;
+using namespace gpnaucrates;
+
+XERCES_CPP_NAMESPACE_USE
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CParseHandlerExtStats
+//
+//	@doc:
+//		Parse handler class for the extended statistics of a relation,
+//		including its column groups and their functional dependencies
+//
+//---------------------------------------------------------------------------
+class CParseHandlerExtStats : public CParseHandlerMetadataObject
+{
+private:
+	// metadata id of the object
+	IMDId *m_mdid;
+
+	// table name
+	CMDName *m_mdname;
+
+	// statistics of the column groups parsed so far
+	CDXLColumnGroupStatsArray *m_column_groups;
+
+	// columns of the column group being parsed
+	IntPtrArray *m_attnos;
+
+	// number of distinct values of the column group being parsed
+	CDouble m_distinct;
+
+	// dependency degrees of the column group being parsed
+	CDynamicPtrArray<CDouble, CleanupDelete> *m_dependency_degrees;
+
+	// private copy ctor
+	CParseHandlerExtStats(const CParseHandlerExtStats &);
+
+	// process the start of an element
+	void StartElement(
+		const XMLCh *const element_uri,			// URI of element's namespace
+		const XMLCh *const element_local_name,	// local part of element's name
+		const XMLCh *const element_qname,		// element's qname
+		const Attributes &attr					// element's attributes
+	);
+
+	// process the end of an element
+	void EndElement(
+		const XMLCh *const element_uri,			// URI of element's namespace
+		const XMLCh *const element_local_name,	// local part of element's name
+		const XMLCh *const element_qname		// element's qname
+	);
+
+public:
+	// ctor
+	CParseHandlerExtStats(CMemoryPool *mp,
+						  CParseHandlerManager *parse_handler_mgr,
+						  CParseHandlerBase *parse_handler_root);
+
+	// dtor
+	virtual ~CParseHandlerExtStats();
+};
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CParseHandlerExtStats_H
+
+// EOF
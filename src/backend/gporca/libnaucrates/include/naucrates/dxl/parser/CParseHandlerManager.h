@@ -48,7 +48,8 @@ private:
 	// the memory manager used for parsing the current document
 	CDXLMemoryManager *m_dxl_memory_manager;
 
-	// parser object responsible for parsing the current XML document
+	// parser object responsible for parsing the current XML document, NULL
+	// for binary DXL documents
 	SAX2XMLReader *m_xml_reader;
 
 	// current parse handler
@@ -96,8 +97,8 @@ public:
 	// Deactivates current handler and returns control to the previously active one.
 	void DeactivateHandler();
 
-	// Returns the current parse handler if one exists; used for debugging purposes
-	const CParseHandlerBase *GetCurrentParseHandler();
+	// Returns the current parse handler if one exists
+	CParseHandlerBase *GetCurrentParseHandler();
 };
 }  // namespace gpdxl
 #endif	// !GPDXL_CParseHandlerManager_H
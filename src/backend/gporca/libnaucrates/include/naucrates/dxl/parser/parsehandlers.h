@@ -35,6 +35,7 @@
 #include "naucrates/dxl/parser/CParseHandlerDynamicIndexScan.h"
 #include "naucrates/dxl/parser/CParseHandlerDynamicTableScan.h"
 #include "naucrates/dxl/parser/CParseHandlerEnumeratorConfig.h"
+#include "naucrates/dxl/parser/CParseHandlerExtStats.h"
 #include "naucrates/dxl/parser/CParseHandlerExternalScan.h"
 #include "naucrates/dxl/parser/CParseHandlerFactory.h"
 #include "naucrates/dxl/parser/CParseHandlerFilter.h"
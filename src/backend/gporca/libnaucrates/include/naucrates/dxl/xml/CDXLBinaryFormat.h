@@ -0,0 +1,111 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLBinaryFormat.h
+//
+//	@doc:
+//		Layout of binary DXL documents
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CDXLBinaryFormat_H
+#define GPDXL_CDXLBinaryFormat_H
+
+#include <xercesc/util/XercesDefs.hpp>
+
+#include "gpos/base.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+
+XERCES_CPP_NAMESPACE_USE
+
+// types of the records of a binary DXL document
+enum EdxlBinaryRecord
+{
+	EdxlbinaryEnd = 0,
+	EdxlbinaryStartElement,
+	EdxlbinaryEndElement,
+
+	EdxlbinarySentinel
+};
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryFormat
+//
+//	@doc:
+//		Binary DXL encodes the stream of SAX events of a DXL document, so that
+//		it can be replayed into the parse handlers that build the DXL trees and
+//		metadata objects from XML. A document consists of:
+//
+//		- a fixed size header (SHeader)
+//		- the records, starting right after the header. A record is a byte
+//		  holding its type (EdxlBinaryRecord), followed for start elements by
+//		  the string ids of the namespace URI, local name and qualified name
+//		  of the element, the number of attributes, and the string ids of the
+//		  qualified name and value of each attribute. Ids and counts are
+//		  variable length integers, 7 bits per byte, least significant first.
+//		- the string table, at a 4-byte aligned offset. Every distinct name or
+//		  value is stored once, in order of first use, as its length in
+//		  XMLCh units (ULONG) followed by the null-terminated XMLCh characters,
+//		  padded to 4 bytes. Strings are in the byte order of the writer, so
+//		  that readers can hand out pointers into the buffer.
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryFormat
+{
+public:
+	// header of a binary DXL document
+	struct SHeader
+	{
+		// magic number, identifying binary DXL documents
+		BYTE m_magic[4];
+
+		// version of the format
+		USINT m_version;
+
+		// byte order mark, as written by the writer
+		USINT m_byte_order;
+
+		// size of the document in bytes
+		ULONG m_size;
+
+		// number of strings of the string table
+		ULONG m_num_strings;
+
+		// offset of the string table
+		ULONG m_string_table_offset;
+	};
+
+	// magic number
+	static const BYTE Magic[4];
+
+	// current version of the format
+	static const USINT Version;
+
+	// byte order mark
+	static const USINT ByteOrderMark;
+
+	// does the buffer start with the magic number of binary DXL
+	static BOOL IsBinaryDXL(const BYTE *buffer, ULONG size);
+
+	// number of XMLCh units needed to encode the given wide characters
+	static ULONG XMLChLength(const WCHAR *wsz, ULONG length);
+
+	// encode wide characters as XMLCh units; the destination must hold
+	// XMLChLength units
+	static void CopyToXMLCh(XMLCh *dest, const WCHAR *wsz, ULONG length);
+
+	// decode a null-terminated XMLCh string into wide characters; the
+	// destination must hold the length of the source plus one characters
+	static void CopyToWideChars(WCHAR *dest, const XMLCh *xml_string);
+};
+
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CDXLBinaryFormat_H
+
+// EOF
@@ -0,0 +1,222 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLBinaryReader.h
+//
+//	@doc:
+//		Class for reading binary DXL documents
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CDXLBinaryReader_H
+#define GPDXL_CDXLBinaryReader_H
+
+#include <xercesc/sax2/Attributes.hpp>
+#include <xercesc/sax2/DefaultHandler.hpp>
+
+#include "gpos/base.h"
+#include "gpos/string/CWStringConst.h"
+
+#include "naucrates/dxl/xml/CDXLBinaryFormat.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+
+XERCES_CPP_NAMESPACE_USE
+
+class CParseHandlerManager;
+class CXMLSerializer;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryReader
+//
+//	@doc:
+//		Reads a binary DXL document (see CDXLBinaryFormat) by replaying its
+//		elements as SAX events, either into the parse handlers of a parse
+//		handler manager, which build the same DXL trees and metadata objects
+//		as from XML, or into a serializer, to convert the document back to
+//		XML.
+//
+//		Names and values are not copied: the string table is validated once
+//		and the strings passed to the handlers point into the buffer, which
+//		must outlive the reader.
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryReader
+{
+private:
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CBinaryAttributes
+	//
+	//	@doc:
+	//		SAX attributes of the element being replayed
+	//
+	//---------------------------------------------------------------------------
+	class CBinaryAttributes : public Attributes
+	{
+	private:
+		// qualified names of the attributes
+		const XMLCh **m_names;
+
+		// values of the attributes
+		const XMLCh **m_values;
+
+		// number of attributes
+		ULONG m_length;
+
+		// private copy ctor
+		CBinaryAttributes(const CBinaryAttributes &);
+
+	public:
+		// ctor
+		CBinaryAttributes() : m_names(NULL), m_values(NULL), m_length(0)
+		{
+		}
+
+		// dtor
+		virtual ~CBinaryAttributes()
+		{
+		}
+
+		// set the attributes of the current element
+		void
+		Set(const XMLCh **names, const XMLCh **values, ULONG length)
+		{
+			m_names = names;
+			m_values = values;
+			m_length = length;
+		}
+
+		// SAX attributes interface
+		virtual XMLSize_t getLength() const;
+		virtual const XMLCh *getURI(const XMLSize_t index) const;
+		virtual const XMLCh *getLocalName(const XMLSize_t index) const;
+		virtual const XMLCh *getQName(const XMLSize_t index) const;
+		virtual const XMLCh *getType(const XMLSize_t index) const;
+		virtual const XMLCh *getValue(const XMLSize_t index) const;
+		virtual bool getIndex(const XMLCh *const uri,
+							  const XMLCh *const local_part,
+							  XMLSize_t &index) const;
+		virtual int getIndex(const XMLCh *const uri,
+							 const XMLCh *const local_part) const;
+		virtual bool getIndex(const XMLCh *const qname,
+							  XMLSize_t &index) const;
+		virtual int getIndex(const XMLCh *const qname) const;
+		virtual const XMLCh *getType(const XMLCh *const uri,
+									 const XMLCh *const local_part) const;
+		virtual const XMLCh *getType(const XMLCh *const qname) const;
+		virtual const XMLCh *getValue(const XMLCh *const uri,
+									  const XMLCh *const local_part) const;
+		virtual const XMLCh *getValue(const XMLCh *const qname) const;
+	};
+
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// document
+	const BYTE *m_buffer;
+
+	// size of the document
+	ULONG m_size;
+
+	// copy of the document, if the given buffer was not aligned
+	BYTE *m_aligned_buffer;
+
+	// strings of the string table, pointing into the document
+	const XMLCh **m_strings;
+
+	// number of strings
+	ULONG m_num_strings;
+
+	// strings converted to wide characters, created on demand
+	CWStringConst **m_wide_strings;
+
+	// read position in the records
+	ULONG m_offset;
+
+	// end of the records, i.e. offset of the string table
+	ULONG m_records_end;
+
+	// name and value string ids of the attributes of the current element
+	ULONG *m_attr_ids;
+
+	// names and values of the attributes of the current element
+	const XMLCh **m_attr_names;
+	const XMLCh **m_attr_values;
+
+	// size of the attribute arrays
+	ULONG m_attrs_capacity;
+
+	// attributes of the current element
+	CBinaryAttributes m_attrs;
+
+	// URI, local name and qualified name string ids of the open elements
+	ULONG *m_open_elements;
+
+	// number of open elements
+	ULONG m_depth;
+
+	// size of the open element array, in elements
+	ULONG m_open_elements_capacity;
+
+	// private copy ctor
+	CDXLBinaryReader(const CDXLBinaryReader &);
+
+	// raise an error for a malformed document
+	static void RaiseError(const WCHAR *details);
+
+	// validate the header and the string table
+	void ReadStringTable();
+
+	// read a variable length integer
+	ULONG ReadVarint();
+
+	// read a string id
+	ULONG ReadStringId();
+
+	// read the next record; for start elements, push the element on the
+	// stack of open elements and read its attributes
+	EdxlBinaryRecord ReadRecord();
+
+	// string ids of the innermost open element
+	const ULONG *
+	GetOpenElement() const
+	{
+		GPOS_ASSERT(0 < m_depth);
+		return m_open_elements + 3 * (m_depth - 1);
+	}
+
+	// the string with the given id as a wide string
+	const CWStringConst *GetWideString(ULONG id);
+
+	// replay the records into the given parse handler manager or handler
+	void Replay(CParseHandlerManager *parse_handler_mgr,
+				DefaultHandler *handler);
+
+public:
+	// ctor; validates the document
+	CDXLBinaryReader(CMemoryPool *mp, const BYTE *buffer, ULONG size);
+
+	// dtor
+	~CDXLBinaryReader();
+
+	// replay the document into the active parse handlers of the manager
+	void Parse(CParseHandlerManager *parse_handler_mgr);
+
+	// replay the document into the given SAX handler
+	void Parse(DefaultHandler *handler);
+
+	// write the document as XML
+	void Serialize(CXMLSerializer *xml_serializer);
+
+};	// class CDXLBinaryReader
+
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CDXLBinaryReader_H
+
+// EOF
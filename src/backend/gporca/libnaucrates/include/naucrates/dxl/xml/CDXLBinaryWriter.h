@@ -0,0 +1,207 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLBinaryWriter.h
+//
+//	@doc:
+//		Class for creating binary DXL documents
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CDXLBinaryWriter_H
+#define GPDXL_CDXLBinaryWriter_H
+
+#include <xercesc/sax2/DefaultHandler.hpp>
+
+#include "gpos/base.h"
+#include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/CHashMap.h"
+#include "gpos/io/COstreamString.h"
+#include "gpos/string/CWStringConst.h"
+#include "gpos/string/CWStringDynamic.h"
+
+#include "naucrates/dxl/xml/CDXLBinaryFormat.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+
+XERCES_CPP_NAMESPACE_USE
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryWriter
+//
+//	@doc:
+//		Writes a binary DXL document (see CDXLBinaryFormat). Documents are
+//		either written by a CXMLSerializer created on the writer, or converted
+//		from XML by using the writer as the content handler of a Xerces SAX
+//		parser.
+//
+//		The start element record is only written when the next element is
+//		opened or the element is closed, once the number of attributes is
+//		known. Names and values are interned as they are written, the string
+//		table is appended by Finish.
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryWriter : public DefaultHandler
+{
+private:
+	// hash function for interned strings
+	static ULONG HashValue(const CWStringConst *str);
+
+	// equality function for interned strings
+	static BOOL Equals(const CWStringConst *str1, const CWStringConst *str2);
+
+	// map of interned strings to their ids
+	typedef CHashMap<CWStringConst, ULONG, HashValue, Equals,
+					 CleanupDelete<CWStringConst>, CleanupDelete<ULONG> >
+		StringToIdMap;
+
+	// interned strings, in the order of their ids
+	typedef CDynamicPtrArray<CWStringConst, CleanupNULL> StringArray;
+
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// buffer holding the document
+	BYTE *m_buffer;
+
+	// number of bytes written
+	ULONG m_size;
+
+	// size of the buffer
+	ULONG m_capacity;
+
+	// ids of the interned strings
+	StringToIdMap *m_string_ids;
+
+	// interned strings, owned by the map
+	StringArray *m_strings;
+
+	// string ids of the element whose start record is not written yet
+	ULONG m_pending_element[3];
+
+	// is there an element whose start record is not written yet
+	BOOL m_has_pending_element;
+
+	// name and value string ids of the attributes of the pending element
+	ULONG *m_pending_attrs;
+
+	// number of entries of the pending attribute array
+	ULONG m_num_pending_attrs;
+
+	// size of the pending attribute array
+	ULONG m_pending_attrs_capacity;
+
+	// number of open elements
+	ULONG m_depth;
+
+	// has the string table been written
+	BOOL m_finished;
+
+	// value of the attribute being written by a serializer
+	CWStringDynamic *m_value;
+
+	// stream writing into the attribute value
+	COstreamString *m_value_stream;
+
+	// scratch string for qualified names
+	CWStringDynamic *m_qname;
+
+	// scratch buffer for converting SAX strings
+	WCHAR *m_wide_chars;
+
+	// size of the scratch buffer
+	ULONG m_wide_chars_capacity;
+
+	// private copy ctor
+	CDXLBinaryWriter(const CDXLBinaryWriter &);
+
+	// make room for the given number of bytes
+	void Reserve(ULONG num_bytes);
+
+	// append bytes to the document
+	void Write(const void *data, ULONG num_bytes);
+
+	// append a variable length integer
+	void WriteVarint(ULONG value);
+
+	// id of the given string, interning it if needed
+	ULONG GetStringId(const WCHAR *wsz);
+
+	// id of the given SAX string, interning it if needed
+	ULONG GetStringId(const XMLCh *xml_string);
+
+	// write the start record of the pending element
+	void FlushPendingElement();
+
+	// add a name/value pair to the pending element
+	void AddAttributeIds(ULONG name_id, ULONG value_id);
+
+public:
+	// ctor
+	explicit CDXLBinaryWriter(CMemoryPool *mp);
+
+	// dtor
+	virtual ~CDXLBinaryWriter();
+
+	// stream into which serializers write attribute values
+	IOstream &
+	GetValueStream()
+	{
+		return *m_value_stream;
+	}
+
+	// open an element with the given namespace prefix and name
+	void OpenElement(const CWStringBase *ns_prefix,
+					 const CWStringBase *elem_str);
+
+	// close the current element
+	void CloseElement();
+
+	// add an attribute to the current element
+	void AddAttribute(const CWStringBase *name_str,
+					  const CWStringBase *value_str);
+
+	// add an attribute to the current element, with the value written
+	// into the value stream
+	void AddAttribute(const CWStringBase *name_str);
+
+	// write the string table; no elements can be added afterwards
+	void Finish();
+
+	// document, valid after Finish
+	const BYTE *
+	GetBuffer() const
+	{
+		GPOS_ASSERT(m_finished);
+		return m_buffer;
+	}
+
+	// size of the document in bytes, valid after Finish
+	ULONG
+	Size() const
+	{
+		GPOS_ASSERT(m_finished);
+		return m_size;
+	}
+
+	// SAX content handler interface, for converting XML documents
+	virtual void startElement(const XMLCh *const element_uri,
+							  const XMLCh *const element_local_name,
+							  const XMLCh *const element_qname,
+							  const Attributes &attr);
+
+	virtual void endElement(const XMLCh *const element_uri,
+							const XMLCh *const element_local_name,
+							const XMLCh *const element_qname);
+
+};	// class CDXLBinaryWriter
+
+}  // namespace gpdxl
+
+#endif	// !GPDXL_CDXLBinaryWriter_H
+
+// EOF
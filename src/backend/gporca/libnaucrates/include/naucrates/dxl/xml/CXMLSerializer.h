@@ -24,12 +24,15 @@ namespace gpdxl
 {
 using namespace gpos;
 
+class CDXLBinaryWriter;
+
 //---------------------------------------------------------------------------
 //	@class:
 //		CXMLSerializer
 //
 //	@doc:
-//		Class for creating XML documents.
+//		Class for creating XML documents. A serializer created on a binary
+//		writer produces a binary DXL document of the same elements instead.
 //
 //---------------------------------------------------------------------------
 class CXMLSerializer
@@ -59,6 +62,9 @@ private:
 	// steps since last check for aborts
 	ULONG m_iteration_since_last_abortcheck;
 
+	// writer of the binary document, NULL when writing XML
+	CDXLBinaryWriter *m_binary_writer;
+
 	// private copy ctor
 	CXMLSerializer(const CXMLSerializer &);
 
@@ -68,6 +74,13 @@ private:
 	// escape the given string and write it to the given stream
 	static void WriteEscaped(IOstream &os, const CWStringBase *str);
 
+	// start an attribute of the open element; the value is written to
+	// the output stream
+	void OpenAttribute(const CWStringBase *pstrAttr);
+
+	// end an attribute of the open element
+	void CloseAttribute(const CWStringBase *pstrAttr);
+
 public:
 	// ctor/dtor
 	CXMLSerializer(CMemoryPool *mp, IOstream &os, BOOL indentation = true)
@@ -77,11 +90,15 @@ public:
 		  m_strstackElems(NULL),
 		  m_fOpenTag(false),
 		  m_ulLevel(0),
-		  m_iteration_since_last_abortcheck(0)
+		  m_iteration_since_last_abortcheck(0),
+		  m_binary_writer(NULL)
 	{
 		m_strstackElems = GPOS_NEW(m_mp) StrStack(m_mp);
 	}
 
+	// ctor for writing a binary DXL document
+	CXMLSerializer(CMemoryPool *mp, CDXLBinaryWriter *binary_writer);
+
 	~CXMLSerializer();
 
 	// get underlying memory pool
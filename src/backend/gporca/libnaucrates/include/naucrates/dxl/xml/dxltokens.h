@@ -66,6 +66,7 @@ enum Edxltoken
 	EdxltokenPushGroupByBelowSetopThreshold,
 	EdxltokenXformBindThreshold,
 	EdxltokenSkewFactor,
+	EdxltokenMemoMemoryBudget,
 	EdxltokenMaxStatsBuckets,
 	EdxltokenWindowOids,
 	EdxltokenOidRowNumber,
@@ -353,6 +354,8 @@ enum Edxltoken
 	EdxltokenColNdvRemain,
 	EdxltokenColFreqRemain,
 	EdxltokenColStatsMissing,
+	EdxltokenColHLLPrecision,
+	EdxltokenColHLLRegisters,
 
 	EdxltokenParamId,
 
@@ -459,6 +462,10 @@ enum Edxltoken
 	EdxltokenRelationStats,
 	EdxltokenColumnStats,
 	EdxltokenColumnStatsBucket,
+	EdxltokenExtendedStats,
+	EdxltokenColumnGroupStats,
+	EdxltokenFunctionalDependency,
+	EdxltokenDependencyDegree,
 	EdxltokenEmptyRelation,
 	EdxltokenIsNull,
 	EdxltokenLintValue,
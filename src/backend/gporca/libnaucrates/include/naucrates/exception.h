@@ -41,6 +41,7 @@ enum ExMinor
 	ExmiDXLValidationError,
 	ExmiDXLXercesParseError,
 	ExmiDXLIncorrectNumberOfChildren,
+	ExmiDXLBinaryFormatError,
 	ExmiPlStmt2DXLConversion,
 	ExmiDXL2PlStmtConversion,
 	ExmiDXL2PlStmtExternalScanError,
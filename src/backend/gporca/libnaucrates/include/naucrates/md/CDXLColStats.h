@@ -69,6 +69,9 @@ private:
 	// is column statistics missing in the database
 	BOOL m_is_col_stats_missing;
 
+	// HyperLogLog sketch of the values of the column, may be NULL
+	CHLLSketch *m_hll_sketch;
+
 	// DXL string for object
 	CWStringDynamic *m_dxl_str;
 
@@ -81,7 +84,7 @@ public:
 				 CMDName *mdname, CDouble width, CDouble null_freq,
 				 CDouble distinct_remaining, CDouble freq_remaining,
 				 CDXLBucketArray *dxl_stats_bucket_array,
-				 BOOL is_col_stats_missing);
+				 BOOL is_col_stats_missing, CHLLSketch *hll_sketch);
 
 	// dtor
 	virtual ~CDXLColStats();
@@ -136,6 +139,13 @@ public:
 	// get the bucket at the given position
 	virtual const CDXLBucket *GetDXLBucketAt(ULONG ul) const;
 
+	// HyperLogLog sketch of the values of the column
+	virtual const CHLLSketch *
+	GetHLLSketch() const
+	{
+		return m_hll_sketch;
+	}
+
 	// serialize column stats in DXL format
 	virtual void Serialize(gpdxl::CXMLSerializer *) const;
 
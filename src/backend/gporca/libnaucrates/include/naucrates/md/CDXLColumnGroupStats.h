@@ -0,0 +1,109 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLColumnGroupStats.h
+//
+//	@doc:
+//		Class representing the statistics of a group of columns in DXL
+//		extended statistics
+//---------------------------------------------------------------------------
+
+
+
+#ifndef GPMD_CDXLColumnGroupStats_H
+#define GPMD_CDXLColumnGroupStats_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDouble.h"
+#include "gpos/common/CDynamicPtrArray.h"
+
+namespace gpdxl
+{
+class CXMLSerializer;
+}
+
+namespace gpmd
+{
+using namespace gpos;
+using namespace gpdxl;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLColumnGroupStats
+//
+//	@doc:
+//		Statistics of a group of columns that was declared as correlated: the
+//		number of distinct combinations of values of the group, and for each
+//		column the degree to which it is functionally determined by the other
+//		columns of the group, i.e. the fraction of the rows whose value of the
+//		column is implied by their values of the other columns
+//
+//---------------------------------------------------------------------------
+class CDXLColumnGroupStats : public CRefCount
+{
+private:
+	// attribute numbers of the columns of the group
+	IntPtrArray *m_attnos;
+
+	// number of distinct combinations of values
+	CDouble m_distinct;
+
+	// dependency degree of each column of the group
+	CDynamicPtrArray<CDouble, CleanupDelete> *m_dependency_degrees;
+
+	// private copy ctor
+	CDXLColumnGroupStats(const CDXLColumnGroupStats &);
+
+public:
+	// ctor
+	CDXLColumnGroupStats(
+		IntPtrArray *attnos, CDouble distinct,
+		CDynamicPtrArray<CDouble, CleanupDelete> *dependency_degrees);
+
+	// dtor
+	virtual ~CDXLColumnGroupStats();
+
+	// attribute numbers of the columns of the group
+	const IntPtrArray *
+	GetAttnos() const
+	{
+		return m_attnos;
+	}
+
+	// number of columns of the group
+	ULONG
+	Size() const
+	{
+		return m_attnos->Size();
+	}
+
+	// number of distinct combinations of values
+	CDouble
+	GetNumDistinct() const
+	{
+		return m_distinct;
+	}
+
+	// dependency degree of the column at the given position
+	CDouble GetDependencyDegree(ULONG pos) const;
+
+	// serialize the group in DXL format
+	void Serialize(gpdxl::CXMLSerializer *) const;
+
+#ifdef GPOS_DEBUG
+	// debug print of the group
+	void DebugPrint(IOstream &os) const;
+#endif
+};
+
+// array of column group statistics
+typedef CDynamicPtrArray<CDXLColumnGroupStats, CleanupRelease>
+	CDXLColumnGroupStatsArray;
+
+}  // namespace gpmd
+
+#endif	// !GPMD_CDXLColumnGroupStats_H
+
+// EOF
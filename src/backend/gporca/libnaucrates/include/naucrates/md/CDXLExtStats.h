@@ -0,0 +1,106 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLExtStats.h
+//
+//	@doc:
+//		Class representing the extended statistics of a relation
+//---------------------------------------------------------------------------
+
+
+
+#ifndef GPMD_CDXLExtStats_H
+#define GPMD_CDXLExtStats_H
+
+#include "gpos/base.h"
+#include "gpos/string/CWStringDynamic.h"
+
+#include "naucrates/md/CDXLColumnGroupStats.h"
+#include "naucrates/md/CMDIdExtStats.h"
+#include "naucrates/md/IMDExtStats.h"
+
+namespace gpdxl
+{
+class CXMLSerializer;
+}
+
+namespace gpmd
+{
+using namespace gpos;
+using namespace gpdxl;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLExtStats
+//
+//	@doc:
+//		Class representing the extended statistics of a relation
+//
+//---------------------------------------------------------------------------
+class CDXLExtStats : public IMDExtStats
+{
+private:
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// metadata id of the object
+	CMDIdExtStats *m_ext_stats_mdid;
+
+	// table name
+	CMDName *m_mdname;
+
+	// statistics of the column groups
+	CDXLColumnGroupStatsArray *m_column_groups;
+
+	// DXL string for object
+	CWStringDynamic *m_dxl_str;
+
+	// private copy ctor
+	CDXLExtStats(const CDXLExtStats &);
+
+public:
+	CDXLExtStats(CMemoryPool *mp, CMDIdExtStats *ext_stats_mdid,
+				 CMDName *mdname, CDXLColumnGroupStatsArray *column_groups);
+
+	virtual ~CDXLExtStats();
+
+	// the metadata id
+	virtual IMDId *MDId() const;
+
+	// relation name
+	virtual CMDName Mdname() const;
+
+	// DXL string representation of cache object
+	virtual const CWStringDynamic *GetStrRepr() const;
+
+	// number of column groups
+	virtual ULONG
+	Size() const
+	{
+		return m_column_groups->Size();
+	}
+
+	// statistics of the column group at the given position
+	virtual const CDXLColumnGroupStats *GetColumnGroupStats(ULONG pos) const;
+
+	// serialize extended stats in DXL format given a serializer object
+	virtual void Serialize(gpdxl::CXMLSerializer *) const;
+
+#ifdef GPOS_DEBUG
+	// debug print of the extended stats
+	virtual void DebugPrint(IOstream &os) const;
+#endif
+
+	// dummy extended stats
+	static CDXLExtStats *CreateDXLDummyExtStats(CMemoryPool *mp, IMDId *mdid);
+};
+
+}  // namespace gpmd
+
+
+
+#endif	// !GPMD_CDXLExtStats_H
+
+// EOF
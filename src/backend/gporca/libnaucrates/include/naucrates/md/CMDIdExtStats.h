@@ -0,0 +1,131 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMDIdExtStats.h
+//
+//	@doc:
+//		Class for representing mdids for extended statistics
+//---------------------------------------------------------------------------
+
+
+
+#ifndef GPMD_CMDIdExtStats_H
+#define GPMD_CMDIdExtStats_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/string/CWStringConst.h"
+
+#include "naucrates/dxl/gpdb_types.h"
+#include "naucrates/md/CMDIdGPDB.h"
+#include "naucrates/md/CSystemId.h"
+
+namespace gpmd
+{
+using namespace gpos;
+
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CMDIdExtStats
+//
+//	@doc:
+//		Class for representing ids of the extended statistics of a relation
+//
+//---------------------------------------------------------------------------
+class CMDIdExtStats : public IMDId
+{
+private:
+	// mdid of base relation
+	CMDIdGPDB *m_rel_mdid;
+
+	// buffer for the serialzied mdid
+	WCHAR m_mdid_array[GPDXL_MDID_LENGTH];
+
+	// string representation of the mdid
+	CWStringStatic m_str;
+
+	// private copy ctor
+	CMDIdExtStats(const CMDIdExtStats &);
+
+	// serialize mdid
+	void Serialize();
+
+public:
+	// ctor
+	explicit CMDIdExtStats(CMDIdGPDB *rel_mdid);
+
+	// dtor
+	virtual ~CMDIdExtStats();
+
+	virtual EMDIdType
+	MdidType() const
+	{
+		return EmdidExtStats;
+	}
+
+	// string representation of mdid
+	virtual const WCHAR *GetBuffer() const;
+
+	// source system id
+	virtual CSystemId
+	Sysid() const
+	{
+		return m_rel_mdid->Sysid();
+	}
+
+	// accessors
+	IMDId *GetRelMdId() const;
+
+	// equality check
+	virtual BOOL Equals(const IMDId *mdid) const;
+
+	// computes the hash value for the metadata id
+	virtual ULONG
+	HashValue() const
+	{
+		return m_rel_mdid->HashValue();
+	}
+
+	// is the mdid valid
+	virtual BOOL
+	IsValid() const
+	{
+		return IMDId::IsValid(m_rel_mdid);
+	}
+
+	// serialize mdid in DXL as the value of the specified attribute
+	virtual void Serialize(CXMLSerializer *xml_serializer,
+						   const CWStringConst *attribute_str) const;
+
+	// debug print of the metadata id
+	virtual IOstream &OsPrint(IOstream &os) const;
+
+	// const converter
+	static const CMDIdExtStats *
+	CastMdid(const IMDId *mdid)
+	{
+		GPOS_ASSERT(NULL != mdid && EmdidExtStats == mdid->MdidType());
+
+		return dynamic_cast<const CMDIdExtStats *>(mdid);
+	}
+
+	// non-const converter
+	static CMDIdExtStats *
+	CastMdid(IMDId *mdid)
+	{
+		GPOS_ASSERT(NULL != mdid && EmdidExtStats == mdid->MdidType());
+
+		return dynamic_cast<CMDIdExtStats *>(mdid);
+	}
+};
+
+}  // namespace gpmd
+
+
+
+#endif	// !GPMD_CMDIdExtStats_H
+
+// EOF
@@ -19,10 +19,16 @@
 #include "naucrates/md/CDXLBucket.h"
 #include "naucrates/md/IMDCacheObject.h"
 
+namespace gpnaucrates
+{
+class CHLLSketch;
+}
+
 namespace gpmd
 {
 using namespace gpos;
 using namespace gpdxl;
+using gpnaucrates::CHLLSketch;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -62,6 +68,9 @@ public:
 
 	// get the bucket at the given position
 	virtual const CDXLBucket *GetDXLBucketAt(ULONG ul) const = 0;
+
+	// HyperLogLog sketch of the values of the column, NULL if there is none
+	virtual const CHLLSketch *GetHLLSketch() const = 0;
 };
 }  // namespace gpmd
 
@@ -0,0 +1,57 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		IMDExtStats.h
+//
+//	@doc:
+//		Interface for the extended (multi-column) statistics of a relation
+//---------------------------------------------------------------------------
+
+
+
+#ifndef GPMD_IMDExtStats_H
+#define GPMD_IMDExtStats_H
+
+#include "gpos/base.h"
+
+#include "naucrates/md/CDXLColumnGroupStats.h"
+#include "naucrates/md/IMDCacheObject.h"
+
+namespace gpmd
+{
+using namespace gpos;
+using namespace gpdxl;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		IMDExtStats
+//
+//	@doc:
+//		Interface for the extended statistics of a relation, i.e. the
+//		statistics of the groups of columns declared as correlated
+//
+//---------------------------------------------------------------------------
+class IMDExtStats : public IMDCacheObject
+{
+public:
+	// object type
+	virtual Emdtype
+	MDType() const
+	{
+		return EmdtExtStats;
+	}
+
+	// number of column groups
+	virtual ULONG Size() const = 0;
+
+	// statistics of the column group at the given position
+	virtual const CDXLColumnGroupStats *GetColumnGroupStats(
+		ULONG pos) const = 0;
+};
+}  // namespace gpmd
+
+#endif	// !GPMD_IMDExtStats_H
+
+// EOF
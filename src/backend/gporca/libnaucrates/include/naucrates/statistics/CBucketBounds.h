@@ -0,0 +1,139 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CBucketBounds.h
+//
+//	@doc:
+//		Flat representation of the bucket bounds of a histogram whose datums
+//		map to doubles
+//---------------------------------------------------------------------------
+#ifndef GPNAUCRATES_CBucketBounds_H
+#define GPNAUCRATES_CBucketBounds_H
+
+#include "gpos/base.h"
+
+#include "naucrates/statistics/CBucket.h"
+
+namespace gpnaucrates
+{
+using namespace gpos;
+using namespace gpmd;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CBucketBounds
+//
+//	@doc:
+//		Bounds of the buckets of a histogram, stored as contiguous arrays of
+//		doubles together with the closedness of each bound. The comparisons
+//		mirror those of CBucket and CPoint, but work on the mapped values
+//		directly instead of going through the datums, so that merging two
+//		histograms does not pay for virtual calls on every bucket pair.
+//
+//		Bounds are only built for histograms where every bound maps to a
+//		value that compares exactly like the datum: either all bounds map
+//		to LINT values small enough to be represented exactly as doubles,
+//		or none of them maps to LINT and all of them map to doubles.
+//
+//---------------------------------------------------------------------------
+class CBucketBounds
+{
+private:
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// number of buckets
+	ULONG m_size;
+
+	// mapped lower bounds
+	DOUBLE *m_lower;
+
+	// mapped upper bounds
+	DOUBLE *m_upper;
+
+	// is lower bound closed
+	BOOL *m_is_lower_closed;
+
+	// is upper bound closed
+	BOOL *m_is_upper_closed;
+
+	// were the bounds mapped from LINT values
+	BOOL m_is_lint;
+
+	// type of the bounds, not owned
+	IMDId *m_mdid;
+
+	// private copy ctor
+	CBucketBounds(const CBucketBounds &);
+
+	// private ctor
+	CBucketBounds(CMemoryPool *mp, ULONG size);
+
+	// map a bound, returns false if it cannot be represented
+	BOOL FMapBound(const CPoint *point, DOUBLE *value);
+
+	// equality of mapped values
+	static BOOL Equals(DOUBLE value1, DOUBLE value2);
+
+	// less than of mapped values
+	static BOOL IsLessThan(DOUBLE value1, DOUBLE value2);
+
+	// does the bucket at the given position contain the given value
+	BOOL Contains(ULONG idx, DOUBLE value) const;
+
+	// does the bucket at the given position subsume the other bucket
+	BOOL Subsumes(ULONG idx, const CBucketBounds *other,
+				  ULONG other_idx) const;
+
+	// compare lower bounds of two buckets
+	static INT CompareLowerBounds(const CBucketBounds *bounds1, ULONG idx1,
+								  const CBucketBounds *bounds2, ULONG idx2);
+
+	// compare lower bound of first bucket to upper bound of second bucket
+	static INT CompareLowerBoundToUpperBound(const CBucketBounds *bounds1,
+											 ULONG idx1,
+											 const CBucketBounds *bounds2,
+											 ULONG idx2);
+
+public:
+	// dtor
+	~CBucketBounds();
+
+	// build the bounds of the given buckets, returns NULL if any bound
+	// cannot be mapped
+	static CBucketBounds *PbbCreate(CMemoryPool *mp,
+									const CBucketArray *buckets);
+
+	// can the bounds be compared with the given bounds
+	BOOL IsComparable(const CBucketBounds *other) const;
+
+	// number of buckets
+	ULONG
+	Size() const
+	{
+		return m_size;
+	}
+
+	// is the bucket at the given position a singleton
+	BOOL IsSingleton(ULONG idx) const;
+
+	// do the buckets at the given positions intersect
+	BOOL Intersects(ULONG idx, const CBucketBounds *other,
+					ULONG other_idx) const;
+
+	// is the bucket at the given position before the other bucket
+	BOOL IsBefore(ULONG idx, const CBucketBounds *other,
+				  ULONG other_idx) const;
+
+	// compare upper bounds of two buckets
+	static INT CompareUpperBounds(const CBucketBounds *bounds1, ULONG idx1,
+								  const CBucketBounds *bounds2, ULONG idx2);
+
+};	// class CBucketBounds
+}  // namespace gpnaucrates
+
+#endif	// !GPNAUCRATES_CBucketBounds_H
+
+// EOF
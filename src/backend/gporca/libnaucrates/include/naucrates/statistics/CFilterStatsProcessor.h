@@ -65,13 +65,25 @@ private:
 	static UlongToHistogramMap *MakeHistHashMapConjOrDisjFilter(
 		CMemoryPool *mp, const CStatisticsConfig *stats_config,
 		UlongToHistogramMap *input_histograms, CDouble input_rows,
-		CStatsPred *pred_stats, CDouble *scale_factor);
+		CStatsPred *pred_stats, CDouble *scale_factor,
+		const CStatsColGroupArray *column_groups);
 
 	// create new hash map of histograms after applying the conjunction predicate
 	static UlongToHistogramMap *MakeHistHashMapConjFilter(
 		CMemoryPool *mp, const CStatisticsConfig *stats_config,
 		UlongToHistogramMap *intermediate_histograms, CDouble input_rows,
-		CStatsPredConj *conjunctive_pred_stats, CDouble *scale_factor);
+		CStatsPredConj *conjunctive_pred_stats, CDouble *scale_factor,
+		const CStatsColGroupArray *column_groups);
+
+	// reduce the scale factors of the equality predicates on columns that
+	// depend on the other columns of a column group
+	static void AdjustScaleFactorsForColumnGroups(
+		CMemoryPool *mp, const CStatsColGroupArray *column_groups,
+		const ULongPtrArray *scale_factor_colids, const CBitSet *non_eq_colids,
+		CDoubleArray *scale_factors);
+
+	// add the ids of the columns referenced by a predicate to the given set
+	static void AddPredColIds(CStatsPred *pred_stats, CBitSet *colids);
 
 	// create new hash map of histograms after applying the disjunctive predicate
 	static UlongToHistogramMap *MakeHistHashMapDisjFilter(
@@ -0,0 +1,127 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CHLLSketch.h
+//
+//	@doc:
+//		HyperLogLog sketch of the values of a column
+//---------------------------------------------------------------------------
+
+#ifndef GPNAUCRATES_CHLLSketch_H
+#define GPNAUCRATES_CHLLSketch_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDouble.h"
+#include "gpos/common/CRefCount.h"
+
+namespace gpdxl
+{
+class CXMLSerializer;
+}
+
+namespace gpnaucrates
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CHLLSketch
+//
+//	@doc:
+//		HyperLogLog sketch collected by ANALYZE. The sketch has 2^p registers,
+//		p being its precision; the register of index i holds the largest rank
+//		(position of the first set bit, counting from 1) of the remaining bits
+//		of the hashes whose first p bits are i. The hashing and register
+//		layout are those of gp_hyperloglog, so that sketches of different
+//		relations can be merged.
+//
+//		Sketches are used to estimate the number of distinct values of the
+//		union of two inputs, which cannot be derived from their NDVs.
+//		Objects are immutable, histograms share them.
+//
+//---------------------------------------------------------------------------
+class CHLLSketch : public CRefCount
+{
+private:
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// number of bits of the hash used to index the registers
+	ULONG m_precision;
+
+	// registers
+	BYTE *m_registers;
+
+	// private copy ctor
+	CHLLSketch(const CHLLSketch &);
+
+public:
+	// ctor; takes ownership of the registers
+	CHLLSketch(CMemoryPool *mp, ULONG precision, BYTE *registers);
+
+	// dtor
+	virtual ~CHLLSketch();
+
+	// precision
+	ULONG
+	Precision() const
+	{
+		return m_precision;
+	}
+
+	// number of registers
+	ULONG
+	Size() const
+	{
+		return ULONG(1) << m_precision;
+	}
+
+	// registers
+	const BYTE *
+	GetRegisters() const
+	{
+		return m_registers;
+	}
+
+	// estimated number of distinct values
+	CDouble Estimate() const;
+
+	// copy of the sketch
+	CHLLSketch *CopySketch(CMemoryPool *mp) const;
+
+	// sketch of the same values with a lower precision
+	CHLLSketch *MakeSketchFolded(CMemoryPool *mp, ULONG precision) const;
+
+	// sketch of the union of the values of the two sketches
+	CHLLSketch *MakeSketchMerged(CMemoryPool *mp,
+								 const CHLLSketch *other) const;
+
+	// number of distinct values of the union of two inputs, given their
+	// sketches and their NDVs
+	static CDouble UnionNDV(const CHLLSketch *sketch1, CDouble ndv1,
+							const CHLLSketch *sketch2, CDouble ndv2);
+
+	// serialize the sketch as attributes of the current DXL element
+	void Serialize(gpdxl::CXMLSerializer *xml_serializer) const;
+
+	// print function
+	IOstream &OsPrint(IOstream &os) const;
+
+	// minimum precision of a sketch
+	static const ULONG MinPrecision;
+
+	// maximum precision of a sketch
+	static const ULONG MaxPrecision;
+
+	// precision of the sketches passed to the optimizer
+	static const ULONG DefaultPrecision;
+
+};	// class CHLLSketch
+
+}  // namespace gpnaucrates
+
+#endif	// !GPNAUCRATES_CHLLSketch_H
+
+// EOF
@@ -16,6 +16,7 @@
 
 #include "gpopt/base/CKHeap.h"
 #include "naucrates/statistics/CBucket.h"
+#include "naucrates/statistics/CHLLSketch.h"
 #include "naucrates/statistics/CStatsPred.h"
 
 namespace gpopt
@@ -97,6 +98,11 @@ private:
 	// is column statistics missing in the database
 	BOOL m_is_col_stats_missing;
 
+	// HyperLogLog sketch of the values of the column, NULL unless the
+	// histogram describes all the values of a table or of a union all of
+	// tables; shared among histograms
+	CHLLSketch *m_hll_sketch;
+
 	// private copy ctor
 	CHistogram(const CHistogram &);
 
@@ -256,6 +262,16 @@ public:
 		return m_NDVs_were_scaled;
 	}
 
+	// set the HyperLogLog sketch of the column; takes ownership
+	void SetHLLSketch(CHLLSketch *hll_sketch);
+
+	// HyperLogLog sketch of the column, NULL if there is none
+	const CHLLSketch *
+	GetHLLSketch() const
+	{
+		return m_hll_sketch;
+	}
+
 	// filter by comparing with point
 	CHistogram *MakeHistogramFilter(CStatsPred::EStatsCmpType stats_cmp_type,
 									CPoint *point) const;
@@ -357,6 +373,9 @@ public:
 	// total number of distinct values
 	CDouble GetNumDistinct() const;
 
+	// number of distinct non-null values
+	CDouble GetNumDistinctNonNull() const;
+
 	// is histogram well formed
 	BOOL IsValid() const;
 
@@ -367,6 +386,7 @@ public:
 	virtual ~CHistogram()
 	{
 		m_histogram_buckets->Release();
+		CRefCount::SafeRelease(m_hll_sketch);
 	}
 
 	// normalize histogram and return scaling factor
@@ -394,6 +414,9 @@ public:
 		return m_skew;
 	}
 
+	// estimate of the frequency of the most frequent value
+	CDouble GetMaxValueFreq() const;
+
 	// accessor of null fraction
 	CDouble
 	GetNullFreq() const
@@ -421,6 +444,10 @@ public:
 	// cap the total number of distinct values (NDVs) in buckets to the number of rows
 	void CapNDVs(CDouble rows);
 
+	// scale the number of distinct values (NDVs) of the non-null values to
+	// the given value, capping the NDVs of each bucket to its number of rows
+	void ScaleNDVs(CDouble distinct, CDouble rows);
+
 	// is comparison type supported for filters for text columns
 	static BOOL IsOpSupportedForTextFilter(
 		CStatsPred::EStatsCmpType stats_cmp_type);
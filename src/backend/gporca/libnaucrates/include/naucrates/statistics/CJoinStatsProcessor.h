@@ -33,6 +33,14 @@ protected:
 		IStatistics::EStatsJoinType join_type);
 
 
+	// replace the scale factors of the equality predicates covering a column
+	// group of the outer side by a single one based on the number of
+	// distinct combinations of the group
+	static void AdjustScaleFactorsForColumnGroups(
+		CMemoryPool *mp, const CStatistics *outer_stats,
+		const CStatistics *inner_stats, CStatsPredJoinArray *join_preds_stats,
+		CScaleFactorUtils::SJoinConditionArray *join_conds_scale_factors);
+
 	// check if the join statistics object is empty output based on the input
 	// histograms and the join histograms
 	static BOOL JoinStatsAreEmpty(BOOL outer_is_empty, BOOL output_is_empty,
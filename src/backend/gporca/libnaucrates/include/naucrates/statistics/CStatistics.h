@@ -16,6 +16,7 @@
 #include "gpos/string/CWStringDynamic.h"
 
 #include "naucrates/statistics/CHistogram.h"
+#include "naucrates/statistics/CStatsColGroup.h"
 #include "naucrates/statistics/CStatsPredArrayCmp.h"
 #include "naucrates/statistics/CStatsPredConj.h"
 #include "naucrates/statistics/CStatsPredDisj.h"
@@ -121,6 +122,9 @@ private:
 	// source can be one of the following operators: like Get, Group By, and Project
 	CUpperBoundNDVPtrArray *m_src_upper_bound_NDVs;
 
+	// statistics of groups of correlated columns
+	CStatsColGroupArray *m_column_groups;
+
 	// the default value for operators that have no cardinality estimation risk
 	static const ULONG no_card_est_risk_default_val;
 
@@ -185,6 +189,9 @@ public:
 	// skew estimate for given column
 	virtual CDouble GetSkew(ULONG colid) const;
 
+	// frequency of the most frequent value of given column, 0 if unknown
+	virtual CDouble GetMaxValueFreq(ULONG colid) const;
+
 	// what is the width in bytes of set of column id's
 	virtual CDouble Width(ULongPtrArray *colids) const;
 
@@ -317,6 +324,26 @@ public:
 	{
 		return m_src_upper_bound_NDVs;
 	}
+
+	// statistics of groups of correlated columns
+	const CStatsColGroupArray *
+	GetColumnGroups() const
+	{
+		return m_column_groups;
+	}
+
+	// add the statistics of a group of correlated columns
+	void AddColumnGroup(CStatsColGroup *column_group);
+
+	// add the column groups of this object to the given stats object, except
+	// for the groups with a column in the given set (if any)
+	void CopyColumnGroupsInto(CStatistics *dest_stats,
+							  const CBitSet *excluded_colids) const;
+
+	// statistics of the column group covering exactly the given columns,
+	// NULL if there is none
+	const CStatsColGroup *FindColumnGroup(const ULongPtrArray *colids) const;
+
 	// create an empty statistics object
 	static CStatistics *
 	MakeEmptyStats(CMemoryPool *mp)
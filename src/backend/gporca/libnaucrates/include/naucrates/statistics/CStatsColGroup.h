@@ -0,0 +1,117 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CStatsColGroup.h
+//
+//	@doc:
+//		Statistics of a group of correlated columns
+//---------------------------------------------------------------------------
+
+#ifndef GPNAUCRATES_CStatsColGroup_H
+#define GPNAUCRATES_CStatsColGroup_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDouble.h"
+#include "gpos/common/CRefCount.h"
+
+#include "gpopt/base/CColRef.h"
+#include "naucrates/statistics/CHistogram.h"
+
+namespace gpnaucrates
+{
+using namespace gpos;
+using namespace gpopt;
+
+// forward decl
+class CStatsColGroup;
+
+// dynamic array of column groups
+typedef CDynamicPtrArray<CStatsColGroup, CleanupRelease> CStatsColGroupArray;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CStatsColGroup
+//
+//	@doc:
+//		Statistics of a group of columns that were collected together: the
+//		number of distinct combinations of values of the group, and for each
+//		column its dependency degree, i.e. the fraction of the rows in which
+//		the value of the column is determined by the values of the other
+//		columns of the group.
+//
+//		Objects are immutable, stats objects share them.
+//
+//---------------------------------------------------------------------------
+class CStatsColGroup : public CRefCount
+{
+private:
+	// ids of the columns of the group
+	ULongPtrArray *m_colids;
+
+	// number of distinct combinations of values
+	CDouble m_ndv;
+
+	// dependency degree of each column
+	CDoubleArray *m_dependency_degrees;
+
+	// private copy ctor
+	CStatsColGroup(const CStatsColGroup &);
+
+public:
+	// ctor
+	CStatsColGroup(ULongPtrArray *colids, CDouble ndv,
+				   CDoubleArray *dependency_degrees);
+
+	// dtor
+	virtual ~CStatsColGroup();
+
+	// number of columns
+	ULONG
+	Size() const
+	{
+		return m_colids->Size();
+	}
+
+	// id of the column at the given position
+	ULONG
+	GetColId(ULONG pos) const
+	{
+		return *(*m_colids)[pos];
+	}
+
+	// number of distinct combinations of values
+	CDouble
+	GetNDV() const
+	{
+		return m_ndv;
+	}
+
+	// dependency degree of the column at the given position
+	CDouble
+	GetDependencyDegree(ULONG pos) const
+	{
+		return *(*m_dependency_degrees)[pos];
+	}
+
+	// position of the given column in the group, gpos::ulong_max if the
+	// column is not part of it
+	ULONG IndexOf(ULONG colid) const;
+
+	// are all the columns of the group in the given array
+	BOOL IsCoveredBy(const ULongPtrArray *colids) const;
+
+	// copy of the group with remapped column ids; NULL if any of the columns
+	// has no mapping
+	CStatsColGroup *CopyWithRemap(CMemoryPool *mp,
+								  UlongToColRefMap *colref_mapping) const;
+
+	// print function
+	IOstream &OsPrint(IOstream &os) const;
+};
+}  // namespace gpnaucrates
+
+#endif	// !GPNAUCRATES_CStatsColGroup_H
+
+// EOF
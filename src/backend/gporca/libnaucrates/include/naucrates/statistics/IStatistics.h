@@ -125,6 +125,9 @@ public:
 	// skew estimate for given column
 	virtual CDouble GetSkew(ULONG colid) const = 0;
 
+	// frequency of the most frequent value of given column, 0 if unknown
+	virtual CDouble GetMaxValueFreq(ULONG colid) const = 0;
+
 	// what is the width in bytes
 	virtual CDouble Width() const = 0;
 
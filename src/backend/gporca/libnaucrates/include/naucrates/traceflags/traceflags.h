@@ -77,6 +77,9 @@ enum EOptTraceFlag
 	// print equivalent distribution specs
 	EopttracePrintEquivDistrSpecs = 101017,
 
+	// collect optimizer's stats for the caller without printing them
+	EopttraceCollectOptimizationStatistics = 101018,
+
 	///////////////////////////////////////////////////////
 	////////////////// transformations flags //////////////
 	///////////////////////////////////////////////////////
@@ -231,6 +234,9 @@ enum EOptTraceFlag
 	// Keep locks on partition children during planning
 	EopttraceKeepPartitionChildrenLocks = 103045,
 
+	// Use the hypergraph-based DP (DPhyp) join order enumeration
+	EopttraceEnableHypergraphJoinOrder = 103046,
+
 	///////////////////////////////////////////////////////
 	///////////////////// statistics flags ////////////////
 	//////////////////////////////////////////////////////
@@ -261,6 +267,9 @@ enum EOptTraceFlag
 
 	// Use experimental cost model
 	EopttraceExperimentalCostModel = 104009,
+
+	// Cost a hash redistribution for the host receiving the most frequent value
+	EopttracePenalizeHeavyHitters = 104010,
 	///////////////////////////////////////////////////////
 	/////////// constant expression evaluator flags ///////
 	///////////////////////////////////////////////////////
@@ -39,6 +39,8 @@
 #include "naucrates/dxl/parser/CParseHandlerFactory.h"
 #include "naucrates/dxl/parser/CParseHandlerManager.h"
 #include "naucrates/dxl/parser/CParseHandlerPlan.h"
+#include "naucrates/dxl/xml/CDXLBinaryReader.h"
+#include "naucrates/dxl/xml/CDXLBinaryWriter.h"
 #include "naucrates/dxl/xml/CDXLMemoryManager.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
 #include "naucrates/md/CDXLStatsDerivedRelation.h"
@@ -151,6 +153,8 @@ CDXLUtils::GetParseHandlerForDXLString(CMemoryPool *mp, const CHAR *dxl_string,
 //		Start the parsing of the given DXL string and return the top-level parser.
 //		If a non-empty XSD schema location is provided, the DXL is validated against
 //		that schema, and an exception is thrown if the DXL does not conform.
+//		Files holding a binary DXL document, like minidumps converted with
+//		ConvertDXLToBinary, are parsed as such; they are not validated.
 //
 //---------------------------------------------------------------------------
 CParseHandlerDXL *
@@ -159,6 +163,22 @@ CDXLUtils::GetParseHandlerForDXLFile(CMemoryPool *mp, const CHAR *dxl_filename,
 {
 	GPOS_ASSERT(NULL != mp);
 
+	if (ioutils::PathExists(dxl_filename) && !ioutils::IsDir(dxl_filename))
+	{
+		BYTE magic[GPOS_ARRAY_SIZE(CDXLBinaryFormat::Magic)];
+		CFileReader fr;
+		fr.Open(dxl_filename);
+		ULONG_PTR read_bytes = fr.ReadBytesToBuffer(magic, GPOS_SIZEOF(magic));
+		fr.Close();
+
+		if (CDXLBinaryFormat::IsBinaryDXL(magic, (ULONG) read_bytes))
+		{
+			ULONG size = 0;
+			CAutoRg<BYTE> buffer(ReadBytes(mp, dxl_filename, &size));
+			return GetParseHandlerForDXLBinary(mp, buffer.Rgt(), size);
+		}
+	}
+
 	// setup own memory manager
 	CDXLMemoryManager mm(mp);
 	SAX2XMLReader *sax_2_xml_reader = NULL;
@@ -242,6 +262,134 @@ CDXLUtils::GetParseHandlerForDXLFile(CMemoryPool *mp, const CHAR *dxl_filename,
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::GetParseHandlerForDXLBinary
+//
+//	@doc:
+//		Parse the given binary DXL document and return the top-level parser.
+//		The elements of the document are replayed into the parse handlers,
+//		without Xerces.
+//
+//---------------------------------------------------------------------------
+CParseHandlerDXL *
+CDXLUtils::GetParseHandlerForDXLBinary(CMemoryPool *mp, const BYTE *buffer,
+									   ULONG size)
+{
+	GPOS_ASSERT(NULL != mp);
+	GPOS_ASSERT(NULL != buffer);
+
+	CDXLBinaryReader binary_reader(mp, buffer, size);
+
+	CDXLMemoryManager mm(mp);
+	CParseHandlerManager parse_handler_mgr(&mm, NULL /*sax_2_xml_reader*/);
+	CAutoP<CParseHandlerDXL> parse_handler_dxl(
+		CParseHandlerFactory::GetParseHandlerDXL(mp, &parse_handler_mgr));
+	parse_handler_mgr.ActivateParseHandler(parse_handler_dxl.Value());
+
+	binary_reader.Parse(&parse_handler_mgr);
+
+	GPOS_CHECK_ABORT;
+
+	return parse_handler_dxl.Reset();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::ConvertDXLToBinary
+//
+//	@doc:
+//		Convert the given DXL document into a binary DXL document. The
+//		function allocates the returned buffer in the provided memory pool,
+//		and it is the responsibility of the caller to deallocate it.
+//
+//---------------------------------------------------------------------------
+BYTE *
+CDXLUtils::ConvertDXLToBinary(CMemoryPool *mp, const CHAR *dxl_string,
+							  ULONG *size)
+{
+	GPOS_ASSERT(NULL != mp);
+	GPOS_ASSERT(NULL != dxl_string);
+	GPOS_ASSERT(NULL != size);
+
+	// we need to disable OOM simulation here, otherwise xerces throws ABORT signal
+	CAutoTraceFlag auto_trace_flg1(EtraceSimulateOOM, false);
+	CAutoTraceFlag auto_trace_flg2(EtraceSimulateAbort, false);
+
+	CDXLMemoryManager mm(mp);
+	SAX2XMLReader *sax_2_xml_reader = XMLReaderFactory::createXMLReader(&mm);
+
+	// report the namespace declarations as attributes, so that they are
+	// kept in the binary document
+	sax_2_xml_reader->setFeature(XMLUni::fgSAX2CoreNameSpaces, true);
+	sax_2_xml_reader->setFeature(XMLUni::fgSAX2CoreNameSpacePrefixes, true);
+
+	CDXLBinaryWriter binary_writer(mp);
+	sax_2_xml_reader->setContentHandler(&binary_writer);
+	sax_2_xml_reader->setErrorHandler(&binary_writer);
+
+	MemBufInputSource input_src_memory_buffer(
+		(const XMLByte *) dxl_string, strlen(dxl_string), "dxl binary", false,
+		&mm);
+
+	try
+	{
+		sax_2_xml_reader->parse(input_src_memory_buffer);
+	}
+	catch (const XMLException &)
+	{
+		delete sax_2_xml_reader;
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLXercesParseError);
+	}
+	catch (const SAXParseException &)
+	{
+		delete sax_2_xml_reader;
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLXercesParseError);
+	}
+	catch (const SAXException &)
+	{
+		delete sax_2_xml_reader;
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLXercesParseError);
+	}
+
+	delete sax_2_xml_reader;
+
+	binary_writer.Finish();
+
+	*size = binary_writer.Size();
+	BYTE *buffer = GPOS_NEW_ARRAY(mp, BYTE, *size);
+	clib::Memcpy(buffer, binary_writer.GetBuffer(), *size);
+
+	return buffer;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::ConvertBinaryToDXL
+//
+//	@doc:
+//		Convert the given binary DXL document into a DXL document
+//
+//---------------------------------------------------------------------------
+CWStringDynamic *
+CDXLUtils::ConvertBinaryToDXL(CMemoryPool *mp, const BYTE *buffer, ULONG size,
+							  BOOL indentation)
+{
+	GPOS_ASSERT(NULL != mp);
+	GPOS_ASSERT(NULL != buffer);
+
+	CDXLBinaryReader binary_reader(mp, buffer, size);
+
+	CAutoP<CWStringDynamic> dxl_string(GPOS_NEW(mp) CWStringDynamic(mp));
+	COstreamString oss(dxl_string.Value());
+
+	CXMLSerializer xml_serializer(mp, oss, indentation);
+	xml_serializer.StartDocument();
+	binary_reader.Serialize(&xml_serializer);
+
+	return dxl_string.Reset();
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLUtils::GetParseHandlerForDXLString
@@ -979,6 +1127,55 @@ CDXLUtils::SerializeMetadata(CMemoryPool *mp,
 	return;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLUtils::SerializeMetadataToBinary
+//
+//	@doc:
+//		Serialize a list of MD objects into a binary DXL document. The
+//		function allocates the returned buffer in the provided memory pool,
+//		and it is the responsibility of the caller to deallocate it.
+//
+//---------------------------------------------------------------------------
+BYTE *
+CDXLUtils::SerializeMetadataToBinary(CMemoryPool *mp,
+									 const IMDCacheObjectArray *imd_obj_array,
+									 ULONG *size)
+{
+	GPOS_ASSERT(NULL != mp);
+	GPOS_ASSERT(NULL != imd_obj_array);
+	GPOS_ASSERT(NULL != size);
+
+	CDXLBinaryWriter binary_writer(mp);
+	{
+		CXMLSerializer xml_serializer(mp, &binary_writer);
+		SerializeHeader(mp, &xml_serializer);
+
+		xml_serializer.OpenElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenMetadata));
+
+		for (ULONG ul = 0; ul < imd_obj_array->Size(); ul++)
+		{
+			IMDCacheObject *imd_cache_obj = (*imd_obj_array)[ul];
+			imd_cache_obj->Serialize(&xml_serializer);
+		}
+
+		xml_serializer.CloseElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenMetadata));
+
+		SerializeFooter(&xml_serializer);
+	}
+	binary_writer.Finish();
+
+	*size = binary_writer.Size();
+	BYTE *buffer = GPOS_NEW_ARRAY(mp, BYTE, *size);
+	clib::Memcpy(buffer, binary_writer.GetBuffer(), *size);
+
+	return buffer;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDXLUtils::SerializeMetadata
@@ -1785,6 +1982,36 @@ CDXLUtils::Read(CMemoryPool *mp, const CHAR *filename)
 	return read_buffer.RgtReset();
 }
 
+//---------------------------------------------------------------------------
+//		CDXLUtils::ReadBytes
+//
+//	@doc:
+//		Read a given file in a byte buffer, e.g. a binary DXL document.
+//		The function allocates memory from the provided memory pool, and it is
+//		the responsibility of the caller to deallocate it.
+//
+//---------------------------------------------------------------------------
+BYTE *
+CDXLUtils::ReadBytes(CMemoryPool *mp, const CHAR *filename, ULONG *size)
+{
+	GPOS_ASSERT(NULL != size);
+
+	CFileReader fr;
+	fr.Open(filename);
+
+	ULONG_PTR file_size = (ULONG_PTR) fr.FileSize();
+	CAutoRg<BYTE> read_buffer(GPOS_NEW_ARRAY(mp, BYTE, file_size));
+
+	ULONG_PTR read_bytes = fr.ReadBytesToBuffer(read_buffer.Rgt(), file_size);
+	fr.Close();
+
+	GPOS_ASSERT(read_bytes == file_size);
+
+	*size = (ULONG) read_bytes;
+
+	return read_buffer.RgtReset();
+}
+
 #ifdef GPOS_DEBUG
 //---------------------------------------------------------------------------
 //	@function:
@@ -17,6 +17,7 @@
 
 #include "naucrates/dxl/CDXLUtils.h"
 #include "naucrates/dxl/xml/CXMLSerializer.h"
+#include "naucrates/statistics/CHLLSketch.h"
 #include "naucrates/statistics/CStatistics.h"
 
 using namespace gpdxl;
@@ -34,7 +35,8 @@ CDXLColStats::CDXLColStats(CMemoryPool *mp, CMDIdColStats *mdid_col_stats,
 						   CMDName *mdname, CDouble width, CDouble null_freq,
 						   CDouble distinct_remaining, CDouble freq_remaining,
 						   CDXLBucketArray *dxl_stats_bucket_array,
-						   BOOL is_col_stats_missing)
+						   BOOL is_col_stats_missing,
+						   CHLLSketch *hll_sketch)
 	: m_mp(mp),
 	  m_mdid_col_stats(mdid_col_stats),
 	  m_mdname(mdname),
@@ -43,7 +45,8 @@ CDXLColStats::CDXLColStats(CMemoryPool *mp, CMDIdColStats *mdid_col_stats,
 	  m_distinct_remaining(distinct_remaining),
 	  m_freq_remaining(freq_remaining),
 	  m_dxl_stats_bucket_array(dxl_stats_bucket_array),
-	  m_is_col_stats_missing(is_col_stats_missing)
+	  m_is_col_stats_missing(is_col_stats_missing),
+	  m_hll_sketch(hll_sketch)
 {
 	GPOS_ASSERT(mdid_col_stats->IsValid());
 	GPOS_ASSERT(NULL != dxl_stats_bucket_array);
@@ -65,6 +68,7 @@ CDXLColStats::~CDXLColStats()
 	GPOS_DELETE(m_dxl_str);
 	m_mdid_col_stats->Release();
 	m_dxl_stats_bucket_array->Release();
+	CRefCount::SafeRelease(m_hll_sketch);
 }
 
 //---------------------------------------------------------------------------
@@ -169,6 +173,10 @@ CDXLColStats::Serialize(CXMLSerializer *xml_serializer) const
 	xml_serializer->AddAttribute(
 		CDXLTokens::GetDXLTokenStr(EdxltokenColStatsMissing),
 		m_is_col_stats_missing);
+	if (NULL != m_hll_sketch)
+	{
+		m_hll_sketch->Serialize(xml_serializer);
+	}
 
 	GPOS_CHECK_ABORT;
 
@@ -211,6 +219,12 @@ CDXLColStats::DebugPrint(IOstream &os) const
 		const CDXLBucket *dxl_bucket = GetDXLBucketAt(ul);
 		dxl_bucket->DebugPrint(os);
 	}
+
+	if (NULL != m_hll_sketch)
+	{
+		m_hll_sketch->OsPrint(os);
+		os << std::endl;
+	}
 }
 
 #endif	// GPOS_DEBUG
@@ -235,7 +249,8 @@ CDXLColStats::CreateDXLDummyColStats(CMemoryPool *mp, IMDId *mdid,
 	dxl_col_stats = GPOS_NEW(mp) CDXLColStats(
 		mp, mdid_col_stats, mdname, width, CHistogram::DefaultNullFreq,
 		CHistogram::DefaultNDVRemain, CHistogram::DefaultNDVFreqRemain,
-		dxl_bucket_array.Value(), true /* is_col_stats_missing */
+		dxl_bucket_array.Value(), true /* is_col_stats_missing */,
+		NULL /* hll_sketch */
 	);
 	dxl_bucket_array.Reset();
 	return dxl_col_stats.Reset();
@@ -0,0 +1,150 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLColumnGroupStats.cpp
+//
+//	@doc:
+//		Implementation of the class for representing the statistics of a
+//		group of columns in DXL
+//---------------------------------------------------------------------------
+
+
+#include "naucrates/md/CDXLColumnGroupStats.h"
+
+#include "gpos/string/CWStringDynamic.h"
+
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+
+using namespace gpdxl;
+using namespace gpmd;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLColumnGroupStats::CDXLColumnGroupStats
+//
+//	@doc:
+//		Constructor
+//
+//---------------------------------------------------------------------------
+CDXLColumnGroupStats::CDXLColumnGroupStats(
+	IntPtrArray *attnos, CDouble distinct,
+	CDynamicPtrArray<CDouble, CleanupDelete> *dependency_degrees)
+	: m_attnos(attnos),
+	  m_distinct(distinct),
+	  m_dependency_degrees(dependency_degrees)
+{
+	GPOS_ASSERT(NULL != attnos);
+	GPOS_ASSERT(NULL != dependency_degrees);
+	GPOS_ASSERT(1 < attnos->Size());
+	GPOS_ASSERT(attnos->Size() == dependency_degrees->Size());
+	GPOS_ASSERT(m_distinct >= 0);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLColumnGroupStats::~CDXLColumnGroupStats
+//
+//	@doc:
+//		Destructor
+//
+//---------------------------------------------------------------------------
+CDXLColumnGroupStats::~CDXLColumnGroupStats()
+{
+	m_attnos->Release();
+	m_dependency_degrees->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLColumnGroupStats::GetDependencyDegree
+//
+//	@doc:
+//		Returns the degree to which the column at the given position is
+//		determined by the other columns of the group
+//
+//---------------------------------------------------------------------------
+CDouble
+CDXLColumnGroupStats::GetDependencyDegree(ULONG pos) const
+{
+	return *(*m_dependency_degrees)[pos];
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLColumnGroupStats::Serialize
+//
+//	@doc:
+//		Serialize the column group statistics in DXL format
+//
+//---------------------------------------------------------------------------
+void
+CDXLColumnGroupStats::Serialize(CXMLSerializer *xml_serializer) const
+{
+	xml_serializer->OpenElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenColumnGroupStats));
+
+	CWStringDynamic *attnos_str =
+		CDXLUtils::Serialize(xml_serializer->Pmp(), m_attnos);
+	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenColumns),
+								 attnos_str);
+	GPOS_DELETE(attnos_str);
+
+	xml_serializer->SetFullPrecision(true);
+	xml_serializer->AddAttribute(
+		CDXLTokens::GetDXLTokenStr(EdxltokenStatsDistinct), m_distinct);
+
+	const ULONG size = m_attnos->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		xml_serializer->OpenElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenFunctionalDependency));
+		xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenAttno),
+									 *(*m_attnos)[ul]);
+		xml_serializer->AddAttribute(
+			CDXLTokens::GetDXLTokenStr(EdxltokenDependencyDegree),
+			*(*m_dependency_degrees)[ul]);
+		xml_serializer->CloseElement(
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+			CDXLTokens::GetDXLTokenStr(EdxltokenFunctionalDependency));
+	}
+	xml_serializer->SetFullPrecision(false);
+
+	xml_serializer->CloseElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenColumnGroupStats));
+
+	GPOS_CHECK_ABORT;
+}
+
+#ifdef GPOS_DEBUG
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLColumnGroupStats::DebugPrint
+//
+//	@doc:
+//		Debug print of the column group statistics
+//
+//---------------------------------------------------------------------------
+void
+CDXLColumnGroupStats::DebugPrint(IOstream &os) const
+{
+	os << "Columns: (";
+	const ULONG size = m_attnos->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		os << *(*m_attnos)[ul] << ": " << GetDependencyDegree(ul);
+		if (ul < size - 1)
+		{
+			os << ", ";
+		}
+	}
+	os << ") Distinct: " << m_distinct << std::endl;
+}
+#endif	// GPOS_DEBUG
+
+// EOF
@@ -0,0 +1,206 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLExtStats.cpp
+//
+//	@doc:
+//		Implementation of the class for representing the extended statistics
+//		of a relation in DXL
+//---------------------------------------------------------------------------
+
+
+#include "naucrates/md/CDXLExtStats.h"
+
+#include "gpos/common/CAutoP.h"
+#include "gpos/common/CAutoRef.h"
+#include "gpos/string/CWStringDynamic.h"
+
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+
+using namespace gpdxl;
+using namespace gpmd;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLExtStats::CDXLExtStats
+//
+//	@doc:
+//		Constructor
+//
+//---------------------------------------------------------------------------
+CDXLExtStats::CDXLExtStats(CMemoryPool *mp, CMDIdExtStats *ext_stats_mdid,
+						   CMDName *mdname,
+						   CDXLColumnGroupStatsArray *column_groups)
+	: m_mp(mp),
+	  m_ext_stats_mdid(ext_stats_mdid),
+	  m_mdname(mdname),
+	  m_column_groups(column_groups)
+{
+	GPOS_ASSERT(ext_stats_mdid->IsValid());
+	GPOS_ASSERT(NULL != column_groups);
+	m_dxl_str = CDXLUtils::SerializeMDObj(
+		m_mp, this, false /*fSerializeHeader*/, false /*indentation*/);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLExtStats::~CDXLExtStats
+//
+//	@doc:
+//		Destructor
+//
+//---------------------------------------------------------------------------
+CDXLExtStats::~CDXLExtStats()
+{
+	GPOS_DELETE(m_mdname);
+	GPOS_DELETE(m_dxl_str);
+	m_ext_stats_mdid->Release();
+	m_column_groups->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLExtStats::MDId
+//
+//	@doc:
+//		Returns the metadata id of this extended stats object
+//
+//---------------------------------------------------------------------------
+IMDId *
+CDXLExtStats::MDId() const
+{
+	return m_ext_stats_mdid;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLExtStats::Mdname
+//
+//	@doc:
+//		Returns the name of the relation
+//
+//---------------------------------------------------------------------------
+CMDName
+CDXLExtStats::Mdname() const
+{
+	return *m_mdname;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLExtStats::GetStrRepr
+//
+//	@doc:
+//		Returns the DXL string for this object
+//
+//---------------------------------------------------------------------------
+const CWStringDynamic *
+CDXLExtStats::GetStrRepr() const
+{
+	return m_dxl_str;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLExtStats::GetColumnGroupStats
+//
+//	@doc:
+//		Returns the statistics of the column group at the given position
+//
+//---------------------------------------------------------------------------
+const CDXLColumnGroupStats *
+CDXLExtStats::GetColumnGroupStats(ULONG pos) const
+{
+	return (*m_column_groups)[pos];
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLExtStats::Serialize
+//
+//	@doc:
+//		Serialize extended stats in DXL format
+//
+//---------------------------------------------------------------------------
+void
+CDXLExtStats::Serialize(CXMLSerializer *xml_serializer) const
+{
+	xml_serializer->OpenElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenExtendedStats));
+
+	m_ext_stats_mdid->Serialize(xml_serializer,
+								CDXLTokens::GetDXLTokenStr(EdxltokenMdid));
+	xml_serializer->AddAttribute(CDXLTokens::GetDXLTokenStr(EdxltokenName),
+								 m_mdname->GetMDName());
+
+	const ULONG size = m_column_groups->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		(*m_column_groups)[ul]->Serialize(xml_serializer);
+	}
+
+	xml_serializer->CloseElement(
+		CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix),
+		CDXLTokens::GetDXLTokenStr(EdxltokenExtendedStats));
+
+	GPOS_CHECK_ABORT;
+}
+
+
+
+#ifdef GPOS_DEBUG
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLExtStats::DebugPrint
+//
+//	@doc:
+//		Prints the extended stats to the provided output
+//
+//---------------------------------------------------------------------------
+void
+CDXLExtStats::DebugPrint(IOstream &os) const
+{
+	os << "Extended statistics id: ";
+	MDId()->OsPrint(os);
+	os << std::endl;
+
+	os << "Relation name: " << (Mdname()).GetMDName()->GetBuffer() << std::endl;
+
+	const ULONG size = m_column_groups->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		(*m_column_groups)[ul]->DebugPrint(os);
+	}
+}
+
+#endif	// GPOS_DEBUG
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLExtStats::CreateDXLDummyExtStats
+//
+//	@doc:
+//		Dummy extended stats, without any column group
+//
+//---------------------------------------------------------------------------
+CDXLExtStats *
+CDXLExtStats::CreateDXLDummyExtStats(CMemoryPool *mp, IMDId *mdid)
+{
+	CMDIdExtStats *ext_stats_mdid = CMDIdExtStats::CastMdid(mdid);
+	CAutoP<CWStringDynamic> str;
+	str = GPOS_NEW(mp) CWStringDynamic(mp, ext_stats_mdid->GetBuffer());
+	CAutoP<CMDName> mdname;
+	mdname = GPOS_NEW(mp) CMDName(mp, str.Value());
+	CAutoRef<CDXLExtStats> ext_stats_dxl;
+	ext_stats_dxl = GPOS_NEW(mp)
+		CDXLExtStats(mp, ext_stats_mdid, mdname.Value(),
+					 GPOS_NEW(mp) CDXLColumnGroupStatsArray(mp));
+	mdname.Reset();
+	return ext_stats_dxl.Reset();
+}
+
+// EOF
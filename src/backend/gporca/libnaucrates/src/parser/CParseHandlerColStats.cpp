@@ -17,6 +17,7 @@
 #include "naucrates/dxl/parser/CParseHandlerFactory.h"
 #include "naucrates/dxl/parser/CParseHandlerManager.h"
 #include "naucrates/md/CDXLColStats.h"
+#include "naucrates/statistics/CHLLSketch.h"
 
 using namespace gpdxl;
 using namespace gpmd;
@@ -42,7 +43,8 @@ CParseHandlerColStats::CParseHandlerColStats(
 	  m_null_freq(0.0),
 	  m_distinct_remaining(0.0),
 	  m_freq_remaining(0.0),
-	  m_is_column_stats_missing(false)
+	  m_is_column_stats_missing(false),
+	  m_hll_sketch(NULL)
 {
 }
 
@@ -129,6 +131,8 @@ CParseHandlerColStats::StartElement(const XMLCh *const element_uri,
 					parsed_is_column_stats_missing, EdxltokenColStatsMissing,
 					EdxltokenColumnStats);
 		}
+
+		ParseHLLSketch(attrs);
 	}
 	else if (0 == XMLString::compareString(
 					  CDXLTokens::XmlstrToken(EdxltokenColumnStatsBucket),
@@ -155,6 +159,54 @@ CParseHandlerColStats::StartElement(const XMLCh *const element_uri,
 	}
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerColStats::ParseHLLSketch
+//
+//	@doc:
+//		Parse the optional HyperLogLog sketch of the column: its precision,
+//		and its registers encoded in base 64
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerColStats::ParseHLLSketch(const Attributes &attrs)
+{
+	const XMLCh *parsed_precision =
+		attrs.getValue(CDXLTokens::XmlstrToken(EdxltokenColHLLPrecision));
+	if (NULL == parsed_precision)
+	{
+		return;
+	}
+
+	ULONG precision = CDXLOperatorFactory::ConvertAttrValueToUlong(
+		m_parse_handler_mgr->GetDXLMemoryManager(), parsed_precision,
+		EdxltokenColHLLPrecision, EdxltokenColumnStats);
+	if (CHLLSketch::MinPrecision > precision ||
+		CHLLSketch::MaxPrecision < precision)
+	{
+		GPOS_RAISE(
+			gpdxl::ExmaDXL, gpdxl::ExmiDXLInvalidAttributeValue,
+			CDXLTokens::GetDXLTokenStr(EdxltokenColHLLPrecision)->GetBuffer(),
+			CDXLTokens::GetDXLTokenStr(EdxltokenColumnStats)->GetBuffer());
+	}
+
+	const XMLCh *parsed_registers = CDXLOperatorFactory::ExtractAttrValue(
+		attrs, EdxltokenColHLLRegisters, EdxltokenColumnStats);
+	ULONG length = 0;
+	BYTE *registers = CDXLUtils::CreateStringFrom64XMLStr(
+		m_parse_handler_mgr->GetDXLMemoryManager(), parsed_registers, &length);
+	if (NULL == registers || (ULONG(1) << precision) != length)
+	{
+		GPOS_DELETE_ARRAY(registers);
+		GPOS_RAISE(
+			gpdxl::ExmaDXL, gpdxl::ExmiDXLInvalidAttributeValue,
+			CDXLTokens::GetDXLTokenStr(EdxltokenColHLLRegisters)->GetBuffer(),
+			CDXLTokens::GetDXLTokenStr(EdxltokenColumnStats)->GetBuffer());
+	}
+
+	m_hll_sketch = GPOS_NEW(m_mp) CHLLSketch(m_mp, precision, registers);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CParseHandlerColStats::EndElement
@@ -198,7 +250,8 @@ CParseHandlerColStats::EndElement(const XMLCh *const,  // element_uri,
 
 	m_imd_obj = GPOS_NEW(m_mp) CDXLColStats(
 		m_mp, m_mdid, m_md_name, m_width, m_null_freq, m_distinct_remaining,
-		m_freq_remaining, dxl_stats_bucket_array, m_is_column_stats_missing);
+		m_freq_remaining, dxl_stats_bucket_array, m_is_column_stats_missing,
+		m_hll_sketch);
 
 	// deactivate handler
 	m_parse_handler_mgr->DeactivateHandler();
@@ -0,0 +1,221 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CParseHandlerExtStats.cpp
+//
+//	@doc:
+//		Implementation of the SAX parse handler class for parsing extended
+//		relation statistics.
+//---------------------------------------------------------------------------
+
+#include "naucrates/dxl/parser/CParseHandlerExtStats.h"
+
+#include "naucrates/dxl/operators/CDXLOperatorFactory.h"
+#include "naucrates/dxl/parser/CParseHandlerFactory.h"
+#include "naucrates/dxl/parser/CParseHandlerManager.h"
+#include "naucrates/md/CDXLExtStats.h"
+
+using namespace gpdxl;
+using namespace gpmd;
+using namespace gpnaucrates;
+
+XERCES_CPP_NAMESPACE_USE
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerExtStats::CParseHandlerExtStats
+//
+//	@doc:
+//		Constructor
+//
+//---------------------------------------------------------------------------
+CParseHandlerExtStats::CParseHandlerExtStats(
+	CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
+	CParseHandlerBase *parse_handler_root)
+	: CParseHandlerMetadataObject(mp, parse_handler_mgr, parse_handler_root),
+	  m_mdid(NULL),
+	  m_mdname(NULL),
+	  m_column_groups(NULL),
+	  m_attnos(NULL),
+	  m_distinct(0.0),
+	  m_dependency_degrees(NULL)
+{
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerExtStats::~CParseHandlerExtStats
+//
+//	@doc:
+//		Destructor; releases what was parsed when the object could not be
+//		built
+//
+//---------------------------------------------------------------------------
+CParseHandlerExtStats::~CParseHandlerExtStats()
+{
+	CRefCount::SafeRelease(m_mdid);
+	GPOS_DELETE(m_mdname);
+	CRefCount::SafeRelease(m_column_groups);
+	CRefCount::SafeRelease(m_attnos);
+	CRefCount::SafeRelease(m_dependency_degrees);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerExtStats::StartElement
+//
+//	@doc:
+//		Invoked by Xerces to process an opening tag
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerExtStats::StartElement(const XMLCh *const,	 // element_uri,
+									const XMLCh *const element_local_name,
+									const XMLCh *const,	 // element_qname,
+									const Attributes &attrs)
+{
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenExtendedStats),
+				 element_local_name))
+	{
+		GPOS_ASSERT(NULL == m_mdid);
+
+		// parse table name
+		const XMLCh *xml_str_table_name = CDXLOperatorFactory::ExtractAttrValue(
+			attrs, EdxltokenName, EdxltokenExtendedStats);
+
+		CWStringDynamic *str_table_name =
+			CDXLUtils::CreateDynamicStringFromXMLChArray(
+				m_parse_handler_mgr->GetDXLMemoryManager(), xml_str_table_name);
+
+		// create a copy of the string in the CMDName constructor
+		m_mdname = GPOS_NEW(m_mp) CMDName(m_mp, str_table_name);
+
+		GPOS_DELETE(str_table_name);
+
+		// parse metadata id info
+		m_mdid = CDXLOperatorFactory::ExtractConvertAttrValueToMdId(
+			m_parse_handler_mgr->GetDXLMemoryManager(), attrs, EdxltokenMdid,
+			EdxltokenExtendedStats);
+
+		m_column_groups = GPOS_NEW(m_mp) CDXLColumnGroupStatsArray(m_mp);
+	}
+	else if (0 == XMLString::compareString(
+					  CDXLTokens::XmlstrToken(EdxltokenColumnGroupStats),
+					  element_local_name))
+	{
+		GPOS_ASSERT(NULL != m_column_groups);
+		GPOS_ASSERT(NULL == m_attnos);
+
+		const XMLCh *xml_str_attnos = CDXLOperatorFactory::ExtractAttrValue(
+			attrs, EdxltokenColumns, EdxltokenColumnGroupStats);
+		m_attnos = CDXLOperatorFactory::ExtractIntsToIntArray(
+			m_parse_handler_mgr->GetDXLMemoryManager(), xml_str_attnos,
+			EdxltokenColumns, EdxltokenColumnGroupStats);
+
+		m_distinct = CDXLOperatorFactory::ExtractConvertAttrValueToDouble(
+			m_parse_handler_mgr->GetDXLMemoryManager(), attrs,
+			EdxltokenStatsDistinct, EdxltokenColumnGroupStats);
+
+		m_dependency_degrees =
+			GPOS_NEW(m_mp) CDynamicPtrArray<CDouble, CleanupDelete>(m_mp);
+	}
+	else if (0 == XMLString::compareString(
+					  CDXLTokens::XmlstrToken(EdxltokenFunctionalDependency),
+					  element_local_name))
+	{
+		GPOS_ASSERT(NULL != m_attnos);
+
+		// dependencies are listed in the order of the columns of the group
+		INT attno = CDXLOperatorFactory::ExtractConvertAttrValueToInt(
+			m_parse_handler_mgr->GetDXLMemoryManager(), attrs, EdxltokenAttno,
+			EdxltokenFunctionalDependency);
+		const ULONG pos = m_dependency_degrees->Size();
+		if (pos >= m_attnos->Size() || attno != *(*m_attnos)[pos])
+		{
+			GPOS_RAISE(
+				gpdxl::ExmaDXL, gpdxl::ExmiDXLInvalidAttributeValue,
+				CDXLTokens::GetDXLTokenStr(EdxltokenAttno)->GetBuffer(),
+				CDXLTokens::GetDXLTokenStr(EdxltokenFunctionalDependency)
+					->GetBuffer());
+		}
+
+		CDouble degree = CDXLOperatorFactory::ExtractConvertAttrValueToDouble(
+			m_parse_handler_mgr->GetDXLMemoryManager(), attrs,
+			EdxltokenDependencyDegree, EdxltokenFunctionalDependency);
+		m_dependency_degrees->Append(GPOS_NEW(m_mp) CDouble(degree));
+	}
+	else
+	{
+		CWStringDynamic *str = CDXLUtils::CreateDynamicStringFromXMLChArray(
+			m_parse_handler_mgr->GetDXLMemoryManager(), element_local_name);
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag,
+				   str->GetBuffer());
+	}
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParseHandlerExtStats::EndElement
+//
+//	@doc:
+//		Invoked by Xerces to process a closing tag
+//
+//---------------------------------------------------------------------------
+void
+CParseHandlerExtStats::EndElement(const XMLCh *const,  // element_uri,
+								  const XMLCh *const element_local_name,
+								  const XMLCh *const  // element_qname
+)
+{
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenFunctionalDependency),
+				 element_local_name))
+	{
+		return;
+	}
+
+	if (0 == XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenColumnGroupStats),
+				 element_local_name))
+	{
+		if (m_attnos->Size() != m_dependency_degrees->Size() ||
+			2 > m_attnos->Size())
+		{
+			GPOS_RAISE(
+				gpdxl::ExmaDXL, gpdxl::ExmiDXLInvalidAttributeValue,
+				CDXLTokens::GetDXLTokenStr(EdxltokenColumns)->GetBuffer(),
+				CDXLTokens::GetDXLTokenStr(EdxltokenColumnGroupStats)
+					->GetBuffer());
+		}
+
+		m_column_groups->Append(GPOS_NEW(m_mp) CDXLColumnGroupStats(
+			m_attnos, m_distinct, m_dependency_degrees));
+		m_attnos = NULL;
+		m_dependency_degrees = NULL;
+		return;
+	}
+
+	if (0 != XMLString::compareString(
+				 CDXLTokens::XmlstrToken(EdxltokenExtendedStats),
+				 element_local_name))
+	{
+		CWStringDynamic *str = CDXLUtils::CreateDynamicStringFromXMLChArray(
+			m_parse_handler_mgr->GetDXLMemoryManager(), element_local_name);
+		GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLUnexpectedTag,
+				   str->GetBuffer());
+	}
+
+	m_imd_obj = GPOS_NEW(m_mp) CDXLExtStats(
+		m_mp, CMDIdExtStats::CastMdid(m_mdid), m_mdname, m_column_groups);
+	m_mdid = NULL;
+	m_mdname = NULL;
+	m_column_groups = NULL;
+
+	// deactivate handler
+	m_parse_handler_mgr->DeactivateHandler();
+}
+
+// EOF
@@ -76,6 +76,7 @@ CParseHandlerFactory::Init(CMemoryPool *mp)
 		{EdxltokenGPDBTrigger, &CreateMDTriggerParseHandler},
 		{EdxltokenCheckConstraint, &CreateMDChkConstraintParseHandler},
 		{EdxltokenRelationStats, &CreateRelStatsParseHandler},
+		{EdxltokenExtendedStats, &CreateExtStatsParseHandler},
 		{EdxltokenColumnStats, &CreateColStatsParseHandler},
 		{EdxltokenMetadataIdList, &CreateMDIdListParseHandler},
 		{EdxltokenIndexInfoList, &CreateMDIndexInfoListParseHandler},
@@ -502,6 +503,16 @@ CParseHandlerFactory::CreateRelStatsParseHandler(
 		CParseHandlerRelStats(mp, parse_handler_mgr, parse_handler_root);
 }
 
+// creates a parse handler for parsing extended relation stats
+CParseHandlerBase *
+CParseHandlerFactory::CreateExtStatsParseHandler(
+	CMemoryPool *mp, CParseHandlerManager *parse_handler_mgr,
+	CParseHandlerBase *parse_handler_root)
+{
+	return GPOS_NEW(mp)
+		CParseHandlerExtStats(mp, parse_handler_mgr, parse_handler_root);
+}
+
 // creates a parse handler for parsing column stats
 CParseHandlerBase *
 CParseHandlerFactory::CreateColStatsParseHandler(
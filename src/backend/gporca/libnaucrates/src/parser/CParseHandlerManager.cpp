@@ -24,7 +24,8 @@ XERCES_CPP_NAMESPACE_USE
 //		CParseHandlerManager::CParseHandlerManager
 //
 //	@doc:
-//		Constructor
+//		Constructor. The XML reader is NULL when the events come from a
+//		binary DXL document instead.
 //
 //---------------------------------------------------------------------------
 CParseHandlerManager::CParseHandlerManager(
@@ -75,8 +76,11 @@ CParseHandlerManager::ActivateParseHandler(
 	GPOS_ASSERT(NULL != parse_handler_base);
 
 	m_curr_parse_handler = parse_handler_base;
-	m_xml_reader->setContentHandler(parse_handler_base);
-	m_xml_reader->setErrorHandler(parse_handler_base);
+	if (NULL != m_xml_reader)
+	{
+		m_xml_reader->setContentHandler(parse_handler_base);
+		m_xml_reader->setErrorHandler(parse_handler_base);
+	}
 }
 
 //---------------------------------------------------------------------------
@@ -103,8 +107,11 @@ CParseHandlerManager::ReplaceHandler(CParseHandlerBase *parse_handler_base,
 	}
 
 	m_curr_parse_handler = parse_handler_base;
-	m_xml_reader->setContentHandler(parse_handler_base);
-	m_xml_reader->setErrorHandler(parse_handler_base);
+	if (NULL != m_xml_reader)
+	{
+		m_xml_reader->setContentHandler(parse_handler_base);
+		m_xml_reader->setErrorHandler(parse_handler_base);
+	}
 }
 
 
@@ -133,8 +140,11 @@ CParseHandlerManager::DeactivateHandler()
 		m_curr_parse_handler = NULL;
 	}
 
-	m_xml_reader->setContentHandler(m_curr_parse_handler);
-	m_xml_reader->setErrorHandler(m_curr_parse_handler);
+	if (NULL != m_xml_reader)
+	{
+		m_xml_reader->setContentHandler(m_curr_parse_handler);
+		m_xml_reader->setErrorHandler(m_curr_parse_handler);
+	}
 }
 
 //---------------------------------------------------------------------------
@@ -145,7 +155,7 @@ CParseHandlerManager::DeactivateHandler()
 //		Returns the current handler
 //
 //---------------------------------------------------------------------------
-const CParseHandlerBase *
+CParseHandlerBase *
 CParseHandlerManager::GetCurrentParseHandler()
 {
 	return m_curr_parse_handler;
@@ -0,0 +1,436 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CBucketBounds.cpp
+//
+//	@doc:
+//		Implementation of the flat representation of histogram bucket bounds
+//---------------------------------------------------------------------------
+
+#include "naucrates/statistics/CBucketBounds.h"
+
+#include "naucrates/base/IDatum.h"
+#include "naucrates/statistics/CStatistics.h"
+
+using namespace gpnaucrates;
+
+// largest magnitude of a LINT that is represented exactly by a double
+#define GPNAUCRATES_BUCKET_BOUNDS_MAX_LINT (LINT(1) << 53)
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBucketBounds::CBucketBounds
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CBucketBounds::CBucketBounds(CMemoryPool *mp, ULONG size)
+	: m_mp(mp),
+	  m_size(size),
+	  m_lower(NULL),
+	  m_upper(NULL),
+	  m_is_lower_closed(NULL),
+	  m_is_upper_closed(NULL),
+	  m_is_lint(false),
+	  m_mdid(NULL)
+{
+	m_lower = GPOS_NEW_ARRAY(m_mp, DOUBLE, std::max(size, (ULONG) 1));
+	m_upper = GPOS_NEW_ARRAY(m_mp, DOUBLE, std::max(size, (ULONG) 1));
+	m_is_lower_closed = GPOS_NEW_ARRAY(m_mp, BOOL, std::max(size, (ULONG) 1));
+	m_is_upper_closed = GPOS_NEW_ARRAY(m_mp, BOOL, std::max(size, (ULONG) 1));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBucketBounds::~CBucketBounds
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CBucketBounds::~CBucketBounds()
+{
+	GPOS_DELETE_ARRAY(m_lower);
+	GPOS_DELETE_ARRAY(m_upper);
+	GPOS_DELETE_ARRAY(m_is_lower_closed);
+	GPOS_DELETE_ARRAY(m_is_upper_closed);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBucketBounds::FMapBound
+//
+//	@doc:
+//		Map a bound to a double. LINT values are preferred over doubles,
+//		as IDatum does when comparing statistics, and all bounds must take
+//		the same route and be of the same type
+//
+//---------------------------------------------------------------------------
+BOOL
+CBucketBounds::FMapBound(const CPoint *point, DOUBLE *value)
+{
+	IDatum *datum = point->GetDatum();
+	if (datum->IsNull() || !datum->IsDatumMappableToDouble())
+	{
+		return false;
+	}
+
+	if (NULL == m_mdid)
+	{
+		m_mdid = datum->MDId();
+		m_is_lint = datum->IsDatumMappableToLINT();
+	}
+	else if (!m_mdid->Equals(datum->MDId()) ||
+			 m_is_lint != datum->IsDatumMappableToLINT())
+	{
+		return false;
+	}
+
+	if (m_is_lint)
+	{
+		LINT lint_value = datum->GetLINTMapping();
+		if (GPNAUCRATES_BUCKET_BOUNDS_MAX_LINT < lint_value ||
+			-GPNAUCRATES_BUCKET_BOUNDS_MAX_LINT > lint_value)
+		{
+			return false;
+		}
+
+		*value = DOUBLE(lint_value);
+		return true;
+	}
+
+	*value = datum->GetDoubleMapping().Get();
+	return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBucketBounds::PbbCreate
+//
+//	@doc:
+//		Build the bounds of the given buckets, returns NULL if any bound
+//		cannot be mapped
+//
+//---------------------------------------------------------------------------
+CBucketBounds *
+CBucketBounds::PbbCreate(CMemoryPool *mp, const CBucketArray *buckets)
+{
+	GPOS_ASSERT(NULL != buckets);
+
+	const ULONG size = buckets->Size();
+	CBucketBounds *bounds = GPOS_NEW(mp) CBucketBounds(mp, size);
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		CBucket *bucket = (*buckets)[ul];
+		if (!bounds->FMapBound(bucket->GetLowerBound(), &bounds->m_lower[ul]) ||
+			!bounds->FMapBound(bucket->GetUpperBound(), &bounds->m_upper[ul]))
+		{
+			GPOS_DELETE(bounds);
+			return NULL;
+		}
+
+		bounds->m_is_lower_closed[ul] = bucket->IsLowerClosed();
+		bounds->m_is_upper_closed[ul] = bucket->IsUpperClosed();
+	}
+
+	return bounds;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBucketBounds::IsComparable
+//
+//	@doc:
+//		Can the bounds be compared with the given bounds
+//
+//---------------------------------------------------------------------------
+BOOL
+CBucketBounds::IsComparable(const CBucketBounds *other) const
+{
+	GPOS_ASSERT(NULL != other);
+
+	return NULL != m_mdid && NULL != other->m_mdid &&
+		   m_is_lint == other->m_is_lint && m_mdid->Equals(other->m_mdid);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBucketBounds::Equals
+//
+//	@doc:
+//		Equality of mapped values, see IDatum::StatsAreEqual. Distinct LINT
+//		values differ by at least one, so they compare exactly
+//
+//---------------------------------------------------------------------------
+BOOL
+CBucketBounds::Equals(DOUBLE value1, DOUBLE value2)
+{
+	CDouble diff = CDouble(value1) - CDouble(value2);
+	return diff.Absolute() <= CStatistics::Epsilon;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBucketBounds::IsLessThan
+//
+//	@doc:
+//		Less than of mapped values, see IDatum::StatsAreLessThan
+//
+//---------------------------------------------------------------------------
+BOOL
+CBucketBounds::IsLessThan(DOUBLE value1, DOUBLE value2)
+{
+	CDouble diff = CDouble(value2) - CDouble(value1);
+	return diff > CStatistics::Epsilon;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBucketBounds::IsSingleton
+//
+//	@doc:
+//		Is the bucket at the given position a singleton
+//
+//---------------------------------------------------------------------------
+BOOL
+CBucketBounds::IsSingleton(ULONG idx) const
+{
+	GPOS_ASSERT(idx < m_size);
+
+	return Equals(m_lower[idx], m_upper[idx]);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBucketBounds::Contains
+//
+//	@doc:
+//		Does the bucket at the given position contain the given value,
+//		see CBucket::Contains
+//
+//---------------------------------------------------------------------------
+BOOL
+CBucketBounds::Contains(ULONG idx, DOUBLE value) const
+{
+	if (IsSingleton(idx))
+	{
+		return Equals(m_lower[idx], value);
+	}
+
+	if (m_is_lower_closed[idx] && Equals(m_lower[idx], value))
+	{
+		return true;
+	}
+
+	if (m_is_upper_closed[idx] && Equals(m_upper[idx], value))
+	{
+		return true;
+	}
+
+	return IsLessThan(m_lower[idx], value) && IsLessThan(value, m_upper[idx]);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBucketBounds::Subsumes
+//
+//	@doc:
+//		Does the bucket at the given position subsume the other bucket,
+//		see CBucket::Subsumes
+//
+//---------------------------------------------------------------------------
+BOOL
+CBucketBounds::Subsumes(ULONG idx, const CBucketBounds *other,
+						ULONG other_idx) const
+{
+	if (IsSingleton(idx) && other->IsSingleton(other_idx))
+	{
+		return Equals(m_lower[idx], other->m_lower[other_idx]);
+	}
+
+	if (other->IsSingleton(other_idx))
+	{
+		return Contains(idx, other->m_lower[other_idx]);
+	}
+
+	INT lower_bounds_comparison =
+		CompareLowerBounds(this, idx, other, other_idx);
+	INT upper_bounds_comparison =
+		CompareUpperBounds(this, idx, other, other_idx);
+
+	return (0 >= lower_bounds_comparison && 0 <= upper_bounds_comparison);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBucketBounds::CompareLowerBounds
+//
+//	@doc:
+//		Compare lower bounds of two buckets, see CBucket::CompareLowerBounds
+//
+//---------------------------------------------------------------------------
+INT
+CBucketBounds::CompareLowerBounds(const CBucketBounds *bounds1, ULONG idx1,
+								  const CBucketBounds *bounds2, ULONG idx2)
+{
+	DOUBLE value1 = bounds1->m_lower[idx1];
+	DOUBLE value2 = bounds2->m_lower[idx2];
+
+	if (Equals(value1, value2))
+	{
+		BOOL is_closed_point1 = bounds1->m_is_lower_closed[idx1];
+		if (is_closed_point1 == bounds2->m_is_lower_closed[idx2])
+		{
+			return 0;
+		}
+
+		return is_closed_point1 ? -1 : 1;
+	}
+
+	return IsLessThan(value1, value2) ? -1 : 1;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBucketBounds::CompareUpperBounds
+//
+//	@doc:
+//		Compare upper bounds of two buckets, see CBucket::CompareUpperBounds
+//
+//---------------------------------------------------------------------------
+INT
+CBucketBounds::CompareUpperBounds(const CBucketBounds *bounds1, ULONG idx1,
+								  const CBucketBounds *bounds2, ULONG idx2)
+{
+	DOUBLE value1 = bounds1->m_upper[idx1];
+	DOUBLE value2 = bounds2->m_upper[idx2];
+
+	if (Equals(value1, value2))
+	{
+		BOOL is_closed_point1 = bounds1->m_is_upper_closed[idx1];
+		if (is_closed_point1 == bounds2->m_is_upper_closed[idx2])
+		{
+			return 0;
+		}
+
+		return is_closed_point1 ? 1 : -1;
+	}
+
+	return IsLessThan(value1, value2) ? -1 : 1;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBucketBounds::CompareLowerBoundToUpperBound
+//
+//	@doc:
+//		Compare lower bound of first bucket to upper bound of second bucket,
+//		see CBucket::CompareLowerBoundToUpperBound
+//
+//---------------------------------------------------------------------------
+INT
+CBucketBounds::CompareLowerBoundToUpperBound(const CBucketBounds *bounds1,
+											 ULONG idx1,
+											 const CBucketBounds *bounds2,
+											 ULONG idx2)
+{
+	DOUBLE lower_bound_first = bounds1->m_lower[idx1];
+	DOUBLE upper_bound_second = bounds2->m_upper[idx2];
+
+	if (IsLessThan(upper_bound_second, lower_bound_first))
+	{
+		return 1;
+	}
+
+	if (IsLessThan(lower_bound_first, upper_bound_second))
+	{
+		return -1;
+	}
+
+	// equal
+	if (bounds1->m_is_lower_closed[idx1] && bounds2->m_is_upper_closed[idx2])
+	{
+		return 0;
+	}
+
+	return 1;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBucketBounds::Intersects
+//
+//	@doc:
+//		Do the buckets at the given positions intersect, see
+//		CBucket::Intersects
+//
+//---------------------------------------------------------------------------
+BOOL
+CBucketBounds::Intersects(ULONG idx, const CBucketBounds *other,
+						  ULONG other_idx) const
+{
+	GPOS_ASSERT(idx < m_size);
+	GPOS_ASSERT(other_idx < other->m_size);
+
+	BOOL is_singleton = IsSingleton(idx);
+	BOOL is_other_singleton = other->IsSingleton(other_idx);
+
+	if (is_singleton && is_other_singleton)
+	{
+		return Equals(m_lower[idx], other->m_lower[other_idx]);
+	}
+
+	if (is_singleton)
+	{
+		return other->Contains(other_idx, m_lower[idx]);
+	}
+
+	if (is_other_singleton)
+	{
+		return Contains(idx, other->m_lower[other_idx]);
+	}
+
+	if (Subsumes(idx, other, other_idx) ||
+		other->Subsumes(other_idx, this, idx))
+	{
+		return true;
+	}
+
+	if (0 >= CompareLowerBounds(this, idx, other, other_idx))
+	{
+		// current bucket starts before the other bucket
+		return 0 >= CompareLowerBoundToUpperBound(other, other_idx, this, idx);
+	}
+
+	// current bucket starts before the other bucket ends
+	return 0 >= CompareLowerBoundToUpperBound(this, idx, other, other_idx);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CBucketBounds::IsBefore
+//
+//	@doc:
+//		Is the bucket at the given position before the other bucket, see
+//		CBucket::IsBefore
+//
+//---------------------------------------------------------------------------
+BOOL
+CBucketBounds::IsBefore(ULONG idx, const CBucketBounds *other,
+						ULONG other_idx) const
+{
+	if (Intersects(idx, other, other_idx))
+	{
+		return false;
+	}
+
+	DOUBLE upper_bound = m_upper[idx];
+	DOUBLE other_lower_bound = other->m_lower[other_idx];
+	return IsLessThan(upper_bound, other_lower_bound) ||
+		   Equals(upper_bound, other_lower_bound);
+}
+
+// EOF
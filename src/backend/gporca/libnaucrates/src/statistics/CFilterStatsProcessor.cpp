@@ -230,7 +230,7 @@ CFilterStatsProcessor::MakeStatsFilter(CMemoryPool *mp,
 	{
 		histograms_new = MakeHistHashMapConjOrDisjFilter(
 			mp, stats_config, histograms_copy, input_rows, base_pred_stats,
-			&scale_factor);
+			&scale_factor, input_stats->GetColumnGroups());
 
 		GPOS_ASSERT(CStatistics::MinRows.Get() <= scale_factor.Get());
 		rows_filter = input_rows / scale_factor;
@@ -258,16 +258,57 @@ CFilterStatsProcessor::MakeStatsFilter(CMemoryPool *mp,
 		mp, input_stats, filter_stats, rows_filter,
 		CStatistics::EcbmMin /* card_bounding_method */);
 
+	// the number of distinct combinations of a column group changes when
+	// one of its columns is filtered, keep the other groups only
+	CBitSet *pred_colids = GPOS_NEW(mp) CBitSet(mp);
+	AddPredColIds(base_pred_stats, pred_colids);
+	input_stats->CopyColumnGroupsInto(filter_stats, pred_colids);
+	pred_colids->Release();
+
 	return filter_stats;
 }
 
+// add the ids of the columns referenced by a predicate to the given set
+void
+CFilterStatsProcessor::AddPredColIds(CStatsPred *pred_stats, CBitSet *colids)
+{
+	GPOS_ASSERT(NULL != pred_stats);
+	GPOS_ASSERT(NULL != colids);
+
+	if (CStatsPred::EsptConj == pred_stats->GetPredStatsType())
+	{
+		CStatsPredConj *conjunctive_pred_stats =
+			CStatsPredConj::ConvertPredStats(pred_stats);
+		const ULONG num_preds = conjunctive_pred_stats->GetNumPreds();
+		for (ULONG ul = 0; ul < num_preds; ul++)
+		{
+			AddPredColIds(conjunctive_pred_stats->GetPredStats(ul), colids);
+		}
+	}
+	else if (CStatsPred::EsptDisj == pred_stats->GetPredStatsType())
+	{
+		CStatsPredDisj *disjunctive_pred_stats =
+			CStatsPredDisj::ConvertPredStats(pred_stats);
+		const ULONG num_preds = disjunctive_pred_stats->GetNumPreds();
+		for (ULONG ul = 0; ul < num_preds; ul++)
+		{
+			AddPredColIds(disjunctive_pred_stats->GetPredStats(ul), colids);
+		}
+	}
+	else if (gpos::ulong_max != pred_stats->GetColId())
+	{
+		(void) colids->ExchangeSet(pred_stats->GetColId());
+	}
+}
+
 // create a new hash map of histograms after applying a conjunctive
 // or a disjunctive filter
 UlongToHistogramMap *
 CFilterStatsProcessor::MakeHistHashMapConjOrDisjFilter(
 	CMemoryPool *mp, const CStatisticsConfig *stats_config,
 	UlongToHistogramMap *input_histograms, CDouble input_rows,
-	CStatsPred *pred_stats, CDouble *scale_factor)
+	CStatsPred *pred_stats, CDouble *scale_factor,
+	const CStatsColGroupArray *column_groups)
 {
 	GPOS_ASSERT(NULL != pred_stats);
 	GPOS_ASSERT(NULL != stats_config);
@@ -281,7 +322,7 @@ CFilterStatsProcessor::MakeHistHashMapConjOrDisjFilter(
 			CStatsPredConj::ConvertPredStats(pred_stats);
 		return MakeHistHashMapConjFilter(mp, stats_config, input_histograms,
 										 input_rows, conjunctive_pred_stats,
-										 scale_factor);
+										 scale_factor, column_groups);
 	}
 
 	CStatsPredDisj *disjunctive_pred_stats =
@@ -300,7 +341,8 @@ UlongToHistogramMap *
 CFilterStatsProcessor::MakeHistHashMapConjFilter(
 	CMemoryPool *mp, const CStatisticsConfig *stats_config,
 	UlongToHistogramMap *input_histograms, CDouble input_rows,
-	CStatsPredConj *conjunctive_pred_stats, CDouble *scale_factor)
+	CStatsPredConj *conjunctive_pred_stats, CDouble *scale_factor,
+	const CStatsColGroupArray *column_groups)
 {
 	GPOS_ASSERT(NULL != stats_config);
 	GPOS_ASSERT(NULL != input_histograms);
@@ -311,6 +353,11 @@ CFilterStatsProcessor::MakeHistHashMapConjFilter(
 	CBitSet *filter_colids = GPOS_NEW(mp) CBitSet(mp);
 	CDoubleArray *scale_factors = GPOS_NEW(mp) CDoubleArray(mp);
 
+	// column of each scale factor, and the columns with predicates other
+	// than equality, used to account for column groups
+	ULongPtrArray *scale_factor_colids = GPOS_NEW(mp) ULongPtrArray(mp);
+	CBitSet *non_eq_colids = GPOS_NEW(mp) CBitSet(mp);
+
 	// create copy of the original hash map of colid -> histogram
 	UlongToHistogramMap *result_histograms =
 		CStatisticsUtils::CopyHistHashMap(mp, input_histograms);
@@ -338,6 +385,7 @@ CFilterStatsProcessor::MakeHistHashMapConjFilter(
 				CStatsPredUnsupported::ConvertPredStats(child_pred_stats);
 			scale_factors->Append(
 				GPOS_NEW(mp) CDouble(unsupported_pred_stats->ScaleFactor()));
+			scale_factor_colids->Append(GPOS_NEW(mp) ULONG(gpos::ulong_max));
 
 			continue;
 		}
@@ -347,9 +395,19 @@ CFilterStatsProcessor::MakeHistHashMapConjFilter(
 		if (IsNewStatsColumn(colid, last_colid))
 		{
 			scale_factors->Append(GPOS_NEW(mp) CDouble(last_scale_factor));
+			scale_factor_colids->Append(GPOS_NEW(mp) ULONG(last_colid));
 			last_scale_factor = CDouble(1.0);
 		}
 
+		if (gpos::ulong_max != colid &&
+			!(CStatsPred::EsptPoint == child_pred_stats->GetPredStatsType() &&
+			  CStatsPred::EstatscmptEq ==
+				  CStatsPredPoint::ConvertPredStats(child_pred_stats)
+					  ->GetCmpType()))
+		{
+			(void) non_eq_colids->ExchangeSet(colid);
+		}
+
 		if (CStatsPred::EsptDisj != child_pred_stats->GetPredStatsType())
 		{
 			GPOS_ASSERT(gpos::ulong_max != colid);
@@ -437,6 +495,14 @@ CFilterStatsProcessor::MakeHistHashMapConjFilter(
 
 	// scaling factor of the last predicate
 	scale_factors->Append(GPOS_NEW(mp) CDouble(last_scale_factor));
+	scale_factor_colids->Append(GPOS_NEW(mp) ULONG(last_colid));
+
+	if (NULL != column_groups)
+	{
+		AdjustScaleFactorsForColumnGroups(mp, column_groups,
+										  scale_factor_colids, non_eq_colids,
+										  scale_factors);
+	}
 
 	GPOS_ASSERT(NULL != scale_factors);
 	CScaleFactorUtils::SortScalingFactor(scale_factors, true /* fDescending */);
@@ -446,11 +512,83 @@ CFilterStatsProcessor::MakeHistHashMapConjFilter(
 
 	// clean up
 	scale_factors->Release();
+	scale_factor_colids->Release();
+	non_eq_colids->Release();
 	filter_colids->Release();
 
 	return result_histograms;
 }
 
+//	For a column group whose columns all have equality predicates, the
+//	predicate on the column c with the largest dependency degree f is only
+//	selective in the rows where c is not determined by the other columns:
+//	its selectivity s becomes f + (1 - f) * s, given that the predicates on
+//	the other columns hold. The scale factor of c is adjusted accordingly.
+void
+CFilterStatsProcessor::AdjustScaleFactorsForColumnGroups(
+	CMemoryPool *mp, const CStatsColGroupArray *column_groups,
+	const ULongPtrArray *scale_factor_colids, const CBitSet *non_eq_colids,
+	CDoubleArray *scale_factors)
+{
+	GPOS_ASSERT(NULL != column_groups);
+	GPOS_ASSERT(scale_factor_colids->Size() == scale_factors->Size());
+
+	// columns whose scale factor was already adjusted for another group
+	CBitSet *adjusted_colids = GPOS_NEW(mp) CBitSet(mp);
+
+	const ULONG num_column_groups = column_groups->Size();
+	for (ULONG ul = 0; ul < num_column_groups; ul++)
+	{
+		const CStatsColGroup *column_group = (*column_groups)[ul];
+		if (!column_group->IsCoveredBy(scale_factor_colids))
+		{
+			continue;
+		}
+
+		BOOL is_eq_only = true;
+		ULONG best_pos = gpos::ulong_max;
+		CDouble best_degree(0.0);
+		const ULONG size = column_group->Size();
+		for (ULONG pos = 0; is_eq_only && pos < size; pos++)
+		{
+			const ULONG colid = column_group->GetColId(pos);
+			is_eq_only = !non_eq_colids->Get(colid);
+			if (!adjusted_colids->Get(colid) &&
+				column_group->GetDependencyDegree(pos) > best_degree)
+			{
+				best_pos = pos;
+				best_degree = column_group->GetDependencyDegree(pos);
+			}
+		}
+
+		if (!is_eq_only || gpos::ulong_max == best_pos)
+		{
+			continue;
+		}
+
+		const ULONG colid = column_group->GetColId(best_pos);
+		const ULONG num_scale_factors = scale_factors->Size();
+		for (ULONG idx = 0; idx < num_scale_factors; idx++)
+		{
+			if (colid != *(*scale_factor_colids)[idx])
+			{
+				continue;
+			}
+
+			CDouble *col_scale_factor = (*scale_factors)[idx];
+			const DOUBLE degree = std::min(best_degree.Get(), 1.0);
+			const DOUBLE adjusted_scale_factor =
+				col_scale_factor->Get() /
+				(degree * col_scale_factor->Get() + 1.0 - degree);
+			*col_scale_factor = CDouble(std::max(adjusted_scale_factor, 1.0));
+			(void) adjusted_colids->ExchangeSet(colid);
+			break;
+		}
+	}
+
+	adjusted_colids->Release();
+}
+
 // create new hash map of histograms after applying disjunctive predicates
 UlongToHistogramMap *
 CFilterStatsProcessor::MakeHistHashMapDisjFilter(
@@ -541,7 +679,8 @@ CFilterStatsProcessor::MakeHistHashMapDisjFilter(
 		{
 			child_histograms = MakeHistHashMapConjOrDisjFilter(
 				mp, stats_config, input_histograms, input_rows,
-				child_pred_stats, &child_scale_factor);
+				child_pred_stats, &child_scale_factor,
+				NULL /* column_groups */);
 
 			GPOS_ASSERT_IMP(
 				CStatsPred::EsptDisj == child_pred_stats->GetPredStatsType(),
@@ -0,0 +1,253 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CHLLSketch.cpp
+//
+//	@doc:
+//		Implementation of the HyperLogLog sketch of the values of a column
+//---------------------------------------------------------------------------
+
+#include "naucrates/statistics/CHLLSketch.h"
+
+#include <math.h>
+
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+#include "naucrates/dxl/xml/dxltokens.h"
+
+using namespace gpnaucrates;
+using namespace gpdxl;
+
+// sketches with less registers are too inaccurate to be useful
+const ULONG CHLLSketch::MinPrecision = 4;
+
+// precision of the sketches built by gp_hyperloglog
+const ULONG CHLLSketch::MaxPrecision = 16;
+
+// 1024 registers give a standard error of about 3%, and keep the metadata
+// passed to the optimizer small
+const ULONG CHLLSketch::DefaultPrecision = 10;
+
+// ctor
+CHLLSketch::CHLLSketch(CMemoryPool *mp, ULONG precision, BYTE *registers)
+	: m_mp(mp), m_precision(precision), m_registers(registers)
+{
+	GPOS_ASSERT(MinPrecision <= precision && precision <= MaxPrecision);
+	GPOS_ASSERT(NULL != registers);
+}
+
+// dtor
+CHLLSketch::~CHLLSketch()
+{
+	GPOS_DELETE_ARRAY(m_registers);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CHLLSketch::Estimate
+//
+//	@doc:
+//		Estimated number of distinct values, using the raw HyperLogLog
+//		estimate, or linear counting over the empty registers when the raw
+//		estimate is small (Flajolet et al., 2007)
+//
+//---------------------------------------------------------------------------
+CDouble
+CHLLSketch::Estimate() const
+{
+	const ULONG size = Size();
+	const DOUBLE m = (DOUBLE) size;
+
+	DOUBLE alpha;
+	switch (size)
+	{
+		case 16:
+			alpha = 0.673;
+			break;
+		case 32:
+			alpha = 0.697;
+			break;
+		case 64:
+			alpha = 0.709;
+			break;
+		default:
+			alpha = 0.7213 / (1.0 + 1.079 / m);
+	}
+
+	DOUBLE sum = 0.0;
+	ULONG num_zeros = 0;
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		sum += pow(2.0, -(DOUBLE) m_registers[ul]);
+		if (0 == m_registers[ul])
+		{
+			num_zeros++;
+		}
+	}
+
+	DOUBLE estimate = alpha * m * m / sum;
+	if (estimate <= 2.5 * m && 0 < num_zeros)
+	{
+		estimate = m * log(m / (DOUBLE) num_zeros);
+	}
+
+	return CDouble(estimate);
+}
+
+// copy of the sketch
+CHLLSketch *
+CHLLSketch::CopySketch(CMemoryPool *mp) const
+{
+	const ULONG size = Size();
+	BYTE *registers = GPOS_NEW_ARRAY(mp, BYTE, size);
+	clib::Memcpy(registers, m_registers, size);
+
+	return GPOS_NEW(mp) CHLLSketch(mp, m_precision, registers);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CHLLSketch::MakeSketchFolded
+//
+//	@doc:
+//		Sketch of the same values with a lower precision. With d fewer index
+//		bits, the d low bits of the old index become the leading bits of the
+//		hash suffix: if they are not all zero, they alone determine the rank,
+//		otherwise the old rank is shifted by d. The result is the sketch that
+//		would have been built with the lower precision.
+//
+//---------------------------------------------------------------------------
+CHLLSketch *
+CHLLSketch::MakeSketchFolded(CMemoryPool *mp, ULONG precision) const
+{
+	GPOS_ASSERT(MinPrecision <= precision && precision <= m_precision);
+
+	const ULONG shift = m_precision - precision;
+	const ULONG size = ULONG(1) << precision;
+	BYTE *registers = GPOS_NEW_ARRAY(mp, BYTE, size);
+	clib::Memset(registers, 0, size);
+
+	const ULONG old_size = Size();
+	const ULONG low_mask = (ULONG(1) << shift) - 1;
+	for (ULONG ul = 0; ul < old_size; ul++)
+	{
+		if (0 == m_registers[ul])
+		{
+			continue;
+		}
+
+		ULONG low = ul & low_mask;
+		ULONG rank;
+		if (0 != low)
+		{
+			// position of the first set bit in the shift low bits
+			rank = shift;
+			while (0 != (low >>= 1))
+			{
+				rank--;
+			}
+		}
+		else
+		{
+			rank = std::min(ULONG(255), shift + m_registers[ul]);
+		}
+
+		ULONG index = ul >> shift;
+		if (rank > registers[index])
+		{
+			registers[index] = (BYTE) rank;
+		}
+	}
+
+	return GPOS_NEW(mp) CHLLSketch(mp, precision, registers);
+}
+
+// sketch of the union of the values of the two sketches, with the lower of
+// their precisions
+CHLLSketch *
+CHLLSketch::MakeSketchMerged(CMemoryPool *mp, const CHLLSketch *other) const
+{
+	GPOS_ASSERT(NULL != other);
+
+	const ULONG precision = std::min(m_precision, other->Precision());
+	CHLLSketch *result = MakeSketchFolded(mp, precision);
+	CHLLSketch *other_folded = other->MakeSketchFolded(mp, precision);
+
+	const ULONG size = result->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		if (other_folded->m_registers[ul] > result->m_registers[ul])
+		{
+			result->m_registers[ul] = other_folded->m_registers[ul];
+		}
+	}
+	other_folded->Release();
+
+	return result;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CHLLSketch::UnionNDV
+//
+//	@doc:
+//		Number of distinct values of the union of two inputs, given their
+//		sketches and NDVs. The sketches estimate the fraction of the values
+//		of each input that also appear in the other one, by inclusion-
+//		exclusion. That fraction is applied to the NDVs, which may be more
+//		accurate than the sketches, or may already reflect the predicates
+//		applied to the inputs.
+//
+//---------------------------------------------------------------------------
+CDouble
+CHLLSketch::UnionNDV(const CHLLSketch *sketch1, CDouble ndv1,
+					 const CHLLSketch *sketch2, CDouble ndv2)
+{
+	GPOS_ASSERT(NULL != sketch1);
+	GPOS_ASSERT(NULL != sketch2);
+
+	CDouble estimate1 = sketch1->Estimate();
+	CDouble estimate2 = sketch2->Estimate();
+	if (CDouble(1.0) > estimate1 || CDouble(1.0) > estimate2)
+	{
+		return ndv1 + ndv2;
+	}
+
+	CHLLSketch *merged = sketch1->MakeSketchMerged(sketch1->m_mp, sketch2);
+	CDouble estimate_union = merged->Estimate();
+	merged->Release();
+
+	CDouble intersection =
+		std::max(CDouble(0.0), estimate1 + estimate2 - estimate_union);
+	CDouble overlap =
+		std::min(ndv1 * std::min(CDouble(1.0), intersection / estimate1),
+				 ndv2 * std::min(CDouble(1.0), intersection / estimate2));
+
+	CDouble ndv = ndv1 + ndv2 - overlap;
+
+	return std::min(ndv1 + ndv2, std::max(std::max(ndv1, ndv2), ndv));
+}
+
+// serialize the sketch as attributes of the current DXL element
+void
+CHLLSketch::Serialize(CXMLSerializer *xml_serializer) const
+{
+	xml_serializer->AddAttribute(
+		CDXLTokens::GetDXLTokenStr(EdxltokenColHLLPrecision), m_precision);
+	xml_serializer->AddAttribute(
+		CDXLTokens::GetDXLTokenStr(EdxltokenColHLLRegisters),
+		false /* is_null */, m_registers, Size());
+}
+
+// print function
+IOstream &
+CHLLSketch::OsPrint(IOstream &os) const
+{
+	os << "HLL sketch: precision: " << m_precision
+	   << ", estimate: " << Estimate();
+
+	return os;
+}
+
+// EOF
@@ -12,6 +12,7 @@
 
 #include "naucrates/statistics/CHistogram.h"
 
+#include "gpos/common/CAutoP.h"
 #include "gpos/common/syslibwrapper.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/string/CWStringDynamic.h"
@@ -19,6 +20,7 @@
 #include "gpopt/base/CColRef.h"
 #include "naucrates/dxl/CDXLUtils.h"
 #include "naucrates/dxl/operators/CDXLScalarConstValue.h"
+#include "naucrates/statistics/CBucketBounds.h"
 #include "naucrates/statistics/CLeftAntiSemiJoinStatsProcessor.h"
 #include "naucrates/statistics/CScaleFactorUtils.h"
 #include "naucrates/statistics/CStatistics.h"
@@ -61,7 +63,8 @@ CHistogram::CHistogram(CMemoryPool *mp, CBucketArray *histogram_buckets,
 	  m_skew_was_measured(false),
 	  m_skew(1.0),
 	  m_NDVs_were_scaled(false),
-	  m_is_col_stats_missing(false)
+	  m_is_col_stats_missing(false),
+	  m_hll_sketch(NULL)
 {
 	GPOS_ASSERT(NULL != histogram_buckets);
 }
@@ -77,7 +80,8 @@ CHistogram::CHistogram(CMemoryPool *mp, BOOL is_well_defined)
 	  m_skew_was_measured(false),
 	  m_skew(1.0),
 	  m_NDVs_were_scaled(false),
-	  m_is_col_stats_missing(false)
+	  m_is_col_stats_missing(false),
+	  m_hll_sketch(NULL)
 {
 	m_histogram_buckets = GPOS_NEW(m_mp) CBucketArray(m_mp);
 }
@@ -96,7 +100,8 @@ CHistogram::CHistogram(CMemoryPool *mp, CBucketArray *histogram_buckets,
 	  m_skew_was_measured(false),
 	  m_skew(1.0),
 	  m_NDVs_were_scaled(false),
-	  m_is_col_stats_missing(is_col_stats_missing)
+	  m_is_col_stats_missing(is_col_stats_missing),
+	  m_hll_sketch(NULL)
 {
 	GPOS_ASSERT(m_histogram_buckets);
 	GPOS_ASSERT(CDouble(0.0) <= null_freq);
@@ -117,6 +122,14 @@ CHistogram::SetNullFrequency(CDouble null_freq)
 	m_null_freq = null_freq;
 }
 
+// set the HyperLogLog sketch of the column
+void
+CHistogram::SetHLLSketch(CHLLSketch *hll_sketch)
+{
+	CRefCount::SafeRelease(m_hll_sketch);
+	m_hll_sketch = hll_sketch;
+}
+
 FORCE_GENERATE_DBGSTR(gpnaucrates::CHistogram);
 
 //	print function
@@ -152,6 +165,12 @@ CHistogram::OsPrint(IOstream &os) const
 	os << "Was NDVs re-scaled Based on Row Estimate: " << m_NDVs_were_scaled
 	   << std::endl;
 
+	if (NULL != m_hll_sketch)
+	{
+		m_hll_sketch->OsPrint(os);
+		os << std::endl;
+	}
+
 	return os;
 }
 
@@ -493,6 +512,19 @@ CHistogram::GetNumDistinct() const
 	return distinct + distinct_null + m_distinct_remaining;
 }
 
+// number of distinct non-null values
+CDouble
+CHistogram::GetNumDistinctNonNull() const
+{
+	CDouble distinct = GetNumDistinct();
+	if (CStatistics::Epsilon < m_null_freq)
+	{
+		distinct = distinct - 1.0;
+	}
+
+	return distinct;
+}
+
 // cap the total number of distinct values (NDVs) in buckets to the number of rows
 // creates new histogram of buckets, as this modifies individual buckets in the array
 void
@@ -526,6 +558,62 @@ CHistogram::CapNDVs(CDouble rows)
 	m_distinct_remaining = m_distinct_remaining * scale_ratio;
 }
 
+// scale the NDVs of the non-null values to the given value. Singleton
+// buckets keep their NDV, the NDV of the other buckets and the remaining
+// NDV are scaled, but capped to their number of rows.
+// creates new histogram of buckets, as this modifies individual buckets
+void
+CHistogram::ScaleNDVs(CDouble distinct, CDouble rows)
+{
+	CDouble singleton_distinct(0.0);
+	const ULONG num_of_buckets = m_histogram_buckets->Size();
+	for (ULONG ul = 0; ul < num_of_buckets; ul++)
+	{
+		CBucket *bucket = (*m_histogram_buckets)[ul];
+		if (bucket->IsSingleton())
+		{
+			singleton_distinct = singleton_distinct + bucket->GetNumDistinct();
+		}
+	}
+
+	// NDV of the values that can be scaled
+	CDouble current_distinct = GetNumDistinctNonNull() - singleton_distinct;
+	if (CStatistics::Epsilon > current_distinct)
+	{
+		return;
+	}
+
+	CDouble scale_ratio =
+		std::max(CDouble(0.0), distinct - singleton_distinct) /
+		current_distinct;
+	if (CStatistics::Epsilon > (scale_ratio - 1.0).Absolute())
+	{
+		return;
+	}
+
+	m_NDVs_were_scaled = true;
+	CBucketArray *histogram_buckets =
+		DeepCopyHistogramBuckets(m_mp, m_histogram_buckets);
+	for (ULONG ul = 0; ul < num_of_buckets; ul++)
+	{
+		CBucket *bucket = (*histogram_buckets)[ul];
+		if (bucket->IsSingleton())
+		{
+			continue;
+		}
+
+		CDouble distinct_bucket =
+			std::min(bucket->GetNumDistinct() * scale_ratio,
+					 bucket->GetFrequency() * rows);
+		bucket->SetDistinct(
+			std::max(CHistogram::MinDistinct.Get(), distinct_bucket.Get()));
+	}
+	m_histogram_buckets->Release();
+	m_histogram_buckets = histogram_buckets;
+	m_distinct_remaining = std::min(m_distinct_remaining * scale_ratio,
+									m_freq_remaining * rows);
+}
+
 // create a deep copy of the bucket array.
 // this should be used if a bucket needs to be modified
 CBucketArray *
@@ -1021,6 +1109,12 @@ CHistogram::CopyHistogram() const
 		histogram_copy->SetNDVScaled();
 	}
 
+	if (NULL != m_hll_sketch)
+	{
+		m_hll_sketch->AddRef();
+		histogram_copy->SetHLLSketch(m_hll_sketch);
+	}
+
 	return histogram_copy;
 }
 
@@ -1105,13 +1199,28 @@ CHistogram::MakeJoinHistogramEqualityFilter(const CHistogram *histogram) const
 		return MakeNDVBasedJoinHistogramEqualityFilter(histogram);
 	}
 
+	// when the bounds of both histograms map to doubles, compare the
+	// buckets on their flat bounds instead of going through the datums
+	CAutoP<CBucketBounds> bounds1(
+		CBucketBounds::PbbCreate(m_mp, m_histogram_buckets));
+	CAutoP<CBucketBounds> bounds2(
+		CBucketBounds::PbbCreate(m_mp, histogram->m_histogram_buckets));
+	const BOOL use_bounds = NULL != bounds1.Value() &&
+							NULL != bounds2.Value() &&
+							bounds1->IsComparable(bounds2.Value());
+
 	CBucketArray *join_buckets = GPOS_NEW(m_mp) CBucketArray(m_mp);
 	while (idx1 < buckets1 && idx2 < buckets2)
 	{
 		CBucket *bucket1 = (*m_histogram_buckets)[idx1];
 		CBucket *bucket2 = (*histogram->m_histogram_buckets)[idx2];
 
-		if (bucket1->Intersects(bucket2))
+		BOOL intersects = use_bounds
+							  ? bounds1->Intersects(idx1, bounds2.Value(), idx2)
+							  : bucket1->Intersects(bucket2);
+		GPOS_ASSERT(intersects == bucket1->Intersects(bucket2));
+
+		if (intersects)
 		{
 			CDouble freq_intersect1(0.0);
 			CDouble freq_intersect2(0.0);
@@ -1123,7 +1232,11 @@ CHistogram::MakeJoinHistogramEqualityFilter(const CHistogram *histogram) const
 			hist1_buckets_freq = hist1_buckets_freq + freq_intersect1;
 			hist2_buckets_freq = hist2_buckets_freq + freq_intersect2;
 
-			INT res = CBucket::CompareUpperBounds(bucket1, bucket2);
+			INT res = use_bounds
+						  ? CBucketBounds::CompareUpperBounds(
+								bounds1.Value(), idx1, bounds2.Value(), idx2)
+						  : CBucket::CompareUpperBounds(bucket1, bucket2);
+			GPOS_ASSERT(res == CBucket::CompareUpperBounds(bucket1, bucket2));
 			if (0 == res)
 			{
 				// both ubs are equal
@@ -1140,7 +1253,8 @@ CHistogram::MakeJoinHistogramEqualityFilter(const CHistogram *histogram) const
 				idx2++;
 			}
 		}
-		else if (bucket1->IsBefore(bucket2))
+		else if (use_bounds ? bounds1->IsBefore(idx1, bounds2.Value(), idx2)
+							: bucket1->IsBefore(bucket2))
 		{
 			// buckets do not intersect there one bucket is before the other
 			idx1++;
@@ -1525,6 +1639,19 @@ CHistogram::MakeUnionAllHistogramNormalize(CDouble rows,
 		CHistogram(m_mp, result_buckets, true /*is_well_defined*/,
 				   new_null_freq, distinct_remaining, freq_remaining);
 	(void) result_histogram->NormalizeHistogram();
+
+	// the merge of the buckets assumes that the values of overlapping
+	// buckets are the same; when both inputs have sketches, use them to
+	// estimate how many values the inputs really have in common
+	if (NULL != m_hll_sketch && NULL != histogram->m_hll_sketch)
+	{
+		CDouble distinct = CHLLSketch::UnionNDV(
+			m_hll_sketch, GetNumDistinctNonNull(), histogram->m_hll_sketch,
+			histogram->GetNumDistinctNonNull());
+		result_histogram->ScaleNDVs(distinct, rows_new);
+		result_histogram->SetHLLSketch(
+			m_hll_sketch->MakeSketchMerged(m_mp, histogram->m_hll_sketch));
+	}
 	GPOS_ASSERT(result_histogram->IsValid());
 
 	new_buckets->Release();
@@ -2176,6 +2303,40 @@ CHistogram::ComputeSkew()
 	}
 }
 
+// estimate the frequency of the most frequent value of the column, that is
+// the fraction of the rows that a redistribution on the column sends to a
+// single segment at least. Singleton buckets, as built from MCVs, hold the
+// frequency of their value; other buckets spread their frequency evenly over
+// their distinct values. NULLs are all sent to the same segment, so they
+// count as one value. Returns 0 when the histogram has no bounds.
+CDouble
+CHistogram::GetMaxValueFreq() const
+{
+	if (!m_is_well_defined)
+	{
+		return CDouble(0.0);
+	}
+
+	CDouble max_freq = m_null_freq;
+	const ULONG num_buckets = m_histogram_buckets->Size();
+	for (ULONG ul = 0; ul < num_buckets; ul++)
+	{
+		CBucket *bucket = (*m_histogram_buckets)[ul];
+		CDouble value_freq = bucket->GetFrequency() /
+							 std::max(bucket->GetNumDistinct(), CDouble(1.0));
+		max_freq = std::max(max_freq, value_freq);
+	}
+
+	if (CStatistics::Epsilon < m_freq_remaining)
+	{
+		CDouble value_freq =
+			m_freq_remaining / std::max(m_distinct_remaining, CDouble(1.0));
+		max_freq = std::max(max_freq, value_freq);
+	}
+
+	return std::min(max_freq, CDouble(1.0));
+}
+
 // create the default histogram for a given column reference
 CHistogram *
 CHistogram::MakeDefaultHistogram(CMemoryPool *mp, CColRef *col_ref,
@@ -420,6 +420,14 @@ CJoinStatsProcessor::SetResultingJoinStats(
 	}
 
 
+	if (!IsLASJ &&
+		!CStatistics::IsEmptyJoin(outer_stats, inner_side_stats, IsLASJ))
+	{
+		AdjustScaleFactorsForColumnGroups(mp, outer_stats, inner_side_stats,
+										  join_pred_stats_info,
+										  join_conds_scale_factors);
+	}
+
 	num_join_rows = CStatistics::MinRows;
 	if (!output_is_empty)
 	{
@@ -430,7 +438,6 @@ CJoinStatsProcessor::SetResultingJoinStats(
 
 	// clean up
 	join_conds_scale_factors->Release();
-	join_colids->Release();
 
 	UlongToDoubleMap *col_width_mapping_result = outer_stats->CopyWidths(mp);
 	if (!semi_join)
@@ -459,9 +466,143 @@ CJoinStatsProcessor::SetResultingJoinStats(
 			CStatistics::EcbmMin /* card_bounding_method */);
 	}
 
+	// column groups without join columns are not affected by the join
+	outer_stats->CopyColumnGroupsInto(join_stats, join_colids);
+	if (!semi_join)
+	{
+		inner_side_stats->CopyColumnGroupsInto(join_stats, join_colids);
+	}
+	join_colids->Release();
+
 	return join_stats;
 }
 
+//	Predicates t1.a = t2.x AND t1.b = t2.y on the columns of a column group
+//	(a, b) of the outer side are not independent: the join matches the
+//	distinct combinations of (a, b) with the ones of (x, y). Following the
+//	containment assumption used for single predicates, their combined scale
+//	factor is the larger of the two numbers of combinations. The number of
+//	combinations of the inner side comes from a matching column group, or
+//	otherwise from the product of the NDVs of its columns.
+void
+CJoinStatsProcessor::AdjustScaleFactorsForColumnGroups(
+	CMemoryPool *mp, const CStatistics *outer_stats,
+	const CStatistics *inner_stats, CStatsPredJoinArray *join_preds_stats,
+	CScaleFactorUtils::SJoinConditionArray *join_conds_scale_factors)
+{
+	GPOS_ASSERT(join_preds_stats->Size() == join_conds_scale_factors->Size());
+
+	const CStatsColGroupArray *column_groups = outer_stats->GetColumnGroups();
+	const ULONG num_column_groups = column_groups->Size();
+	const ULONG num_join_conds = join_preds_stats->Size();
+	if (0 == num_column_groups || 2 > num_join_conds)
+	{
+		return;
+	}
+
+	// predicates already combined for another group
+	CBitSet *used_preds = GPOS_NEW(mp) CBitSet(mp);
+
+	for (ULONG ul = 0; ul < num_column_groups; ul++)
+	{
+		const CStatsColGroup *column_group = (*column_groups)[ul];
+		ULongPtrArray *pred_indexes = GPOS_NEW(mp) ULongPtrArray(mp);
+		ULongPtrArray *inner_colids = GPOS_NEW(mp) ULongPtrArray(mp);
+
+		// find an unused equality predicate for every column of the group
+		BOOL is_covered = true;
+		const ULONG size = column_group->Size();
+		for (ULONG pos = 0; is_covered && pos < size; pos++)
+		{
+			const ULONG colid = column_group->GetColId(pos);
+			ULONG pred_index = gpos::ulong_max;
+			for (ULONG i = 0;
+				 gpos::ulong_max == pred_index && i < num_join_conds; i++)
+			{
+				CStatsPredJoin *pred_info = (*join_preds_stats)[i];
+				if (!used_preds->Get(i) &&
+					CStatsPred::EstatscmptEq == pred_info->GetCmpType() &&
+					pred_info->HasValidColIdOuter() &&
+					pred_info->HasValidColIdInner() &&
+					colid == pred_info->ColIdOuter())
+				{
+					pred_index = i;
+				}
+			}
+
+			is_covered = (gpos::ulong_max != pred_index);
+			if (is_covered)
+			{
+				pred_indexes->Append(GPOS_NEW(mp) ULONG(pred_index));
+				inner_colids->Append(GPOS_NEW(mp) ULONG(
+					(*join_preds_stats)[pred_index]->ColIdInner()));
+			}
+		}
+
+		if (is_covered)
+		{
+			const DOUBLE outer_rows =
+				std::max(CStatistics::MinRows.Get(), outer_stats->Rows().Get());
+			const DOUBLE inner_rows =
+				std::max(CStatistics::MinRows.Get(), inner_stats->Rows().Get());
+
+			DOUBLE outer_ndv =
+				std::min(column_group->GetNDV().Get(), outer_rows);
+
+			DOUBLE inner_ndv = inner_rows;
+			const CStatsColGroup *inner_column_group =
+				inner_stats->FindColumnGroup(inner_colids);
+			if (NULL != inner_column_group)
+			{
+				inner_ndv =
+					std::min(inner_column_group->GetNDV().Get(), inner_rows);
+			}
+			else
+			{
+				DOUBLE ndv_product = 1.0;
+				for (ULONG pos = 0; pos < size; pos++)
+				{
+					const CHistogram *histogram =
+						inner_stats->GetHistogram(*(*inner_colids)[pos]);
+					if (NULL == histogram || histogram->IsEmpty())
+					{
+						ndv_product = inner_rows;
+						break;
+					}
+					ndv_product =
+						ndv_product * histogram->GetNumDistinct().Get();
+				}
+				inner_ndv = std::min(ndv_product, inner_rows);
+			}
+
+			// the combined factor is at least the factor of any of the
+			// predicates on its own
+			DOUBLE scale_factor = std::max(outer_ndv, inner_ndv);
+			for (ULONG pos = 0; pos < size; pos++)
+			{
+				const ULONG pred_index = *(*pred_indexes)[pos];
+				CScaleFactorUtils::SJoinCondition *join_cond =
+					(*join_conds_scale_factors)[pred_index];
+				scale_factor =
+					std::max(scale_factor, join_cond->m_scale_factor.Get());
+			}
+
+			for (ULONG pos = 0; pos < size; pos++)
+			{
+				const ULONG pred_index = *(*pred_indexes)[pos];
+				(*join_conds_scale_factors)[pred_index]->m_scale_factor =
+					(0 == pos) ? CDouble(scale_factor) : CDouble(1.0);
+				(void) used_preds->ExchangeSet(pred_index);
+			}
+		}
+
+		pred_indexes->Release();
+		inner_colids->Release();
+	}
+
+	used_preds->Release();
+}
+
 
 // return join cardinality based on scaling factor and join type
 CDouble
@@ -71,7 +71,8 @@ CStatistics::CStatistics(CMemoryPool *mp,
 	  m_num_rebinds(
 		  1.0),	 // by default, a stats object is rebound to parameters only once
 	  m_num_predicates(num_predicates),
-	  m_src_upper_bound_NDVs(NULL)
+	  m_src_upper_bound_NDVs(NULL),
+	  m_column_groups(NULL)
 {
 	GPOS_ASSERT(NULL != m_colid_histogram_mapping);
 	GPOS_ASSERT(NULL != m_colid_width_mapping);
@@ -80,6 +81,8 @@ CStatistics::CStatistics(CMemoryPool *mp,
 	// hash map for source id -> max source cardinality mapping
 	m_src_upper_bound_NDVs = GPOS_NEW(mp) CUpperBoundNDVPtrArray(mp);
 
+	m_column_groups = GPOS_NEW(mp) CStatsColGroupArray(mp);
+
 	m_stats_conf =
 		COptCtxt::PoctxtFromTLS()->GetOptimizerConfig()->GetStatsConf();
 }
@@ -98,7 +101,8 @@ CStatistics::CStatistics(CMemoryPool *mp,
 	  m_relallvisible(relallvisible),
 	  m_num_rebinds(rebinds),
 	  m_num_predicates(num_predicates),
-	  m_src_upper_bound_NDVs(NULL)
+	  m_src_upper_bound_NDVs(NULL),
+	  m_column_groups(NULL)
 {
 	GPOS_ASSERT(NULL != m_colid_histogram_mapping);
 	GPOS_ASSERT(NULL != m_colid_width_mapping);
@@ -107,6 +111,8 @@ CStatistics::CStatistics(CMemoryPool *mp,
 	// hash map for source id -> max source cardinality mapping
 	m_src_upper_bound_NDVs = GPOS_NEW(mp) CUpperBoundNDVPtrArray(mp);
 
+	m_column_groups = GPOS_NEW(mp) CStatsColGroupArray(mp);
+
 	m_stats_conf =
 		COptCtxt::PoctxtFromTLS()->GetOptimizerConfig()->GetStatsConf();
 }
@@ -117,6 +123,7 @@ CStatistics::~CStatistics()
 	m_colid_histogram_mapping->Release();
 	m_colid_width_mapping->Release();
 	m_src_upper_bound_NDVs->Release();
+	m_column_groups->Release();
 }
 
 // look up the width of a particular column
@@ -174,6 +181,12 @@ CStatistics::OsPrint(IOstream &os) const
 		const CUpperBoundNDVs *upper_bound_NDVs = (*m_src_upper_bound_NDVs)[i];
 		upper_bound_NDVs->OsPrint(os);
 	}
+
+	const ULONG num_column_groups = m_column_groups->Size();
+	for (ULONG i = 0; i < num_column_groups; i++)
+	{
+		(*m_column_groups)[i]->OsPrint(os);
+	}
 	os << "StatsEstimationRisk = " << StatsEstimationRisk() << std::endl;
 	os << "}" << std::endl;
 
@@ -201,6 +214,19 @@ CStatistics::GetSkew(ULONG colid) const
 	return histogram->GetSkew();
 }
 
+// return the frequency of the most frequent value of the given column
+CDouble
+CStatistics::GetMaxValueFreq(ULONG colid) const
+{
+	CHistogram *histogram = m_colid_histogram_mapping->Find(&colid);
+	if (NULL == histogram)
+	{
+		return CDouble(0.0);
+	}
+
+	return histogram->GetMaxValueFreq();
+}
+
 // return total width in bytes
 CDouble
 CStatistics::Width() const
@@ -585,6 +611,8 @@ CStatistics::ScaleStats(CMemoryPool *mp, CDouble factor) const
 		mp, this, scaled_stats, scaled_num_rows,
 		CStatistics::EcbmMin /* card_bounding_method */);
 
+	CopyColumnGroupsInto(scaled_stats, NULL /* excluded_colids */);
+
 	return scaled_stats;
 }
 
@@ -626,6 +654,19 @@ CStatistics::CopyStatsWithRemap(CMemoryPool *mp,
 		}
 	}
 
+	// copy the column groups whose columns are all remapped
+	const ULONG num_column_groups = m_column_groups->Size();
+	for (ULONG i = 0; i < num_column_groups; i++)
+	{
+		CStatsColGroup *column_group_copy =
+			(*m_column_groups)[i]->CopyWithRemap(mp, colref_mapping);
+
+		if (NULL != column_group_copy)
+		{
+			stats_copy->AddColumnGroup(column_group_copy);
+		}
+	}
+
 	return stats_copy;
 }
 
@@ -759,6 +800,65 @@ CStatistics::AddCardUpperBound(CUpperBoundNDVs *upper_bound_NDVs)
 	m_src_upper_bound_NDVs->Append(upper_bound_NDVs);
 }
 
+// add the statistics of a group of correlated columns
+void
+CStatistics::AddColumnGroup(CStatsColGroup *column_group)
+{
+	GPOS_ASSERT(NULL != column_group);
+
+	m_column_groups->Append(column_group);
+}
+
+// add the column groups of this object to the given stats object, except
+// for the groups with a column in the given set (if any)
+void
+CStatistics::CopyColumnGroupsInto(CStatistics *dest_stats,
+								  const CBitSet *excluded_colids) const
+{
+	GPOS_ASSERT(NULL != dest_stats);
+
+	const ULONG num_column_groups = m_column_groups->Size();
+	for (ULONG i = 0; i < num_column_groups; i++)
+	{
+		CStatsColGroup *column_group = (*m_column_groups)[i];
+
+		BOOL is_excluded = false;
+		const ULONG size = column_group->Size();
+		for (ULONG ul = 0; NULL != excluded_colids && !is_excluded && ul < size;
+			 ul++)
+		{
+			is_excluded = excluded_colids->Get(column_group->GetColId(ul));
+		}
+
+		if (!is_excluded)
+		{
+			column_group->AddRef();
+			dest_stats->AddColumnGroup(column_group);
+		}
+	}
+}
+
+// statistics of the column group covering exactly the given columns,
+// NULL if there is none
+const CStatsColGroup *
+CStatistics::FindColumnGroup(const ULongPtrArray *colids) const
+{
+	GPOS_ASSERT(NULL != colids);
+
+	const ULONG num_column_groups = m_column_groups->Size();
+	for (ULONG i = 0; i < num_column_groups; i++)
+	{
+		const CStatsColGroup *column_group = (*m_column_groups)[i];
+		if (column_group->Size() == colids->Size() &&
+			column_group->IsCoveredBy(colids))
+		{
+			return column_group;
+		}
+	}
+
+	return NULL;
+}
+
 // return the dxl representation of the statistics object
 CDXLStatsDerivedRelation *
 CStatistics::GetDxlStatsDrvdRelation(CMemoryPool *mp,
@@ -1307,7 +1307,9 @@ CStatisticsUtils::GetGrpColIdToUpperBoundNDVIdxMap(
 //		CStatisticsUtils::AddNdvForAllGrpCols
 //
 //	@doc:
-//		Add the NDV for all of the grouping columns
+//		Add the NDV for all of the grouping columns. The columns of a column
+//		group whose columns are all grouping columns contribute the number of
+//		distinct combinations of the group instead of their own NDVs
 //---------------------------------------------------------------------------
 void
 CStatisticsUtils::AddNdvForAllGrpCols(
@@ -1321,11 +1323,54 @@ CStatisticsUtils::AddNdvForAllGrpCols(
 	GPOS_ASSERT(NULL != input_stats);
 	GPOS_ASSERT(NULL != output_ndvs);
 
+	// grouping columns accounted for by a column group
+	CBitSet *grouped_colids = GPOS_NEW(mp) CBitSet(mp);
+
+	const CStatsColGroupArray *column_groups = input_stats->GetColumnGroups();
+	const ULONG num_column_groups = column_groups->Size();
+	for (ULONG i = 0; i < num_column_groups; i++)
+	{
+		const CStatsColGroup *column_group = (*column_groups)[i];
+		if (!column_group->IsCoveredBy(grouping_columns))
+		{
+			continue;
+		}
+
+		// groups are used as they come, a group overlapping with one that
+		// is already used is skipped
+		BOOL is_overlapping = false;
+		const ULONG size = column_group->Size();
+		for (ULONG ul = 0; !is_overlapping && ul < size; ul++)
+		{
+			is_overlapping = grouped_colids->Get(column_group->GetColId(ul));
+		}
+
+		if (is_overlapping)
+		{
+			continue;
+		}
+
+		for (ULONG ul = 0; ul < size; ul++)
+		{
+			(void) grouped_colids->ExchangeSet(column_group->GetColId(ul));
+		}
+
+		CDouble distinct_vals =
+			std::max(CStatistics::MinRows.Get(),
+					 std::min(column_group->GetNDV().Get(),
+							  input_stats->Rows().Get()));
+		output_ndvs->Append(GPOS_NEW(mp) CDouble(distinct_vals));
+	}
+
 	const ULONG num_cols = grouping_columns->Size();
 	// iterate over grouping columns
 	for (ULONG i = 0; i < num_cols; i++)
 	{
 		ULONG colid = (*(*grouping_columns)[i]);
+		if (grouped_colids->Get(colid))
+		{
+			continue;
+		}
 
 		CDouble distinct_vals =
 			CStatisticsUtils::DefaultDistinctVals(input_stats->Rows());
@@ -1340,6 +1385,8 @@ CStatisticsUtils::AddNdvForAllGrpCols(
 		}
 		output_ndvs->Append(GPOS_NEW(mp) CDouble(distinct_vals));
 	}
+
+	grouped_colids->Release();
 }
 
 
@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CStatsColGroup.cpp
+//
+//	@doc:
+//		Implementation of the statistics of a group of correlated columns
+//---------------------------------------------------------------------------
+
+#include "naucrates/statistics/CStatsColGroup.h"
+
+using namespace gpnaucrates;
+using namespace gpopt;
+
+// ctor
+CStatsColGroup::CStatsColGroup(ULongPtrArray *colids, CDouble ndv,
+							   CDoubleArray *dependency_degrees)
+	: m_colids(colids), m_ndv(ndv), m_dependency_degrees(dependency_degrees)
+{
+	GPOS_ASSERT(NULL != colids);
+	GPOS_ASSERT(NULL != dependency_degrees);
+	GPOS_ASSERT(colids->Size() == dependency_degrees->Size());
+	GPOS_ASSERT(CDouble(0.0) <= ndv);
+}
+
+// dtor
+CStatsColGroup::~CStatsColGroup()
+{
+	m_colids->Release();
+	m_dependency_degrees->Release();
+}
+
+// position of the given column in the group
+ULONG
+CStatsColGroup::IndexOf(ULONG colid) const
+{
+	const ULONG size = m_colids->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		if (colid == *(*m_colids)[ul])
+		{
+			return ul;
+		}
+	}
+
+	return gpos::ulong_max;
+}
+
+// are all the columns of the group in the given array
+BOOL
+CStatsColGroup::IsCoveredBy(const ULongPtrArray *colids) const
+{
+	GPOS_ASSERT(NULL != colids);
+
+	const ULONG size = m_colids->Size();
+	const ULONG num_colids = colids->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		BOOL found = false;
+		for (ULONG ulOther = 0; !found && ulOther < num_colids; ulOther++)
+		{
+			found = (*(*m_colids)[ul] == *(*colids)[ulOther]);
+		}
+
+		if (!found)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// copy of the group with remapped column ids; NULL if any of the columns
+// has no mapping
+CStatsColGroup *
+CStatsColGroup::CopyWithRemap(CMemoryPool *mp,
+							  UlongToColRefMap *colref_mapping) const
+{
+	GPOS_ASSERT(NULL != colref_mapping);
+
+	ULongPtrArray *colids = GPOS_NEW(mp) ULongPtrArray(mp);
+	const ULONG size = m_colids->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		ULONG colid = *(*m_colids)[ul];
+		CColRef *colref = colref_mapping->Find(&colid);
+		if (NULL == colref)
+		{
+			colids->Release();
+			return NULL;
+		}
+		colids->Append(GPOS_NEW(mp) ULONG(colref->Id()));
+	}
+
+	m_dependency_degrees->AddRef();
+
+	return GPOS_NEW(mp) CStatsColGroup(colids, m_ndv, m_dependency_degrees);
+}
+
+// print function
+IOstream &
+CStatsColGroup::OsPrint(IOstream &os) const
+{
+	os << "Column group (";
+	const ULONG size = m_colids->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		os << "Col" << GetColId(ul) << ": " << GetDependencyDegree(ul);
+		if (ul < size - 1)
+		{
+			os << ", ";
+		}
+	}
+	os << ") NDV = " << m_ndv << std::endl;
+
+	return os;
+}
+
+// EOF
@@ -0,0 +1,98 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLBinaryFormat.cpp
+//
+//	@doc:
+//		Implementation of the helpers for binary DXL documents
+//---------------------------------------------------------------------------
+
+#include "naucrates/dxl/xml/CDXLBinaryFormat.h"
+
+#include "gpos/common/clibwrapper.h"
+
+using namespace gpdxl;
+
+// magic number; not a valid start of an XML document
+const BYTE CDXLBinaryFormat::Magic[4] = {0xD0, 'D', 'X', 'L'};
+
+// current version of the format
+const USINT CDXLBinaryFormat::Version = 1;
+
+// byte order mark; read as 0xFFFE on machines with the other byte order
+const USINT CDXLBinaryFormat::ByteOrderMark = 0xFEFF;
+
+// does the buffer start with the magic number of binary DXL
+BOOL
+CDXLBinaryFormat::IsBinaryDXL(const BYTE *buffer, ULONG size)
+{
+	return GPOS_ARRAY_SIZE(Magic) <= size &&
+		   0 == clib::Memcmp(buffer, Magic, GPOS_ARRAY_SIZE(Magic));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryFormat::XMLChLength
+//
+//	@doc:
+//		Number of XMLCh (UTF-16) units needed to encode the given wide
+//		characters; characters outside of the basic multilingual plane take
+//		a surrogate pair
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLBinaryFormat::XMLChLength(const WCHAR *wsz, ULONG length)
+{
+	ULONG xml_length = length;
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		if (0xFFFF < (ULONG) wsz[ul])
+		{
+			xml_length++;
+		}
+	}
+
+	return xml_length;
+}
+
+// encode wide characters as XMLCh units
+void
+CDXLBinaryFormat::CopyToXMLCh(XMLCh *dest, const WCHAR *wsz, ULONG length)
+{
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		ULONG code_point = (ULONG) wsz[ul];
+		if (0xFFFF < code_point)
+		{
+			code_point -= 0x10000;
+			*dest++ = (XMLCh)(0xD800 + (code_point >> 10));
+			*dest++ = (XMLCh)(0xDC00 + (code_point & 0x3FF));
+		}
+		else
+		{
+			*dest++ = (XMLCh) code_point;
+		}
+	}
+}
+
+// decode a null-terminated XMLCh string into wide characters
+void
+CDXLBinaryFormat::CopyToWideChars(WCHAR *dest, const XMLCh *xml_string)
+{
+	while (0 != *xml_string)
+	{
+		ULONG code_point = *xml_string++;
+		if (0xD800 <= code_point && code_point < 0xDC00 &&
+			0xDC00 <= *xml_string && *xml_string < 0xE000)
+		{
+			code_point = 0x10000 + ((code_point - 0xD800) << 10) +
+						 (*xml_string++ - 0xDC00);
+		}
+		*dest++ = (WCHAR) code_point;
+	}
+	*dest = 0;
+}
+
+// EOF
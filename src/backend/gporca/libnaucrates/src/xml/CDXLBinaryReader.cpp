@@ -0,0 +1,638 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLBinaryReader.cpp
+//
+//	@doc:
+//		Implementation of the class for reading binary DXL documents
+//---------------------------------------------------------------------------
+
+#include "naucrates/dxl/xml/CDXLBinaryReader.h"
+
+#include <xercesc/util/XMLString.hpp>
+
+#include "gpos/common/CAutoRg.h"
+
+#include "naucrates/dxl/parser/CParseHandlerBase.h"
+#include "naucrates/dxl/parser/CParseHandlerManager.h"
+#include "naucrates/dxl/xml/CXMLSerializer.h"
+#include "naucrates/exception.h"
+
+using namespace gpdxl;
+
+#define GPDXL_BINARY_CFA_FREQUENCY 1024
+
+// namespace URI of attributes
+static const XMLCh xmlszEmpty[] = {0};
+
+// type of attributes
+static const XMLCh xmlszCDATA[] = {'C', 'D', 'A', 'T', 'A', 0};
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::CDXLBinaryReader
+//
+//	@doc:
+//		Constructor. The strings are handed out as pointers into the buffer,
+//		so the buffer is copied if it is not aligned for them.
+//
+//---------------------------------------------------------------------------
+CDXLBinaryReader::CDXLBinaryReader(CMemoryPool *mp, const BYTE *buffer,
+								   ULONG size)
+	: m_mp(mp),
+	  m_buffer(buffer),
+	  m_size(size),
+	  m_aligned_buffer(NULL),
+	  m_strings(NULL),
+	  m_num_strings(0),
+	  m_wide_strings(NULL),
+	  m_offset(0),
+	  m_records_end(0),
+	  m_attr_ids(NULL),
+	  m_attr_names(NULL),
+	  m_attr_values(NULL),
+	  m_attrs_capacity(0),
+	  m_open_elements(NULL),
+	  m_depth(0),
+	  m_open_elements_capacity(0)
+{
+	GPOS_ASSERT(NULL != buffer);
+
+	if (0 != ((ULONG_PTR) buffer) % GPOS_SIZEOF(ULONG))
+	{
+		m_aligned_buffer = GPOS_NEW_ARRAY(m_mp, BYTE, size);
+		clib::Memcpy(m_aligned_buffer, buffer, size);
+		m_buffer = m_aligned_buffer;
+	}
+
+	ReadStringTable();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::~CDXLBinaryReader
+//
+//	@doc:
+//		Destructor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryReader::~CDXLBinaryReader()
+{
+	if (NULL != m_wide_strings)
+	{
+		for (ULONG ul = 0; ul < m_num_strings; ul++)
+		{
+			GPOS_DELETE(m_wide_strings[ul]);
+		}
+		GPOS_DELETE_ARRAY(m_wide_strings);
+	}
+
+	GPOS_DELETE_ARRAY(m_strings);
+	GPOS_DELETE_ARRAY(m_attr_ids);
+	GPOS_DELETE_ARRAY(m_attr_names);
+	GPOS_DELETE_ARRAY(m_attr_values);
+	GPOS_DELETE_ARRAY(m_open_elements);
+	GPOS_DELETE_ARRAY(m_aligned_buffer);
+}
+
+// raise an error for a malformed document
+void
+CDXLBinaryReader::RaiseError(const WCHAR *details)
+{
+	GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXLBinaryFormatError, details);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadStringTable
+//
+//	@doc:
+//		Validate the header and build the array of strings, pointing into the
+//		string table
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::ReadStringTable()
+{
+	CDXLBinaryFormat::SHeader header;
+	if (m_size < GPOS_SIZEOF(header) ||
+		!CDXLBinaryFormat::IsBinaryDXL(m_buffer, m_size))
+	{
+		RaiseError(GPOS_WSZ_LIT("not a binary DXL document"));
+	}
+	clib::Memcpy(&header, m_buffer, GPOS_SIZEOF(header));
+
+	if (CDXLBinaryFormat::Version != header.m_version)
+	{
+		RaiseError(GPOS_WSZ_LIT("unsupported version"));
+	}
+
+	if (CDXLBinaryFormat::ByteOrderMark != header.m_byte_order)
+	{
+		RaiseError(GPOS_WSZ_LIT("written with a different byte order"));
+	}
+
+	const ULONG string_table_offset = header.m_string_table_offset;
+	if (m_size != header.m_size ||
+		GPOS_SIZEOF(header) >= string_table_offset ||
+		m_size < string_table_offset || 0 != string_table_offset % 4)
+	{
+		RaiseError(GPOS_WSZ_LIT("truncated document"));
+	}
+
+	// every string takes 8 bytes or more
+	m_num_strings = header.m_num_strings;
+	if ((m_size - string_table_offset) / 8 < m_num_strings)
+	{
+		RaiseError(GPOS_WSZ_LIT("truncated string table"));
+	}
+
+	m_strings = GPOS_NEW_ARRAY(m_mp, const XMLCh *, m_num_strings);
+	ULONG offset = string_table_offset;
+	for (ULONG ul = 0; ul < m_num_strings; ul++)
+	{
+		ULONG length = 0;
+		if (m_size < offset + GPOS_SIZEOF(length))
+		{
+			RaiseError(GPOS_WSZ_LIT("truncated string table"));
+		}
+		clib::Memcpy(&length, m_buffer + offset, GPOS_SIZEOF(length));
+		offset += GPOS_SIZEOF(length);
+
+		if ((m_size - offset) / GPOS_SIZEOF(XMLCh) <= length)
+		{
+			RaiseError(GPOS_WSZ_LIT("truncated string table"));
+		}
+
+		const XMLCh *xml_string = (const XMLCh *) (m_buffer + offset);
+		if (0 != xml_string[length])
+		{
+			RaiseError(GPOS_WSZ_LIT("unterminated string"));
+		}
+		m_strings[ul] = xml_string;
+
+		offset += (length + 1) * GPOS_SIZEOF(XMLCh);
+		offset += (4 - offset % 4) % 4;
+	}
+
+	m_records_end = string_table_offset;
+}
+
+// read a variable length integer
+ULONG
+CDXLBinaryReader::ReadVarint()
+{
+	ULONG value = 0;
+	for (ULONG shift = 0; shift < 32; shift += 7)
+	{
+		if (m_records_end <= m_offset)
+		{
+			RaiseError(GPOS_WSZ_LIT("truncated record"));
+		}
+
+		BYTE byte = m_buffer[m_offset++];
+		value |= ((ULONG)(byte & 0x7F)) << shift;
+		if (0 == (byte & 0x80))
+		{
+			return value;
+		}
+	}
+
+	RaiseError(GPOS_WSZ_LIT("invalid integer"));
+	return 0;
+}
+
+// read a string id
+ULONG
+CDXLBinaryReader::ReadStringId()
+{
+	ULONG id = ReadVarint();
+	if (m_num_strings <= id)
+	{
+		RaiseError(GPOS_WSZ_LIT("invalid string id"));
+	}
+
+	return id;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::ReadRecord
+//
+//	@doc:
+//		Read the next record. A start element is pushed on the stack of open
+//		elements, and its attributes are set up; an end element is left on
+//		the stack for the caller to pop after it has been handled.
+//
+//---------------------------------------------------------------------------
+EdxlBinaryRecord
+CDXLBinaryReader::ReadRecord()
+{
+	if (m_records_end <= m_offset)
+	{
+		RaiseError(GPOS_WSZ_LIT("truncated record"));
+	}
+
+	const BYTE record_type = m_buffer[m_offset++];
+	switch (record_type)
+	{
+		case EdxlbinaryStartElement:
+		{
+			if (m_open_elements_capacity == m_depth)
+			{
+				ULONG capacity = std::max(ULONG(32), 2 * m_depth);
+				ULONG *open_elements =
+					GPOS_NEW_ARRAY(m_mp, ULONG, 3 * capacity);
+				if (0 < m_depth)
+				{
+					clib::Memcpy(open_elements, m_open_elements,
+								 3 * m_depth * GPOS_SIZEOF(ULONG));
+				}
+				GPOS_DELETE_ARRAY(m_open_elements);
+				m_open_elements = open_elements;
+				m_open_elements_capacity = capacity;
+			}
+
+			ULONG *element = m_open_elements + 3 * m_depth;
+			for (ULONG ul = 0; ul < 3; ul++)
+			{
+				element[ul] = ReadStringId();
+			}
+			m_depth++;
+
+			// every attribute takes 2 bytes or more
+			const ULONG num_attrs = ReadVarint();
+			if ((m_records_end - m_offset) / 2 < num_attrs)
+			{
+				RaiseError(GPOS_WSZ_LIT("truncated record"));
+			}
+
+			if (m_attrs_capacity < num_attrs)
+			{
+				GPOS_DELETE_ARRAY(m_attr_ids);
+				GPOS_DELETE_ARRAY(m_attr_names);
+				GPOS_DELETE_ARRAY(m_attr_values);
+				m_attrs_capacity = std::max(2 * m_attrs_capacity, num_attrs);
+				m_attr_ids = GPOS_NEW_ARRAY(m_mp, ULONG, 2 * m_attrs_capacity);
+				m_attr_names =
+					GPOS_NEW_ARRAY(m_mp, const XMLCh *, m_attrs_capacity);
+				m_attr_values =
+					GPOS_NEW_ARRAY(m_mp, const XMLCh *, m_attrs_capacity);
+			}
+
+			for (ULONG ul = 0; ul < num_attrs; ul++)
+			{
+				m_attr_ids[2 * ul] = ReadStringId();
+				m_attr_ids[2 * ul + 1] = ReadStringId();
+				m_attr_names[ul] = m_strings[m_attr_ids[2 * ul]];
+				m_attr_values[ul] = m_strings[m_attr_ids[2 * ul + 1]];
+			}
+			m_attrs.Set(m_attr_names, m_attr_values, num_attrs);
+
+			return EdxlbinaryStartElement;
+		}
+
+		case EdxlbinaryEndElement:
+			if (0 == m_depth)
+			{
+				RaiseError(GPOS_WSZ_LIT("unbalanced end element"));
+			}
+			return EdxlbinaryEndElement;
+
+		case EdxlbinaryEnd:
+			if (0 != m_depth)
+			{
+				RaiseError(GPOS_WSZ_LIT("unclosed element"));
+			}
+			return EdxlbinaryEnd;
+
+		default:
+			RaiseError(GPOS_WSZ_LIT("unknown record type"));
+			return EdxlbinarySentinel;
+	}
+}
+
+// the string with the given id as a wide string
+const CWStringConst *
+CDXLBinaryReader::GetWideString(ULONG id)
+{
+	GPOS_ASSERT(id < m_num_strings);
+
+	if (NULL == m_wide_strings)
+	{
+		m_wide_strings = GPOS_NEW_ARRAY(m_mp, CWStringConst *, m_num_strings);
+		clib::Memset(m_wide_strings, 0,
+					 m_num_strings * GPOS_SIZEOF(CWStringConst *));
+	}
+
+	if (NULL == m_wide_strings[id])
+	{
+		const ULONG length = (ULONG) XMLString::stringLen(m_strings[id]);
+		CAutoRg<WCHAR> wsz(GPOS_NEW_ARRAY(m_mp, WCHAR, length + 1));
+		CDXLBinaryFormat::CopyToWideChars(wsz.Rgt(), m_strings[id]);
+		m_wide_strings[id] = GPOS_NEW(m_mp) CWStringConst(m_mp, wsz.Rgt());
+	}
+
+	return m_wide_strings[id];
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::Replay
+//
+//	@doc:
+//		Replay the records as SAX events. With a parse handler manager, every
+//		event goes to the handler that is active at that point, like it does
+//		when Xerces drives the handlers.
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::Replay(CParseHandlerManager *parse_handler_mgr,
+						 DefaultHandler *handler)
+{
+	GPOS_ASSERT((NULL == parse_handler_mgr) != (NULL == handler));
+
+	m_offset = GPOS_SIZEOF(CDXLBinaryFormat::SHeader);
+	m_depth = 0;
+
+	ULONG num_records = 0;
+	EdxlBinaryRecord record_type = ReadRecord();
+	while (EdxlbinaryEnd != record_type)
+	{
+		if (NULL != parse_handler_mgr)
+		{
+			handler = parse_handler_mgr->GetCurrentParseHandler();
+			if (NULL == handler)
+			{
+				RaiseError(GPOS_WSZ_LIT("element outside of the document"));
+			}
+		}
+
+		const ULONG *element = GetOpenElement();
+		if (EdxlbinaryStartElement == record_type)
+		{
+			handler->startElement(m_strings[element[0]], m_strings[element[1]],
+								  m_strings[element[2]], m_attrs);
+		}
+		else
+		{
+			handler->endElement(m_strings[element[0]], m_strings[element[1]],
+								m_strings[element[2]]);
+			m_depth--;
+		}
+
+		if (0 == ++num_records % GPDXL_BINARY_CFA_FREQUENCY)
+		{
+			GPOS_CHECK_ABORT;
+		}
+
+		record_type = ReadRecord();
+	}
+}
+
+// replay the document into the active parse handlers of the manager
+void
+CDXLBinaryReader::Parse(CParseHandlerManager *parse_handler_mgr)
+{
+	GPOS_ASSERT(NULL != parse_handler_mgr);
+
+	Replay(parse_handler_mgr, NULL);
+}
+
+// replay the document into the given SAX handler
+void
+CDXLBinaryReader::Parse(DefaultHandler *handler)
+{
+	GPOS_ASSERT(NULL != handler);
+
+	Replay(NULL, handler);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryReader::Serialize
+//
+//	@doc:
+//		Write the document as XML. Elements are written with their qualified
+//		names; the namespace declarations are attributes of the root element.
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryReader::Serialize(CXMLSerializer *xml_serializer)
+{
+	GPOS_ASSERT(NULL != xml_serializer);
+
+	m_offset = GPOS_SIZEOF(CDXLBinaryFormat::SHeader);
+	m_depth = 0;
+
+	EdxlBinaryRecord record_type = ReadRecord();
+	while (EdxlbinaryEnd != record_type)
+	{
+		const ULONG *element = GetOpenElement();
+		if (EdxlbinaryStartElement == record_type)
+		{
+			xml_serializer->OpenElement(NULL, GetWideString(element[2]));
+
+			const ULONG num_attrs = (ULONG) m_attrs.getLength();
+			for (ULONG ul = 0; ul < num_attrs; ul++)
+			{
+				xml_serializer->AddAttribute(
+					GetWideString(m_attr_ids[2 * ul]),
+					GetWideString(m_attr_ids[2 * ul + 1]));
+			}
+		}
+		else
+		{
+			xml_serializer->CloseElement(NULL, GetWideString(element[2]));
+			m_depth--;
+		}
+
+		record_type = ReadRecord();
+	}
+}
+
+//---------------------------------------------------------------------------
+//	CDXLBinaryReader::CBinaryAttributes
+//
+//	Attributes have no namespace, so lookups by URI and local name only
+//	compare the local names
+//---------------------------------------------------------------------------
+
+// number of attributes
+XMLSize_t
+CDXLBinaryReader::CBinaryAttributes::getLength() const
+{
+	return m_length;
+}
+
+// namespace URI of the attribute
+const XMLCh *
+CDXLBinaryReader::CBinaryAttributes::getURI(const XMLSize_t index) const
+{
+	return index < m_length ? xmlszEmpty : NULL;
+}
+
+// local name of the attribute: its qualified name without the prefix
+const XMLCh *
+CDXLBinaryReader::CBinaryAttributes::getLocalName(const XMLSize_t index) const
+{
+	if (m_length <= index)
+	{
+		return NULL;
+	}
+
+	const XMLCh *qname = m_names[index];
+	for (const XMLCh *xmlch = qname; 0 != *xmlch; xmlch++)
+	{
+		if (':' == *xmlch)
+		{
+			return xmlch + 1;
+		}
+	}
+
+	return qname;
+}
+
+// qualified name of the attribute
+const XMLCh *
+CDXLBinaryReader::CBinaryAttributes::getQName(const XMLSize_t index) const
+{
+	return index < m_length ? m_names[index] : NULL;
+}
+
+// type of the attribute
+const XMLCh *
+CDXLBinaryReader::CBinaryAttributes::getType(const XMLSize_t index) const
+{
+	return index < m_length ? xmlszCDATA : NULL;
+}
+
+// value of the attribute
+const XMLCh *
+CDXLBinaryReader::CBinaryAttributes::getValue(const XMLSize_t index) const
+{
+	return index < m_length ? m_values[index] : NULL;
+}
+
+// index of the attribute with the given local name
+bool
+CDXLBinaryReader::CBinaryAttributes::getIndex(const XMLCh *const,  // uri
+											  const XMLCh *const local_part,
+											  XMLSize_t &index) const
+{
+	for (ULONG ul = 0; ul < m_length; ul++)
+	{
+		if (XMLString::equals(getLocalName(ul), local_part))
+		{
+			index = ul;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// index of the attribute with the given local name, -1 if there is none
+int
+CDXLBinaryReader::CBinaryAttributes::getIndex(
+	const XMLCh *const uri, const XMLCh *const local_part) const
+{
+	XMLSize_t index = 0;
+	if (getIndex(uri, local_part, index))
+	{
+		return (int) index;
+	}
+
+	return -1;
+}
+
+// index of the attribute with the given qualified name
+bool
+CDXLBinaryReader::CBinaryAttributes::getIndex(const XMLCh *const qname,
+											  XMLSize_t &index) const
+{
+	for (ULONG ul = 0; ul < m_length; ul++)
+	{
+		if (XMLString::equals(m_names[ul], qname))
+		{
+			index = ul;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// index of the attribute with the given qualified name, -1 if there is none
+int
+CDXLBinaryReader::CBinaryAttributes::getIndex(const XMLCh *const qname) const
+{
+	XMLSize_t index = 0;
+	if (getIndex(qname, index))
+	{
+		return (int) index;
+	}
+
+	return -1;
+}
+
+// type of the attribute with the given local name
+const XMLCh *
+CDXLBinaryReader::CBinaryAttributes::getType(
+	const XMLCh *const uri, const XMLCh *const local_part) const
+{
+	XMLSize_t index = 0;
+	if (getIndex(uri, local_part, index))
+	{
+		return xmlszCDATA;
+	}
+
+	return NULL;
+}
+
+// type of the attribute with the given qualified name
+const XMLCh *
+CDXLBinaryReader::CBinaryAttributes::getType(const XMLCh *const qname) const
+{
+	XMLSize_t index = 0;
+	if (getIndex(qname, index))
+	{
+		return xmlszCDATA;
+	}
+
+	return NULL;
+}
+
+// value of the attribute with the given local name
+const XMLCh *
+CDXLBinaryReader::CBinaryAttributes::getValue(
+	const XMLCh *const uri, const XMLCh *const local_part) const
+{
+	XMLSize_t index = 0;
+	if (getIndex(uri, local_part, index))
+	{
+		return m_values[index];
+	}
+
+	return NULL;
+}
+
+// value of the attribute with the given qualified name; this is how the
+// parse handlers look up attributes
+const XMLCh *
+CDXLBinaryReader::CBinaryAttributes::getValue(const XMLCh *const qname) const
+{
+	for (ULONG ul = 0; ul < m_length; ul++)
+	{
+		if (XMLString::equals(m_names[ul], qname))
+		{
+			return m_values[ul];
+		}
+	}
+
+	return NULL;
+}
+
+// EOF
@@ -0,0 +1,415 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLBinaryWriter.cpp
+//
+//	@doc:
+//		Implementation of the class for creating binary DXL documents
+//---------------------------------------------------------------------------
+
+#include "naucrates/dxl/xml/CDXLBinaryWriter.h"
+
+#include <xercesc/util/XMLString.hpp>
+
+#include "naucrates/dxl/xml/dxltokens.h"
+
+using namespace gpdxl;
+
+// initial size of the document buffer
+#define GPDXL_BINARY_INITIAL_SIZE 4096
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::CDXLBinaryWriter
+//
+//	@doc:
+//		Constructor; reserves room for the header, which is filled in by
+//		Finish
+//
+//---------------------------------------------------------------------------
+CDXLBinaryWriter::CDXLBinaryWriter(CMemoryPool *mp)
+	: m_mp(mp),
+	  m_buffer(NULL),
+	  m_size(0),
+	  m_capacity(0),
+	  m_string_ids(NULL),
+	  m_strings(NULL),
+	  m_has_pending_element(false),
+	  m_pending_attrs(NULL),
+	  m_num_pending_attrs(0),
+	  m_pending_attrs_capacity(0),
+	  m_depth(0),
+	  m_finished(false),
+	  m_value(NULL),
+	  m_value_stream(NULL),
+	  m_qname(NULL),
+	  m_wide_chars(NULL),
+	  m_wide_chars_capacity(0)
+{
+	m_string_ids = GPOS_NEW(m_mp) StringToIdMap(m_mp);
+	m_strings = GPOS_NEW(m_mp) StringArray(m_mp);
+	m_value = GPOS_NEW(m_mp) CWStringDynamic(m_mp);
+	m_value_stream = GPOS_NEW(m_mp) COstreamString(m_value);
+	m_qname = GPOS_NEW(m_mp) CWStringDynamic(m_mp);
+
+	Reserve(GPDXL_BINARY_INITIAL_SIZE);
+	clib::Memset(m_buffer, 0, GPOS_SIZEOF(CDXLBinaryFormat::SHeader));
+	m_size = GPOS_SIZEOF(CDXLBinaryFormat::SHeader);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::~CDXLBinaryWriter
+//
+//	@doc:
+//		Destructor
+//
+//---------------------------------------------------------------------------
+CDXLBinaryWriter::~CDXLBinaryWriter()
+{
+	GPOS_DELETE_ARRAY(m_buffer);
+	GPOS_DELETE_ARRAY(m_pending_attrs);
+	GPOS_DELETE_ARRAY(m_wide_chars);
+	GPOS_DELETE(m_value_stream);
+	GPOS_DELETE(m_value);
+	GPOS_DELETE(m_qname);
+	m_strings->Release();
+	m_string_ids->Release();
+}
+
+// hash function for interned strings
+ULONG
+CDXLBinaryWriter::HashValue(const CWStringConst *str)
+{
+	return gpos::HashByteArray((const BYTE *) str->GetBuffer(),
+							   str->Length() * GPOS_SIZEOF(WCHAR));
+}
+
+// equality function for interned strings
+BOOL
+CDXLBinaryWriter::Equals(const CWStringConst *str1, const CWStringConst *str2)
+{
+	return str1->Equals(str2);
+}
+
+// make room for the given number of bytes
+void
+CDXLBinaryWriter::Reserve(ULONG num_bytes)
+{
+	if (m_size + num_bytes <= m_capacity)
+	{
+		return;
+	}
+
+	ULONG capacity = std::max(ULONG(GPDXL_BINARY_INITIAL_SIZE), m_capacity);
+	while (capacity < m_size + num_bytes)
+	{
+		capacity *= 2;
+	}
+
+	BYTE *buffer = GPOS_NEW_ARRAY(m_mp, BYTE, capacity);
+	if (NULL != m_buffer)
+	{
+		clib::Memcpy(buffer, m_buffer, m_size);
+		GPOS_DELETE_ARRAY(m_buffer);
+	}
+	m_buffer = buffer;
+	m_capacity = capacity;
+}
+
+// append bytes to the document
+void
+CDXLBinaryWriter::Write(const void *data, ULONG num_bytes)
+{
+	Reserve(num_bytes);
+	clib::Memcpy(m_buffer + m_size, data, num_bytes);
+	m_size += num_bytes;
+}
+
+// append a variable length integer, 7 bits per byte, least significant
+// first; the high bit of a byte is set if more bytes follow
+void
+CDXLBinaryWriter::WriteVarint(ULONG value)
+{
+	Reserve(5);
+	while (0x80 <= value)
+	{
+		m_buffer[m_size++] = (BYTE)(0x80 | (value & 0x7F));
+		value >>= 7;
+	}
+	m_buffer[m_size++] = (BYTE) value;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::GetStringId
+//
+//	@doc:
+//		Id of the given string; strings are interned on first use, and get
+//		consecutive ids
+//
+//---------------------------------------------------------------------------
+ULONG
+CDXLBinaryWriter::GetStringId(const WCHAR *wsz)
+{
+	CWStringConst str(wsz);
+	const ULONG *id = m_string_ids->Find(&str);
+	if (NULL != id)
+	{
+		return *id;
+	}
+
+	CWStringConst *interned_str = GPOS_NEW(m_mp) CWStringConst(m_mp, wsz);
+	ULONG new_id = m_strings->Size();
+	m_strings->Append(interned_str);
+	m_string_ids->Insert(interned_str, GPOS_NEW(m_mp) ULONG(new_id));
+
+	return new_id;
+}
+
+// id of the given SAX string, interning it if needed
+ULONG
+CDXLBinaryWriter::GetStringId(const XMLCh *xml_string)
+{
+	const ULONG length = (ULONG) XMLString::stringLen(xml_string);
+	if (m_wide_chars_capacity < length + 1)
+	{
+		GPOS_DELETE_ARRAY(m_wide_chars);
+		m_wide_chars_capacity = std::max(2 * m_wide_chars_capacity, length + 1);
+		m_wide_chars = GPOS_NEW_ARRAY(m_mp, WCHAR, m_wide_chars_capacity);
+	}
+	CDXLBinaryFormat::CopyToWideChars(m_wide_chars, xml_string);
+
+	return GetStringId(m_wide_chars);
+}
+
+// write the start record of the pending element
+void
+CDXLBinaryWriter::FlushPendingElement()
+{
+	if (!m_has_pending_element)
+	{
+		return;
+	}
+
+	Reserve(1);
+	m_buffer[m_size++] = (BYTE) EdxlbinaryStartElement;
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(m_pending_element); ul++)
+	{
+		WriteVarint(m_pending_element[ul]);
+	}
+
+	WriteVarint(m_num_pending_attrs / 2);
+	for (ULONG ul = 0; ul < m_num_pending_attrs; ul++)
+	{
+		WriteVarint(m_pending_attrs[ul]);
+	}
+
+	m_has_pending_element = false;
+	m_num_pending_attrs = 0;
+}
+
+// add a name/value pair to the pending element
+void
+CDXLBinaryWriter::AddAttributeIds(ULONG name_id, ULONG value_id)
+{
+	GPOS_ASSERT(m_has_pending_element);
+
+	if (m_pending_attrs_capacity < m_num_pending_attrs + 2)
+	{
+		ULONG capacity = std::max(ULONG(16), 2 * m_pending_attrs_capacity);
+		ULONG *pending_attrs = GPOS_NEW_ARRAY(m_mp, ULONG, capacity);
+		if (0 < m_num_pending_attrs)
+		{
+			clib::Memcpy(pending_attrs, m_pending_attrs,
+						 m_num_pending_attrs * GPOS_SIZEOF(ULONG));
+		}
+		GPOS_DELETE_ARRAY(m_pending_attrs);
+		m_pending_attrs = pending_attrs;
+		m_pending_attrs_capacity = capacity;
+	}
+
+	m_pending_attrs[m_num_pending_attrs++] = name_id;
+	m_pending_attrs[m_num_pending_attrs++] = value_id;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::OpenElement
+//
+//	@doc:
+//		Open an element with the given namespace prefix and name. Elements
+//		in the DXL namespace get the DXL namespace URI, as they would when
+//		parsed from XML.
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::OpenElement(const CWStringBase *ns_prefix,
+							  const CWStringBase *elem_str)
+{
+	GPOS_ASSERT(NULL != elem_str);
+	GPOS_ASSERT(!m_finished);
+
+	FlushPendingElement();
+
+	const ULONG local_id = GetStringId(elem_str->GetBuffer());
+	ULONG uri_id = 0;
+	ULONG qname_id = local_id;
+	if (NULL == ns_prefix)
+	{
+		uri_id = GetStringId(GPOS_WSZ_LIT(""));
+	}
+	else
+	{
+		const CWStringConst *dxl_prefix =
+			CDXLTokens::GetDXLTokenStr(EdxltokenNamespacePrefix);
+		if (ns_prefix->Equals(dxl_prefix))
+		{
+			uri_id = GetStringId(
+				CDXLTokens::GetDXLTokenStr(EdxltokenNamespaceURI)->GetBuffer());
+		}
+		else
+		{
+			uri_id = GetStringId(GPOS_WSZ_LIT(""));
+		}
+
+		m_qname->Reset();
+		m_qname->Append(ns_prefix);
+		m_qname->Append(CDXLTokens::GetDXLTokenStr(EdxltokenColon));
+		m_qname->Append(elem_str);
+		qname_id = GetStringId(m_qname->GetBuffer());
+	}
+
+	m_pending_element[0] = uri_id;
+	m_pending_element[1] = local_id;
+	m_pending_element[2] = qname_id;
+	m_has_pending_element = true;
+	m_depth++;
+}
+
+// close the current element
+void
+CDXLBinaryWriter::CloseElement()
+{
+	GPOS_ASSERT(0 < m_depth);
+
+	FlushPendingElement();
+
+	Reserve(1);
+	m_buffer[m_size++] = (BYTE) EdxlbinaryEndElement;
+	m_depth--;
+}
+
+// add an attribute to the current element
+void
+CDXLBinaryWriter::AddAttribute(const CWStringBase *name_str,
+							   const CWStringBase *value_str)
+{
+	GPOS_ASSERT(NULL != name_str);
+	GPOS_ASSERT(NULL != value_str);
+
+	AddAttributeIds(GetStringId(name_str->GetBuffer()),
+					GetStringId(value_str->GetBuffer()));
+}
+
+// add an attribute to the current element, with the value written into the
+// value stream
+void
+CDXLBinaryWriter::AddAttribute(const CWStringBase *name_str)
+{
+	AddAttribute(name_str, m_value);
+	m_value->Reset();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryWriter::Finish
+//
+//	@doc:
+//		Terminate the records, append the string table and fill in the
+//		header
+//
+//---------------------------------------------------------------------------
+void
+CDXLBinaryWriter::Finish()
+{
+	GPOS_ASSERT(0 == m_depth);
+	GPOS_ASSERT(!m_finished);
+
+	Reserve(1);
+	m_buffer[m_size++] = (BYTE) EdxlbinaryEnd;
+
+	const BYTE padding[4] = {0, 0, 0, 0};
+	Write(padding, (4 - m_size % 4) % 4);
+
+	const ULONG string_table_offset = m_size;
+	const ULONG num_strings = m_strings->Size();
+	for (ULONG ul = 0; ul < num_strings; ul++)
+	{
+		const CWStringConst *str = (*m_strings)[ul];
+		const ULONG length =
+			CDXLBinaryFormat::XMLChLength(str->GetBuffer(), str->Length());
+		Write(&length, GPOS_SIZEOF(ULONG));
+
+		const ULONG num_bytes = (length + 1) * GPOS_SIZEOF(XMLCh);
+		Reserve(num_bytes);
+		XMLCh *xml_string = (XMLCh *) (m_buffer + m_size);
+		CDXLBinaryFormat::CopyToXMLCh(xml_string, str->GetBuffer(),
+									  str->Length());
+		xml_string[length] = 0;
+		m_size += num_bytes;
+
+		Write(padding, (4 - m_size % 4) % 4);
+	}
+
+	CDXLBinaryFormat::SHeader header;
+	clib::Memcpy(header.m_magic, CDXLBinaryFormat::Magic,
+				 GPOS_SIZEOF(header.m_magic));
+	header.m_version = CDXLBinaryFormat::Version;
+	header.m_byte_order = CDXLBinaryFormat::ByteOrderMark;
+	header.m_size = m_size;
+	header.m_num_strings = num_strings;
+	header.m_string_table_offset = string_table_offset;
+	clib::Memcpy(m_buffer, &header, GPOS_SIZEOF(header));
+
+	m_finished = true;
+}
+
+// SAX handler for the start of an element of a converted XML document
+void
+CDXLBinaryWriter::startElement(const XMLCh *const element_uri,
+							   const XMLCh *const element_local_name,
+							   const XMLCh *const element_qname,
+							   const Attributes &attrs)
+{
+	GPOS_ASSERT(!m_finished);
+
+	FlushPendingElement();
+
+	m_pending_element[0] = GetStringId(element_uri);
+	m_pending_element[1] = GetStringId(element_local_name);
+	m_pending_element[2] = GetStringId(element_qname);
+	m_has_pending_element = true;
+	m_depth++;
+
+	const ULONG num_attrs = (ULONG) attrs.getLength();
+	for (ULONG ul = 0; ul < num_attrs; ul++)
+	{
+		AddAttributeIds(GetStringId(attrs.getQName(ul)),
+						GetStringId(attrs.getValue(ul)));
+	}
+}
+
+// SAX handler for the end of an element of a converted XML document
+void
+CDXLBinaryWriter::endElement(const XMLCh *const,  // element_uri,
+							 const XMLCh *const,  // element_local_name,
+							 const XMLCh *const	  // element_qname
+)
+{
+	CloseElement();
+}
+
+// EOF
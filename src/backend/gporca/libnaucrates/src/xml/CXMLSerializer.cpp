@@ -14,12 +14,37 @@
 #include "gpos/string/CWStringDynamic.h"
 
 #include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/xml/CDXLBinaryWriter.h"
 #include "naucrates/dxl/xml/dxltokens.h"
 
 using namespace gpdxl;
 
 #define GPDXL_SERIALIZE_CFA_FREQUENCY 30
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CXMLSerializer::CXMLSerializer
+//
+//	@doc:
+//		Constructor for writing a binary DXL document. Attribute values are
+//		formatted into the value stream of the writer, so that they are the
+//		same as in XML documents.
+//
+//---------------------------------------------------------------------------
+CXMLSerializer::CXMLSerializer(CMemoryPool *mp,
+							   CDXLBinaryWriter *binary_writer)
+	: m_mp(mp),
+	  m_os(binary_writer->GetValueStream()),
+	  m_indentation(false),
+	  m_strstackElems(NULL),
+	  m_fOpenTag(false),
+	  m_ulLevel(0),
+	  m_iteration_since_last_abortcheck(0),
+	  m_binary_writer(binary_writer)
+{
+	m_strstackElems = GPOS_NEW(m_mp) StrStack(m_mp);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CXMLSerializer::~CXMLSerializer
@@ -45,6 +70,12 @@ void
 CXMLSerializer::StartDocument()
 {
 	GPOS_ASSERT(m_strstackElems->IsEmpty());
+	if (NULL != m_binary_writer)
+	{
+		// the writer starts the document with its header
+		return;
+	}
+
 	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenXMLDocHeader)->GetBuffer();
 	if (m_indentation)
 	{
@@ -77,6 +108,14 @@ CXMLSerializer::OpenElement(const CWStringBase *pstrNamespace,
 	// put element on the stack
 	m_strstackElems->Push(elem_str);
 
+	if (NULL != m_binary_writer)
+	{
+		m_binary_writer->OpenElement(pstrNamespace, elem_str);
+		m_fOpenTag = true;
+		m_ulLevel++;
+		return;
+	}
+
 	// write the closing bracket for the previous element if necessary and add indentation
 	if (m_fOpenTag)
 	{
@@ -131,7 +170,12 @@ CXMLSerializer::CloseElement(const CWStringBase *pstrNamespace,
 
 	GPOS_ASSERT(strOpenElem->Equals(elem_str));
 
-	if (m_fOpenTag)
+	if (NULL != m_binary_writer)
+	{
+		m_binary_writer->CloseElement();
+		m_fOpenTag = false;
+	}
+	else if (m_fOpenTag)
 	{
 		// singleton element with no children - close the element with "/>"
 		m_os << CDXLTokens::GetDXLTokenStr(EdxltokenBracketCloseSingletonTag)
@@ -185,12 +229,16 @@ CXMLSerializer::AddAttribute(const CWStringBase *pstrAttr,
 	GPOS_ASSERT(NULL != str_value);
 
 	GPOS_ASSERT(m_fOpenTag);
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenSpace)->GetBuffer()
-		 << pstrAttr->GetBuffer()
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenEq)->GetBuffer()	  // =
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // "
+	if (NULL != m_binary_writer)
+	{
+		// values are stored unescaped
+		m_binary_writer->AddAttribute(pstrAttr, str_value);
+		return;
+	}
+
+	OpenAttribute(pstrAttr);
 	WriteEscaped(m_os, str_value);
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // "
+	CloseAttribute(pstrAttr);
 }
 
 //---------------------------------------------------------------------------
@@ -208,12 +256,9 @@ CXMLSerializer::AddAttribute(const CWStringBase *pstrAttr, const CHAR *szValue)
 	GPOS_ASSERT(NULL != szValue);
 
 	GPOS_ASSERT(m_fOpenTag);
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenSpace)->GetBuffer()
-		 << pstrAttr->GetBuffer()
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenEq)->GetBuffer()	 // =
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer()	 // "
-		 << szValue
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // "
+	OpenAttribute(pstrAttr);
+	m_os << szValue;
+	CloseAttribute(pstrAttr);
 }
 
 //---------------------------------------------------------------------------
@@ -231,12 +276,9 @@ CXMLSerializer::AddAttribute(const CWStringBase *pstrAttr, ULONG ulValue)
 	GPOS_ASSERT(NULL != pstrAttr);
 
 	GPOS_ASSERT(m_fOpenTag);
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenSpace)->GetBuffer()
-		 << pstrAttr->GetBuffer()
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenEq)->GetBuffer()	 // =
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer()	 // \"
-		 << ulValue
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // \"
+	OpenAttribute(pstrAttr);
+	m_os << ulValue;
+	CloseAttribute(pstrAttr);
 }
 
 //---------------------------------------------------------------------------
@@ -254,12 +296,9 @@ CXMLSerializer::AddAttribute(const CWStringBase *pstrAttr, ULLONG ullValue)
 	GPOS_ASSERT(NULL != pstrAttr);
 
 	GPOS_ASSERT(m_fOpenTag);
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenSpace)->GetBuffer()
-		 << pstrAttr->GetBuffer()
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenEq)->GetBuffer()	 // =
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer()	 // \"
-		 << ullValue
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // \"
+	OpenAttribute(pstrAttr);
+	m_os << ullValue;
+	CloseAttribute(pstrAttr);
 }
 
 //---------------------------------------------------------------------------
@@ -277,12 +316,9 @@ CXMLSerializer::AddAttribute(const CWStringBase *pstrAttr, INT iValue)
 	GPOS_ASSERT(NULL != pstrAttr);
 
 	GPOS_ASSERT(m_fOpenTag);
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenSpace)->GetBuffer()
-		 << pstrAttr->GetBuffer()
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenEq)->GetBuffer()	 // =
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer()	 // \"
-		 << iValue
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // \"
+	OpenAttribute(pstrAttr);
+	m_os << iValue;
+	CloseAttribute(pstrAttr);
 }
 
 //---------------------------------------------------------------------------
@@ -300,12 +336,9 @@ CXMLSerializer::AddAttribute(const CWStringBase *pstrAttr, LINT value)
 	GPOS_ASSERT(NULL != pstrAttr);
 
 	GPOS_ASSERT(m_fOpenTag);
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenSpace)->GetBuffer()
-		 << pstrAttr->GetBuffer()
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenEq)->GetBuffer()	 // =
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer()	 // \"
-		 << value
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // \"
+	OpenAttribute(pstrAttr);
+	m_os << value;
+	CloseAttribute(pstrAttr);
 }
 
 //---------------------------------------------------------------------------
@@ -323,12 +356,9 @@ CXMLSerializer::AddAttribute(const CWStringBase *pstrAttr, CDouble value)
 	GPOS_ASSERT(NULL != pstrAttr);
 
 	GPOS_ASSERT(m_fOpenTag);
-	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenSpace)->GetBuffer()
-		 << pstrAttr->GetBuffer()
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenEq)->GetBuffer()	 // =
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer()	 // \"
-		 << value
-		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // \"
+	OpenAttribute(pstrAttr);
+	m_os << value;
+	CloseAttribute(pstrAttr);
 }
 
 //---------------------------------------------------------------------------
@@ -357,6 +387,52 @@ CXMLSerializer::AddAttribute(const CWStringBase *pstrAttr, BOOL fValue)
 	AddAttribute(pstrAttr, str_value);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CXMLSerializer::OpenAttribute
+//
+//	@doc:
+//		Start an attribute of the currently open XML tag; the caller writes
+//		the value to the output stream. Binary documents take the value from
+//		the stream when the attribute is closed.
+//
+//---------------------------------------------------------------------------
+void
+CXMLSerializer::OpenAttribute(const CWStringBase *pstrAttr)
+{
+	GPOS_ASSERT(NULL != pstrAttr);
+
+	if (NULL != m_binary_writer)
+	{
+		return;
+	}
+
+	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenSpace)->GetBuffer()
+		 << pstrAttr->GetBuffer()
+		 << CDXLTokens::GetDXLTokenStr(EdxltokenEq)->GetBuffer()	  // =
+		 << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // "
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXMLSerializer::CloseAttribute
+//
+//	@doc:
+//		End an attribute of the currently open XML tag
+//
+//---------------------------------------------------------------------------
+void
+CXMLSerializer::CloseAttribute(const CWStringBase *pstrAttr)
+{
+	if (NULL != m_binary_writer)
+	{
+		m_binary_writer->AddAttribute(pstrAttr);
+		return;
+	}
+
+	m_os << CDXLTokens::GetDXLTokenStr(EdxltokenQuote)->GetBuffer();  // "
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CXMLSerializer::Indent
@@ -87,6 +87,7 @@ CDXLTokens::Init(CMemoryPool *mp)
 		 GPOS_WSZ_LIT("PushGroupByBelowSetopThreshold")},
 		{EdxltokenXformBindThreshold, GPOS_WSZ_LIT("XformBindThreshold")},
 		{EdxltokenSkewFactor, GPOS_WSZ_LIT("SkewFactor")},
+		{EdxltokenMemoMemoryBudget, GPOS_WSZ_LIT("MemoMemoryBudget")},
 		{EdxltokenWindowOids, GPOS_WSZ_LIT("WindowOids")},
 		{EdxltokenOidRowNumber, GPOS_WSZ_LIT("RowNumber")},
 		{EdxltokenOidRank, GPOS_WSZ_LIT("Rank")},
@@ -402,6 +403,8 @@ CDXLTokens::Init(CMemoryPool *mp)
 		{EdxltokenColNdvRemain, GPOS_WSZ_LIT("NdvRemain")},
 		{EdxltokenColFreqRemain, GPOS_WSZ_LIT("FreqRemain")},
 		{EdxltokenColStatsMissing, GPOS_WSZ_LIT("ColStatsMissing")},
+		{EdxltokenColHLLPrecision, GPOS_WSZ_LIT("HLLPrecision")},
+		{EdxltokenColHLLRegisters, GPOS_WSZ_LIT("HLLRegisters")},
 
 		{EdxltokenParamId, GPOS_WSZ_LIT("ParamId")},
 
@@ -506,6 +509,10 @@ CDXLTokens::Init(CMemoryPool *mp)
 		{EdxltokenRelationStats, GPOS_WSZ_LIT("RelationStatistics")},
 		{EdxltokenColumnStats, GPOS_WSZ_LIT("ColumnStatistics")},
 		{EdxltokenColumnStatsBucket, GPOS_WSZ_LIT("StatsBucket")},
+		{EdxltokenExtendedStats, GPOS_WSZ_LIT("ExtendedStatistics")},
+		{EdxltokenColumnGroupStats, GPOS_WSZ_LIT("ColumnGroupStatistics")},
+		{EdxltokenFunctionalDependency, GPOS_WSZ_LIT("FunctionalDependency")},
+		{EdxltokenDependencyDegree, GPOS_WSZ_LIT("Degree")},
 		{EdxltokenEmptyRelation, GPOS_WSZ_LIT("EmptyRelation")},
 
 		{EdxltokenIsNull, GPOS_WSZ_LIT("IsNull")},
@@ -0,0 +1,570 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		main.cpp
+//
+//	@doc:
+//		Optimizer benchmark driver; replays minidumps a number of times and
+//		reports optimization time, peak memory and search space size of each
+//		of them, optionally comparing the results against a baseline report
+//---------------------------------------------------------------------------
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gpos/_api.h"
+#include "gpos/common/CMainArgs.h"
+#include "gpos/common/CWallClock.h"
+#include "gpos/common/clibwrapper.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/test/CUnittest.h"
+#include "gpos/types.h"
+
+#include "gpopt/cost/ICostModel.h"
+#include "gpopt/init.h"
+#include "gpopt/mdcache/CMDCache.h"
+#include "gpopt/minidump/CDXLMinidump.h"
+#include "gpopt/minidump/CMinidumperUtils.h"
+#include "gpopt/optimizer/COptimizer.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
+#include "naucrates/init.h"
+
+#include "unittest/base.h"
+
+using namespace gpos;
+using namespace gpopt;
+using namespace gpdxl;
+
+// default number of times each minidump is optimized
+#define GPOPT_BENCH_RUNS 5
+
+// default regression threshold, in percent
+#define GPOPT_BENCH_THRESHOLD 10.0
+
+// columns of a benchmark report
+#define GPOPT_BENCH_HEADER                                              \
+	"minidump\truns\ttime_min_us\ttime_median_us\tpeak_memory_bytes\t" \
+	"groups\tgroup_exprs\tjobs\txforms_filtered_operator\t"            \
+	"xforms_filtered_pattern"
+
+//---------------------------------------------------------------------------
+//	@struct:
+//		SBenchResult
+//
+//	@doc:
+//		Measurements of one minidump, aggregated over all runs
+//
+//---------------------------------------------------------------------------
+struct SBenchResult
+{
+	// number of runs
+	ULONG m_ulRuns;
+
+	// fastest optimization time
+	ULLONG m_ullTimeMin;
+
+	// median optimization time
+	ULLONG m_ullTimeMedian;
+
+	// highest peak memory of the optimization pool over all runs
+	ULLONG m_ullPeakMemory;
+
+	// number of memo groups
+	ULLONG m_ullGroups;
+
+	// number of memo group expressions
+	ULLONG m_ullGroupExprs;
+
+	// number of jobs completed by the scheduler
+	ULLONG m_ullJobs;
+
+	// number of candidate xforms dropped by the operator index
+	ULLONG m_ullXformsFiltered;
+
+	// number of candidate xforms dropped by the pattern pre-check
+	ULLONG m_ullPatternMismatches;
+
+	// ctor
+	SBenchResult()
+		: m_ulRuns(0),
+		  m_ullTimeMin(0),
+		  m_ullTimeMedian(0),
+		  m_ullPeakMemory(0),
+		  m_ullGroups(0),
+		  m_ullGroupExprs(0),
+		  m_ullJobs(0),
+		  m_ullXformsFiltered(0),
+		  m_ullPatternMismatches(0)
+	{
+	}
+};
+
+typedef std::map<std::string, SBenchResult> BenchResultMap;
+
+//---------------------------------------------------------------------------
+//	@struct:
+//		SBenchOptions
+//
+//	@doc:
+//		Benchmark options, filled in from the command line
+//
+//---------------------------------------------------------------------------
+struct SBenchOptions
+{
+	// minidumps to replay
+	std::vector<std::string> m_minidumps;
+
+	// number of runs per minidump
+	ULONG m_ulRuns;
+
+	// report file, or NULL to trace the report only
+	const CHAR *m_szReport;
+
+	// baseline report, or NULL
+	const CHAR *m_szBaseline;
+
+	// regression threshold in percent
+	DOUBLE m_dThreshold;
+};
+
+// number of metrics that regressed against the baseline
+static ULONG regressions = 0;
+
+// set when the benchmark could not run to completion
+static BOOL failed = false;
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		FReadList
+//
+//	@doc:
+//		Append the minidumps named in the given file, one per line; blank
+//		lines and lines starting with '#' are skipped
+//
+//---------------------------------------------------------------------------
+static BOOL
+FReadList(const CHAR *szFile, std::vector<std::string> *minidumps)
+{
+	std::ifstream in(szFile);
+	if (!in)
+	{
+		GPOS_TRACE_FORMAT_ERR("Cannot open minidump list %s", szFile);
+		return false;
+	}
+
+	std::string line;
+	while (std::getline(in, line))
+	{
+		const SIZE_T begin = line.find_first_not_of(" \t\r");
+		if (std::string::npos == begin || '#' == line[begin])
+		{
+			continue;
+		}
+		const SIZE_T end = line.find_last_not_of(" \t\r");
+		minidumps->push_back(line.substr(begin, end - begin + 1));
+	}
+
+	return true;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		FReadBaseline
+//
+//	@doc:
+//		Load a report written by an earlier run of the benchmark
+//
+//---------------------------------------------------------------------------
+static BOOL
+FReadBaseline(const CHAR *szFile, BenchResultMap *baseline)
+{
+	std::ifstream in(szFile);
+	if (!in)
+	{
+		GPOS_TRACE_FORMAT_ERR("Cannot open baseline %s", szFile);
+		return false;
+	}
+
+	std::string line;
+	while (std::getline(in, line))
+	{
+		if (line.empty() || 0 == line.compare(0, 8, "minidump"))
+		{
+			continue;
+		}
+
+		std::istringstream fields(line);
+		std::string name;
+		SBenchResult result;
+		if (!std::getline(fields, name, '\t') ||
+			!(fields >> result.m_ulRuns >> result.m_ullTimeMin >>
+			  result.m_ullTimeMedian >> result.m_ullPeakMemory >>
+			  result.m_ullGroups >> result.m_ullGroupExprs >> result.m_ullJobs))
+		{
+			GPOS_TRACE_FORMAT_ERR("Malformed baseline line: %s", line.c_str());
+			return false;
+		}
+
+		// filtering counters are missing from older baselines
+		fields >> result.m_ullXformsFiltered >> result.m_ullPatternMismatches;
+		(*baseline)[name] = result;
+	}
+
+	return true;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UlSegments
+//
+//	@doc:
+//		Number of segments to optimize for; same rule as the minidump tests
+//
+//---------------------------------------------------------------------------
+static ULONG
+UlSegments(COptimizerConfig *optimizer_config)
+{
+	ULONG ulSegments = GPOPT_TEST_SEGMENTS;
+	if (NULL != optimizer_config->GetCostModel())
+	{
+		ulSegments = std::max(ulSegments,
+							  optimizer_config->GetCostModel()->UlHosts());
+	}
+
+	return ulSegments;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		Run
+//
+//	@doc:
+//		Optimize the given minidump the requested number of times; every run
+//		starts with an empty metadata cache and a fresh memory pool
+//
+//---------------------------------------------------------------------------
+static SBenchResult
+Run(const CHAR *szMinidump, ULONG ulRuns)
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CDXLMinidump *pdxlmd = CMinidumperUtils::PdxlmdLoad(mp, szMinidump);
+	GPOS_CHECK_ABORT;
+
+	COptimizerConfig *optimizer_config = pdxlmd->GetOptimizerConfig();
+	if (NULL == optimizer_config)
+	{
+		optimizer_config = COptimizerConfig::PoconfDefault(mp);
+	}
+	else
+	{
+		optimizer_config->AddRef();
+	}
+
+	const ULONG ulSegments = UlSegments(optimizer_config);
+
+	SBenchResult result;
+	std::vector<ULLONG> times;
+	for (ULONG ul = 0; ul < ulRuns; ul++)
+	{
+		CAutoMemoryPool ampRun;
+		CMemoryPool *pmpRun = ampRun.Pmp();
+		SOptimizerMetrics metrics;
+
+		CWallClock clock;
+		CDXLNode *pdxlnPlan = CMinidumperUtils::PdxlnExecuteMinidump(
+			pmpRun, pdxlmd, szMinidump, ulSegments, 1 /*ulSessionId*/,
+			1 /*ulCmdId*/, optimizer_config, NULL /*pceeval*/, &metrics);
+		times.push_back(clock.ElapsedUS());
+
+		pdxlnPlan->Release();
+
+		result.m_ullPeakMemory =
+			std::max(result.m_ullPeakMemory, pmpRun->PeakAllocatedSize());
+
+		// the search space is deterministic, keep the last run's
+		result.m_ullGroups = metrics.m_ulGroups;
+		result.m_ullGroupExprs = metrics.m_ulGroupExprs;
+		result.m_ullJobs = metrics.m_ullJobs;
+		result.m_ullXformsFiltered = metrics.m_ullXformsFiltered;
+		result.m_ullPatternMismatches = metrics.m_ullPatternMismatches;
+	}
+
+	std::sort(times.begin(), times.end());
+	result.m_ulRuns = ulRuns;
+	result.m_ullTimeMin = times[0];
+	result.m_ullTimeMedian = times[ulRuns / 2];
+
+	optimizer_config->Release();
+	GPOS_DELETE(pdxlmd);
+
+	return result;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		FRegressed
+//
+//	@doc:
+//		Check a single metric against its baseline value and trace it if it
+//		grew beyond the threshold
+//
+//---------------------------------------------------------------------------
+static BOOL
+FRegressed(const std::string &minidump, const CHAR *szMetric, ULLONG ullBase,
+		   ULLONG ullCurrent, DOUBLE dThreshold)
+{
+	if ((DOUBLE) ullCurrent <= (DOUBLE) ullBase * (1.0 + dThreshold / 100.0))
+	{
+		return false;
+	}
+
+	GPOS_TRACE_FORMAT_ERR("REGRESSION %s: %s %llu -> %llu", minidump.c_str(),
+						  szMetric, ullBase, ullCurrent);
+	return true;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		UlCompare
+//
+//	@doc:
+//		Compare the results of a minidump against the baseline; returns the
+//		number of regressed metrics
+//
+//---------------------------------------------------------------------------
+static ULONG
+UlCompare(const std::string &minidump, const SBenchResult &base,
+		  const SBenchResult &current, DOUBLE dThreshold)
+{
+	ULONG ulRegressions = 0;
+	ulRegressions +=
+		FRegressed(minidump, "time_median_us", base.m_ullTimeMedian,
+				   current.m_ullTimeMedian, dThreshold);
+	ulRegressions +=
+		FRegressed(minidump, "peak_memory_bytes", base.m_ullPeakMemory,
+				   current.m_ullPeakMemory, dThreshold);
+	ulRegressions += FRegressed(minidump, "groups", base.m_ullGroups,
+								current.m_ullGroups, dThreshold);
+	ulRegressions += FRegressed(minidump, "group_exprs", base.m_ullGroupExprs,
+								current.m_ullGroupExprs, dThreshold);
+	ulRegressions += FRegressed(minidump, "jobs", base.m_ullJobs,
+								current.m_ullJobs, dThreshold);
+
+	return ulRegressions;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		FParseOptions
+//
+//	@doc:
+//		Fill in the benchmark options from the command line
+//
+//		-d <file>	minidump to replay; may be repeated
+//		-f <file>	file listing minidumps to replay, one per line
+//		-n <runs>	number of runs per minidump
+//		-o <file>	write the report to the given file
+//		-b <file>	compare against the given baseline report
+//		-t <pct>	regression threshold in percent
+//		-T <flag>	enable the given trace flag
+//
+//---------------------------------------------------------------------------
+static BOOL
+FParseOptions(CMainArgs *pma, SBenchOptions *options)
+{
+	options->m_ulRuns = GPOPT_BENCH_RUNS;
+	options->m_szReport = NULL;
+	options->m_szBaseline = NULL;
+	options->m_dThreshold = GPOPT_BENCH_THRESHOLD;
+
+	CHAR ch = '\0';
+	while (pma->Getopt(&ch))
+	{
+		switch (ch)
+		{
+			case 'd':
+				options->m_minidumps.push_back(optarg);
+				break;
+
+			case 'f':
+				if (!FReadList(optarg, &options->m_minidumps))
+				{
+					return false;
+				}
+				break;
+
+			case 'n':
+				options->m_ulRuns = (ULONG) clib::Strtol(optarg, NULL, 10);
+				break;
+
+			case 'o':
+				options->m_szReport = optarg;
+				break;
+
+			case 'b':
+				options->m_szBaseline = optarg;
+				break;
+
+			case 't':
+				options->m_dThreshold = clib::Strtod(optarg);
+				break;
+
+			case 'T':
+				CUnittest::SetTraceFlag(optarg);
+				break;
+
+			default:
+				// ignore other parameters
+				break;
+		}
+	}
+
+	if (0 == options->m_ulRuns || options->m_minidumps.empty())
+	{
+		GPOS_TRACE_ERR(GPOS_WSZ_LIT(
+			"Usage: gporca_bench {-d minidump | -f list}... [-n runs] "
+			"[-o report] [-b baseline] [-t threshold]"));
+		return false;
+	}
+
+	return true;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		PvExec
+//
+//	@doc:
+//		Function driving execution
+//
+//---------------------------------------------------------------------------
+static void *
+PvExec(void *pv)
+{
+	CMainArgs *pma = (CMainArgs *) pv;
+
+	SBenchOptions options;
+	BenchResultMap baseline;
+	if (!FParseOptions(pma, &options) ||
+		(NULL != options.m_szBaseline &&
+		 !FReadBaseline(options.m_szBaseline, &baseline)))
+	{
+		failed = true;
+		return NULL;
+	}
+
+	InitDXL();
+	CMDCache::Init();
+
+	std::ostringstream report;
+	report << GPOPT_BENCH_HEADER << "\n";
+
+	for (SIZE_T ul = 0; ul < options.m_minidumps.size(); ul++)
+	{
+		const std::string &minidump = options.m_minidumps[ul];
+		SBenchResult result = Run(minidump.c_str(), options.m_ulRuns);
+
+		std::ostringstream line;
+		line << minidump << "\t" << result.m_ulRuns << "\t"
+			 << result.m_ullTimeMin << "\t" << result.m_ullTimeMedian << "\t"
+			 << result.m_ullPeakMemory << "\t" << result.m_ullGroups << "\t"
+			 << result.m_ullGroupExprs << "\t" << result.m_ullJobs << "\t"
+			 << result.m_ullXformsFiltered << "\t"
+			 << result.m_ullPatternMismatches;
+		GPOS_TRACE_FORMAT("%s", line.str().c_str());
+		report << line.str() << "\n";
+
+		if (NULL == options.m_szBaseline)
+		{
+			continue;
+		}
+
+		BenchResultMap::const_iterator it = baseline.find(minidump);
+		if (baseline.end() == it)
+		{
+			GPOS_TRACE_FORMAT("No baseline for %s", minidump.c_str());
+			continue;
+		}
+		regressions +=
+			UlCompare(minidump, it->second, result, options.m_dThreshold);
+	}
+
+	CMDCache::Shutdown();
+
+	if (NULL != options.m_szReport)
+	{
+		std::ofstream out(options.m_szReport);
+		out << report.str();
+		if (!out)
+		{
+			GPOS_TRACE_FORMAT_ERR("Cannot write report %s", options.m_szReport);
+			failed = true;
+		}
+	}
+
+	if (NULL != options.m_szBaseline)
+	{
+		GPOS_TRACE_FORMAT("%d regression(s) above %.1f%% threshold",
+						  regressions, options.m_dThreshold);
+	}
+
+	return NULL;
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		main
+//
+//	@doc:
+//		Entry point for the optimizer benchmark
+//
+//---------------------------------------------------------------------------
+INT
+main(INT iArgs, const CHAR **rgszArgs)
+{
+	// Use default allocator
+	struct gpos_init_params gpos_params = {NULL};
+
+	gpos_init(&gpos_params);
+	gpdxl_init();
+	gpopt_init();
+
+	GPOS_ASSERT(iArgs >= 0);
+
+	CMainArgs ma(iArgs, rgszArgs, "d:f:n:o:b:t:T:");
+
+	gpos_exec_params params;
+	params.func = PvExec;
+	params.arg = &ma;
+	params.stack_start = &params;
+	params.error_buffer = NULL;
+	params.error_buffer_size = -1;
+	params.abort_requested = NULL;
+
+	if (gpos_exec(&params) || failed || 0 != regressions)
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+
+// EOF
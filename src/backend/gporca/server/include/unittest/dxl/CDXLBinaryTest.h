@@ -0,0 +1,62 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLBinaryTest.h
+//
+//	@doc:
+//		Tests for binary DXL documents
+//---------------------------------------------------------------------------
+
+
+#ifndef GPOPT_CDXLBinaryTest_H
+#define GPOPT_CDXLBinaryTest_H
+
+#include "gpos/base.h"
+
+namespace gpdxl
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CDXLBinaryTest
+//
+//	@doc:
+//		Static unit tests
+//
+//---------------------------------------------------------------------------
+class CDXLBinaryTest
+{
+private:
+	// metadata file
+	static const CHAR *m_szMetadataFileName;
+
+	// sizes and parse times of minidumps in both forms
+	struct SComparison
+	{
+		ULLONG m_xml_size;
+		ULLONG m_binary_size;
+		ULONG m_xml_parse_ms;
+		ULONG m_binary_parse_ms;
+	};
+
+	// parse a minidump in both forms and add up the comparison
+	static GPOS_RESULT EresCompareMinidump(const CHAR *file_name,
+										   SComparison *comparison);
+
+public:
+	// unittests
+	static GPOS_RESULT EresUnittest();
+	static GPOS_RESULT EresUnittest_Metadata();
+	static GPOS_RESULT EresUnittest_ConvertToDXL();
+	static GPOS_RESULT EresUnittest_Minidump();
+	static GPOS_RESULT EresUnittest_Malformed();
+
+};	// class CDXLBinaryTest
+}  // namespace gpdxl
+
+#endif	// !GPOPT_CDXLBinaryTest_H
+
+// EOF
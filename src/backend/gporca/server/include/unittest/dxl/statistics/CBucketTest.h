@@ -85,6 +85,9 @@ public:
 	// bucket intersect
 	static GPOS_RESULT EresUnittest_CBucketIntersect();
 
+	// flat bucket bounds agree with buckets
+	static GPOS_RESULT EresUnittest_CBucketBounds();
+
 	// bucket scaling tests
 	static GPOS_RESULT EresUnittest_CBucketScale();
 
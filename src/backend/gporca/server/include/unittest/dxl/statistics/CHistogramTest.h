@@ -32,6 +32,9 @@ private:
 	// including null fraction and nDistinctRemain
 	static CHistogram *PhistExampleInt4Remain(CMemoryPool *mp);
 
+	// generate a HyperLogLog sketch of the integers in [first, last]
+	static CHLLSketch *PhllSketchInt4(CMemoryPool *mp, INT first, INT last);
+
 public:
 	// unittests
 	static GPOS_RESULT EresUnittest();
@@ -46,11 +49,17 @@ public:
 	// skew basic tests
 	static GPOS_RESULT EresUnittest_Skew();
 
+	// frequency of the most frequent value
+	static GPOS_RESULT EresUnittest_MaxValueFreq();
+
 	// merge basic tests
 	static GPOS_RESULT EresUnittest_MergeUnion();
 
 	// merge union test with double values differing by less than epsilon
 	static GPOS_RESULT EresUnittest_MergeUnionDoubleLessThanEpsilon();
+
+	// union all of histograms with HyperLogLog sketches
+	static GPOS_RESULT EresUnittest_UnionAllHLLSketch();
 };	// class CHistogramTest
 }  // namespace gpnaucrates
 
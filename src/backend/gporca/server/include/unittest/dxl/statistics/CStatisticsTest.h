@@ -90,6 +90,12 @@ private:
 		return pdrgpul;
 	}
 
+	// create stats for two int4 columns whose values are equal, optionally
+	// with a column group on the two columns
+	static CStatistics *PstatsCorrelatedColumns(CMemoryPool *mp, ULONG colid1,
+												ULONG colid2,
+												BOOL with_column_group);
+
 	// create a table descriptor with two columns having the given names
 	static CTableDescriptor *PtabdescTwoColumnSource(
 		CMemoryPool *mp, const CName &nameTable, const IMDTypeInt4 *pmdtype,
@@ -122,6 +128,9 @@ public:
 	// test that stats copy methods copy all fields
 	static GPOS_RESULT EresUnittest_CStatisticsCopy();
 
+	// test the estimates of filters, group by and joins on column groups
+	static GPOS_RESULT EresUnittest_ColumnGroups();
+
 
 };	// class CStatisticsTest
 }  // namespace gpnaucrates
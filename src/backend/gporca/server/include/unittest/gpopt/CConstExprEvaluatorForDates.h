@@ -61,6 +61,11 @@ public:
 	// caller takes ownership of returned expression
 	virtual CExpression *PexprEval(CExpression *pexpr);
 
+	// evaluate the given expressions one by one
+	// caller takes ownership of returned array
+	virtual CExpressionArray *PdrgpexprEval(CMemoryPool *mp,
+											CExpressionArray *pdrgpexpr);
+
 	// returns true iff the evaluator can evaluate constant expressions
 	virtual BOOL
 	FCanEvalExpressions()
@@ -119,6 +119,9 @@ public:
 	static GPOS_RESULT EresUnittest_CConstraintIntervalPexpr();
 	static GPOS_RESULT EresUnittest_CConstraintIntervalFromArrayExpr();
 
+	// test intervals of IN lists with many constants
+	static GPOS_RESULT EresUnittest_CConstraintIntervalFromLargeArrayExpr();
+
 #ifdef GPOS_DEBUG
 	// tests for unconstrainable types
 	static GPOS_RESULT EresUnittest_NegativeTests();
@@ -58,6 +58,9 @@ public:
 	// basic unittest
 	static GPOS_RESULT EresUnittest_Basic();
 
+	// optimization with a memory budget that is exceeded
+	static GPOS_RESULT EresUnittest_MemoryBudget();
+
 	// helper function for optimizing deep join trees
 	static GPOS_RESULT EresOptimize(
 		FnOptimize *pfopt,	 // optimization function
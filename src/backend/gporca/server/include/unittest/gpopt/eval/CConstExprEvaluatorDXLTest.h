@@ -58,14 +58,27 @@ private:
 		// dummy value to return
 		INT m_val;
 
+		// number of expressions evaluated so far
+		ULONG m_ulExprs;
+
+		// number of calls to the evaluator so far
+		ULONG m_ulCalls;
+
 		// private copy ctor
 		CDummyConstDXLNodeEvaluator(const CDummyConstDXLNodeEvaluator &);
 
+		// return the dummy value as DXL
+		gpdxl::CDXLNode *PdxlnDummyValue();
+
 	public:
 		// ctor
 		CDummyConstDXLNodeEvaluator(CMemoryPool *mp, CMDAccessor *md_accessor,
 									INT val)
-			: m_mp(mp), m_pmda(md_accessor), m_val(val)
+			: m_mp(mp),
+			  m_pmda(md_accessor),
+			  m_val(val),
+			  m_ulExprs(0),
+			  m_ulCalls(0)
 		{
 		}
 
@@ -77,6 +90,24 @@ private:
 		// evaluate the given DXL node representing an expression and returns a dummy value as DXL
 		virtual gpdxl::CDXLNode *EvaluateExpr(const gpdxl::CDXLNode *pdxlnExpr);
 
+		// evaluate the given DXL nodes and return a dummy value for each
+		virtual gpdxl::CDXLNodeArray *EvaluateExprs(
+			const gpdxl::CDXLNodeArray *pdrgpdxlnExpr);
+
+		// number of expressions evaluated so far
+		ULONG
+		UlExprs() const
+		{
+			return m_ulExprs;
+		}
+
+		// number of calls to the evaluator so far
+		ULONG
+		UlCalls() const
+		{
+			return m_ulCalls;
+		}
+
 		// can evaluate expressions
 		virtual BOOL
 		FCanEvalExpressions()
@@ -100,6 +131,9 @@ public:
 
 	// test that evaluation fails for a scalar with variables
 	static GPOS_RESULT EresUnittest_ScalarContainingVariables();
+
+	// test that expressions are evaluated in batches and only once
+	static GPOS_RESULT EresUnittest_BatchAndMemo();
 };
 }  // namespace gpopt
 
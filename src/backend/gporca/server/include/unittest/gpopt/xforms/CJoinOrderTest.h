@@ -35,6 +35,8 @@ public:
 	// unittests
 	static GPOS_RESULT EresUnittest();
 	static GPOS_RESULT EresUnittest_ExpandMinCard();
+	static GPOS_RESULT EresUnittest_ExpandDPhyp();
+	static GPOS_RESULT EresUnittest_ExpandDPv2();
 	static GPOS_RESULT EresUnittest_RunTests();
 
 };	// class CJoinOrderTest
@@ -31,6 +31,7 @@ public:
 	// unittests
 	static GPOS_RESULT EresUnittest();
 	static GPOS_RESULT EresUnittest_Basic();
+	static GPOS_RESULT EresUnittest_OperatorIndex();
 
 };	// class CXformFactoryTest
 
@@ -28,6 +28,7 @@
 // test headers
 
 #include "unittest/base.h"
+#include "unittest/dxl/CDXLBinaryTest.h"
 #include "unittest/dxl/CDXLMemoryManagerTest.h"
 #include "unittest/dxl/CDXLUtilsTest.h"
 #include "unittest/dxl/CParseHandlerCostModelTest.h"
@@ -163,6 +164,7 @@ static gpos::CUnittest rgut[] = {
 	GPOS_UNITTEST_STD(CTranslatorDXLToExprTest),
 	GPOS_UNITTEST_STD(CTranslatorExprToDXLTest),
 	GPOS_UNITTEST_STD(CXMLSerializerTest),
+	GPOS_UNITTEST_STD(CDXLBinaryTest),
 
 	// opt
 	GPOS_UNITTEST_STD(CArrayExpansionTest),
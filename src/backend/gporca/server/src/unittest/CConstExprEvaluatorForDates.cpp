@@ -89,4 +89,26 @@ CConstExprEvaluatorForDates::PexprEval(CExpression *pexpr)
 	return pexprResult;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorForDates::PdrgpexprEval
+//
+//	@doc:
+//		Evaluate the given date comparisons one by one
+//
+//---------------------------------------------------------------------------
+CExpressionArray *
+CConstExprEvaluatorForDates::PdrgpexprEval(CMemoryPool *mp,
+										   CExpressionArray *pdrgpexpr)
+{
+	CExpressionArray *pdrgpexprResult = GPOS_NEW(mp) CExpressionArray(mp);
+	const ULONG size = pdrgpexpr->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		pdrgpexprResult->Append(PexprEval((*pdrgpexpr)[ul]));
+	}
+
+	return pdrgpexprResult;
+}
+
 // EOF
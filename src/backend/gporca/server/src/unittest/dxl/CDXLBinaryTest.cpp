@@ -0,0 +1,321 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CDXLBinaryTest.cpp
+//
+//	@doc:
+//		Tests for writing and reading binary DXL documents
+//---------------------------------------------------------------------------
+
+#include "unittest/dxl/CDXLBinaryTest.h"
+
+#include "gpos/base.h"
+#include "gpos/common/CAutoRg.h"
+#include "gpos/common/CTimerUser.h"
+#include "gpos/error/CAutoTrace.h"
+#include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/test/CUnittest.h"
+
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/parser/CParseHandlerDXL.h"
+#include "naucrates/exception.h"
+
+using namespace gpos;
+using namespace gpdxl;
+
+// metadata file, as written by the serializer
+const CHAR *CDXLBinaryTest::m_szMetadataFileName =
+	"../data/dxl/parse_tests/q26-Metadata.xml";
+
+// TPC-DS minidumps, parsed both ways to compare sizes and parse times
+const CHAR *rgszTpcdsMinidumpFileNames[] = {
+	"../data/dxl/minidump/Tpcds-NonPart-Q70a.mdp",
+	"../data/dxl/minidump/Tpcds-10TB-Q37-NoIndexJoin.mdp",
+	"../data/dxl/minidump/TPCDS-39-InnerJoin-JoinEstimate.mdp",
+	"../data/dxl/minidump/LeftOuter2InnerUnionAllAntiSemiJoin-Tpcds.mdp",
+};
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryTest::EresUnittest
+//
+//	@doc:
+//		Unittest for binary DXL documents
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLBinaryTest::EresUnittest()
+{
+	CUnittest rgut[] = {
+		GPOS_UNITTEST_FUNC(CDXLBinaryTest::EresUnittest_Metadata),
+		GPOS_UNITTEST_FUNC(CDXLBinaryTest::EresUnittest_ConvertToDXL),
+		GPOS_UNITTEST_FUNC(CDXLBinaryTest::EresUnittest_Minidump),
+		GPOS_UNITTEST_FUNC_THROW(CDXLBinaryTest::EresUnittest_Malformed,
+								 gpdxl::ExmaDXL,
+								 gpdxl::ExmiDXLBinaryFormatError),
+	};
+
+	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryTest::EresUnittest_Metadata
+//
+//	@doc:
+//		Serialize metadata objects into a binary document, parse it back and
+//		check that the objects serialize to the original XML document
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLBinaryTest::EresUnittest_Metadata()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CAutoRg<CHAR> dxl_string(CDXLUtils::Read(mp, m_szMetadataFileName));
+	IMDCacheObjectArray *mdcache_obj_array =
+		CDXLUtils::ParseDXLToIMDObjectArray(mp, dxl_string.Rgt(),
+											NULL /*xsd_file_path*/);
+
+	ULONG size = 0;
+	CAutoRg<BYTE> buffer(
+		CDXLUtils::SerializeMetadataToBinary(mp, mdcache_obj_array, &size));
+	CParseHandlerDXL *parse_handler_dxl =
+		CDXLUtils::GetParseHandlerForDXLBinary(mp, buffer.Rgt(), size);
+
+	CWStringDynamic *metadata_str = CDXLUtils::SerializeMetadata(
+		mp, parse_handler_dxl->GetMdIdCachedObjArray(),
+		true /*serialize_header_footer*/, true /*indentation*/);
+
+	CWStringDynamic expected_str(mp);
+	expected_str.AppendFormat(GPOS_WSZ_LIT("%s"), dxl_string.Rgt());
+
+	GPOS_RESULT eres = GPOS_OK;
+	if (!expected_str.Equals(metadata_str))
+	{
+		GPOS_TRACE(metadata_str->GetBuffer());
+		eres = GPOS_FAILED;
+	}
+
+	// names and values are interned, which also drops the indentation
+	if (size >= expected_str.Length())
+	{
+		eres = GPOS_FAILED;
+	}
+
+	GPOS_DELETE(metadata_str);
+	GPOS_DELETE(parse_handler_dxl);
+	mdcache_obj_array->Release();
+
+	return eres;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryTest::EresUnittest_ConvertToDXL
+//
+//	@doc:
+//		Convert an XML document to binary and back, and check that the
+//		conversions are stable
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLBinaryTest::EresUnittest_ConvertToDXL()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CAutoRg<CHAR> dxl_string(CDXLUtils::Read(mp, m_szMetadataFileName));
+
+	ULONG size = 0;
+	CAutoRg<BYTE> buffer(
+		CDXLUtils::ConvertDXLToBinary(mp, dxl_string.Rgt(), &size));
+	CWStringDynamic *converted_str = CDXLUtils::ConvertBinaryToDXL(
+		mp, buffer.Rgt(), size, true /*indentation*/);
+
+	CWStringDynamic expected_str(mp);
+	expected_str.AppendFormat(GPOS_WSZ_LIT("%s"), dxl_string.Rgt());
+
+	GPOS_RESULT eres = GPOS_OK;
+	if (!expected_str.Equals(converted_str))
+	{
+		GPOS_TRACE(converted_str->GetBuffer());
+		eres = GPOS_FAILED;
+	}
+
+	// converting the converted document gives the same binary document
+	CAutoRg<CHAR> converted_sz(CDXLUtils::CreateMultiByteCharStringFromWCString(
+		mp, converted_str->GetBuffer()));
+	ULONG size_converted = 0;
+	CAutoRg<BYTE> buffer_converted(CDXLUtils::ConvertDXLToBinary(
+		mp, converted_sz.Rgt(), &size_converted));
+
+	if (size != size_converted ||
+		0 != clib::Memcmp(buffer.Rgt(), buffer_converted.Rgt(), size))
+	{
+		eres = GPOS_FAILED;
+	}
+
+	GPOS_DELETE(converted_str);
+
+	return eres;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryTest::EresCompareMinidump
+//
+//	@doc:
+//		Parse a minidump from XML and from binary, check that both give the
+//		same metadata and plan, and add up the sizes and parse times
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLBinaryTest::EresCompareMinidump(const CHAR *file_name,
+									SComparison *comparison)
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CAutoRg<CHAR> dxl_string(CDXLUtils::Read(mp, file_name));
+	ULONG size = 0;
+	CAutoRg<BYTE> buffer(
+		CDXLUtils::ConvertDXLToBinary(mp, dxl_string.Rgt(), &size));
+
+	CTimerUser timer;
+	CParseHandlerDXL *parse_handler_xml =
+		CDXLUtils::GetParseHandlerForDXLString(mp, dxl_string.Rgt(),
+											   NULL /*xsd_file_path*/);
+	ULONG xml_parse_ms = timer.ElapsedMS();
+
+	timer.Restart();
+	CParseHandlerDXL *parse_handler_binary =
+		CDXLUtils::GetParseHandlerForDXLBinary(mp, buffer.Rgt(), size);
+	ULONG binary_parse_ms = timer.ElapsedMS();
+
+	CWStringDynamic *metadata_xml = CDXLUtils::SerializeMetadata(
+		mp, parse_handler_xml->GetMdIdCachedObjArray(),
+		false /*serialize_header_footer*/, false /*indentation*/);
+	CWStringDynamic *metadata_binary = CDXLUtils::SerializeMetadata(
+		mp, parse_handler_binary->GetMdIdCachedObjArray(),
+		false /*serialize_header_footer*/, false /*indentation*/);
+
+	GPOS_RESULT eres = GPOS_OK;
+	if (!metadata_xml->Equals(metadata_binary))
+	{
+		eres = GPOS_FAILED;
+	}
+
+	if (NULL != parse_handler_xml->PdxlnPlan())
+	{
+		CWStringDynamic plan_xml(mp);
+		COstreamString oss_xml(&plan_xml);
+		CDXLUtils::SerializePlan(mp, oss_xml, parse_handler_xml->PdxlnPlan(),
+								 parse_handler_xml->GetPlanId(),
+								 parse_handler_xml->GetPlanSpaceSize(),
+								 false /*serialize_header_footer*/,
+								 false /*indentation*/);
+
+		CWStringDynamic plan_binary(mp);
+		COstreamString oss_binary(&plan_binary);
+		CDXLUtils::SerializePlan(
+			mp, oss_binary, parse_handler_binary->PdxlnPlan(),
+			parse_handler_binary->GetPlanId(),
+			parse_handler_binary->GetPlanSpaceSize(),
+			false /*serialize_header_footer*/, false /*indentation*/);
+
+		if (!plan_xml.Equals(&plan_binary))
+		{
+			eres = GPOS_FAILED;
+		}
+	}
+
+	const ULONG xml_size = clib::Strlen(dxl_string.Rgt());
+	{
+		CAutoTrace at(mp);
+		at.Os() << "Minidump " << file_name << ": " << xml_size
+				<< " bytes as XML, " << size
+				<< " bytes as binary DXL; parsed in " << xml_parse_ms
+				<< " ms from XML, " << binary_parse_ms << " ms from binary DXL";
+	}
+
+	comparison->m_xml_size += xml_size;
+	comparison->m_binary_size += size;
+	comparison->m_xml_parse_ms += xml_parse_ms;
+	comparison->m_binary_parse_ms += binary_parse_ms;
+
+	GPOS_DELETE(metadata_xml);
+	GPOS_DELETE(metadata_binary);
+	GPOS_DELETE(parse_handler_xml);
+	GPOS_DELETE(parse_handler_binary);
+
+	return eres;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryTest::EresUnittest_Minidump
+//
+//	@doc:
+//		Compare the XML and binary forms of the TPC-DS minidumps, and report
+//		their total sizes and parse times
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLBinaryTest::EresUnittest_Minidump()
+{
+	SComparison comparison = {0, 0, 0, 0};
+	GPOS_RESULT eres = GPOS_OK;
+
+	const ULONG num_files = GPOS_ARRAY_SIZE(rgszTpcdsMinidumpFileNames);
+	for (ULONG ul = 0; ul < num_files; ul++)
+	{
+		if (GPOS_OK !=
+			EresCompareMinidump(rgszTpcdsMinidumpFileNames[ul], &comparison))
+		{
+			eres = GPOS_FAILED;
+		}
+	}
+
+	CAutoMemoryPool amp;
+	CAutoTrace at(amp.Pmp());
+	at.Os() << num_files << " TPC-DS minidumps: " << comparison.m_xml_size
+			<< " bytes as XML, " << comparison.m_binary_size
+			<< " bytes as binary DXL; parsed in " << comparison.m_xml_parse_ms
+			<< " ms from XML, " << comparison.m_binary_parse_ms
+			<< " ms from binary DXL";
+
+	return eres;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CDXLBinaryTest::EresUnittest_Malformed
+//
+//	@doc:
+//		Parsing a truncated binary document raises an exception
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CDXLBinaryTest::EresUnittest_Malformed()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CAutoRg<CHAR> dxl_string(CDXLUtils::Read(mp, m_szMetadataFileName));
+	ULONG size = 0;
+	CAutoRg<BYTE> buffer(
+		CDXLUtils::ConvertDXLToBinary(mp, dxl_string.Rgt(), &size));
+
+	// raises an exception
+	CParseHandlerDXL *parse_handler_dxl =
+		CDXLUtils::GetParseHandlerForDXLBinary(mp, buffer.Rgt(), size / 2);
+	GPOS_DELETE(parse_handler_dxl);
+
+	return GPOS_FAILED;
+}
+
+// EOF
@@ -27,6 +27,7 @@
 #include "naucrates/md/CMDTypeGenericGPDB.h"
 #include "naucrates/md/IMDType.h"
 #include "naucrates/statistics/CBucket.h"
+#include "naucrates/statistics/CBucketBounds.h"
 #include "naucrates/statistics/CPoint.h"
 #include "naucrates/statistics/CStatisticsUtils.h"
 
@@ -47,6 +48,7 @@ CBucketTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CBucketTest::EresUnittest_CBucketScale),
 		GPOS_UNITTEST_FUNC(CBucketTest::EresUnittest_CBucketDifference),
 		GPOS_UNITTEST_FUNC(CBucketTest::EresUnittest_CBucketIntersect),
+		GPOS_UNITTEST_FUNC(CBucketTest::EresUnittest_CBucketBounds),
 		GPOS_UNITTEST_FUNC(
 			CBucketTest::EresUnittest_CBucketMergeCommutativityUnion),
 		GPOS_UNITTEST_FUNC(
@@ -446,6 +448,70 @@ CBucketTest::EresUnittest_CBucketIntersect()
 	return GPOS_OK;
 }
 
+// comparisons on flat bucket bounds agree with those on buckets
+GPOS_RESULT
+CBucketTest::EresUnittest_CBucketBounds()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// lower bound, upper bound, is lower closed, is upper closed
+	INT rgiBuckets[][4] = {
+		{0, 5, true, true},
+		{0, 5, false, true},
+		{0, 5, true, false},
+		{0, 5, false, false},
+		{5, 10, true, true},
+		{5, 10, false, true},
+		{2, 99, true, true},
+		{13, 103, true, true},
+		{5, 5, true, true},
+		{0, 0, true, true},
+		{10, 15, true, false},
+		{-7, 3, false, true},
+	};
+
+	CBucketArray *buckets = GPOS_NEW(mp) CBucketArray(mp);
+	const ULONG length = GPOS_ARRAY_SIZE(rgiBuckets);
+	for (ULONG ul = 0; ul < length; ul++)
+	{
+		buckets->Append(CCardinalityTestUtils::PbucketInteger(
+			mp, rgiBuckets[ul][0], rgiBuckets[ul][1], rgiBuckets[ul][2],
+			rgiBuckets[ul][3], CDouble(0.1), CDouble(100.0)));
+	}
+
+	CBucketBounds *bounds = CBucketBounds::PbbCreate(mp, buckets);
+	GPOS_RTL_ASSERT(NULL != bounds);
+	GPOS_RTL_ASSERT(bounds->IsComparable(bounds));
+
+	GPOS_RESULT eres = GPOS_OK;
+	for (ULONG ul1 = 0; ul1 < length; ul1++)
+	{
+		CBucket *bucket1 = (*buckets)[ul1];
+		for (ULONG ul2 = 0; ul2 < length; ul2++)
+		{
+			CBucket *bucket2 = (*buckets)[ul2];
+
+			if (bucket1->Intersects(bucket2) !=
+					bounds->Intersects(ul1, bounds, ul2) ||
+				bucket1->IsBefore(bucket2) !=
+					bounds->IsBefore(ul1, bounds, ul2) ||
+				CBucket::CompareUpperBounds(bucket1, bucket2) !=
+					CBucketBounds::CompareUpperBounds(bounds, ul1, bounds,
+													  ul2))
+			{
+				eres = GPOS_FAILED;
+			}
+		}
+	}
+
+	// clean up
+	GPOS_DELETE(bounds);
+	buckets->Release();
+
+	return eres;
+}
 
 // do the bucket boundaries match
 BOOL
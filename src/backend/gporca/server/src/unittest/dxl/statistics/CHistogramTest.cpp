@@ -21,6 +21,7 @@
 #include "gpos/io/COstreamString.h"
 #include "gpos/string/CWStringDynamic.h"
 
+#include "naucrates/statistics/CHLLSketch.h"
 #include "naucrates/statistics/CHistogram.h"
 #include "naucrates/statistics/CPoint.h"
 
@@ -39,10 +40,12 @@ CHistogramTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_CHistogramInt4),
 		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_CHistogramBool),
 		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_Skew),
+		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_MaxValueFreq),
 		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_CHistogramValid),
 		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_MergeUnion),
 		GPOS_UNITTEST_FUNC(
-			CHistogramTest::EresUnittest_MergeUnionDoubleLessThanEpsilon)};
+			CHistogramTest::EresUnittest_MergeUnionDoubleLessThanEpsilon),
+		GPOS_UNITTEST_FUNC(CHistogramTest::EresUnittest_UnionAllHLLSketch)};
 
 
 	CAutoMemoryPool amp;
@@ -323,6 +326,48 @@ CHistogramTest::EresUnittest_Skew()
 	return GPOS_OK;
 }
 
+// frequency of the most frequent value, from singleton buckets, wide
+// buckets, the null fraction and the values not covered by buckets
+GPOS_RESULT
+CHistogramTest::EresUnittest_MaxValueFreq()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// a heavy hitter in a singleton bucket, as built from an MCV
+	CBucketArray *histogram_buckets = GPOS_NEW(mp) CBucketArray(mp);
+	histogram_buckets->Append(
+		CCardinalityTestUtils::PbucketIntegerClosedLowerBound(
+			mp, 1, 100, CDouble(0.5), CDouble(100.0)));
+	histogram_buckets->Append(
+		CCardinalityTestUtils::PbucketIntegerClosedLowerBound(
+			mp, 150, 150, CDouble(0.3), CDouble(1.0)));
+	CHistogram *histogram_mcv = GPOS_NEW(mp)
+		CHistogram(mp, histogram_buckets, true, 0.1 /*null_freq*/,
+				   10.0 /*distinct_remaining*/, 0.1 /*freq_remaining*/);
+
+	// singletons of 0.1, and 0.4 spread over 2 values not in any bucket
+	CHistogram *histogram_remain = PhistExampleInt4Remain(mp);
+
+	// no bounds, no estimate
+	CHistogram *histogram_undefined =
+		GPOS_NEW(mp) CHistogram(mp, false /*is_well_defined*/);
+
+	GPOS_RESULT eres = GPOS_OK;
+	if (CDouble(0.3) != histogram_mcv->GetMaxValueFreq() ||
+		CDouble(0.2) != histogram_remain->GetMaxValueFreq() ||
+		CDouble(0.0) != histogram_undefined->GetMaxValueFreq())
+	{
+		eres = GPOS_FAILED;
+	}
+
+	GPOS_DELETE(histogram_mcv);
+	GPOS_DELETE(histogram_remain);
+	GPOS_DELETE(histogram_undefined);
+
+	return eres;
+}
+
 // basic merge commutativity test
 GPOS_RESULT
 CHistogramTest::EresUnittest_MergeUnion()
@@ -431,4 +476,97 @@ CHistogramTest::EresUnittest_MergeUnionDoubleLessThanEpsilon()
 
 	return GPOS_OK;
 }
+
+// generate a HyperLogLog sketch of the integers in [first, last], using the
+// register layout of gp_hyperloglog and a 64-bit mix as hash function
+CHLLSketch *
+CHistogramTest::PhllSketchInt4(CMemoryPool *mp, INT first, INT last)
+{
+	const ULONG precision = CHLLSketch::DefaultPrecision;
+	const ULONG size = ULONG(1) << precision;
+	BYTE *registers = GPOS_NEW_ARRAY(mp, BYTE, size);
+	clib::Memset(registers, 0, size);
+
+	for (INT i = first; i <= last; i++)
+	{
+		ULLONG hash = (ULLONG) i + UINT64_C(0x9E3779B97F4A7C15);
+		hash = (hash ^ (hash >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+		hash = (hash ^ (hash >> 27)) * UINT64_C(0x94D049BB133111EB);
+		hash = hash ^ (hash >> 31);
+
+		ULONG index = (ULONG)(hash >> (64 - precision));
+		ULLONG suffix = hash << precision;
+		ULONG rank = 64 - precision + 1;
+		if (0 != suffix)
+		{
+			rank = __builtin_clzll(suffix) + 1;
+		}
+
+		if (rank > registers[index])
+		{
+			registers[index] = (BYTE) rank;
+		}
+	}
+
+	return GPOS_NEW(mp) CHLLSketch(mp, precision, registers);
+}
+
+// union all of histograms with HyperLogLog sketches: the bounds of the
+// buckets of the inputs are the same, the sketches tell whether their
+// values are the same too
+GPOS_RESULT
+CHistogramTest::EresUnittest_UnionAllHLLSketch()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// the second input has the same values as the first one, the third one
+	// has different values
+	const INT rgrgiValues[][2] = {{1, 1000}, {1, 1000}, {5001, 6000}};
+	const ULONG num_inputs = GPOS_ARRAY_SIZE(rgrgiValues);
+	CHistogram *rghist[num_inputs];
+	for (ULONG ul = 0; ul < num_inputs; ul++)
+	{
+		// 1000 rows, 1000 distinct values
+		CBucketArray *buckets = GPOS_NEW(mp) CBucketArray(mp);
+		buckets->Append(CCardinalityTestUtils::PbucketIntegerClosedLowerBound(
+			mp, 1, 1000, CDouble(1.0), CDouble(1000.0)));
+		rghist[ul] = GPOS_NEW(mp) CHistogram(mp, buckets);
+		rghist[ul]->SetHLLSketch(
+			PhllSketchInt4(mp, rgrgiValues[ul][0], rgrgiValues[ul][1]));
+	}
+
+	CHistogram *same_values =
+		rghist[0]->MakeUnionAllHistogramNormalize(1000, rghist[1], 1000);
+	CHistogram *different_values =
+		rghist[0]->MakeUnionAllHistogramNormalize(1000, rghist[2], 1000);
+
+	CDouble same_ndv = same_values->GetNumDistinct();
+	CDouble different_ndv = different_values->GetNumDistinct();
+	{
+		CAutoTrace at(mp);
+		at.Os() << "Union all of the same values: " << same_ndv << std::endl;
+		at.Os() << "Union all of different values: " << different_ndv
+				<< std::endl;
+	}
+
+	GPOS_RESULT eres = GPOS_OK;
+	if (CDouble(900.0) > same_ndv || CDouble(1100.0) < same_ndv ||
+		CDouble(1800.0) > different_ndv || CDouble(2000.0) < different_ndv ||
+		NULL == different_values->GetHLLSketch())
+	{
+		eres = GPOS_FAILED;
+	}
+
+	GPOS_DELETE(same_values);
+	GPOS_DELETE(different_values);
+	for (ULONG ul = 0; ul < num_inputs; ul++)
+	{
+		GPOS_DELETE(rghist[ul]);
+	}
+
+	return eres;
+}
+
 // EOF
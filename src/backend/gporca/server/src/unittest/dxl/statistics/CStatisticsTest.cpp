@@ -39,6 +39,7 @@
 #include "naucrates/statistics/CPoint.h"
 #include "naucrates/statistics/CStatistics.h"
 #include "naucrates/statistics/CStatisticsUtils.h"
+#include "naucrates/statistics/CStatsColGroup.h"
 #include "naucrates/statistics/CUnionAllStatsProcessor.h"
 
 #include "unittest/base.h"
@@ -59,6 +60,7 @@ CStatisticsTest::EresUnittest()
 		GPOS_UNITTEST_FUNC(CStatisticsTest::EresUnittest_CStatisticsBasic),
 		GPOS_UNITTEST_FUNC(CStatisticsTest::EresUnittest_UnionAll),
 		GPOS_UNITTEST_FUNC(CStatisticsTest::EresUnittest_CStatisticsCopy),
+		GPOS_UNITTEST_FUNC(CStatisticsTest::EresUnittest_ColumnGroups),
 
 		// TODO,  Mar 18 2013 temporarily disabling the test
 		// GPOS_UNITTEST_FUNC(CStatisticsTest::EresUnittest_CStatisticsSelectDerivation),
@@ -751,4 +753,172 @@ CStatisticsTest::EresUnittest_CStatisticsCopy()
 	return eres;
 }
 
+// create stats for two int4 columns whose values are equal, optionally with
+// a column group on the two columns
+CStatistics *
+CStatisticsTest::PstatsCorrelatedColumns(CMemoryPool *mp, ULONG colid1,
+										 ULONG colid2, BOOL with_column_group)
+{
+	UlongToHistogramMap *col_histogram_mapping =
+		GPOS_NEW(mp) UlongToHistogramMap(mp);
+	col_histogram_mapping->Insert(GPOS_NEW(mp) ULONG(colid1),
+								  PhistExampleInt4Dim(mp));
+	col_histogram_mapping->Insert(GPOS_NEW(mp) ULONG(colid2),
+								  PhistExampleInt4Dim(mp));
+
+	UlongToDoubleMap *colid_width_mapping = GPOS_NEW(mp) UlongToDoubleMap(mp);
+	colid_width_mapping->Insert(GPOS_NEW(mp) ULONG(colid1),
+								GPOS_NEW(mp) CDouble(4.0));
+	colid_width_mapping->Insert(GPOS_NEW(mp) ULONG(colid2),
+								GPOS_NEW(mp) CDouble(4.0));
+
+	CStatistics *stats =
+		GPOS_NEW(mp) CStatistics(mp, col_histogram_mapping, colid_width_mapping,
+								 1000.0 /* rows */, false /* is_empty */);
+
+	if (with_column_group)
+	{
+		// each column determines the other one, and there are as many
+		// combinations as values of each column
+		CDoubleArray *dependency_degrees = GPOS_NEW(mp) CDoubleArray(mp);
+		dependency_degrees->Append(GPOS_NEW(mp) CDouble(1.0));
+		dependency_degrees->Append(GPOS_NEW(mp) CDouble(1.0));
+		stats->AddColumnGroup(GPOS_NEW(mp) CStatsColGroup(
+			Pdrgpul(mp, colid1, colid2), CDouble(90.0), dependency_degrees));
+	}
+
+	return stats;
+}
+
+// test the estimates of filters, group by and joins on column groups
+GPOS_RESULT
+CStatisticsTest::EresUnittest_ColumnGroups()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	CColumnFactory *col_factory = COptCtxt::PoctxtFromTLS()->Pcf();
+	const IMDTypeInt4 *pmdtypeint4 =
+		COptCtxt::PoctxtFromTLS()->Pmda()->PtMDType<IMDTypeInt4>();
+
+	CWStringConst strRelAlias(GPOS_WSZ_LIT("Rel1"));
+	CWStringConst strColA(GPOS_WSZ_LIT("a"));
+	CWStringConst strColB(GPOS_WSZ_LIT("b"));
+	CTableDescriptor *ptabdesc = PtabdescTwoColumnSource(
+		mp, CName(&strRelAlias), pmdtypeint4, strColA, strColB);
+	CExpression *pexprGet =
+		CTestUtils::PexprLogicalGet(mp, ptabdesc, &strRelAlias);
+
+	// the group by estimate looks up the column references of the grouping
+	// columns
+	const ULONG rgulColIds[] = {21, 22, 23, 24};
+	for (ULONG ul = 0; ul < GPOS_ARRAY_SIZE(rgulColIds); ul++)
+	{
+		if (NULL == col_factory->LookupColRef(rgulColIds[ul]))
+		{
+			(void) col_factory->PcrCreate(
+				pmdtypeint4, default_type_modifier, NULL, ul % 2 /* attno */,
+				false /*IsNullable*/, rgulColIds[ul],
+				CName(0 == ul % 2 ? &strColA : &strColB),
+				pexprGet->Pop()->UlOpId(), false /*IsDistCol*/
+			);
+		}
+	}
+
+	CStatistics *stats = PstatsCorrelatedColumns(mp, 21, 22, false);
+	CStatistics *stats_group = PstatsCorrelatedColumns(mp, 21, 22, true);
+
+	GPOS_RESULT eres = GPOS_OK;
+
+	// filter a = 5 and b = 5: the second predicate does not reduce the
+	// estimate if a determines b
+	CStatsPredPtrArry *pdrgpstatspred = GPOS_NEW(mp) CStatsPredPtrArry(mp);
+	pdrgpstatspred->Append(GPOS_NEW(mp) CStatsPredPoint(
+		21, CStatsPred::EstatscmptEq, CTestUtils::PpointInt4(mp, 5)));
+	pdrgpstatspred->Append(GPOS_NEW(mp) CStatsPredPoint(
+		22, CStatsPred::EstatscmptEq, CTestUtils::PpointInt4(mp, 5)));
+	CStatsPredConj *pred_stats = GPOS_NEW(mp) CStatsPredConj(pdrgpstatspred);
+
+	CStatistics *filter_stats = CFilterStatsProcessor::MakeStatsFilter(
+		mp, stats, pred_stats, true /* do_cap_NDVs */);
+	CStatistics *filter_stats_group = CFilterStatsProcessor::MakeStatsFilter(
+		mp, stats_group, pred_stats, true /* do_cap_NDVs */);
+
+	// a point of the histogram has a frequency of 0.01
+	if (filter_stats_group->Rows() <= filter_stats->Rows() ||
+		CDouble(1.0) < (filter_stats_group->Rows() - CDouble(10.0)).Absolute())
+	{
+		eres = GPOS_FAILED;
+	}
+
+	// group by a, b: as many groups as combinations
+	ULongPtrArray *GCs = Pdrgpul(mp, 21, 22);
+	ULongPtrArray *aggs = GPOS_NEW(mp) ULongPtrArray(mp);
+	CStatistics *gb_stats = CGroupByStatsProcessor::CalcGroupByStats(
+		mp, stats, GCs, aggs, NULL /*keys*/);
+	CStatistics *gb_stats_group = CGroupByStatsProcessor::CalcGroupByStats(
+		mp, stats_group, GCs, aggs, NULL /*keys*/);
+
+	if (gb_stats_group->Rows() >= gb_stats->Rows() ||
+		CDouble(90.0) < gb_stats_group->Rows())
+	{
+		eres = GPOS_FAILED;
+	}
+
+	// join on a = c and b = d: the second predicate does not reduce the
+	// estimate if the combinations of both sides are the same
+	CStatistics *inner_stats = PstatsCorrelatedColumns(mp, 23, 24, false);
+	CStatsPredJoinArray *join_preds_stats =
+		GPOS_NEW(mp) CStatsPredJoinArray(mp);
+	join_preds_stats->Append(
+		GPOS_NEW(mp) CStatsPredJoin(21, CStatsPred::EstatscmptEq, 23));
+	join_preds_stats->Append(
+		GPOS_NEW(mp) CStatsPredJoin(22, CStatsPred::EstatscmptEq, 24));
+
+	CStatistics *join_stats =
+		stats->CalcInnerJoinStats(mp, inner_stats, join_preds_stats);
+	CStatistics *join_stats_group =
+		stats_group->CalcInnerJoinStats(mp, inner_stats, join_preds_stats);
+
+	if (join_stats_group->Rows() <= join_stats->Rows())
+	{
+		eres = GPOS_FAILED;
+	}
+
+	// the column group is kept by operators that do not use its columns
+	CStatistics *scaled_stats = CStatistics::CastStats(
+		stats_group->ScaleStats(mp, CDouble(0.5)));
+	if (1 != scaled_stats->GetColumnGroups()->Size())
+	{
+		eres = GPOS_FAILED;
+	}
+
+	{
+		CAutoTrace at(mp);
+		at.Os() << "Column groups: filter " << filter_stats->Rows() << " -> "
+				<< filter_stats_group->Rows() << ", group by "
+				<< gb_stats->Rows() << " -> " << gb_stats_group->Rows()
+				<< ", join " << join_stats->Rows() << " -> "
+				<< join_stats_group->Rows() << std::endl;
+	}
+
+	stats->Release();
+	stats_group->Release();
+	inner_stats->Release();
+	filter_stats->Release();
+	filter_stats_group->Release();
+	gb_stats->Release();
+	gb_stats_group->Release();
+	join_stats->Release();
+	join_stats_group->Release();
+	scaled_stats->Release();
+	pred_stats->Release();
+	join_preds_stats->Release();
+	GCs->Release();
+	aggs->Release();
+	pexprGet->Release();
+
+	return eres;
+}
+
 // EOF
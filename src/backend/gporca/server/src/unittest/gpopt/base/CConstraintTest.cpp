@@ -96,6 +96,8 @@ CConstraintTest::EresUnittest()
 			CConstraintTest::EresUnittest_CConstraintIntervalPexpr),
 		GPOS_UNITTEST_FUNC(
 			CConstraintTest::EresUnittest_CConstraintIntervalFromArrayExpr),
+		GPOS_UNITTEST_FUNC(
+			CConstraintTest::EresUnittest_CConstraintIntervalFromLargeArrayExpr),
 #ifdef GPOS_DEBUG
 		GPOS_UNITTEST_FUNC_THROW(CConstraintTest::EresUnittest_NegativeTests,
 								 gpos::CException::ExmaSystem,
@@ -926,6 +928,97 @@ CConstraintTest::EresUnittest_CConstraintIntervalFromArrayExpr()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstraintTest::EresUnittest_CConstraintIntervalFromLargeArrayExpr
+//
+//	@doc:
+//		Tests intervals of IN lists with many repeated constants, and their
+//		union and intersection
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CConstraintTest::EresUnittest_CConstraintIntervalFromLargeArrayExpr()
+{
+	// create memory pool
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	CConstExprEvaluatorForDates *pceeval =
+		GPOS_NEW(mp) CConstExprEvaluatorForDates(mp);
+
+	// install opt context in TLS
+	CAutoOptCtxt aoc(mp, &mda, pceeval, CTestUtils::GetCostModel(mp));
+
+	CAutoTraceFlag atf(EopttraceArrayConstraints, true);
+
+	// every value in [0, ulValues) appears twice, in a scrambled order
+	const ULONG ulValues = 10000;
+	IntPtrArray *pdrgpiFst = GPOS_NEW(mp) IntPtrArray(mp);
+	for (ULONG ul = 0; ul < 2 * ulValues; ul++)
+	{
+		pdrgpiFst->Append(GPOS_NEW(mp) INT((ul * 7919) % ulValues));
+	}
+
+	// even values in [0, 2 * ulValues)
+	IntPtrArray *pdrgpiSnd = GPOS_NEW(mp) IntPtrArray(mp);
+	for (ULONG ul = 0; ul < ulValues; ul++)
+	{
+		pdrgpiSnd->Append(GPOS_NEW(mp) INT(2 * ul));
+	}
+
+	CExpression *pexprFst = CTestUtils::PexprLogicalSelectArrayCmp(
+		mp, CScalarArrayCmp::EarrcmpAny, IMDType::EcmptEq, pdrgpiFst);
+	CColRef *colref = pexprFst->DeriveOutputColumns()->PcrAny();
+	CConstraintInterval *pciFst =
+		CConstraintInterval::PciIntervalFromScalarExpr(mp, (*pexprFst)[1],
+													   colref);
+	GPOS_RTL_ASSERT(ulValues == pciFst->Pdrgprng()->Size());
+
+	// ranges are sorted points
+	CRangeArray *pdrgprng = pciFst->Pdrgprng();
+	for (ULONG ul = 0; ul < ulValues; ul++)
+	{
+		CRange *prange = (*pdrgprng)[ul];
+		GPOS_RTL_ASSERT(prange->FPoint());
+		GPOS_RTL_ASSERT((LINT) ul == prange->PdatumLeft()->GetLINTMapping());
+	}
+
+	// build the second interval on its own column, then move it to the
+	// column of the first one
+	CExpression *pexprSnd = CTestUtils::PexprLogicalSelectArrayCmp(
+		mp, CScalarArrayCmp::EarrcmpAny, IMDType::EcmptEq, pdrgpiSnd);
+	CConstraintInterval *pciSndOwnCol =
+		CConstraintInterval::PciIntervalFromScalarExpr(
+			mp, (*pexprSnd)[1], pexprSnd->DeriveOutputColumns()->PcrAny());
+	CConstraintInterval *pciSnd = dynamic_cast<CConstraintInterval *>(
+		pciSndOwnCol->PcnstrRemapForColumn(mp, colref));
+	pciSndOwnCol->Release();
+	GPOS_RTL_ASSERT(ulValues == pciSnd->Pdrgprng()->Size());
+
+	CConstraintInterval *pciIntersect = pciFst->PciIntersect(mp, pciSnd);
+	GPOS_RTL_ASSERT(ulValues / 2 == pciIntersect->Pdrgprng()->Size());
+
+	CConstraintInterval *pciUnion = pciFst->PciUnion(mp, pciSnd);
+	GPOS_RTL_ASSERT(ulValues + ulValues / 2 == pciUnion->Pdrgprng()->Size());
+
+	pciUnion->Release();
+	pciIntersect->Release();
+	pciSnd->Release();
+	pciFst->Release();
+	pexprSnd->Release();
+	pexprFst->Release();
+	pdrgpiSnd->Release();
+	pdrgpiFst->Release();
+
+	return GPOS_OK;
+}
+
 
 //---------------------------------------------------------------------------
 //	@function:
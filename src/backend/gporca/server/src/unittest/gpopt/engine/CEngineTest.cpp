@@ -18,6 +18,7 @@
 #include "gpopt/engine/CEngine.h"
 #include "gpopt/eval/CConstExprEvaluatorDefault.h"
 #include "gpopt/mdcache/CMDCache.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
 #include "gpopt/operators/ops.h"
 #include "gpopt/search/CGroup.h"
 #include "gpopt/search/CGroupProxy.h"
@@ -41,6 +42,7 @@ CEngineTest::EresUnittest()
 {
 	CUnittest rgut[] = {
 		GPOS_UNITTEST_FUNC(EresUnittest_Basic),
+		GPOS_UNITTEST_FUNC(EresUnittest_MemoryBudget),
 #ifdef GPOS_DEBUG
 		GPOS_UNITTEST_FUNC(EresUnittest_BuildMemo),
 		GPOS_UNITTEST_FUNC(EresUnittest_AppendStats),
@@ -116,6 +118,61 @@ CEngineTest::EresUnittest_Basic()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngineTest::EresUnittest_MemoryBudget
+//
+//	@doc:
+//		Optimize an n-ary join with a memory budget that is exceeded right
+//		away; the search is degraded and still produces a plan
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CEngineTest::EresUnittest_MemoryBudget()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache(), CTestUtils::m_sysidDefault, pmdp);
+
+	// a budget of 1 kB is reached by the first xform to be scheduled
+	COptimizerConfig *optimizer_config = GPOS_NEW(mp) COptimizerConfig(
+		CEnumeratorConfig::GetEnumeratorCfg(mp, 0 /*plan_id*/),
+		CStatisticsConfig::PstatsconfDefault(mp),
+		CCTEConfig::PcteconfDefault(mp), CTestUtils::GetCostModel(mp),
+		GPOS_NEW(mp) CHint(gpos::int_max, gpos::int_max,
+						   JOIN_ORDER_DP_THRESHOLD, BROADCAST_THRESHOLD,
+						   true /* enforce_constraint_on_dml */,
+						   PUSH_GROUP_BY_BELOW_SETOP_THRESHOLD,
+						   XFORM_BIND_THRESHOLD, SKEW_FACTOR,
+						   1 /* memo_memory_budget */),
+		CWindowOids::GetWindowOids(mp));
+
+	// install opt context in TLS
+	CAutoOptCtxt aoc(mp, &mda, NULL /* pceeval */, optimizer_config);
+
+	CEngine eng(mp);
+
+	CExpression *pexpr = CTestUtils::PexprLogicalNAryJoin(mp);
+	CQueryContext *pqc = CTestUtils::PqcGenerate(mp, pexpr);
+	eng.Init(pqc, NULL /*search_stage_array*/);
+	eng.Optimize();
+
+	GPOS_RTL_ASSERT(eng.FDegraded());
+
+	CExpression *pexprPlan = eng.PexprExtractPlan();
+	GPOS_RTL_ASSERT(NULL != pexprPlan);
+
+	// clean up
+	pexpr->Release();
+	pexprPlan->Release();
+	GPOS_DELETE(pqc);
+
+	return GPOS_OK;
+}
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -51,6 +51,24 @@ CConstExprEvaluatorDXLTest::CDummyConstDXLNodeEvaluator::EvaluateExpr(
 	const gpdxl::CDXLNode * /*pdxlnExpr*/
 )
 {
+	m_ulCalls++;
+
+	return PdxlnDummyValue();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorDXLTest::CDummyConstDXLNodeEvaluator::PdxlnDummyValue
+//
+//	@doc:
+//		Return the dummy value as DXL. Caller must release it.
+//
+//---------------------------------------------------------------------------
+gpdxl::CDXLNode *
+CConstExprEvaluatorDXLTest::CDummyConstDXLNodeEvaluator::PdxlnDummyValue()
+{
+	m_ulExprs++;
+
 	const IMDTypeInt4 *pmdtypeint4 = m_pmda->PtMDType<IMDTypeInt4>();
 	pmdtypeint4->MDId()->AddRef();
 
@@ -62,6 +80,31 @@ CConstExprEvaluatorDXLTest::CDummyConstDXLNodeEvaluator::EvaluateExpr(
 	return GPOS_NEW(m_mp) CDXLNode(m_mp, pdxlnConst);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorDXLTest::CDummyConstDXLNodeEvaluator::EvaluateExprs
+//
+//	@doc:
+//		Evaluate the given DXL nodes in one call and return a dummy value as
+//		DXL for each of them. Caller must release the array.
+//
+//---------------------------------------------------------------------------
+gpdxl::CDXLNodeArray *
+CConstExprEvaluatorDXLTest::CDummyConstDXLNodeEvaluator::EvaluateExprs(
+	const gpdxl::CDXLNodeArray *pdrgpdxlnExpr)
+{
+	gpdxl::CDXLNodeArray *pdrgpdxlnResult =
+		GPOS_NEW(m_mp) gpdxl::CDXLNodeArray(m_mp);
+	const ULONG size = pdrgpdxlnExpr->Size();
+	for (ULONG ul = 0; ul < size; ul++)
+	{
+		pdrgpdxlnResult->Append(PdxlnDummyValue());
+	}
+	m_ulCalls++;
+
+	return pdrgpdxlnResult;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CConstExprEvaluatorDXLTest::EresUnittest
@@ -75,6 +118,8 @@ CConstExprEvaluatorDXLTest::EresUnittest()
 {
 	{
 		CUnittest rgut[] = {
+			GPOS_UNITTEST_FUNC(
+				CConstExprEvaluatorDXLTest::EresUnittest_BatchAndMemo),
 			GPOS_UNITTEST_FUNC_THROW(
 				CConstExprEvaluatorDXLTest::EresUnittest_NonScalar,
 				gpdxl::ExmaGPOPT, gpdxl::ExmiEvalUnsupportedScalarExpr),
@@ -191,4 +236,70 @@ CConstExprEvaluatorDXLTest::EresUnittest_ScalarContainingVariables()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CConstExprEvaluatorDXLTest::EresUnittest_BatchAndMemo
+//
+//	@doc:
+//		Test that the distinct expressions of an array are sent to the DXL
+//		evaluator in one call, and that expressions evaluated before are not
+//		sent again.
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CConstExprEvaluatorDXLTest::EresUnittest_BatchAndMemo()
+{
+	CTestUtils::CTestSetup testsetup;
+	CMemoryPool *mp = testsetup.Pmp();
+	CDummyConstDXLNodeEvaluator consteval(mp, testsetup.Pmda(),
+										  m_iDefaultEvalValue);
+	CConstExprEvaluatorDXL *pceeval =
+		GPOS_NEW(mp) CConstExprEvaluatorDXL(mp, testsetup.Pmda(), &consteval);
+
+	GPOS_RESULT eres = GPOS_OK;
+
+	// evaluating the same comparison twice calls the evaluator once
+	for (ULONG ul = 0; ul < 2; ul++)
+	{
+		CExpression *pexprCmp = CUtils::PexprScalarEqCmp(
+			mp, CUtils::PexprScalarConstInt4(mp, 1 /*val*/),
+			CUtils::PexprScalarConstInt4(mp, 2 /*val*/));
+		CExpression *pexprResult = pceeval->PexprEval(pexprCmp);
+		if (COperator::EopScalarConst != pexprResult->Pop()->Eopid())
+		{
+			eres = GPOS_FAILED;
+		}
+		pexprResult->Release();
+		pexprCmp->Release();
+	}
+
+	if (1 != consteval.UlExprs() || 1 != consteval.UlCalls())
+	{
+		eres = GPOS_FAILED;
+	}
+
+	// an array repeating the comparison above and two new comparisons is
+	// evaluated in one call, for the two new comparisons only
+	CExpressionArray *pdrgpexpr = GPOS_NEW(mp) CExpressionArray(mp);
+	for (INT i = 0; i < 5; i++)
+	{
+		pdrgpexpr->Append(CUtils::PexprScalarEqCmp(
+			mp, CUtils::PexprScalarConstInt4(mp, 1 /*val*/),
+			CUtils::PexprScalarConstInt4(mp, 2 + i % 3 /*val*/)));
+	}
+
+	CExpressionArray *pdrgpexprResult = pceeval->PdrgpexprEval(mp, pdrgpexpr);
+	if (3 != consteval.UlExprs() || 2 != consteval.UlCalls() ||
+		pdrgpexpr->Size() != pdrgpexprResult->Size())
+	{
+		eres = GPOS_FAILED;
+	}
+
+	pdrgpexprResult->Release();
+	pdrgpexpr->Release();
+	pceeval->Release();
+
+	return eres;
+}
+
 // EOF
@@ -19,7 +19,10 @@
 #include "gpopt/eval/CConstExprEvaluatorDefault.h"
 #include "gpopt/operators/CPredicateUtils.h"
 #include "gpopt/operators/ops.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
 #include "gpopt/xforms/CJoinOrder.h"
+#include "gpopt/xforms/CJoinOrderDPhyp.h"
+#include "gpopt/xforms/CJoinOrderDPv2.h"
 #include "gpopt/xforms/CJoinOrderMinCard.h"
 
 #include "unittest/base.h"
@@ -44,6 +47,8 @@ GPOS_RESULT
 CJoinOrderTest::EresUnittest()
 {
 	CUnittest rgut[] = {GPOS_UNITTEST_FUNC(EresUnittest_ExpandMinCard),
+						GPOS_UNITTEST_FUNC(EresUnittest_ExpandDPhyp),
+						GPOS_UNITTEST_FUNC(EresUnittest_ExpandDPv2),
 						GPOS_UNITTEST_FUNC(EresUnittest_RunTests)};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
@@ -135,6 +140,209 @@ CJoinOrderTest::EresUnittest_ExpandMinCard()
 	return GPOS_OK;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderTest::EresUnittest_ExpandDPhyp
+//
+//	@doc:
+//		Expansion using dynamic programming over the join hypergraph; the
+//		join graph is a chain, for which the enumeration visits only
+//		(n^3 - n) / 6 pairs of connected sets
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CJoinOrderTest::EresUnittest_ExpandDPhyp()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// array of relation names
+	CWStringConst rgscRel[] = {
+		GPOS_WSZ_LIT("Rel10"), GPOS_WSZ_LIT("Rel3"),  GPOS_WSZ_LIT("Rel4"),
+		GPOS_WSZ_LIT("Rel6"),  GPOS_WSZ_LIT("Rel7"),  GPOS_WSZ_LIT("Rel8"),
+		GPOS_WSZ_LIT("Rel12"), GPOS_WSZ_LIT("Rel13"), GPOS_WSZ_LIT("Rel5"),
+		GPOS_WSZ_LIT("Rel14"), GPOS_WSZ_LIT("Rel15"), GPOS_WSZ_LIT("Rel1"),
+		GPOS_WSZ_LIT("Rel11"), GPOS_WSZ_LIT("Rel2"),  GPOS_WSZ_LIT("Rel9"),
+	};
+
+	// array of relation IDs
+	ULONG rgulRel[] = {
+		GPOPT_TEST_REL_OID10, GPOPT_TEST_REL_OID3,	GPOPT_TEST_REL_OID4,
+		GPOPT_TEST_REL_OID6,  GPOPT_TEST_REL_OID7,	GPOPT_TEST_REL_OID8,
+		GPOPT_TEST_REL_OID12, GPOPT_TEST_REL_OID13, GPOPT_TEST_REL_OID5,
+		GPOPT_TEST_REL_OID14, GPOPT_TEST_REL_OID15, GPOPT_TEST_REL_OID1,
+		GPOPT_TEST_REL_OID11, GPOPT_TEST_REL_OID2,	GPOPT_TEST_REL_OID9,
+	};
+
+	const ULONG ulRels = GPOS_ARRAY_SIZE(rgscRel);
+	GPOS_ASSERT(GPOS_ARRAY_SIZE(rgulRel) == ulRels);
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache());
+	mda.RegisterProvider(CTestUtils::m_sysidDefault, pmdp);
+
+	{
+		// install opt context in TLS
+		CAutoOptCtxt aoc(mp, &mda, NULL, /* pceeval */
+						 CTestUtils::GetCostModel(mp));
+
+		CExpression *pexprNAryJoin = CTestUtils::PexprLogicalNAryJoin(
+			mp, rgscRel, rgulRel, ulRels, false /*fCrossProduct*/);
+
+		// derive stats on input expression
+		CExpressionHandle exprhdl(mp);
+		exprhdl.Attach(pexprNAryJoin);
+		exprhdl.DeriveStats(mp, mp, NULL /*prprel*/, NULL /*stats_ctxt*/);
+
+		CExpressionArray *pdrgpexpr = GPOS_NEW(mp) CExpressionArray(mp);
+		for (ULONG ul = 0; ul < ulRels; ul++)
+		{
+			CExpression *pexprChild = (*pexprNAryJoin)[ul];
+			pexprChild->AddRef();
+			pdrgpexpr->Append(pexprChild);
+		}
+		CExpressionArray *pdrgpexprPred =
+			CPredicateUtils::PdrgpexprConjuncts(mp, (*pexprNAryJoin)[ulRels]);
+		pdrgpexpr->AddRef();
+		pdrgpexprPred->AddRef();
+
+		CJoinOrderDPhyp jodphyp(mp, pdrgpexpr, pdrgpexprPred,
+								GPOS_NEW(mp) CExpressionArray(mp),
+								NULL /*childPredIndexes*/);
+		jodphyp.PexprExpand();
+		GPOS_RTL_ASSERT((ulRels * ulRels * ulRels - ulRels) / 6 ==
+						jodphyp.NumPairs());
+
+		CExpression *pexprResult = jodphyp.GetNextOfTopK();
+		GPOS_RTL_ASSERT(NULL != pexprResult);
+		{
+			CAutoTrace at(mp);
+			at.Os() << std::endl
+					<< "INPUT:" << std::endl
+					<< *pexprNAryJoin << std::endl;
+			at.Os() << std::endl
+					<< "OUTPUT:" << std::endl
+					<< *pexprResult << std::endl;
+		}
+		pexprResult->Release();
+		pexprNAryJoin->Release();
+		pdrgpexpr->Release();
+		pdrgpexprPred->Release();
+	}
+
+	return GPOS_OK;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderTest::EresUnittest_ExpandDPv2
+//
+//	@doc:
+//		Expansion using DPv2; the join has more atoms than the exhaustive
+//		limit, so the higher levels keep only their best group, and the
+//		later enumeration algorithms take the stats of any discarded group
+//		they recreate from the stats cache instead of deriving them again
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CJoinOrderTest::EresUnittest_ExpandDPv2()
+{
+	CAutoMemoryPool amp;
+	CMemoryPool *mp = amp.Pmp();
+
+	// array of relation names
+	CWStringConst rgscRel[] = {
+		GPOS_WSZ_LIT("Rel10"), GPOS_WSZ_LIT("Rel3"),  GPOS_WSZ_LIT("Rel4"),
+		GPOS_WSZ_LIT("Rel6"),  GPOS_WSZ_LIT("Rel7"),  GPOS_WSZ_LIT("Rel8"),
+		GPOS_WSZ_LIT("Rel12"), GPOS_WSZ_LIT("Rel13"), GPOS_WSZ_LIT("Rel5"),
+		GPOS_WSZ_LIT("Rel14"), GPOS_WSZ_LIT("Rel15"), GPOS_WSZ_LIT("Rel1"),
+		GPOS_WSZ_LIT("Rel11"), GPOS_WSZ_LIT("Rel2"),  GPOS_WSZ_LIT("Rel9"),
+	};
+
+	// array of relation IDs
+	ULONG rgulRel[] = {
+		GPOPT_TEST_REL_OID10, GPOPT_TEST_REL_OID3,	GPOPT_TEST_REL_OID4,
+		GPOPT_TEST_REL_OID6,  GPOPT_TEST_REL_OID7,	GPOPT_TEST_REL_OID8,
+		GPOPT_TEST_REL_OID12, GPOPT_TEST_REL_OID13, GPOPT_TEST_REL_OID5,
+		GPOPT_TEST_REL_OID14, GPOPT_TEST_REL_OID15, GPOPT_TEST_REL_OID1,
+		GPOPT_TEST_REL_OID11, GPOPT_TEST_REL_OID2,	GPOPT_TEST_REL_OID9,
+	};
+
+	const ULONG ulRels = GPOS_ARRAY_SIZE(rgscRel);
+	GPOS_ASSERT(GPOS_ARRAY_SIZE(rgulRel) == ulRels);
+
+	// setup a file-based provider
+	CMDProviderMemory *pmdp = CTestUtils::m_pmdpf;
+	pmdp->AddRef();
+	CMDAccessor mda(mp, CMDCache::Pcache());
+	mda.RegisterProvider(CTestUtils::m_sysidDefault, pmdp);
+
+	{
+		// install opt context in TLS
+		CAutoOptCtxt aoc(mp, &mda, NULL, /* pceeval */
+						 CTestUtils::GetCostModel(mp));
+
+		CExpression *pexprNAryJoin = CTestUtils::PexprLogicalNAryJoin(
+			mp, rgscRel, rgulRel, ulRels, false /*fCrossProduct*/);
+
+		// derive stats on input expression
+		CExpressionHandle exprhdl(mp);
+		exprhdl.Attach(pexprNAryJoin);
+		exprhdl.DeriveStats(mp, mp, NULL /*prprel*/, NULL /*stats_ctxt*/);
+
+		CExpressionArray *pdrgpexpr = GPOS_NEW(mp) CExpressionArray(mp);
+		for (ULONG ul = 0; ul < ulRels; ul++)
+		{
+			CExpression *pexprChild = (*pexprNAryJoin)[ul];
+			pexprChild->AddRef();
+			pdrgpexpr->Append(pexprChild);
+		}
+		CExpressionArray *pdrgpexprPred =
+			CPredicateUtils::PdrgpexprConjuncts(mp, (*pexprNAryJoin)[ulRels]);
+		pdrgpexpr->AddRef();
+		pdrgpexprPred->AddRef();
+
+		COptimizerConfig *optimizer_config =
+			COptCtxt::PoctxtFromTLS()->GetOptimizerConfig();
+		GPOS_RTL_ASSERT(optimizer_config->GetHint()->UlJoinOrderDPLimit() <
+						ulRels);
+
+		CJoinOrderDPv2 jodpv2(mp, pdrgpexpr, pdrgpexprPred,
+							  GPOS_NEW(mp) CExpressionArray(mp),
+							  NULL /*childPredIndexes*/,
+							  GPOS_NEW(mp) CColRefSet(mp) /*outerRefs*/);
+		jodpv2.PexprExpand();
+
+		// every set of atoms had its stats derived once; whether a later
+		// algorithm reuses a discarded group depends on the costs, so the
+		// number of hits is only printed
+		GPOS_RTL_ASSERT(0 < jodpv2.StatsCacheMisses());
+		GPOS_RTL_ASSERT(jodpv2.StatsCacheMisses() ==
+						jodpv2.StatsCacheEntries());
+
+		CExpression *pexprResult = jodpv2.GetNextOfTopK();
+		GPOS_RTL_ASSERT(NULL != pexprResult);
+		{
+			CAutoTrace at(mp);
+			at.Os() << std::endl
+					<< "INPUT:" << std::endl
+					<< *pexprNAryJoin << std::endl;
+			at.Os() << std::endl
+					<< "OUTPUT:" << std::endl
+					<< *pexprResult << std::endl;
+			jodpv2.OsPrint(at.Os());
+		}
+		pexprResult->Release();
+		pexprNAryJoin->Release();
+		pdrgpexpr->Release();
+		pdrgpexprPred->Release();
+	}
+
+	return GPOS_OK;
+}
+
 //	run all Minidump-based tests with plan matching
 GPOS_RESULT
 CJoinOrderTest::EresUnittest_RunTests()
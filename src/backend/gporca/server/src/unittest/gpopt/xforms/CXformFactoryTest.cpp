@@ -32,7 +32,8 @@ GPOS_RESULT
 CXformFactoryTest::EresUnittest()
 {
 	CUnittest rgut[] = {
-		GPOS_UNITTEST_FUNC(CXformFactoryTest::EresUnittest_Basic)};
+		GPOS_UNITTEST_FUNC(CXformFactoryTest::EresUnittest_Basic),
+		GPOS_UNITTEST_FUNC(CXformFactoryTest::EresUnittest_OperatorIndex)};
 
 	return CUnittest::EresExecute(rgut, GPOS_ARRAY_SIZE(rgut));
 }
@@ -72,5 +73,52 @@ CXformFactoryTest::EresUnittest_Basic()
 }
 
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformFactoryTest::EresUnittest_OperatorIndex
+//
+//	@doc:
+//		Check that every xform is indexed under the operators its pattern
+//		can be rooted at, and only under those
+//
+//---------------------------------------------------------------------------
+GPOS_RESULT
+CXformFactoryTest::EresUnittest_OperatorIndex()
+{
+	CXformFactory *pxff = CXformFactory::Pxff();
+
+	for (ULONG ul = 0; ul < CXform::ExfSentinel; ul++)
+	{
+		CXform::EXformId exfid = (CXform::EXformId) ul;
+		if (!pxff->IsXformIdUsed(exfid))
+		{
+			continue;
+		}
+
+		COperator *popPattern = pxff->Pxf(exfid)->PexprPattern()->Pop();
+		if (!popPattern->FPattern())
+		{
+			GPOS_RTL_ASSERT(
+				pxff->PxfsOperator(popPattern->Eopid())->Get(exfid));
+		}
+	}
+
+	// a pattern rooted at a logical operator only matches that operator
+	GPOS_RTL_ASSERT(pxff->PxfsOperator(COperator::EopLogicalGet)
+						->Get(CXform::ExfGet2TableScan));
+	GPOS_RTL_ASSERT(!pxff->PxfsOperator(COperator::EopLogicalSelect)
+						 ->Get(CXform::ExfGet2TableScan));
+
+	// a pattern rooted at a pattern node matches all operators of the node
+	GPOS_RTL_ASSERT(pxff->PxfsOperator(COperator::EopLogicalInnerJoin)
+						->Get(CXform::ExfJoin2IndexGetApply));
+	GPOS_RTL_ASSERT(pxff->PxfsOperator(COperator::EopLogicalLeftOuterJoin)
+						->Get(CXform::ExfJoin2IndexGetApply));
+	GPOS_RTL_ASSERT(!pxff->PxfsOperator(COperator::EopLogicalGet)
+						 ->Get(CXform::ExfJoin2IndexGetApply));
+
+	return GPOS_OK;
+}
+
 
 // EOF
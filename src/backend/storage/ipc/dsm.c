@@ -452,9 +452,12 @@ dsm_set_control_handle(dsm_handle h)
 
 /*
  * Create a new dynamic shared memory segment.
+ *
+ * If DSM_CREATE_NULL_IF_MAXSEGMENTS is passed in flags, NULL is returned
+ * instead of raising an error when all the segment slots are in use.
  */
 dsm_segment *
-dsm_create(Size size)
+dsm_create(Size size, int flags)
 {
 	dsm_segment *seg = dsm_create_descriptor();
 	uint32		i;
@@ -506,6 +509,9 @@ dsm_create(Size size)
 			ResourceOwnerForgetDSM(seg->resowner, seg);
 		dlist_delete(&seg->node);
 		pfree(seg);
+
+		if ((flags & DSM_CREATE_NULL_IF_MAXSEGMENTS) != 0)
+			return NULL;
 		ereport(ERROR,
 				(errcode(ERRCODE_INSUFFICIENT_RESOURCES),
 				 errmsg("too many dynamic shared memory segments")));
@@ -53,6 +53,7 @@
 #include "utils/faultinjector.h"
 #include "utils/sharedsnapshot.h"
 #include "utils/gpexpand.h"
+#include "utils/mdsharedcache.h"
 
 #include "libpq-fe.h"
 #include "libpq-int.h"
@@ -62,6 +63,7 @@
 #include "postmaster/backoff.h"
 #include "cdb/memquota.h"
 #include "executor/instrument.h"
+#include "executor/nodeShareInputScan.h"
 #include "executor/spi.h"
 #include "utils/workfile_mgr.h"
 #include "utils/session_state.h"
@@ -210,12 +212,18 @@ CreateSharedMemoryAndSemaphores(int port)
 		/* size of expand version */
 		size = add_size(size, GpExpandVersionShmemSize());
 
+		/* size of the shared optimizer metadata cache */
+		size = add_size(size, MDSharedCacheShmemSize());
+
 		/* size of token and endpoint shared memory */
 		size = add_size(size, EndpointShmemSize());
 
 		/* size of parallel cursor count */
 		size = add_size(size, ParallelCursorCountSize());
 
+		/* size of cross-slice shared scan state */
+		size = add_size(size, ShareInputShmemSize());
+
 		elog(DEBUG3, "invoking IpcMemoryCreate(size=%zu)", size);
 
 		/*
@@ -363,6 +371,10 @@ CreateSharedMemoryAndSemaphores(int port)
 
 	GpExpandVersionShmemInit();
 
+	MDSharedCacheShmemInit();
+
+	ShareInputShmemInit();
+
 	FtsProbeShmemInit();
 
 #ifdef EXEC_BACKEND
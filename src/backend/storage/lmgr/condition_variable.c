@@ -0,0 +1,237 @@
+/*-------------------------------------------------------------------------
+ *
+ * condition_variable.c
+ *	  Implementation of condition variables.  Condition variables provide
+ *	  a way for one process to wait until a specific condition occurs,
+ *	  without needing to know the specific identity of the process for
+ *	  which they are waiting.  Waits for condition variables can be
+ *	  interrupted, unlike LWLock waits.  Condition variables are safe
+ *	  to use within dynamic shared memory segments.
+ *
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * src/backend/storage/lmgr/condition_variable.c
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include "miscadmin.h"
+#include "storage/condition_variable.h"
+#include "storage/ipc.h"
+#include "storage/proc.h"
+#include "storage/spin.h"
+
+/* Initially, we are not prepared to sleep on any condition variable. */
+static ConditionVariable *cv_sleep_target = NULL;
+
+/*
+ * Initialize a condition variable.
+ */
+void
+ConditionVariableInit(ConditionVariable *cv)
+{
+	SpinLockInit(&cv->mutex);
+	SHMQueueInit(&cv->wakeup);
+}
+
+/*
+ * Prepare to wait on a given condition variable.  This can optionally be
+ * called before entering a test/sleep loop.  Alternatively, the call to
+ * ConditionVariablePrepareToSleep can be omitted.  The only advantage of
+ * calling ConditionVariablePrepareToSleep is that it avoids an initial
+ * double-test of the user's predicate in the case that we need to wait.
+ */
+void
+ConditionVariablePrepareToSleep(ConditionVariable *cv)
+{
+	volatile ConditionVariable *vcv = cv;
+
+	/*
+	 * It's not legal to prepare a sleep until the previous sleep has been
+	 * completed or canceled.
+	 */
+	Assert(cv_sleep_target == NULL);
+
+	/* Record the condition variable on which we will sleep. */
+	cv_sleep_target = cv;
+
+	/*
+	 * Reset my latch before adding myself to the queue and before entering
+	 * the caller's predicate loop.
+	 */
+	ResetLatch(&MyProc->procLatch);
+
+	/* Add myself to the wait queue. */
+	SpinLockAcquire(&vcv->mutex);
+	if (SHMQueueIsDetached(&MyProc->cvWaitLink))
+		SHMQueueInsertBefore((SHM_QUEUE *) &vcv->wakeup, &MyProc->cvWaitLink);
+	SpinLockRelease(&vcv->mutex);
+}
+
+/*
+ * Wait for the given condition variable to be signaled.  This should be
+ * called in a predicate loop that tests for a specific exit condition and
+ * otherwise sleeps, like so:
+ *
+ *	 ConditionVariablePrepareToSleep(cv); [optional]
+ *	 while (condition for which we are waiting is not true)
+ *		 ConditionVariableSleep(cv);
+ *	 ConditionVariableCancelSleep();
+ */
+void
+ConditionVariableSleep(ConditionVariable *cv)
+{
+	volatile ConditionVariable *vcv = cv;
+	bool		done = false;
+
+	/*
+	 * If the caller didn't prepare to sleep explicitly, then do so now and
+	 * return immediately.  The caller's predicate loop should immediately
+	 * call again if its exit condition is not yet met.  This initial spurious
+	 * return can be avoided by calling ConditionVariablePrepareToSleep(cv)
+	 * first.  Whether it's worth doing that depends on whether you expect the
+	 * condition to be met initially, in which case skipping the prepare
+	 * allows you to skip manipulation of the wait list, or not met initially,
+	 * in which case preparing first allows you to skip a spurious test of
+	 * the caller's exit condition.
+	 */
+	if (cv_sleep_target == NULL)
+	{
+		ConditionVariablePrepareToSleep(cv);
+		return;
+	}
+
+	/* Any earlier condition variable sleep must have been canceled. */
+	Assert(cv_sleep_target == cv);
+
+	while (!done)
+	{
+		int			rc;
+
+		CHECK_FOR_INTERRUPTS();
+
+		/*
+		 * Wait for latch to be set.  We don't care about the result because
+		 * our contract permits spurious returns.
+		 */
+		rc = WaitLatch(&MyProc->procLatch, WL_LATCH_SET | WL_POSTMASTER_DEATH, -1);
+
+		/* Emergency bailout if postmaster has died */
+		if (rc & WL_POSTMASTER_DEATH)
+			proc_exit(1);
+
+		/* Reset latch before testing whether we can return. */
+		ResetLatch(&MyProc->procLatch);
+
+		/*
+		 * If this process has been taken out of the wait list, then we know
+		 * that is has been signaled by ConditionVariableSignal.  We put it
+		 * back into the wait list, so we don't miss any further signals while
+		 * the caller's loop checks its condition.  If it hasn't been taken
+		 * out of the wait list, then the latch must have been set by
+		 * something other than ConditionVariableSignal; though we don't
+		 * guarantee not to return spuriously, we'll avoid these obvious
+		 * cases.
+		 */
+		SpinLockAcquire(&vcv->mutex);
+		if (SHMQueueIsDetached(&MyProc->cvWaitLink))
+		{
+			done = true;
+			SHMQueueInsertBefore((SHM_QUEUE *) &vcv->wakeup, &MyProc->cvWaitLink);
+		}
+		SpinLockRelease(&vcv->mutex);
+	}
+}
+
+/*
+ * Cancel any pending sleep operation.  We just need to remove ourselves
+ * from the wait queue of any condition variable for which we have previously
+ * prepared a sleep.
+ */
+void
+ConditionVariableCancelSleep(void)
+{
+	volatile ConditionVariable *cv = cv_sleep_target;
+
+	if (cv == NULL)
+		return;
+
+	SpinLockAcquire(&cv->mutex);
+	if (!SHMQueueIsDetached(&MyProc->cvWaitLink))
+	{
+		SHMQueueDelete(&MyProc->cvWaitLink);
+		SHMQueueElemInit(&MyProc->cvWaitLink);
+	}
+	SpinLockRelease(&cv->mutex);
+
+	cv_sleep_target = NULL;
+}
+
+/*
+ * Wake up one sleeping process, assuming there is at least one.
+ *
+ * The return value indicates whether or not we woke somebody up.
+ */
+bool
+ConditionVariableSignal(ConditionVariable *cv)
+{
+	volatile ConditionVariable *vcv = cv;
+	PGPROC	   *proc;
+
+	/* Remove the first process from the wakeup queue (if any). */
+	SpinLockAcquire(&vcv->mutex);
+	proc = (PGPROC *) SHMQueueNext((SHM_QUEUE *) &vcv->wakeup,
+								   (SHM_QUEUE *) &vcv->wakeup,
+								   offsetof(PGPROC, cvWaitLink));
+	if (proc != NULL)
+	{
+		SHMQueueDelete(&proc->cvWaitLink);
+		SHMQueueElemInit(&proc->cvWaitLink);
+	}
+	SpinLockRelease(&vcv->mutex);
+
+	/* If we found someone sleeping, set their latch to wake them up. */
+	if (proc != NULL)
+	{
+		SetLatch(&proc->procLatch);
+		return true;
+	}
+
+	/* No sleeping processes. */
+	return false;
+}
+
+/*
+ * Wake up all sleeping processes.
+ *
+ * The return value indicates the number of processes we woke.
+ */
+int
+ConditionVariableBroadcast(ConditionVariable *cv)
+{
+	volatile ConditionVariable *vcv = cv;
+	SHM_QUEUE  *elem;
+	int			nwaiters = 0;
+	int			nwoken = 0;
+
+	/*
+	 * Count the processes sleeping now, and wake up that many.  A woken
+	 * process puts itself back at the end of the queue, so signaling until
+	 * the queue is empty could go on forever.  We don't want to set latches
+	 * while holding the mutex either.
+	 */
+	SpinLockAcquire(&vcv->mutex);
+	elem = (SHM_QUEUE *) &vcv->wakeup;
+	while ((elem = (SHM_QUEUE *) SHMQueueNext((SHM_QUEUE *) &vcv->wakeup,
+											  elem, 0)) != NULL)
+		++nwaiters;
+	SpinLockRelease(&vcv->mutex);
+
+	while (nwoken < nwaiters && ConditionVariableSignal(cv))
+		++nwoken;
+
+	return nwoken;
+}
@@ -253,6 +253,9 @@ NumLWLocks(void)
     /* cdbfts.c needs one lock */
     numLocks++;
 
+	/* mdsharedcache.c needs one lock */
+	numLocks++;
+
 	/* multixact.c needs two SLRU areas */
 	numLocks += NUM_MXACTOFFSET_BUFFERS + NUM_MXACTMEMBER_BUFFERS;
 
@@ -47,6 +47,7 @@
 #include "replication/slot.h"
 #include "replication/syncrep.h"
 #include "replication/walsender.h"
+#include "storage/condition_variable.h"
 #include "storage/ipc.h"
 #include "storage/spin.h"
 #include "storage/sinval.h"
@@ -510,6 +511,9 @@ InitProcess(void)
 	MyProc->syncRepState = SYNC_REP_NOT_WAITING;
 	SHMQueueElemInit(&(MyProc->syncRepLinks));
 
+	/* Initialize the link for condition variables */
+	SHMQueueElemInit(&(MyProc->cvWaitLink));
+
 	/*
 	 * Acquire ownership of the PGPROC's latch, so that we can use WaitLatch.
 	 * Note that there's no particular need to do ResetLatch here.
@@ -684,6 +688,7 @@ InitAuxiliaryProcess(void)
 			Assert(SHMQueueEmpty(&(MyProc->myProcLocks[i])));
 	}
 #endif
+	SHMQueueElemInit(&(MyProc->cvWaitLink));
 
 	/*
 	 * Acquire ownership of the PGPROC's latch, so that we can use WaitLatch.
@@ -1007,6 +1012,9 @@ ProcKill(int code, Datum arg)
 	 */
 	LWLockReleaseAll();
 
+	/* Make sure we're not left in the wait list of a condition variable */
+	ConditionVariableCancelSleep();
+
 	MyProc->localDistribXactData.state = LOCALDISTRIBXACT_STATE_NONE;
     MyProc->mppLocalProcessSerial = 0;
 	MyProc->mppSessionId = InvalidGpSessionId;
@@ -1090,6 +1098,9 @@ AuxiliaryProcKill(int code, Datum arg)
 	/* Release any LW locks I am holding (see notes above) */
 	LWLockReleaseAll();
 
+	/* Make sure we're not left in the wait list of a condition variable */
+	ConditionVariableCancelSleep();
+
 	/*
 	 * Clear MyProc first; then disown the process latch.  This is so that
 	 * signal handlers won't try to clear the process latch after it's no
@@ -8,13 +8,17 @@
  *
  * gp_opt_version: This function wraps LibraryVersion. 
  *
+ * gp_optimizer_profile: This function wraps OptimizerProfile.
+ *
  * Copyright(c) 2012 - present, EMC/Greenplum
  */
 
 #include "postgres.h"
 
 #include "funcapi.h"
+#include "miscadmin.h"
 #include "utils/builtins.h"
+#include "utils/tuplestore.h"
 
 extern Datum EnableXform(PG_FUNCTION_ARGS);
 
@@ -60,3 +64,44 @@ gp_opt_version(PG_FUNCTION_ARGS __attribute__((unused)))
 	return CStringGetTextDatum("Server has been compiled without ORCA");
 #endif
 }
+
+extern void OptimizerProfile(Tuplestorestate *tupstore, TupleDesc tupdesc);
+
+/*
+ * Returns the profile of the most recent optimization by GPORCA in this
+ * session: one row per summary item, per search stage and per applied xform.
+ */
+Datum
+gp_optimizer_profile(PG_FUNCTION_ARGS)
+{
+	ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+	TupleDesc	tupdesc;
+	Tuplestorestate *tupstore;
+	MemoryContext oldcontext;
+
+	if (!rsinfo || !IsA(rsinfo, ReturnSetInfo) ||
+		(rsinfo->allowedModes & SFRM_Materialize) == 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("set-valued function called in context that "
+						"cannot accept a set")));
+
+	if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	oldcontext = MemoryContextSwitchTo(rsinfo->econtext->ecxt_per_query_memory);
+
+	tupdesc = CreateTupleDescCopy(tupdesc);
+	tupstore = tuplestore_begin_heap(true, false, work_mem);
+	rsinfo->returnMode = SFRM_Materialize;
+	rsinfo->setResult = tupstore;
+	rsinfo->setDesc = tupdesc;
+
+	MemoryContextSwitchTo(oldcontext);
+
+#ifdef USE_ORCA
+	OptimizerProfile(tupstore, tupdesc);
+#endif
+
+	return (Datum) 0;
+}
@@ -789,6 +789,19 @@ PrepareInvalidationState(void)
 	transInvalInfo = myInfo;
 }
 
+/*
+ * HavePendingInvalidations
+ *		Has the current transaction queued any invalidation messages?
+ *
+ * Such a transaction has changed catalog contents that other backends
+ * can't see yet.
+ */
+bool
+HavePendingInvalidations(void)
+{
+	return transInvalInfo != NULL;
+}
+
 /*
  * PostPrepare_Inval
  *		Clean up after successful PREPARE.
@@ -0,0 +1,406 @@
+/*-------------------------------------------------------------------------
+ *
+ * mdsharedcache.c
+ *	  Cross-backend cache of serialized optimizer metadata objects.
+ *
+ * Every backend running GPORCA keeps a private metadata cache (CMDCache),
+ * which is filled by translating relcache and syscache entries to DXL. On a
+ * coordinator with many sessions, the same objects are translated and kept
+ * over and over again. This module lets backends share the serialized DXL of
+ * those objects through a fixed-size area of shared memory, sized by
+ * optimizer_mdcache_shared_size. The private cache stays in front of it.
+ *
+ * The area consists of a small open-addressing hash table of slots, and a
+ * ring buffer holding the entries themselves. Entries are appended to the
+ * ring at an ever-increasing log position ("head"); an entry is overwritten,
+ * and thus implicitly evicted, once the head has moved more than the ring
+ * size past it.
+ *
+ * Writers are serialized by an LWLock. Readers take no lock at all: a slot
+ * carries a sequence counter that is odd while the slot is being rewritten,
+ * and a reader copies the entry out of the ring and then checks that the
+ * head has not moved far enough to overwrite it meanwhile. Writers advance
+ * the head before they copy data into the ring, so that check is sufficient.
+ * The copied entry also carries its key, which the reader compares to guard
+ * against hash collisions.
+ *
+ * Invalidation is coarse: whenever a backend running GPORCA receives a
+ * catalog invalidation for anything the metadata cache depends on, it bumps
+ * the shared generation number, and entries of older generations are never
+ * returned again. A backend publishes an object only if the generation did
+ * not change between the start of its optimization and the publication, so
+ * an object built from catalog contents that were invalidated meanwhile is
+ * not shared. Backends with uncommitted changes in their own transaction
+ * neither publish nor look up anything: other backends must not see those
+ * changes, and the shared entries don't reflect them.
+ *
+ * Copyright (C) 2026 VMware, Inc. or its affiliates.
+ *
+ * IDENTIFICATION
+ *	    src/backend/utils/cache/mdsharedcache.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/hash.h"
+#include "access/transam.h"
+#include "access/xact.h"
+#include "cdb/cdbvars.h"
+#include "miscadmin.h"
+#include "port/atomics.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
+#include "utils/guc.h"
+#include "utils/inval.h"
+#include "utils/mdsharedcache.h"
+
+/* bytes of ring buffer per hash table slot */
+#define MDSC_RING_BYTES_PER_SLOT	1024
+
+/* number of slots probed for a key */
+#define MDSC_MAX_PROBES				8
+
+typedef struct MDSharedCacheSlot
+{
+	pg_atomic_uint32 seq;		/* odd while the slot is being rewritten */
+	uint32		hash;			/* hash of the key, 0 if the slot is empty */
+	uint32		size;			/* size of the entry in the ring */
+	uint64		generation;		/* generation the entry was published in */
+	uint64		pos;			/* log position of the entry in the ring */
+} MDSharedCacheSlot;
+
+/* entry in the ring, followed by the key and the data */
+typedef struct MDSharedCacheEntry
+{
+	Oid			dbid;
+	uint32		keylen;
+	uint32		datalen;
+} MDSharedCacheEntry;
+
+typedef struct MDSharedCacheControl
+{
+	LWLock	   *lock;			/* serializes writers */
+	pg_atomic_uint64 generation;
+	pg_atomic_uint64 head;		/* log position of the next entry */
+	uint32		nslots;
+	uint64		ringsize;
+	MDSharedCacheSlot slots[1];	/* VARIABLE LENGTH ARRAY */
+} MDSharedCacheControl;
+
+static MDSharedCacheControl *mdSharedCache = NULL;
+static char *mdSharedCacheRing = NULL;
+
+static uint32
+MDSharedCacheNumSlots(void)
+{
+	return Max((Size) optimizer_mdcache_shared_size * 1024L /
+			   MDSC_RING_BYTES_PER_SLOT, MDSC_MAX_PROBES);
+}
+
+static Size
+MDSharedCacheControlSize(void)
+{
+	return MAXALIGN(offsetof(MDSharedCacheControl, slots) +
+					MDSharedCacheNumSlots() * sizeof(MDSharedCacheSlot));
+}
+
+/*
+ * The cache is only useful where queries are planned, so it doesn't
+ * exist on the segments.
+ */
+Size
+MDSharedCacheShmemSize(void)
+{
+	if (optimizer_mdcache_shared_size <= 0)
+		return 0;
+
+	if (Gp_role != GP_ROLE_DISPATCH && Gp_role != GP_ROLE_UTILITY)
+		return 0;
+
+	return add_size(MDSharedCacheControlSize(),
+					(Size) optimizer_mdcache_shared_size * 1024L);
+}
+
+void
+MDSharedCacheShmemInit(void)
+{
+	Size		size = MDSharedCacheShmemSize();
+	bool		found;
+
+	if (size == 0)
+		return;
+
+	mdSharedCache = (MDSharedCacheControl *)
+		ShmemInitStruct("Optimizer Shared Metadata Cache", size, &found);
+	mdSharedCacheRing = (char *) mdSharedCache + MDSharedCacheControlSize();
+
+	if (!found)
+	{
+		uint32		i;
+
+		mdSharedCache->lock = LWLockAssign();
+		pg_atomic_init_u64(&mdSharedCache->generation, 1);
+		pg_atomic_init_u64(&mdSharedCache->head, 0);
+		mdSharedCache->nslots = MDSharedCacheNumSlots();
+		mdSharedCache->ringsize = size - MDSharedCacheControlSize();
+
+		for (i = 0; i < mdSharedCache->nslots; i++)
+		{
+			MDSharedCacheSlot *slot = &mdSharedCache->slots[i];
+
+			pg_atomic_init_u32(&slot->seq, 0);
+			slot->hash = 0;
+			slot->size = 0;
+			slot->generation = 0;
+			slot->pos = 0;
+		}
+	}
+}
+
+bool
+MDSharedCacheEnabled(void)
+{
+	return mdSharedCache != NULL;
+}
+
+uint64
+MDSharedCacheGeneration(void)
+{
+	if (mdSharedCache == NULL)
+		return 0;
+
+	return pg_atomic_read_u64(&mdSharedCache->generation);
+}
+
+/*
+ * Make all entries published so far invisible.
+ */
+void
+MDSharedCacheInvalidate(void)
+{
+	if (mdSharedCache == NULL)
+		return;
+
+	pg_atomic_fetch_add_u64(&mdSharedCache->generation, 1);
+}
+
+/*
+ * Shared entries are built from committed catalog contents. A transaction
+ * that changed the catalogs, or is about to, must see its own changes and
+ * must not publish them.
+ */
+static bool
+MDSharedCacheUsableInXact(void)
+{
+	return !TransactionIdIsValid(GetTopTransactionIdIfAny()) &&
+		!HavePendingInvalidations();
+}
+
+/*
+ * Entries of different databases share the cache, so the database is hashed
+ * along with the key. 0 marks empty slots.
+ */
+static uint32
+MDSharedCacheHash(const char *key, uint32 keylen)
+{
+	uint32		hash;
+
+	hash = DatumGetUInt32(hash_any((const unsigned char *) key, keylen));
+	hash ^= DatumGetUInt32(hash_uint32((uint32) MyDatabaseId));
+
+	return hash == 0 ? 1 : hash;
+}
+
+/* Has the entry at the given log position been overwritten? */
+static inline bool
+MDSharedCachePosOverwritten(uint64 pos)
+{
+	return pg_atomic_read_u64(&mdSharedCache->head) - pos >
+		mdSharedCache->ringsize;
+}
+
+static inline bool
+MDSharedCacheEntryMatches(const MDSharedCacheEntry *entry, const char *key,
+						  uint32 keylen)
+{
+	return entry->dbid == MyDatabaseId && entry->keylen == keylen &&
+		memcmp((const char *) entry + sizeof(MDSharedCacheEntry), key,
+			   keylen) == 0;
+}
+
+/*
+ * Look up the data published for the given key. Returns a palloc'd copy of
+ * it, or NULL if there is none.
+ */
+char *
+MDSharedCacheLookup(const char *key, uint32 keylen, uint32 *datalen)
+{
+	uint32		hash;
+	uint64		generation;
+	int			i;
+
+	if (mdSharedCache == NULL || !MDSharedCacheUsableInXact())
+		return NULL;
+
+	hash = MDSharedCacheHash(key, keylen);
+	generation = pg_atomic_read_u64(&mdSharedCache->generation);
+
+	for (i = 0; i < MDSC_MAX_PROBES; i++)
+	{
+		volatile MDSharedCacheSlot *slot =
+			&mdSharedCache->slots[(hash + i) % mdSharedCache->nslots];
+		MDSharedCacheEntry *entry;
+		uint32		seq;
+		uint32		slothash;
+		uint32		size;
+		uint64		slotgeneration;
+		uint64		pos;
+		char	   *result;
+
+		seq = pg_atomic_read_u32(&slot->seq);
+		if (seq & 1)
+			continue;
+		pg_read_barrier();
+		slothash = slot->hash;
+		size = slot->size;
+		slotgeneration = slot->generation;
+		pos = slot->pos;
+		pg_read_barrier();
+		if (pg_atomic_read_u32(&slot->seq) != seq)
+			continue;
+
+		if (slothash != hash || slotgeneration != generation)
+			continue;
+
+		result = palloc(size);
+		memcpy(result, mdSharedCacheRing + pos % mdSharedCache->ringsize, size);
+		pg_read_barrier();
+
+		entry = (MDSharedCacheEntry *) result;
+		if (MDSharedCachePosOverwritten(pos) ||
+			!MDSharedCacheEntryMatches(entry, key, keylen))
+		{
+			pfree(result);
+			continue;
+		}
+
+		*datalen = entry->datalen;
+		memmove(result, result + sizeof(MDSharedCacheEntry) + keylen,
+				entry->datalen);
+
+		return result;
+	}
+
+	return NULL;
+}
+
+/*
+ * Publish the data of the given key, unless the cache was invalidated since
+ * the given generation was obtained.
+ */
+void
+MDSharedCacheInsert(const char *key, uint32 keylen, const char *data,
+					uint32 datalen, uint64 generation)
+{
+	MDSharedCacheSlot *victim = NULL;
+	bool		victimlive = false;
+	MDSharedCacheEntry entry;
+	uint32		hash;
+	uint32		size;
+	uint64		head;
+	uint64		pos;
+	int			i;
+
+	if (mdSharedCache == NULL)
+		return;
+
+	/* others must not see the effects of our uncommitted catalog changes */
+	if (!MDSharedCacheUsableInXact())
+		return;
+
+	size = MAXALIGN(sizeof(MDSharedCacheEntry) + keylen + datalen);
+
+	/* don't let a single huge object wipe out the whole cache */
+	if (size > mdSharedCache->ringsize / 4)
+		return;
+
+	hash = MDSharedCacheHash(key, keylen);
+
+	LWLockAcquire(mdSharedCache->lock, LW_EXCLUSIVE);
+
+	if (pg_atomic_read_u64(&mdSharedCache->generation) != generation)
+	{
+		LWLockRelease(mdSharedCache->lock);
+		return;
+	}
+
+	/*
+	 * Replace the entry of the same key, or else use an empty or stale slot,
+	 * or else the slot whose entry is the oldest.
+	 */
+	for (i = 0; i < MDSC_MAX_PROBES; i++)
+	{
+		MDSharedCacheSlot *slot =
+			&mdSharedCache->slots[(hash + i) % mdSharedCache->nslots];
+		bool		live;
+
+		live = slot->hash != 0 && slot->generation == generation &&
+			!MDSharedCachePosOverwritten(slot->pos);
+
+		if (live && slot->hash == hash &&
+			MDSharedCacheEntryMatches((MDSharedCacheEntry *)
+									  (mdSharedCacheRing + slot->pos %
+									   mdSharedCache->ringsize),
+									  key, keylen))
+		{
+			victim = slot;
+			break;
+		}
+
+		if (!live)
+		{
+			if (victim == NULL || victimlive)
+			{
+				victim = slot;
+				victimlive = false;
+			}
+		}
+		else if (victim == NULL || (victimlive && slot->pos < victim->pos))
+		{
+			victim = slot;
+			victimlive = true;
+		}
+	}
+
+	/* entries don't wrap around the end of the ring */
+	head = pg_atomic_read_u64(&mdSharedCache->head);
+	pos = head;
+	if (pos % mdSharedCache->ringsize + size > mdSharedCache->ringsize)
+		pos += mdSharedCache->ringsize - pos % mdSharedCache->ringsize;
+
+	/* claim the space before overwriting it, see the comment at the top */
+	pg_atomic_write_u64(&mdSharedCache->head, pos + size);
+	pg_write_barrier();
+
+	entry.dbid = MyDatabaseId;
+	entry.keylen = keylen;
+	entry.datalen = datalen;
+	memcpy(mdSharedCacheRing + pos % mdSharedCache->ringsize, &entry,
+		   sizeof(MDSharedCacheEntry));
+	memcpy(mdSharedCacheRing + pos % mdSharedCache->ringsize +
+		   sizeof(MDSharedCacheEntry), key, keylen);
+	memcpy(mdSharedCacheRing + pos % mdSharedCache->ringsize +
+		   sizeof(MDSharedCacheEntry) + keylen, data, datalen);
+
+	pg_atomic_fetch_add_u32(&victim->seq, 1);
+	pg_write_barrier();
+	victim->hash = hash;
+	victim->size = size;
+	victim->generation = generation;
+	victim->pos = pos;
+	pg_write_barrier();
+	pg_atomic_fetch_add_u32(&victim->seq, 1);
+
+	LWLockRelease(mdSharedCache->lock);
+}
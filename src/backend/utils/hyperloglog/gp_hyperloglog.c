@@ -856,6 +856,34 @@ gp_hyperloglog_len(GpHLLCounter hyperloglog)
 	return VARSIZE_ANY(hyperloglog);
 }
 
+/*
+ * Returns the registers of the counter in a palloc'd array of 2^b bytes, one
+ * byte per register, and sets *b to the number of index bits of the counter.
+ * The counter itself is left untouched, so it can point into a catalog tuple.
+ */
+char *
+gp_hyperloglog_get_registers(GpHLLCounter hyperloglog, int *b)
+{
+	GpHLLCounter copy;
+	GpHLLCounter unpacked;
+	char	   *registers;
+	int			m;
+
+	/* gp_hll_unpack() changes the format of a packed counter in place */
+	copy = gp_hll_copy(hyperloglog);
+	unpacked = gp_hll_unpack(copy);
+
+	*b = unpacked->b;
+	m = POW2(unpacked->b);
+	registers = palloc(m);
+	memcpy(registers, unpacked->data, m);
+
+	pfree(unpacked);
+	pfree(copy);
+
+	return registers;
+}
+
 /* GpMurmurHash64A produces the fastest 64 bit hash of the MurmurHash 
  * implementations and is ~ 20x faster than md5. This version produces the
  * same hash for the same key and seed in both big and little endian systems
@@ -79,6 +79,7 @@ static bool check_verify_gpfdists_cert(bool *newval, void **extra, GucSource sou
 static bool check_dispatch_log_stats(bool *newval, void **extra, GucSource source);
 static bool check_gp_hashagg_default_nbatches(int *newval, void **extra, GucSource source);
 static bool check_gp_workfile_compression(bool *newval, void **extra, GucSource source);
+static bool check_gp_interconnect_compression(bool *newval, void **extra, GucSource source);
 
 /* Helper function for guc setter */
 bool gpvars_check_gp_resqueue_priority_default_value(char **newval,
@@ -308,7 +309,12 @@ int			optimizer_minidump;
 int			optimizer_cost_model;
 bool		optimizer_metadata_caching;
 int			optimizer_mdcache_size;
+int			optimizer_mdcache_shared_size;
+int			optimizer_plan_cache_size;
+int			optimizer_memo_memory_budget;
+bool		optimizer_prefetch_metadata;
 bool		optimizer_use_gpdb_allocators;
+bool		optimizer_use_arena_allocators;
 
 /* Optimizer debugging GUCs */
 bool		optimizer_print_query;
@@ -322,6 +328,8 @@ bool		optimizer_print_expression_properties;
 bool		optimizer_print_group_properties;
 bool		optimizer_print_optimization_context;
 bool		optimizer_print_optimization_stats;
+bool		optimizer_collect_optimization_stats;
+bool		optimizer_explain_profile;
 bool		optimizer_print_xform_results;
 
 /* array of xforms disable flags */
@@ -412,6 +420,7 @@ bool		optimizer_force_three_stage_scalar_dqa;
 bool		optimizer_force_expanded_distinct_aggs;
 bool		optimizer_force_agg_skew_avoidance;
 bool		optimizer_penalize_skew;
+bool		optimizer_penalize_heavy_hitters;
 bool		optimizer_prune_computed_columns;
 bool		optimizer_push_requirements_from_consumer_to_producer;
 bool		optimizer_enforce_subplans;
@@ -468,6 +477,7 @@ bool		gp_external_enable_filter_pushdown = true;
 /* Executor */
 bool		gp_enable_mk_sort = true;
 bool		gp_enable_motion_mk_sort = true;
+bool		gp_enable_runtime_filter = false;
 
 /* Enable GDD */
 bool		gp_enable_global_deadlock_detector = false;
@@ -614,6 +624,7 @@ static const struct config_enum_entry optimizer_join_order_options[] = {
 	{"greedy", JOIN_ORDER_GREEDY_SEARCH},
 	{"exhaustive", JOIN_ORDER_EXHAUSTIVE_SEARCH},
 	{"exhaustive2", JOIN_ORDER_EXHAUSTIVE2_SEARCH},
+	{"hypergraph", JOIN_ORDER_HYPERGRAPH_SEARCH},
 	{NULL, 0}
 };
 
@@ -923,6 +934,19 @@ struct config_bool ConfigureNamesBool_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"gp_enable_runtime_filter", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enable runtime filters from hash joins to the scans on their outer side."),
+			gettext_noop("The inner side of a hash join builds a Bloom filter and a range "
+						 "of its join keys, and the sequential scan that produces the "
+						 "outer rows drops the rows that cannot match."),
+			GUC_NOT_IN_SAMPLE
+		},
+		&gp_enable_runtime_filter,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"gp_gang_creation_retry_non_recovery", PGC_USERSET, QUERY_TUNING_METHOD,
 		 gettext_noop("Retry gang creation if non-recovery failures are encountered during dispatch."),
@@ -1219,6 +1243,16 @@ struct config_bool ConfigureNamesBool_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"gp_interconnect_compression", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Compresses the tuple data sent over the interconnect."),
+			gettext_noop("Packets that do not compress well are sent uncompressed.")
+		},
+		&gp_interconnect_compression,
+		false,
+		check_gp_interconnect_compression, NULL, NULL
+	},
+
 	{
 		{"gp_interconnect_log_stats", PGC_USERSET, QUERY_TUNING_OTHER,
 			gettext_noop("Emit statistics from the UDP-IC at the end of every statement."),
@@ -2184,6 +2218,16 @@ struct config_bool ConfigureNamesBool_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_prefetch_metadata", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Prefetch the statistics of all relations and columns referenced in a query before optimizing it."),
+			NULL
+		},
+		&optimizer_prefetch_metadata,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"optimizer_print_missing_stats", PGC_USERSET, LOGGING_WHAT,
 			gettext_noop("Print columns with missing statistics."),
@@ -2294,6 +2338,28 @@ struct config_bool ConfigureNamesBool_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_collect_optimization_stats", PGC_USERSET, STATS_MONITORING,
+			gettext_noop("Collect a profile of each optimization for EXPLAIN and gp_optimizer_profile()."),
+			NULL,
+			GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_collect_optimization_stats,
+		true,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"optimizer_explain_profile", PGC_USERSET, STATS_MONITORING,
+			gettext_noop("Show the optimizer profile in EXPLAIN (ANALYZE, VERBOSE)."),
+			gettext_noop("Requires optimizer_collect_optimization_stats."),
+			GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_explain_profile,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"optimizer_extract_dxl_stats", PGC_USERSET, LOGGING_WHAT,
 			gettext_noop("Extract plan stats in dxl."),
@@ -2596,6 +2662,17 @@ struct config_bool ConfigureNamesBool_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_penalize_heavy_hitters", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Cost a hash redistribute by the rows its most frequent value sends to one segment."),
+			NULL,
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_penalize_heavy_hitters,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"optimizer_multilevel_partitioning", PGC_USERSET, DEVELOPER_OPTIONS,
 			gettext_noop("Enable optimization of queries on multilevel partitioned tables."),
@@ -3026,6 +3103,17 @@ struct config_bool ConfigureNamesBool_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_use_arena_allocators", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Serve ORCA allocations from slabs of GPDB memory contexts."),
+			gettext_noop("Only takes effect when optimizer_use_gpdb_allocators is on."),
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE
+		},
+		&optimizer_use_arena_allocators,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"vmem_process_interrupt", PGC_USERSET, DEVELOPER_OPTIONS,
 			gettext_noop("Checks for interrupts before reserving VMEM"),
@@ -3645,6 +3733,17 @@ struct config_int ConfigureNamesInt_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"gp_shared_scan_memory_limit", PGC_USERSET, RESOURCES_MEM,
+			gettext_noop("Maximum size (in KB) of a cross-slice shared scan kept in shared memory."),
+			gettext_noop("Larger shared scans are written to workfiles. 0 always uses workfiles."),
+			GUC_UNIT_KB
+		},
+		&gp_shared_scan_memory_limit,
+		4096, 0, MAX_KILOBYTES,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"gp_vmem_idle_resource_timeout", PGC_USERSET, CLIENT_CONN_OTHER,
 			gettext_noop("Sets the time a session can be idle (in milliseconds) before we release gangs on the segment DBs to free resources."),
@@ -4245,6 +4344,17 @@ struct config_int ConfigureNamesInt_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"gp_motion_batch_size", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Sets the number of tuples that motions send in a batch."),
+			gettext_noop("Batches are laid out column by column, and are sent when they are "
+						 "full, or at the end of the stream. 0 sends the tuples one by one.")
+		},
+		&gp_motion_batch_size,
+		0, 0, 65536,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"gp_reject_percent_threshold", PGC_USERSET, GP_ERROR_HANDLING,
 			gettext_noop("Reject limit in percent starts calculating after this number of rows processed"),
@@ -4618,6 +4728,39 @@ struct config_int ConfigureNamesInt_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"optimizer_memo_memory_budget", PGC_USERSET, RESOURCES_MEM,
+			gettext_noop("Sets the memory used by GPORCA for a query at which the search is degraded."),
+			gettext_noop("Past this amount, GPORCA stops exploring expensive alternatives and returns the first plan it finds, instead of running out of memory. Zero disables the budget."),
+			GUC_UNIT_KB
+		},
+		&optimizer_memo_memory_budget,
+		0, 0, INT_MAX,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"optimizer_mdcache_shared_size", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Sets the size of the MDCache shared by all sessions on the coordinator."),
+			gettext_noop("Zero disables the shared MDCache."),
+			GUC_UNIT_KB
+		},
+		&optimizer_mdcache_shared_size,
+		0, 0, MAX_KILOBYTES,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"optimizer_plan_cache_size", PGC_USERSET, RESOURCES_MEM,
+			gettext_noop("Sets the size of the session's cache of plans produced by GPORCA."),
+			gettext_noop("Zero disables the plan cache."),
+			GUC_UNIT_KB
+		},
+		&optimizer_plan_cache_size,
+		0, 0, MAX_KILOBYTES,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"memory_profiler_dataset_size", PGC_USERSET, DEVELOPER_OPTIONS,
 			gettext_noop("Set the size in GB"),
@@ -4840,6 +4983,17 @@ struct config_real ConfigureNamesReal_gp[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"gp_hashagg_stream_min_reduction", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Minimum fraction of input rows the streaming bottom stage of a hashagg must merge into groups."),
+			gettext_noop("Below it, the partial groups are streamed out in small batches. 0 disables this."),
+			GUC_NOT_IN_SAMPLE
+		},
+		&gp_hashagg_stream_min_reduction,
+		0.1, 0.0, 1.0,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"gp_resqueue_priority_cpucores_per_segment", PGC_POSTMASTER, RESOURCES_MGM,
 			gettext_noop("Number of processing units associated with a segment."),
@@ -5373,7 +5527,7 @@ struct config_enum ConfigureNamesEnum_gp[] =
 	{
 		{"optimizer_join_order", PGC_USERSET, QUERY_TUNING_OTHER,
 			gettext_noop("Set optimizer join heuristic model."),
-			gettext_noop("Valid values are query, greedy, exhaustive and exhaustive2"),
+			gettext_noop("Valid values are query, greedy, exhaustive, exhaustive2 and hypergraph"),
 			GUC_NOT_IN_SAMPLE
 		},
 		&optimizer_join_order,
@@ -5786,6 +5940,19 @@ check_gp_workfile_compression(bool *newval, void **extra, GucSource source)
 	return true;
 }
 
+static bool
+check_gp_interconnect_compression(bool *newval, void **extra, GucSource source)
+{
+#ifndef HAVE_LIBZSTD
+	if (*newval)
+	{
+		GUC_check_errmsg("interconnect compression is not supported by this build");
+		return false;
+	}
+#endif
+	return true;
+}
+
 void
 DispatchSyncPGVariable(struct config_generic * gconfig)
 {
@@ -246,6 +246,7 @@ struct NTupleStore
 
 	workfile_set *work_set; /* workfile set to use when using workfile manager */
 	char	   *operation_name;
+	char	   *rw_filename;	/* name of the shared files, for a writer */
 
 	BufFile *pfile; 	/* underlying backed file */
 	BufFile *plobfile;  /* underlying backed file for lobs (entries does not fit one page) */
@@ -261,6 +262,7 @@ struct NTupleStore
 };
 
 bool ntuplestore_is_readerwriter_reader(NTupleStore *nts) { return nts->rwflag == NTS_IS_READER; }
+bool ntuplestore_is_spilled(NTupleStore *nts) { return nts->pfile != NULL; }
 
 /* Accessor to the tuplestore.
  * 
@@ -695,6 +697,9 @@ ntuplestore_destroy(NTupleStore *ts)
 		ts->work_set = NULL;
 	}
 
+	if (ts->rw_filename)
+		pfree(ts->rw_filename);
+
 	pfree(ts);
 }
 
@@ -712,6 +717,7 @@ ntuplestore_create_common(int64 maxBytes, char *operation_name)
 
 	store->work_set = NULL;
 	store->operation_name = operation_name;
+	store->rw_filename = NULL;
 
 	Assert(maxBytes >= 0);
 	store->page_max = maxBytes / BLCKSZ;
@@ -747,6 +753,10 @@ ntuplestore_create_common(int64 maxBytes, char *operation_name)
  *   filename must be a unique name that identifies the share.
  *   filename does not include the pgsql_tmp/ prefix
  *   useWorkFile specify whether to use workfile for tuplestore
+ *
+ * The writer creates the named files only when it first spills or is
+ * flushed, so that a store handed to the readers in shared memory never
+ * touches the disk.
  */
 NTupleStore *
 ntuplestore_create_readerwriter(const char *filename, int64 maxBytes, bool isWriter)
@@ -760,21 +770,14 @@ ntuplestore_create_readerwriter(const char *filename, int64 maxBytes, bool isWri
 	{
 		store = ntuplestore_create_common(maxBytes, "SharedTupleStore");
 		store->rwflag = NTS_IS_WRITER;
-		store->lobbytes = 0;
-		store->work_set = NULL;
-		store->work_set = workfile_mgr_create_set(store->operation_name, filename, true /* hold pin */);
-		store->pfile = BufFileCreateNamedTemp(filename,
-											  false /* interXact */,
-											  store->work_set);
-		store->plobfile = BufFileCreateNamedTemp(filenamelob,
-												 false /* interXact */,
-												 store->work_set);
+		store->rw_filename = pstrdup(filename);
 	}
 	else
 	{
 		store = (NTupleStore *) palloc(sizeof(NTupleStore));
 		store->mcxt = CurrentMemoryContext;
 		store->work_set = NULL;
+		store->rw_filename = NULL;
 
 		store->pfile = BufFileOpenNamedTemp(filename,
 											false /* interXact */);
@@ -858,7 +861,8 @@ ntuplestore_flush(NTupleStore *ts)
 	NTupleStorePage *p = ts->first_page;
 
 	Assert(ts->rwflag != NTS_IS_READER || !"Flush attempted for Reader");
-	Assert(ts->pfile);
+
+	ntuplestore_create_spill_files(ts);
 
 	while(p)
 	{
@@ -1384,13 +1388,32 @@ ntuplestore_create_spill_files(NTupleStore *nts)
 	}
 
 	Assert(!nts->work_set);
-	nts->work_set = workfile_mgr_create_set(nts->operation_name, NULL, true /* hold pin */);
 
 	oldcxt = MemoryContextSwitchTo(nts->mcxt);
 
-	nts->pfile = BufFileCreateTempInSet(nts->work_set, false /* interXact */);
-
-	nts->plobfile = BufFileCreateTempInSet(nts->work_set, false /* interXact */);
+	if (nts->rwflag == NTS_IS_WRITER)
+	{
+		char		filenamelob[MAXPGPATH];
+
+		/* the readers open these files by name */
+		snprintf(filenamelob, sizeof(filenamelob), "%s_LOB", nts->rw_filename);
+
+		nts->work_set = workfile_mgr_create_set(nts->operation_name, nts->rw_filename,
+												true /* hold pin */);
+		nts->pfile = BufFileCreateNamedTemp(nts->rw_filename,
+											false /* interXact */,
+											nts->work_set);
+		nts->plobfile = BufFileCreateNamedTemp(filenamelob,
+											   false /* interXact */,
+											   nts->work_set);
+	}
+	else
+	{
+		nts->work_set = workfile_mgr_create_set(nts->operation_name, NULL,
+												true /* hold pin */);
+		nts->pfile = BufFileCreateTempInSet(nts->work_set, false /* interXact */);
+		nts->plobfile = BufFileCreateTempInSet(nts->work_set, false /* interXact */);
+	}
 
 	MemoryContextSwitchTo(oldcxt);
 
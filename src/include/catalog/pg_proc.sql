@@ -304,6 +304,8 @@
  CREATE FUNCTION enable_xform(text) RETURNS text LANGUAGE internal IMMUTABLE STRICT AS 'enable_xform' WITH (OID=6088, DESCRIPTION="enables transformations in the optimizer");
 
  CREATE FUNCTION gp_opt_version() RETURNS text LANGUAGE internal IMMUTABLE STRICT AS 'gp_opt_version' WITH (OID=6089, DESCRIPTION="Returns the optimizer and gpos library versions");
+
+ CREATE FUNCTION gp_optimizer_profile(OUT category text, OUT name text, OUT count int8, OUT time_ms float8, OUT alternatives int8) RETURNS SETOF pg_catalog.record LANGUAGE internal VOLATILE AS 'gp_optimizer_profile' EXECUTE ON MASTER WITH (OID=6090, DESCRIPTION="Returns the profile of the most recent optimization by GPORCA in this session");
  
  
   -- functions for the complex data type
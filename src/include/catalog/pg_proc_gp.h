@@ -620,6 +620,10 @@ DESCR("enables transformations in the optimizer");
 DATA(insert OID = 6089 ( gp_opt_version  PGNSP PGUID 12 1 0 0 0 f f f f t f i 0 0 25 "" _null_ _null_ _null_ _null_ gp_opt_version _null_ _null_ _null_ n a ));
 DESCR("Returns the optimizer and gpos library versions");
 
+/* gp_optimizer_profile(OUT category text, OUT name text, OUT count int8, OUT time_ms float8, OUT alternatives int8) => SETOF pg_catalog.record */
+DATA(insert OID = 6090 ( gp_optimizer_profile  PGNSP PGUID 12 1 1000 0 0 f f f f f t v 0 0 2249 "" "{25,25,20,701,20}" "{o,o,o,o,o}" "{category,name,count,time_ms,alternatives}" _null_ gp_optimizer_profile _null_ _null_ _null_ n m ));
+DESCR("Returns the profile of the most recent optimization by GPORCA in this session");
+
 
   /* functions for the complex data type */
 /* complex_in(cstring) => complex */
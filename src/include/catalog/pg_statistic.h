@@ -315,4 +315,20 @@ typedef FormData_pg_statistic *Form_pg_statistic;
  */
 #define STATISTIC_KIND_FULLHLL  98
 
+/*
+ * A "group ndistinct" slot describes a group of columns declared with the
+ * statistics_group attribute option of its first column, on which the slot
+ * is stored. stavalues is not used and should be NULL. stanumbers contains
+ * the number of distinct combinations of values of the group (negative for a
+ * fraction of the rows, like stadistinct), followed by the attribute numbers
+ * of the K columns of the group, the first one being the column itself, and
+ * then by the dependency degree of each of the K columns: the fraction of
+ * the sampled rows in which the value of the column is determined by the
+ * values of the other columns of the group.
+ */
+#define STATISTIC_KIND_NDISTINCT_GROUP  97
+
+/* maximum number of columns of a group, including the column itself */
+#define STATISTIC_GROUP_MAX_COLUMNS  8
+
 #endif   /* PG_STATISTIC_H */
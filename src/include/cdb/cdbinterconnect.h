@@ -291,6 +291,19 @@ struct MotionConn
 	uint64 stat_max_resent;
 	uint64 stat_count_dropped;
 
+	/* tuple chunk bytes before and after interconnect compression */
+	uint64 stat_bytes_before_compression;
+	uint64 stat_bytes_after_compression;
+
+	/*
+	 * used by the sender.
+	 *
+	 * packets to send uncompressed before trying to compress again, and the
+	 * number to skip after the next packet that does not compress well.
+	 */
+	int			compress_skip;
+	int			compress_backoff;
+
 	/*
 	 * used by the sender.
 	 *
@@ -414,6 +427,15 @@ typedef struct MotionNodeEntry
 	 */
 	SerTupInfo      ser_tup_info;
 
+	/*
+	 * If batch_size is > 0, the tuples are sent in batches of up to that many
+	 * tuples, one batch per route plus one for broadcasts, in send_batches.
+	 * The batches are created on first use.
+	 */
+	int             batch_size;
+	SerTupBatch   **send_batches;
+	int             num_send_batches;
+
 	/*
 	 * If preserve_order is false, this is used to hold completed tuples that
 	 * have not yet been consumed.  If preserve_order is true, this is NULL.
@@ -52,7 +52,7 @@ extern MotionLayerState *createMotionLayerState(int maxMotNodeID);
 
 /* Initialization of each motion node in execution plan. */
 extern void UpdateMotionLayerNode(MotionLayerState *mlStates, int16 motNodeID, bool preserveOrder,
-								  TupleDesc tupDesc);
+								  TupleDesc tupDesc, int batchSize);
 
 /* Cleanup of each motion node in execution plan (normal termination). */
 extern void EndMotionLayerNode(MotionLayerState *mlStates, int16 motNodeID, bool flushCommLayer);
@@ -458,6 +458,22 @@ extern bool gp_interconnect_aggressive_retry; /* fast-track app-level retry */
  */
 extern bool gp_interconnect_full_crc;
 
+/*
+ * Parameter gp_interconnect_compression
+ *
+ * Compress the tuple chunks of outgoing interconnect packets with zstd,
+ * when that makes them smaller.
+ */
+extern bool gp_interconnect_compression;
+
+/*
+ * Parameter gp_motion_batch_size
+ *
+ * Send the tuples of a motion in batches of up to this many tuples, laid out
+ * column by column. 0 sends the tuples one by one.
+ */
+extern int gp_motion_batch_size;
+
 /*
  * Parameter gp_interconnect_log_stats
  *
@@ -766,6 +782,9 @@ extern bool gp_enable_sort_distinct;
 extern bool gp_enable_mk_sort;
 extern bool gp_enable_motion_mk_sort;
 
+/* Hash joins push runtime filters down to the scans on their outer side */
+extern bool gp_enable_runtime_filter;
+
 /* Alter table add column inherits storage setting from the table */
 extern bool gp_add_column_inherits_table_setting;
 
@@ -817,6 +836,16 @@ extern bool gp_hashagg_streambottom;
  */
 extern int gp_hashagg_default_nbatches;
 
+/*
+ * Parameter gp_hashagg_stream_min_reduction
+ *
+ * When the streaming bottom stage of a two stage hashagg merges less than
+ * this fraction of its first input rows into existing groups, it stops
+ * building a large hash table and streams out its partial groups in small
+ * batches. 0 disables this.
+ */
+extern double gp_hashagg_stream_min_reduction;
+
 /* Get statistics for partitioned parent from a child */
 extern bool 	gp_statistics_pullup_from_child_partition;
 
@@ -852,6 +881,15 @@ extern int gpperfmon_log_alert_level;
 extern int gp_workfile_limit_per_segment;
 extern int gp_workfile_limit_per_query;
 extern int gp_workfile_limit_files_per_query;
+
+/*
+ * Parameter gp_shared_scan_memory_limit
+ *
+ * Cross-slice shared scans (CTEs read by several slices) whose tuples fit in
+ * this many kilobytes are handed to the readers in dynamic shared memory
+ * instead of workfiles. 0 always uses workfiles.
+ */
+extern int gp_shared_scan_memory_limit;
 extern int gp_workfile_compression_overhead_limit;
 extern int gp_workfile_caching_loglevel;
 extern int gp_sessionstate_loglevel;
@@ -305,6 +305,9 @@ extern ChunkTransportStateEntry *removeChunkTransportState(ChunkTransportState *
 														   int16 motNodeID);
 
 extern TupleChunkListItem RecvTupleChunk(MotionConn *conn, ChunkTransportState *transportStates);
+extern void CompressPacketChunks(MotionConn *conn, int hdrSize);
+extern void GetMotionCompressionStats(ChunkTransportState *transportStates, int16 motNodeID,
+									  uint64 *bytesBefore, uint64 *bytesAfter);
 
 extern void InitMotionTCP(int *listenerSocketFd, uint16 *listenerPort);
 extern void InitMotionUDPIFC(int *listenerSocketFd, uint16 *listenerPort);
@@ -60,8 +60,28 @@ typedef struct SerTupInfo
 
 	/* true if tupdesc contains record types */
 	bool		has_record_types;
+
+	/* Tuples deserialized from the last batch received */
+	GenericTuple *batch_tuples;
+	int			batch_ntuples;
+	int			batch_capacity;
 }	SerTupInfo;
 
+/*
+ * A batch of tuples collected for one target route, kept column by column
+ * until it is serialized (see SerializeBatchIntoChunks()).
+ */
+typedef struct SerTupBatch
+{
+	int			ntuples;		/* Number of tuples in the batch */
+	int			capacity;		/* Maximum number of tuples */
+	int			nbytes;			/* Size of the values of all columns */
+	int			maxbytes;		/* Send the batch once nbytes reaches this */
+
+	bits8	   *nullbitmaps;	/* Per column, bit set for non-null values */
+	StringInfoData *values;		/* Per column, packed non-null values */
+}	SerTupBatch;
+
 /*
  * forward declaration to avoid #including cdbmotion.h here, which would create a circular
  * dependency
@@ -84,8 +104,20 @@ extern void SerializeRecordCacheIntoChunks(SerTupInfo *pSerInfo,
 /* Convert a tuple into chunks directly in a set of transport buffers */
 extern int SerializeTuple(TupleTableSlot *tuple, SerTupInfo *pSerInfo, struct directTransportBuffer *b, TupleChunkList tcList, int16 targetRoute);
 
+/* Create an empty batch of up to 'capacity' tuples, using about 'maxbytes'. */
+extern SerTupBatch *CreateSerTupBatch(SerTupInfo *pSerInfo, int capacity, int maxbytes);
+
+/* Add the tuple in a slot to a batch; the caller checks that it isn't full */
+extern void AddTupleToBatch(TupleTableSlot *slot, SerTupInfo *pSerInfo, SerTupBatch *batch);
+
+/* Convert a batch into chunks ready to send out, and empty the batch */
+extern void SerializeBatchIntoChunks(SerTupInfo *pSerInfo,
+									 SerTupBatch *batch,
+									 TupleChunkList tcList);
+
 /* Convert a sequence of chunks containing serialized tuple data into a
- * HeapTuple or MemTuple.
+ * HeapTuple or MemTuple.  If the chunks contain a batch of tuples, the
+ * tuples are stored in pSerInfo->batch_tuples, and NULL is returned.
  */
 extern GenericTuple CvtChunksToTup(TupleChunkList tclist, SerTupInfo * pSerInfo, TupleRemapper *remapper);
 
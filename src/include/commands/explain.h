@@ -29,6 +29,8 @@ typedef struct ExplainStateExtra
 {
 	List	   *groupingstack;	/* format-specific grouping state */
 	List	   *deparsecxt;		/* context list for deparsing expressions */
+	List	   *optprofile;		/* CDB: GPORCA profile summary lines */
+	List	   *optprofilexforms;	/* CDB: GPORCA profile xform lines */
 } ExplainStateExtra;
 
 typedef struct ExplainState
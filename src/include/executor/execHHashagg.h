@@ -209,6 +209,12 @@ typedef struct HashAggTable
 	bool expandable;  /* hash table buckets still have space to grow */
 	struct TupleTableSlot *prev_slot; /* a slot that is read previously. */
 
+	/* Adaptive streaming of the bottom stage of a two stage hashagg */
+	bool reduction_checked; /* have we measured the reduction yet? */
+	bool stream_partial_groups; /* aggregation doesn't pay off, stream small batches */
+	double reduction; /* fraction of input tuples merged into groups */
+	uint64 reduction_tuples; /* input tuples the reduction was measured on */
+
 	/* Statistics used for EXPLAIN ANALYZE */
 	CdbExplain_Agg      chainlength;
 	uint64 total_buckets; /* total of nbuckets across spills and reloads */
@@ -216,4 +216,51 @@ typedef struct HashJoinTableData
 	uint64      workset_compression_buf_total;
 }	HashJoinTableData;
 
+/*
+ * Runtime filter of a hash join
+ *
+ * While the Hash node builds the hash table, it also records the join keys
+ * of the inner rows: the hash values in a Bloom filter, and the smallest and
+ * largest value of each key whose type has a btree ordering that agrees
+ * with the join operator.  A sequential scan below the outer side of the
+ * join applies the filter to its rows (see PushdownRuntimeFilter() in
+ * nodeHashjoin.c), and drops the rows that cannot have a match before they
+ * are passed up to the join.
+ *
+ * The Bloom filter takes at most RUNTIME_FILTER_MEM_PERCENT of the memory of
+ * the Hash node, and the hash table gets the rest.
+ */
+#define RUNTIME_FILTER_MEM_PERCENT	10
+
+typedef struct HashRuntimeFilterKey
+{
+	AttrNumber	scanattno;		/* key column in the scan tuple */
+	FmgrInfo	hashfunction;	/* outer side hash function */
+
+	/* range of the inner keys, if hasrange */
+	bool		hasrange;
+	FmgrInfo	cmpfunction;	/* btree comparison function */
+	Oid			collation;
+	int16		typlen;
+	bool		typbyval;
+	Datum		minval;
+	Datum		maxval;
+} HashRuntimeFilterKey;
+
+typedef struct HashRuntimeFilterData
+{
+	int			nkeys;
+	HashRuntimeFilterKey *keys;	/* array [0..nkeys-1] */
+	Datum	   *keyvals;		/* workspace for the keys of an inner row */
+	MemoryContext cxt;			/* holds the filter and the key ranges */
+
+	/* Bloom filter over the hash values of the inner keys */
+	uint64	   *bloom;
+	uint32		bloom_mask;		/* number of bits - 1 */
+	bool		bloom_useful;	/* false if too many rows were inserted */
+
+	double		ninserted;		/* inner rows with no null keys */
+	bool		built;			/* is the inner side done */
+}	HashRuntimeFilterData;
+
 #endif   /* HASHJOIN_H */
@@ -62,6 +62,17 @@ extern void ExecHashTableExplainInit(HashState *hashState, HashJoinState *hjstat
                                      HashJoinTable  hashtable);
 extern void ExecHashTableExplainBatchEnd(HashState *hashState, HashJoinTable hashtable);
 
+extern HashRuntimeFilter ExecHashRuntimeFilterCreate(List *hashclauses,
+							AttrNumber *scanattnos,
+							double ninner,
+							uint64 operatorMemKB);
+extern void ExecHashRuntimeFilterReset(HashRuntimeFilter filter);
+extern void ExecHashRuntimeFilterInsert(HashState *hashState,
+							ExprContext *econtext,
+							uint32 hashvalue);
+extern bool ExecHashRuntimeFilterCheck(HashRuntimeFilter filter,
+							struct TupleTableSlot *slot);
+
 static inline int
 ExecHashRowSize(int tupwidth)
 {
@@ -26,4 +26,7 @@ extern void ExecSquelchShareInputScan(ShareInputScanState *node);
 
 extern void ExecSliceDependencyShareInputScan(ShareInputScanState *node);
 
+extern Size ShareInputShmemSize(void);
+extern void ShareInputShmemInit(void);
+
 #endif   /* NODESHAREINPUTSCAN_H */
@@ -47,6 +47,8 @@ extern "C" {
 extern PlannedStmt *GPOPTOptimizedPlan(Query *query,
 									   bool *had_unexpected_failure);
 extern char *SerializeDXLPlan(Query *query);
+extern void GetGPOPTPlanCacheStats(uint64 *hits, uint64 *misses);
+extern void GetGPOPTProfile(List **summary, List **xforms);
 extern void InitGPOPT();
 extern void TerminateGPOPT();
 }
@@ -144,6 +144,9 @@ bool AggregateExists(Oid oid);
 // add member to Bitmapset
 Bitmapset *BmsAddMember(Bitmapset *a, int x);
 
+// is an integer a member of a Bitmapset
+bool BmsIsMember(int x, const Bitmapset *a);
+
 // create a copy of an object
 void *CopyObject(void *from);
 
@@ -195,6 +198,10 @@ bool GetAttrStatsSlot(AttStatsSlot *sslot, HeapTuple statstuple, int reqkind,
 // free attribute stats slot
 void FreeAttrStatsSlot(AttStatsSlot *sslot);
 
+// registers of a HyperLogLog counter of the statistics, one byte per
+// register, and the number of bits of the register index
+char *GetHLLRegisters(Datum counter, int *precision);
+
 // attribute statistics
 HeapTuple GetAttStats(Oid relid, AttrNumber attnum);
 
@@ -662,6 +669,11 @@ Oid GetBaseType(Oid typid);
 // and takes ownership of the result
 Expr *EvaluateExpr(Expr *expr, Oid result_type, int32 typmod);
 
+// returns the results of evaluating the constant expressions of 'exprs' as
+// a list of Consts, using a single executor state. Caller keeps ownership of
+// 'exprs' and takes ownership of the result
+List *EvaluateExprList(List *exprs);
+
 // interpret the value of "With oids" option from a list of defelems
 bool InterpretOidsOption(List *options, bool allowOids);
 
@@ -683,9 +695,44 @@ FaultInjectorType_e InjectFaultInOptTasks(const char *fault_name);
 // return the number of leaf partition for a given table oid
 gpos::ULONG CountLeafPartTables(Oid oidRelation);
 
+// a catalog change that invalidates individual metadata cache objects;
+// m_cacheid is -1 for a relcache invalidation of relation m_relid,
+// otherwise m_hashvalue is the hash of the changed syscache key
+struct SMDCacheInvalidation
+{
+	int m_cacheid;
+	uint32 m_hashvalue;
+	Oid m_relid;
+};
+
+// register the catalog invalidation callbacks of the metadata cache; called
+// once at backend start
+void RegisterMDCacheInvalidationCallbacks(void);
+
 // Does the metadata cache need to be reset (because of a catalog
-// table has been changed?)
-bool MDCacheNeedsReset(void);
+// table has been changed?) If not, the catalog changes since the last
+// call, if any, are returned in invalidations; they stay valid until
+// the next call
+bool MDCacheNeedsReset(const SMDCacheInvalidation **invalidations,
+					   gpos::ULONG *num_invalidations);
+
+// hash value of the given key in the given syscache, as passed to
+// invalidation callbacks
+uint32 GetSysCacheHashValue(int cache_id, Datum key1, Datum key2,
+							Datum key3);
+
+// current generation of the metadata cache shared by all backends, or 0 if
+// the shared cache is disabled
+uint64 MDSharedCacheGeneration(void);
+
+// look up a serialized metadata object in the shared metadata cache; returns
+// a palloc'd copy, or NULL if the object is not there
+char *MDSharedCacheLookup(const char *key, uint32 key_len, uint32 *data_len);
+
+// publish a serialized metadata object in the shared metadata cache, unless
+// the cache has been invalidated since the given generation
+void MDSharedCacheInsert(const char *key, uint32 key_len, const char *data,
+						 uint32 data_len, uint64 generation);
 
 // returns true if a query cancel is requested in GPDB
 bool IsAbortRequested(void);
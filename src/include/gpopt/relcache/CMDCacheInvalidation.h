@@ -0,0 +1,150 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMDCacheInvalidation.h
+//
+//	@doc:
+//		Targeted eviction of metadata cache objects affected by catalog
+//		invalidation messages.
+//
+//---------------------------------------------------------------------------
+
+#ifndef GPOPT_CMDCacheInvalidation_H
+#define GPOPT_CMDCacheInvalidation_H
+
+extern "C" {
+#include "postgres.h"
+
+#include "utils/syscache.h"
+}
+
+#include "gpos/base.h"
+#include "gpos/common/CHashSet.h"
+
+#include "gpopt/gpdbwrappers.h"
+#include "gpopt/mdcache/CMDKey.h"
+#include "naucrates/md/IMDCacheObject.h"
+
+// maximum number of catalog keys of a single metadata object
+#define GPOPT_MDCACHE_MAX_CATALOG_KEYS 2
+
+namespace gpopt
+{
+using namespace gpos;
+using namespace gpmd;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CMDCacheInvalidation
+//
+//	@doc:
+//		Maps relcache and syscache invalidations recorded since the last
+//		optimization to the metadata cache objects built from the changed
+//		catalog rows, and evicts only those objects.
+//
+//		Syscache invalidations only carry the hash value of the changed key,
+//		so cached objects are matched by hashing their own key with the
+//		same syscache. Column statistics are keyed by column position rather
+//		than attribute number; changed pg_statistic rows are therefore first
+//		matched against the columns of the cached relations, and the column
+//		statistics of those relations are evicted in a second pass.
+//
+//---------------------------------------------------------------------------
+class CMDCacheInvalidation
+{
+private:
+	// set of relation oids
+	typedef CHashSet<ULONG, gpos::HashValue<ULONG>, gpos::Equals<ULONG>,
+					 CleanupDelete<ULONG> >
+		OidHashSet;
+
+	// memory pool
+	CMemoryPool *m_mp;
+
+	// invalidations to process
+	const gpdb::SMDCacheInvalidation *m_invalidations;
+
+	// number of invalidations
+	ULONG m_num_invalidations;
+
+	// relations named by relcache invalidations
+	OidHashSet *m_invalidated_rels;
+
+	// relations whose column statistics changed
+	OidHashSet *m_stats_rels;
+
+	// relations found in the cache during the first pass
+	OidHashSet *m_cached_rels;
+
+	// is there any invalidation for the given syscache?
+	BOOL m_has_syscache_inval[SysCacheSize];
+
+	// private copy ctor
+	CMDCacheInvalidation(const CMDCacheInvalidation &);
+
+	// is the given hash value invalidated in the given syscache?
+	BOOL FHashInvalidated(int cache_id, uint32 hash_value) const;
+
+	// is the syscache entry with the given key invalidated?
+	BOOL FKeyInvalidated(int cache_id, Datum key1, Datum key2 = 0,
+						 Datum key3 = 0) const;
+
+	// did pg_statistic change for any column of the given relation?
+	BOOL FColStatsInvalidated(OID rel_oid, const IMDCacheObject *md_obj) const;
+
+	// is the given object invalidated directly by its own catalog row?
+	BOOL FObjInvalidated(const IMDId *mdid,
+						 const IMDCacheObject *md_obj) const;
+
+	// add an oid to the given set
+	void AddOid(OidHashSet *oid_set, OID oid) const;
+
+	// first pass predicate: relations, indexes and objects with own keys
+	static BOOL FEvictObject(CMDKey *const &mdkey, IMDCacheObject *md_obj,
+							 void *arg);
+
+	// second pass predicate: statistics depending on evicted relations
+	static BOOL FEvictStats(CMDKey *const &mdkey, IMDCacheObject *md_obj,
+							void *arg);
+
+public:
+	// catalog entry a metadata object is built from; a relation (m_cache_id
+	// is -1 and the first key is its oid) or a syscache key
+	struct SCatalogKey
+	{
+		// syscache id, -1 for relations
+		int m_cache_id;
+
+		// key of the entry
+		Datum m_keys[3];
+
+		// does the object depend on any entry of the cache?
+		BOOL m_any;
+	};
+
+	// ctor
+	CMDCacheInvalidation(CMemoryPool *mp,
+						 const gpdb::SMDCacheInvalidation *invalidations,
+						 ULONG num_invalidations);
+
+	// dtor
+	~CMDCacheInvalidation();
+
+	// evict affected objects from the metadata cache; returns their number
+	ULONG Evict();
+
+	// catalog entries the given object is built from; statistics objects
+	// have no keys of their own. Returns gpos::ulong_max for objects of
+	// unknown kind.
+	static ULONG GetCatalogKeys(
+		const IMDId *mdid, const IMDCacheObject *md_obj,
+		SCatalogKey keys[GPOPT_MDCACHE_MAX_CATALOG_KEYS]);
+
+};	// class CMDCacheInvalidation
+}  // namespace gpopt
+
+#endif	// !GPOPT_CMDCacheInvalidation_H
+
+// EOF
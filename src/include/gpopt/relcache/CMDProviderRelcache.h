@@ -19,11 +19,13 @@
 #define GPMD_CMDProviderRelcache_H
 
 #include "gpos/base.h"
+#include "gpos/io/IOstream.h"
 #include "gpos/string/CWStringBase.h"
 
 #include "naucrates/md/CSystemId.h"
 #include "naucrates/md/IMDId.h"
 #include "naucrates/md/IMDProvider.h"
+#include "naucrates/statistics/IStatistics.h"
 
 // fwd decl
 namespace gpopt
@@ -49,16 +51,56 @@ private:
 	// memory pool
 	CMemoryPool *m_mp;
 
+	// generation of the shared metadata cache when the provider was
+	// created, 0 if the shared cache is not used
+	ULLONG m_shared_cache_generation;
+
+	// time spent retrieving objects of one type from the relcache
+	struct SRetrievalStats
+	{
+		// number of objects retrieved
+		ULONG m_num_objects;
+
+		// total retrieval time
+		ULLONG m_total_us;
+
+		// retrieval time of the slowest object
+		ULONG m_max_us;
+
+		// slowest object
+		IMDId *m_max_mdid;
+	};
+
+	// retrieval stats, indexed by the requested object type; objects are
+	// retrieved through a const interface, hence mutable
+	mutable SRetrievalStats m_retrieval_stats[IMDCacheObject::EmdtSentinel + 1];
+
+	// row count estimates of the relations whose statistics were retrieved,
+	// shared by all statistics objects of a relation
+	mutable UlongToDoubleMap *m_rel_num_rows;
+
 	// private copy ctor
 	CMDProviderRelcache(const CMDProviderRelcache &);
 
+	// record the retrieval time of an object
+	void RecordRetrieval(IMDId *mdid, IMDCacheObject::Emdtype mdtype,
+						 ULONG elapsed_us) const;
+
+	// key of the given object in the shared metadata cache
+	static CHAR *SharedCacheKey(CMemoryPool *mp, IMDId *mdid, ULONG *key_len);
+
+	// look up the DXL of an object in the shared metadata cache
+	CWStringBase *LookupSharedCache(const CHAR *key, ULONG key_len) const;
+
+	// publish the DXL of an object in the shared metadata cache
+	void PublishSharedCache(const CHAR *key, ULONG key_len,
+							const CWStringBase *str) const;
+
 public:
 	// ctor/dtor
 	explicit CMDProviderRelcache(CMemoryPool *mp);
 
-	~CMDProviderRelcache()
-	{
-	}
+	virtual ~CMDProviderRelcache();
 
 	// returns the DXL string of the requested metadata object
 	virtual CWStringBase *GetMDObjDXLStr(CMemoryPool *mp,
@@ -71,6 +113,9 @@ public:
 	{
 		return GetGPDBTypeMdid(mp, sysid, type_info);
 	}
+
+	// print the time spent retrieving objects from the relcache
+	IOstream &OsPrintRetrievalStats(IOstream &os) const;
 };
 }  // namespace gpmd
 
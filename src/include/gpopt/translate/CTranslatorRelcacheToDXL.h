@@ -30,6 +30,7 @@ extern "C" {
 #include "naucrates/dxl/gpdb_types.h"
 #include "naucrates/dxl/operators/CDXLColDescr.h"
 #include "naucrates/md/CDXLColStats.h"
+#include "naucrates/md/CDXLColumnGroupStats.h"
 #include "naucrates/md/CMDAggregateGPDB.h"
 #include "naucrates/md/CMDCheckConstraintGPDB.h"
 #include "naucrates/md/CMDFunctionGPDB.h"
@@ -185,13 +186,30 @@ private:
 	static IMDCacheObject *RetrieveObjectGPDB(CMemoryPool *mp, IMDId *mdid,
 											  IMDCacheObject::Emdtype mdtype);
 
+	// estimate the number of rows of a relation, reusing the estimate
+	// recorded in the given map, if any
+	static double EstimateNumRows(CMemoryPool *mp, Relation rel,
+								  UlongToDoubleMap *rel_num_rows);
+
 	// retrieve relstats object from the relcache
-	static IMDCacheObject *RetrieveRelStats(CMemoryPool *mp, IMDId *mdid);
+	static IMDCacheObject *RetrieveRelStats(CMemoryPool *mp, IMDId *mdid,
+											UlongToDoubleMap *rel_num_rows);
+
+	// retrieve extended relation stats object from the relcache
+	static IMDCacheObject *RetrieveExtStats(CMemoryPool *mp, IMDId *mdid,
+											UlongToDoubleMap *rel_num_rows);
+
+	// retrieve the stats of the column group stored on the given column
+	static CDXLColumnGroupStats *RetrieveColumnGroupStats(CMemoryPool *mp,
+														  OID rel_oid,
+														  AttrNumber attno,
+														  double num_rows);
 
 	// retrieve column stats object from the relcache
 	static IMDCacheObject *RetrieveColStats(CMemoryPool *mp,
 											CMDAccessor *md_accessor,
-											IMDId *mdid);
+											IMDId *mdid,
+											UlongToDoubleMap *rel_num_rows);
 
 	// retrieve cast object from the relcache
 	static IMDCacheObject *RetrieveCast(CMemoryPool *mp, IMDId *mdid);
@@ -361,11 +379,17 @@ private:
 		CMDName *md_colname, OID att_type, AttrNumber attrnum,
 		CDXLBucketArray *dxl_stats_bucket_array, CDouble rows);
 
+	// retrieve the HyperLogLog sketch of a column from its pg_statistic entry
+	static CHLLSketch *RetrieveHLLSketch(CMemoryPool *mp, HeapTuple stats_tup);
+
 public:
-	// retrieve a metadata object from the relcache
-	static IMDCacheObject *RetrieveObject(CMemoryPool *mp,
-										  CMDAccessor *md_accessor, IMDId *mdid,
-										  IMDCacheObject::Emdtype mdtype);
+	// retrieve a metadata object from the relcache; the row count estimates
+	// of partitioned tables are recorded in the given map, if any, and
+	// shared by the statistics objects retrieved for the same relation
+	static IMDCacheObject *RetrieveObject(
+		CMemoryPool *mp, CMDAccessor *md_accessor, IMDId *mdid,
+		IMDCacheObject::Emdtype mdtype,
+		UlongToDoubleMap *rel_num_rows = NULL);
 
 	// retrieve a relation from the relcache
 	static IMDRelation *RetrieveRel(CMemoryPool *mp, CMDAccessor *md_accessor,
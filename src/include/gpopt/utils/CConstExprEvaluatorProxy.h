@@ -77,6 +77,10 @@ private:
 	// translator for the DXL input -> GPDB Expr
 	CTranslatorDXLToScalar m_dxl2scalar_translator;
 
+	// translate the result of an evaluation to DXL; raises an exception if
+	// the expression did not evaluate to a constant
+	CDXLNode *TranslateResultToDXL(Expr *result);
+
 public:
 	// ctor
 	CConstExprEvaluatorProxy(CMemoryPool *mp, CMDAccessor *md_accessor)
@@ -97,6 +101,12 @@ public:
 	// caller keeps ownership of 'expr_dxlnode' and takes ownership of the returned pointer
 	virtual CDXLNode *EvaluateExpr(const CDXLNode *expr);
 
+	// evaluate the given constant expressions with a single executor state
+	// and return the DXL representations of the results, in the order of the
+	// input. caller keeps ownership of 'exprs' and takes ownership of the
+	// returned array
+	virtual CDXLNodeArray *EvaluateExprs(const CDXLNodeArray *exprs);
+
 	// returns true iff the evaluator can evaluate constant expressions without subqueries
 	virtual BOOL
 	FCanEvalExpressions()
@@ -0,0 +1,50 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMemoryPoolArenaManager.h
+//
+//	@doc:
+//		MemoryPoolManager implementation that creates
+//		CMemoryPoolPallocArena memory pools
+//
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CMemoryPoolArenaManager_H
+#define GPDXL_CMemoryPoolArenaManager_H
+
+#include "gpos/base.h"
+#include "gpos/memory/CMemoryPoolManager.h"
+
+namespace gpos
+{
+// memory pool manager that serves ORCA allocations from slabs of GPDB
+// memory contexts
+class CMemoryPoolArenaManager : public CMemoryPoolManager
+{
+private:
+	// private no copy ctor
+	CMemoryPoolArenaManager(const CMemoryPoolArenaManager &);
+
+public:
+	// ctor
+	CMemoryPoolArenaManager(CMemoryPool *internal,
+							EMemoryPoolType memory_pool_type);
+
+	// allocate new memorypool
+	virtual CMemoryPool *NewMemoryPool();
+
+	// free allocation
+	void DeleteImpl(void *ptr, CMemoryPool::EAllocationType eat);
+
+	// get user requested size of allocation
+	ULONG UserSizeOfAlloc(const void *ptr);
+
+	static void Init();
+};
+}  // namespace gpos
+
+#endif	// !GPDXL_CMemoryPoolArenaManager_H
+
+// EOF
@@ -51,6 +51,9 @@ public:
 	// return total allocated size include management overhead
 	ULLONG TotalAllocatedSize() const;
 
+	// return the highest total allocated size of the pool's lifetime
+	ULLONG PeakAllocatedSize() const;
+
 	// get user requested size of allocation
 	static ULONG UserSizeOfAlloc(const void *ptr);
 };
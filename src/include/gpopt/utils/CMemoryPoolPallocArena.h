@@ -0,0 +1,52 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		CMemoryPoolPallocArena.h
+//
+//	@doc:
+//		Arena memory pool whose slabs are taken from a PostgreSQL memory
+//		context.
+//
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CMemoryPoolPallocArena_H
+#define GPDXL_CMemoryPoolPallocArena_H
+
+#include "gpos/base.h"
+#include "gpos/memory/CMemoryPoolArena.h"
+
+namespace gpos
+{
+// Arena memory pool backed by a Postgres MemoryContext. Only slab refills and
+// allocations larger than the biggest size class go through the gpdb::
+// wrappers; the common case touches no Postgres code at all.
+class CMemoryPoolPallocArena : public CMemoryPoolArena
+{
+private:
+	// memory context owning all slabs and oversized chunks
+	MemoryContext m_cxt;
+
+	// private copy ctor
+	CMemoryPoolPallocArena(const CMemoryPoolPallocArena &);
+
+protected:
+	// allocate a block from the memory context
+	virtual void *AllocateBlock(ULONG size);
+
+	// return a block to the memory context
+	virtual void FreeBlock(void *block);
+
+public:
+	// ctor
+	CMemoryPoolPallocArena();
+
+	// prepare the memory pool to be deleted
+	virtual void TearDown();
+};
+}  // namespace gpos
+
+#endif	// !GPDXL_CMemoryPoolPallocArena_H
+
+// EOF
@@ -0,0 +1,250 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		COptPlanCache.h
+//
+//	@doc:
+//		Session-local cache of plans produced by the optimizer
+//
+//---------------------------------------------------------------------------
+
+#ifndef GPOPT_COptPlanCache_H
+#define GPOPT_COptPlanCache_H
+
+#include "gpos/base.h"
+#include "gpos/common/CRefCount.h"
+#include "gpos/memory/CCache.h"
+#include "gpos/memory/CCacheAccessor.h"
+#include "gpos/string/CWStringBase.h"
+#include "gpos/string/CWStringDynamic.h"
+
+#include "gpopt/gpdbwrappers.h"
+#include "gpopt/mdcache/CMDAccessor.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
+#include "naucrates/dxl/operators/CDXLNode.h"
+
+namespace gpopt
+{
+using namespace gpos;
+using namespace gpmd;
+using namespace gpdxl;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		COptPlanCache
+//
+//	@doc:
+//		Caches the plan DXL produced for a query, keyed by the serialized
+//		query DXL together with the optimizer configuration it was optimized
+//		with. Constants are part of the query DXL, so a plan is only reused
+//		for an identical query and identical settings.
+//
+//		Every cached plan records the catalog entries of the metadata
+//		objects the optimizer retrieved for it, including the statistics,
+//		and is evicted by the relcache and syscache invalidations that name
+//		any of them. A reset of the metadata cache resets the plan cache as
+//		well.
+//
+//---------------------------------------------------------------------------
+class COptPlanCache
+{
+public:
+	// catalog entry a cached plan depends on; relations are identified by
+	// a cache id of -1 and their oid. A zero hash value or an invalid oid
+	// match any invalidation of the given cache.
+	struct SDependency
+	{
+		// syscache id, -1 for relations
+		INT m_cache_id;
+
+		// syscache hash value of the entry
+		ULONG m_hash_value;
+
+		// relation oid
+		OID m_relid;
+	};
+
+	//---------------------------------------------------------------------------
+	//	@class:
+	//		CEntry
+	//
+	//	@doc:
+	//		Cached plan and the catalog entries it depends on
+	//
+	//---------------------------------------------------------------------------
+	class CEntry : public CRefCount
+	{
+	private:
+		// memory pool
+		CMemoryPool *m_mp;
+
+		// plan DXL
+		CHAR *m_plan_dxl;
+
+		// dependencies
+		SDependency *m_deps;
+
+		// number of dependencies
+		ULONG m_num_deps;
+
+		// private copy ctor
+		CEntry(const CEntry &);
+
+	public:
+		// ctor; copies the plan and the dependencies into the given pool
+		CEntry(CMemoryPool *mp, const CHAR *plan_dxl, const SDependency *deps,
+			   ULONG num_deps);
+
+		// dtor
+		virtual ~CEntry();
+
+		// plan DXL
+		const CHAR *
+		PlanDXL() const
+		{
+			return m_plan_dxl;
+		}
+
+		// is the plan affected by any of the given invalidations?
+		BOOL FInvalidated(const gpdb::SMDCacheInvalidation *invalidations,
+						  ULONG num_invalidations) const;
+	};
+
+	// ccache template for plans
+	typedef CCache<CEntry *, CWStringBase *> PlanCache;
+
+	// accessor for plans
+	typedef CCacheAccessor<CEntry *, CWStringBase *> PlanCacheAccessor;
+
+private:
+	// invalidations passed to the eviction predicate
+	struct SInvalidations
+	{
+		const gpdb::SMDCacheInvalidation *m_invalidations;
+
+		ULONG m_num_invalidations;
+	};
+
+	// dynamic array of dependencies
+	typedef CDynamicPtrArray<SDependency, CleanupDelete> SDependencyArray;
+
+	// pointer to the underlying cache
+	static PlanCache *m_pcache;
+
+	// the maximum size of the cache
+	static ULLONG m_ullCacheQuota;
+
+	// number of lookups that found a plan
+	static ULLONG m_ullCacheHits;
+
+	// number of lookups that had to optimize the query
+	static ULLONG m_ullCacheMisses;
+
+	// number of plans evicted because of invalidations
+	static ULLONG m_ullInvalidations;
+
+	// private ctor
+	COptPlanCache();
+
+	// no copy ctor
+	COptPlanCache(const COptPlanCache &);
+
+	// hash function for keys
+	static ULONG UlHashKey(CWStringBase *const &key);
+
+	// equality function for keys
+	static BOOL FEqualKeys(CWStringBase *const &key1,
+						   CWStringBase *const &key2);
+
+	// eviction predicate
+	static BOOL FEvictPlan(CWStringBase *const &key, CEntry *entry,
+						   void *arg);
+
+	// append a dependency to the given array
+	static void AddDependency(CMemoryPool *mp, SDependencyArray *deps,
+							  INT cache_id, ULONG hash_value, OID relid);
+
+	// collect the dependencies of the objects retrieved through the given
+	// accessor; returns false if the plan cannot be cached
+	static BOOL FCollectDependencies(CMemoryPool *mp, CMDAccessor *md_accessor,
+									 SDependencyArray *deps);
+
+public:
+	// initialize underlying cache
+	static void Init();
+
+	// has cache been initialized?
+	static BOOL
+	FInitialized()
+	{
+		return (NULL != m_pcache);
+	}
+
+	// destroy global instance
+	static void Shutdown();
+
+	// reset global instance
+	static void Reset();
+
+	// set the maximum size of the cache
+	static void SetCacheQuota(ULLONG ullCacheQuota);
+
+	// get the maximum size of the cache
+	static ULLONG
+	ULLGetCacheQuota()
+	{
+		return m_ullCacheQuota;
+	}
+
+	// evict the plans affected by the given invalidations; returns their number
+	static ULONG Invalidate(const gpdb::SMDCacheInvalidation *invalidations,
+							ULONG num_invalidations);
+
+	// build the cache key of a query; must be called while the trace
+	// flags the query is optimized with are set
+	static CWStringDynamic *PstrKey(
+		CMemoryPool *mp, const CDXLNode *query_dxl,
+		const CDXLNodeArray *query_output_dxlnode_array,
+		const CDXLNodeArray *cte_producers, COptimizerConfig *optimizer_config,
+		ULONG num_segments, ULONG num_segments_for_costing,
+		const CHAR *search_strategy_path);
+
+	// look up the plan cached for the given key; returns a copy allocated
+	// in the given pool, or NULL
+	static CHAR *PszLookup(CMemoryPool *mp, const CWStringBase *key);
+
+	// cache the plan DXL produced for the given key; the metadata objects
+	// retrieved through the given accessor become its dependencies
+	static void Insert(CMemoryPool *mp, CMDAccessor *md_accessor,
+					   const CWStringBase *key, const CWStringBase *plan_str);
+
+	// number of lookups that found a plan
+	static ULLONG
+	ULLGetCacheHits()
+	{
+		return m_ullCacheHits;
+	}
+
+	// number of lookups that had to optimize the query
+	static ULLONG
+	ULLGetCacheMisses()
+	{
+		return m_ullCacheMisses;
+	}
+
+	// number of plans evicted because of invalidations
+	static ULLONG
+	ULLGetInvalidations()
+	{
+		return m_ullInvalidations;
+	}
+
+};	// class COptPlanCache
+
+}  // namespace gpopt
+
+#endif	// !GPOPT_COptPlanCache_H
+
+// EOF
@@ -0,0 +1,92 @@
+//---------------------------------------------------------------------------
+//	Greenplum Database
+//	Copyright (C) 2026 VMware, Inc. or its affiliates.
+//
+//	@filename:
+//		COptProfile.h
+//
+//	@doc:
+//		Profile of the last optimization run in the session
+//
+//---------------------------------------------------------------------------
+
+#ifndef GPOPT_COptProfile_H
+#define GPOPT_COptProfile_H
+
+#include "gpos/base.h"
+
+#include "gpopt/optimizer/COptimizer.h"
+
+namespace gpopt
+{
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		COptProfile
+//
+//	@doc:
+//		Keeps the profile of the last optimization of the session: the size
+//		of the memo, the time spent in each search stage and in each xform,
+//		and the peak memory of the optimizer. The profile is recorded by
+//		COptTasks when optimization statistics are collected, and read by
+//		EXPLAIN and by gp_optimizer_profile(). It lives in static storage,
+//		so recording does not allocate.
+//
+//---------------------------------------------------------------------------
+class COptProfile
+{
+public:
+	// profile of a single optimization
+	struct SProfile
+	{
+		// was a profile recorded
+		BOOL m_is_valid;
+
+		// was the plan served from the plan cache
+		BOOL m_is_cached_plan;
+
+		// wall clock time of translating and optimizing the query in usec
+		ULLONG m_optimization_time;
+
+		// peak memory of the optimizer's memory pool in bytes
+		ULLONG m_peak_memory;
+
+		// search space, search stage and xform statistics
+		SOptimizerMetrics m_metrics;
+
+		// ctor
+		SProfile()
+			: m_is_valid(false),
+			  m_is_cached_plan(false),
+			  m_optimization_time(0),
+			  m_peak_memory(0)
+		{
+		}
+	};
+
+private:
+	// profile of the last optimization
+	static SProfile m_profile;
+
+public:
+	// forget the last profile
+	static void Reset();
+
+	// record the profile of an optimization; metrics are NULL if the plan
+	// was served from the plan cache
+	static void Record(const SOptimizerMetrics *metrics,
+					   ULLONG optimization_time, ULLONG peak_memory);
+
+	// profile of the last optimization, NULL if there is none
+	static const SProfile *Pprofile();
+
+	// fill the given array with the ids of the xforms applied in the last
+	// optimization, most expensive first, and return their number
+	static ULONG UlSortedXforms(ULONG *xform_ids, ULONG size);
+};
+}  // namespace gpopt
+
+#endif	// !GPOPT_COptProfile_H
+
+// EOF
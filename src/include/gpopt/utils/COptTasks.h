@@ -46,6 +46,8 @@ class ICostModel;
 
 struct PlannedStmt;
 struct Query;
+struct Node;
+struct RangeTblEntry;
 struct List;
 struct MemoryContextData;
 
@@ -154,6 +156,37 @@ private:
 										 IMdIdArray *col_stats,
 										 MdidHashSet *phsmdidRel);
 
+	// context for prefetching the statistics used by a query
+	struct SPrefetchContext
+	{
+		// memory pool
+		CMemoryPool *m_mp;
+
+		// metadata accessor
+		CMDAccessor *m_md_accessor;
+
+		// number of relations whose statistics were prefetched
+		ULONG m_num_rels;
+
+		// number of columns whose statistics were prefetched
+		ULONG m_num_cols;
+	};
+
+	// prefetch the statistics of a relation and of its referenced columns
+	static void PrefetchRelStats(SPrefetchContext *context,
+								 const RangeTblEntry *rte);
+
+	// walker prefetching the statistics of the relations in a query
+	static BOOL PrefetchStatsWalker(Node *node, SPrefetchContext *context);
+
+	// prefetch the statistics of the relations and columns referenced in a
+	// query, so that they are retrieved in one pass before optimization
+	static void PrefetchStats(CMemoryPool *mp, CMDAccessor *md_accessor,
+							  Query *query);
+
+	// walker checking if a query reads the optimizer profile
+	static BOOL ReadsProfileWalker(Node *node, void *context);
+
 public:
 	// convert Query->DXL->LExpr->Optimize->PExpr->DXL
 	static char *Optimize(Query *query);
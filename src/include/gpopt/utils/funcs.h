@@ -17,10 +17,12 @@ extern "C" {
 
 #include "fmgr.h"
 #include "utils/builtins.h"
+#include "utils/tuplestore.h"
 
 extern Datum DisableXform(PG_FUNCTION_ARGS);
 extern Datum EnableXform(PG_FUNCTION_ARGS);
 extern Datum LibraryVersion();
+extern void OptimizerProfile(Tuplestorestate *tupstore, TupleDesc tupdesc);
 }
 
 #endif	// GPOPT_funcs_H
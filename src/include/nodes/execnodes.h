@@ -1702,6 +1702,10 @@ typedef struct SeqScanState
 	/* extra state for AOCS scans */
 	bool	   *ss_aocs_proj;
 	int			ss_aocs_ncol;
+
+	/* runtime filters of hash joins above us, see nodeHashjoin.c */
+	List	   *ss_runtimeFilters;	/* list of HashRuntimeFilter */
+	double		ss_runtimeFilteredRows;	/* rows removed by the filters */
 } SeqScanState;
 
 /*
@@ -2404,6 +2408,7 @@ typedef struct MergeJoinState
 /* these structs are defined in executor/hashjoin.h: */
 typedef struct HashJoinTupleData *HashJoinTuple;
 typedef struct HashJoinTableData *HashJoinTable;
+typedef struct HashRuntimeFilterData *HashRuntimeFilter;
 
 typedef struct HashJoinState
 {
@@ -2492,6 +2497,10 @@ typedef struct ShareInputScanState
 	bool		freed; /* is this node already freed? */
 
 	char	   *share_bufname_prefix;
+
+	/* tuples of a cross-slice share kept in shared memory, if any */
+	void	   *share_memstore;
+	int			share_mem_pos;
 } ShareInputScanState;
 
 /* XXX Should move into buf file */
@@ -2500,6 +2509,7 @@ extern void shareinput_reader_waitready(void *, int share_id, PlanGenerator plan
 extern void shareinput_writer_notifyready(void *, int share_id, int nsharer_xslice_notify_ready, PlanGenerator planGen);
 extern void shareinput_reader_notifydone(void *, int share_id);
 extern void shareinput_writer_waitdone(void *, int share_id, int nsharer_xslice_wait_done);
+extern bool shareinput_writer_store_in_memory(void *, struct NTupleStore *ts);
 extern char *shareinput_create_bufname_prefix(int share_id);
 
 /* ----------------
@@ -2733,6 +2743,7 @@ typedef struct HashState
 	bool		hs_quit_if_hashkeys_null;	/* quit building hash table if hashkeys are all null */
 	bool		hs_hashkeys_null;	/* found an instance wherein hashkeys are all null */
 	/* hashkeys is same as parent's hj_InnerHashKeys */
+	HashRuntimeFilter runtimefilter;	/* runtime filter to build, or NULL */
 } HashState;
 
 /* ----------------
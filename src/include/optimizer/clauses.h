@@ -116,6 +116,7 @@ extern Query *inline_set_returning_function(PlannerInfo *root,
 
 extern Expr *evaluate_expr(Expr *expr, Oid result_type, int32 result_typmod,
 			  Oid result_collation);
+extern List *evaluate_expr_list(List *exprs);
 
 extern bool is_grouping_extension(CanonicalGroupingSets *grpsets);
 extern bool contain_extended_grouping(List *grp);
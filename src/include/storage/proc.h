@@ -148,6 +148,10 @@ struct PGPROC
 	int			syncRepState;	/* wait state for sync rep */
 	SHM_QUEUE	syncRepLinks;	/* list link if process is in syncrep queue */
 
+	/* Support for condition variables. */
+	SHM_QUEUE	cvWaitLink;		/* list link if process is sleeping on a
+								 * condition variable */
+
 	/*
 	 * All PROCLOCK objects for locks held or awaited by this backend are
 	 * linked into one of these lists, according to the partition number of
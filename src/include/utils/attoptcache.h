@@ -21,6 +21,8 @@ typedef struct AttributeOpts
 	int32		vl_len_;		/* varlena header (do not touch directly!) */
 	float8		n_distinct;
 	float8		n_distinct_inherited;
+	int			statistics_group;	/* offset of the names of the other
+									 * columns of the group, or 0 */
 } AttributeOpts;
 
 AttributeOpts *get_attribute_options(Oid spcid, int attnum);
@@ -1388,6 +1388,9 @@ extern Datum enable_xform(PG_FUNCTION_ARGS);
 /* Optimizer's version */
 extern Datum gp_opt_version(PG_FUNCTION_ARGS);
 
+/* Profile of the optimizer's last optimization */
+extern Datum gp_optimizer_profile(PG_FUNCTION_ARGS);
+
 /* query_metrics.c */
 extern Datum gp_instrument_shmem_summary(PG_FUNCTION_ARGS);
 
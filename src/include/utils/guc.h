@@ -438,6 +438,10 @@ extern int optimizer_minidump;
 extern int  optimizer_cost_model;
 extern bool optimizer_metadata_caching;
 extern int	optimizer_mdcache_size;
+extern int	optimizer_mdcache_shared_size;
+extern int	optimizer_plan_cache_size;
+extern int	optimizer_memo_memory_budget;
+extern bool optimizer_prefetch_metadata;
 
 /* Optimizer debugging GUCs */
 extern bool optimizer_print_query;
@@ -451,6 +455,8 @@ extern bool	optimizer_print_expression_properties;
 extern bool	optimizer_print_group_properties;
 extern bool	optimizer_print_optimization_context;
 extern bool optimizer_print_optimization_stats;
+extern bool optimizer_collect_optimization_stats;
+extern bool optimizer_explain_profile;
 extern bool optimizer_print_xform_results;
 
 /* array of xforms disable flags */
@@ -543,6 +549,7 @@ extern bool optimizer_force_three_stage_scalar_dqa;
 extern bool optimizer_force_expanded_distinct_aggs;
 extern bool optimizer_force_agg_skew_avoidance;
 extern bool optimizer_penalize_skew;
+extern bool optimizer_penalize_heavy_hitters;
 extern bool optimizer_prune_computed_columns;
 extern bool optimizer_push_requirements_from_consumer_to_producer;
 extern bool optimizer_enforce_subplans;
@@ -563,6 +570,7 @@ extern bool optimizer_analyze_midlevel_partition;
 extern bool optimizer_analyze_enable_merge_of_leaf_stats;
 
 extern bool optimizer_use_gpdb_allocators;
+extern bool optimizer_use_arena_allocators;
 
 /* optimizer GUCs for replicated table */
 extern bool optimizer_replicated_table_insert;
@@ -581,6 +589,7 @@ extern bool	optimizer_partition_selection_log;
 #define JOIN_ORDER_GREEDY_SEARCH            1
 #define JOIN_ORDER_EXHAUSTIVE_SEARCH        2
 #define JOIN_ORDER_EXHAUSTIVE2_SEARCH       3
+#define JOIN_ORDER_HYPERGRAPH_SEARCH        4
 
 /* Time based authentication GUC */
 extern char  *gp_auth_time_override_str;
@@ -210,6 +210,7 @@ extern GpHLLCounter gp_hyperloglog_merge_counters(GpHLLCounter counter1, GpHLLCo
 
 extern GpHLLCounter gp_hyperloglog_init_def(void);
 extern int gp_hyperloglog_len(GpHLLCounter hyperloglog);
+extern char *gp_hyperloglog_get_registers(GpHLLCounter hyperloglog, int *b);
 
 
 /*
@@ -0,0 +1,30 @@
+/*-------------------------------------------------------------------------
+ *
+ * mdsharedcache.h
+ *	  Cross-backend cache of serialized optimizer metadata objects.
+ *
+ *
+ * Copyright (C) 2026 VMware, Inc. or its affiliates.
+ *
+ * src/include/utils/mdsharedcache.h
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#ifndef MDSHAREDCACHE_H
+#define MDSHAREDCACHE_H
+
+extern Size MDSharedCacheShmemSize(void);
+extern void MDSharedCacheShmemInit(void);
+
+extern bool MDSharedCacheEnabled(void);
+extern uint64 MDSharedCacheGeneration(void);
+extern void MDSharedCacheInvalidate(void);
+
+extern char *MDSharedCacheLookup(const char *key, uint32 keylen,
+								 uint32 *datalen);
+extern void MDSharedCacheInsert(const char *key, uint32 keylen,
+								const char *data, uint32 datalen,
+								uint64 generation);
+
+#endif   /* MDSHAREDCACHE_H */
@@ -23,16 +23,19 @@
 		"gp_disable_tuple_hints",
 		"gp_enable_mk_sort",
 		"gp_enable_motion_mk_sort",
+		"gp_enable_runtime_filter",
 		"gp_enable_segment_copy_checking",
 		"gp_external_enable_filter_pushdown",
 		"gp_gpperfmon_send_interval",
 		"gp_hashagg_default_nbatches",
 		"gp_hashagg_groups_per_bucket",
+		"gp_hashagg_stream_min_reduction",
 		"gp_hashjoin_tuples_per_bucket",
 		"gp_ignore_error_table",
 		"gp_indexcheck_insert",
 		"gp_indexcheck_vacuum",
 		"gp_initial_bad_row_limit",
+		"gp_interconnect_compression",
 		"gp_interconnect_cursor_ic_table_size",
 		"gp_interconnect_debug_retry_interval",
 		"gp_interconnect_default_rtt",
@@ -60,6 +63,7 @@
 		"gp_max_packet_size",
 		"gp_max_partition_level",
 		"gp_mk_sort_check",
+		"gp_motion_batch_size",
 		"gp_motion_slice_noop",
 		"gp_partitioning_dynamic_selection_log",
 		"gp_perfmon_print_packet_info",
@@ -69,6 +73,7 @@
 		"gp_resqueue_print_operator_memory_limits",
 		"gp_select_invisible",
 		"gp_sessionstate_loglevel",
+		"gp_shared_scan_memory_limit",
 		"gp_snapshotadd_timeout",
 		"gp_udp_bufsize_k",
 		"gp_udpic_dropacks_percent",
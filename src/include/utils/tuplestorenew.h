@@ -28,6 +28,7 @@ void ntuplestore_setinstrument(NTupleStore* ts, struct Instrumentation *ins);
 extern NTupleStore *ntuplestore_create(int64 maxBytes, char *operation_name);
 extern NTupleStore *ntuplestore_create_readerwriter(const char* filename, int64 maxBytes, bool isWriter);
 extern bool ntuplestore_is_readerwriter_reader(NTupleStore* nts);
+extern bool ntuplestore_is_spilled(NTupleStore *nts);
 extern void ntuplestore_flush(NTupleStore *ts);
 extern void ntuplestore_destroy(NTupleStore *ts);
 
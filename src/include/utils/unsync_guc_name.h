@@ -350,6 +350,7 @@
 		"optimizer_apply_left_outer_to_union_all_disregarding_stats",
 		"optimizer_array_constraints",
 		"optimizer_array_expansion_threshold",
+		"optimizer_collect_optimization_stats",
 		"optimizer_control",
 		"optimizer_cost_model",
 		"optimizer_cost_threshold",
@@ -410,6 +411,7 @@
 		"optimizer_enforce_subplans",
 		"optimizer_enumerate_plans",
 		"optimizer_expand_fulljoin",
+		"optimizer_explain_profile",
 		"optimizer_extract_dxl_stats",
 		"optimizer_extract_dxl_stats_all_nodes",
 		"optimizer_force_agg_skew_avoidance",
@@ -421,13 +423,18 @@
 		"optimizer_join_order_threshold",
 		"optimizer_log",
 		"optimizer_log_failure",
+		"optimizer_mdcache_shared_size",
+		"optimizer_memo_memory_budget",
 		"optimizer_metadata_caching",
 		"optimizer_minidump",
 		"optimizer_multilevel_partitioning",
 		"optimizer_nestloop_factor",
 		"optimizer_parallel_union",
 		"optimizer_penalize_broadcast_threshold",
+		"optimizer_penalize_heavy_hitters",
 		"optimizer_penalize_skew",
+		"optimizer_plan_cache_size",
+		"optimizer_prefetch_metadata",
 		"optimizer_print_expression_properties",
 		"optimizer_print_group_properties",
 		"optimizer_print_job_scheduler",
@@ -453,6 +460,7 @@
 		"optimizer_sort_factor",
 		"optimizer_trace_fallback",
 		"optimizer_skew_factor",
+		"optimizer_use_arena_allocators",
 		"optimizer_use_external_constant_expression_evaluation_for_ints",
 		"optimizer_use_gpdb_allocators",
 		"password_encryption",
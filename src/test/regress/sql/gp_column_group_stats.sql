@@ -0,0 +1,62 @@
+--
+-- Column group statistics, declared with the statistics_group attribute
+-- option, collected by ANALYZE and used by ORCA for correlated columns.
+--
+create table cgs_t (a int, b int, c int) distributed by (a);
+insert into cgs_t select i % 100, i % 100, i % 2 from generate_series(1, 10000) i;
+
+-- the option takes a list of at most 7 other columns
+alter table cgs_t alter column a set (statistics_group = 'b,,c');
+alter table cgs_t alter column a set (statistics_group = 'b, c, d, e, f, g, h, i');
+
+-- the columns are resolved by ANALYZE, which skips invalid groups
+alter table cgs_t alter column a set (statistics_group = 'b, nosuch');
+analyze cgs_t;
+alter table cgs_t alter column a set (statistics_group = 'b, b');
+analyze cgs_t;
+alter table cgs_t alter column a set (statistics_group = 'b, a');
+analyze cgs_t;
+
+create view cgs_stats as
+  select a.attname,
+         case 97 when s.stakind1 then s.stanumbers1
+                 when s.stakind2 then s.stanumbers2
+                 when s.stakind3 then s.stanumbers3
+                 when s.stakind4 then s.stanumbers4 end as group_numbers
+  from pg_statistic s
+  join pg_attribute a on a.attrelid = s.starelid and a.attnum = s.staattnum
+  where s.starelid = 'cgs_t'::regclass;
+select * from cgs_stats order by attname;
+
+-- estimated rows of the top plan node of a query
+create function cgs_estimated_rows(query text) returns int as $$
+declare
+  ln text;
+begin
+  for ln in execute 'explain ' || query loop
+    return substring(ln from 'rows=(\d+)')::int;
+  end loop;
+end;
+$$ language plpgsql;
+
+set optimizer_damping_factor_filter = 1.0;
+
+-- a and b are equal, and c is determined by either of them
+select cgs_estimated_rows('select * from cgs_t where a = 1 and b = 1 and c = 1');
+
+-- ndistinct of (a, b, c), then the attnums, then the dependency degrees
+alter table cgs_t alter column a set (statistics_group = 'b, c');
+analyze cgs_t;
+select * from cgs_stats order by attname;
+
+-- ORCA no longer multiplies the selectivities of a and b
+select cgs_estimated_rows('select * from cgs_t where a = 1 and b = 1 and c = 1');
+
+alter table cgs_t alter column a reset (statistics_group);
+analyze cgs_t;
+select * from cgs_stats order by attname;
+
+reset optimizer_damping_factor_filter;
+drop function cgs_estimated_rows(text);
+drop view cgs_stats;
+drop table cgs_t;
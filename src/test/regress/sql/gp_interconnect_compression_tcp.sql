@@ -0,0 +1,58 @@
+-- 
+-- @description Interconnect compression over the TCP interconnect: the same tuples arrive with and without it
+-- @tags executor
+
+-- gp_interconnect_type can only be set at connection start; reconnect with it,
+-- keeping the options pg_regress and the caller passed
+\setenv PGOPTIONS `echo "$PGOPTIONS -c gp_interconnect_type=tcp"`
+\c regression
+SHOW gp_interconnect_type;
+
+-- Create a table, with rows that compress well and rows that do not
+CREATE TEMP TABLE ic_compression(dkey INT, jkey INT, tval TEXT) DISTRIBUTED BY (dkey);
+INSERT INTO ic_compression SELECT i, i % 100, repeat('abcdefghij', 10) FROM generate_series(1, 10000) i;
+INSERT INTO ic_compression SELECT i, i % 100, md5(i::text) FROM generate_series(10001, 12000) i;
+
+-- Whether a motion in the query sent fewer bytes than it would have without
+-- compression, per the counts EXPLAIN ANALYZE reports; NULL if it reports none
+CREATE FUNCTION ic_compression_saved(query text) RETURNS bool AS $$
+DECLARE
+	line text;
+BEGIN
+	FOR line IN EXECUTE 'EXPLAIN (ANALYZE, COSTS OFF) ' || query LOOP
+		IF line ~ 'Interconnect compression: \d+ bytes before' THEN
+			RETURN substring(line from '(\d+) bytes after')::bigint <
+				   substring(line from '(\d+) bytes before')::bigint;
+		END IF;
+	END LOOP;
+	RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+
+SET gp_interconnect_compression = on;
+SHOW gp_interconnect_compression;
+
+-- Gather
+SELECT COUNT(*) AS count, COUNT(DISTINCT tval) AS ndistinct, SUM(length(tval)) AS sum_len_tval
+  FROM (SELECT tval FROM ic_compression ORDER BY dkey LIMIT 12000) foo;
+
+-- Redistribute
+SELECT COUNT(*) AS count, SUM(length(b.tval)) AS sum_len_tval
+  FROM ic_compression a JOIN ic_compression b ON a.dkey = b.jkey;
+
+-- The motions send fewer bytes than they would without compression
+SELECT ic_compression_saved('SELECT tval FROM ic_compression ORDER BY dkey LIMIT 12000') AS saved;
+SELECT ic_compression_saved('SELECT b.tval FROM ic_compression a JOIN ic_compression b ON a.dkey = b.jkey') AS saved;
+
+-- Without compression
+SET gp_interconnect_compression = off;
+SELECT COUNT(*) AS count, COUNT(DISTINCT tval) AS ndistinct, SUM(length(tval)) AS sum_len_tval
+  FROM (SELECT tval FROM ic_compression ORDER BY dkey LIMIT 12000) foo;
+
+SELECT COUNT(*) AS count, SUM(length(b.tval)) AS sum_len_tval
+  FROM ic_compression a JOIN ic_compression b ON a.dkey = b.jkey;
+
+-- Nothing is reported without compression
+SELECT ic_compression_saved('SELECT tval FROM ic_compression ORDER BY dkey LIMIT 12000') IS NULL AS no_stats;
+
+DROP FUNCTION ic_compression_saved(text);
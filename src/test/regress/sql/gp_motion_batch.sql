@@ -0,0 +1,51 @@
+--
+-- Motions sending their tuples in batches, column by column. The results
+-- must be the same as when the tuples are sent one by one.
+--
+create temp table motion_batch (a int, b int8, c text, d numeric, e float8,
+  f bool, g date, h name, k char(3)) distributed by (a);
+insert into motion_batch
+  select i,
+         case when i % 7 = 0 then null else i * 1000000007::int8 end,
+         case when i % 5 = 0 then null else repeat(chr(97 + i % 26), i % 500) end,
+         case when i % 11 = 0 then null else i * 0.25 end,
+         i * 0.5::float8,
+         i % 2 = 0,
+         date '2020-01-01' + i,
+         ('n' || i)::name,
+         case when i % 3 = 0 then null else 'ab' end
+  from generate_series(1, 3000) i;
+-- an out-of-line value
+insert into motion_batch (a, c)
+  select 0, string_agg(md5(i::text), '') from generate_series(1, 3000) i;
+create temp table motion_batch_small (id int, label text) distributed by (id);
+insert into motion_batch_small select i, 'label ' || i from generate_series(0, 3) i;
+set gp_motion_batch_size = 64;
+show gp_motion_batch_size;
+-- gather, preserving the order
+select a, b, c, d from motion_batch where a > 0 order by a limit 8;
+select count(*), count(b), count(c), sum(length(c)), sum(d), sum(e), count(k)
+  from (select * from motion_batch order by a limit 5000) t;
+-- redistribute, broadcast and gather
+create temp table motion_batch_redist as
+  select * from motion_batch distributed by (b);
+create temp table motion_batch_join as
+  select m.*, s.label from motion_batch m, motion_batch_small s
+  where m.a % 4 = s.id distributed by (a);
+create temp table motion_batch_gather as
+  select * from (select * from motion_batch order by a limit 5000) t distributed by (a);
+-- compare with the tuples sent one by one
+set gp_motion_batch_size = 0;
+select count(*) from motion_batch_redist;
+select count(*) from
+  (select * from motion_batch except all select * from motion_batch_redist) t;
+select count(*) from
+  (select * from motion_batch_redist except all select * from motion_batch) t;
+select count(*) from
+  ((select m.*, s.label from motion_batch m, motion_batch_small s where m.a % 4 = s.id)
+   except all select * from motion_batch_join) t;
+select count(*) from motion_batch_join;
+select count(*) from
+  (select * from motion_batch except all select * from motion_batch_gather) t;
+select count(*) from motion_batch_gather;
+reset gp_motion_batch_size;
@@ -0,0 +1,53 @@
+--
+-- Session cache of GPORCA plans, enabled by optimizer_plan_cache_size.
+-- gp_optimizer_profile() reports whether the plan of the previous query
+-- came from the cache.
+--
+create table plancache_t (a int, b int) distributed by (a);
+insert into plancache_t select i, i % 10 from generate_series(1, 100) i;
+analyze plancache_t;
+set optimizer = on;
+set optimizer_plan_cache_size = '10MB';
+
+-- a repeated query is served from the cache
+select count(*) from plancache_t where b = 1;
+select count from gp_optimizer_profile() where name = 'plan cache hit';
+select count(*) from plancache_t where b = 1;
+select count from gp_optimizer_profile() where name = 'plan cache hit';
+-- constants are part of the key
+select count(*) from plancache_t where b = 2;
+select count from gp_optimizer_profile() where name = 'plan cache hit';
+
+-- ANALYZE evicts the plans using the statistics of the table
+analyze plancache_t;
+select count(*) from plancache_t where b = 1;
+select count from gp_optimizer_profile() where name = 'plan cache hit';
+select count(*) from plancache_t where b = 1;
+select count from gp_optimizer_profile() where name = 'plan cache hit';
+
+-- and so does DDL on the table
+alter table plancache_t add column c int;
+select count(*) from plancache_t where b = 1;
+select count from gp_optimizer_profile() where name = 'plan cache hit';
+select count(*) from plancache_t where b = 1;
+select count from gp_optimizer_profile() where name = 'plan cache hit';
+create index plancache_t_b on plancache_t (b);
+select count(*) from plancache_t where b = 1;
+select count from gp_optimizer_profile() where name = 'plan cache hit';
+
+-- a size of zero disables the cache and drops the cached plans
+set optimizer_plan_cache_size = 0;
+select count(*) from plancache_t where b = 1;
+select count from gp_optimizer_profile() where name = 'plan cache hit';
+select count(*) from plancache_t where b = 1;
+select count from gp_optimizer_profile() where name = 'plan cache hit';
+-- enabling it again starts with an empty cache
+set optimizer_plan_cache_size = '10MB';
+select count(*) from plancache_t where b = 1;
+select count from gp_optimizer_profile() where name = 'plan cache hit';
+select count(*) from plancache_t where b = 1;
+select count from gp_optimizer_profile() where name = 'plan cache hit';
+
+reset optimizer_plan_cache_size;
+reset optimizer;
+drop table plancache_t;
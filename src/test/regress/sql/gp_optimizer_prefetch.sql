@@ -0,0 +1,57 @@
+--
+-- Statistics prefetch of GPORCA, with optimizer_prefetch_metadata, and the
+-- metadata retrieval times. Both are printed to the server log with
+-- optimizer_print_optimization_stats.
+--
+create table prefetch_t1 (a int, b int, c int) distributed by (a);
+create table prefetch_t2 (a int, b int, c int) distributed by (a);
+create table prefetch_t3 (a int, b int, c int) distributed by (a);
+insert into prefetch_t1 select i, i % 10, i % 5 from generate_series(1, 100) i;
+insert into prefetch_t2 select i, i % 10, i % 5 from generate_series(1, 100) i;
+insert into prefetch_t3 select i, i % 10, i % 5 from generate_series(1, 100) i;
+analyze prefetch_t1;
+analyze prefetch_t2;
+analyze prefetch_t3;
+
+-- the optimization statistics last logged by this session; read with
+-- optimizer_print_optimization_stats off, so the query reading the log
+-- doesn't log its own
+create function prefetch_last_stats() returns text as $$
+	select logmessage from gp_toolkit.__gp_log_master_ext
+	 where logsession = 'con' || current_setting('gp_session_id')
+	   and logmessage like '%[OPT]: Metadata retrieval: total: %'
+	 order by logtime desc limit 1;
+$$ language sql;
+
+set optimizer = on;
+set optimizer_prefetch_metadata = on;
+
+-- t1.a and t1.b, t2.b and t2.c, and t3.a of the sublink
+set optimizer_print_optimization_stats = on;
+select count(*) from prefetch_t1 t1 join prefetch_t2 t2 on t1.a = t2.b
+ where t2.c > 0 and exists (select 1 from prefetch_t3 t3 where t3.a = t1.b);
+reset optimizer_print_optimization_stats;
+select substring(prefetch_last_stats()
+				 from 'Metadata prefetch: ([0-9]+ relations, [0-9]+ columns)') as prefetched;
+select prefetch_last_stats() ~ 'Metadata retrieval: column stats: [0-9]+ objects in [0-9]+ us, slowest ' as column_stats_timed,
+	   prefetch_last_stats() ~ 'Metadata retrieval: total: [0-9]+ objects in [0-9]+ us' as total_timed;
+
+-- a star selects all columns of the relation
+set optimizer_print_optimization_stats = on;
+select count(*) from (select * from prefetch_t1) s;
+reset optimizer_print_optimization_stats;
+select substring(prefetch_last_stats()
+				 from 'Metadata prefetch: ([0-9]+ relations, [0-9]+ columns)') as prefetched;
+
+-- nothing is prefetched without optimizer_prefetch_metadata, the
+-- retrieval times are still printed
+reset optimizer_prefetch_metadata;
+set optimizer_print_optimization_stats = on;
+select count(*) from prefetch_t2 where c > 0;
+reset optimizer_print_optimization_stats;
+select prefetch_last_stats() ~ 'Metadata prefetch' as prefetched,
+	   prefetch_last_stats() ~ 'Metadata retrieval: total: [0-9]+ objects in [0-9]+ us' as total_timed;
+
+reset optimizer;
+drop function prefetch_last_stats();
+drop table prefetch_t1, prefetch_t2, prefetch_t3;
@@ -0,0 +1,42 @@
+--
+-- Profile of the GPORCA optimizations, returned by gp_optimizer_profile()
+-- and shown by EXPLAIN (ANALYZE, VERBOSE) with optimizer_explain_profile.
+--
+create table optprof_t (a int, b int) distributed by (a);
+insert into optprof_t select i, i % 10 from generate_series(1, 100) i;
+analyze optprof_t;
+set optimizer = on;
+show optimizer_collect_optimization_stats;
+show optimizer_explain_profile;
+select count(*) from optprof_t t1 join optprof_t t2 on t1.b = t2.a;
+-- the query reading the profile isn't profiled itself
+select name, count is not null as counted, time_ms is not null as timed
+  from gp_optimizer_profile() where category = 'summary' order by name;
+select count from gp_optimizer_profile() where name = 'plan cache hit';
+select count(*) > 0 as stages, bool_and(time_ms is not null) as timed
+  from gp_optimizer_profile() where category = 'stage';
+select count(*) > 0 as xforms, bool_and(count > 0) as applied
+  from gp_optimizer_profile() where category = 'xform';
+select count(*) from gp_optimizer_profile() where category = 'xform'
+  and name = 'CXformInnerJoin2HashJoin';
+-- the profile sections of EXPLAIN
+create function optprof_explain_has(query text, section text) returns bool as $$
+declare
+	line text;
+begin
+	for line in execute 'explain (analyze, verbose) ' || query loop
+		if line like section || ':%' then
+			return true;
+		end if;
+	end loop;
+	return false;
+end;
+$$ language plpgsql;
+select optprof_explain_has('select count(*) from optprof_t', 'Optimizer Profile');
+set optimizer_explain_profile = on;
+select optprof_explain_has('select count(*) from optprof_t', 'Optimizer Profile');
+select optprof_explain_has('select count(*) from optprof_t', 'Optimizer Xforms');
+reset optimizer_explain_profile;
+reset optimizer;
+drop function optprof_explain_has(text, text);
+drop table optprof_t;
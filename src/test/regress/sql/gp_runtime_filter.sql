@@ -0,0 +1,88 @@
+--
+-- Runtime filters, built by hash joins and applied by the sequential scans
+-- on their outer side. The results must be the same as without them.
+--
+create table rf_fact (id int, dim_id int, txt text) distributed by (id);
+create table rf_fact_ao (id int, dim_id int, txt text)
+  with (appendonly=true) distributed by (id);
+create table rf_fact_co (id int, dim_id int, txt text)
+  with (appendonly=true, orientation=column) distributed by (id);
+create table rf_dim (dim_id int, name text) distributed by (dim_id);
+create table rf_dim2 (id int) distributed by (id);
+
+insert into rf_fact select i, i % 1000, 'row ' || (i % 7) from generate_series(1, 10000) i;
+insert into rf_fact values (10001, null, null);
+insert into rf_fact_ao select * from rf_fact;
+insert into rf_fact_co select * from rf_fact;
+insert into rf_dim select i, 'row ' || (i / 100) from generate_series(1, 901, 100) i;
+insert into rf_dim values (5000, 'row 50');
+insert into rf_dim2 select generate_series(1, 500);
+analyze rf_fact;
+analyze rf_fact_ao;
+analyze rf_fact_co;
+analyze rf_dim;
+analyze rf_dim2;
+
+set enable_nestloop to off;
+set enable_mergejoin to off;
+set gp_enable_runtime_filter to on;
+
+-- heap, AO and AOCS tables
+select count(*) from rf_fact f join rf_dim d on f.dim_id = d.dim_id;
+select count(*) from rf_fact_ao f join rf_dim d on f.dim_id = d.dim_id;
+select count(*) from rf_fact_co f join rf_dim d on f.dim_id = d.dim_id;
+
+-- several keys, text keys
+select count(*) from rf_fact f join rf_dim d on f.dim_id = d.dim_id and f.txt = d.name;
+select count(*) from rf_fact f join (select name from rf_dim where dim_id = 301) d on f.txt = d.name;
+
+-- semi joins and outer joins
+select count(*) from rf_fact f where f.dim_id in (select dim_id from rf_dim);
+select count(*), count(f.id) from rf_fact f right join rf_dim d on f.dim_id = d.dim_id;
+select count(*), count(d.dim_id) from rf_fact f left join rf_dim d on f.dim_id = d.dim_id;
+
+-- star join, both filters apply to the same scan
+select count(*) from rf_fact f
+  join rf_dim d on f.dim_id = d.dim_id
+  join rf_dim2 d2 on f.id = d2.id;
+
+-- empty inner side
+select count(*) from rf_fact f join (select * from rf_dim where dim_id < 0) d on f.dim_id = d.dim_id;
+
+-- the rows removed by the filters are reported by EXPLAIN ANALYZE
+-- start_matchsubs
+-- m/\(seg\d+\)\s+Rows removed by/
+-- s/\(seg\d+\)/(segN)/
+-- m/Rows removed by \d+ runtime filters?: \d+\./
+-- s/: \d+\.$/: N./
+-- end_matchsubs
+create function rf_explain_filtered(query text) returns setof text as $$
+declare
+	line text;
+begin
+	for line in execute 'explain (analyze, costs off) ' || query loop
+		if line ~ 'runtime filter' then
+			return next btrim(line);
+		end if;
+	end loop;
+end;
+$$ language plpgsql;
+\t on
+select rf_explain_filtered('select count(*) from rf_fact f join rf_dim d on f.dim_id = d.dim_id');
+select rf_explain_filtered('select count(*) from rf_fact_co f join rf_dim d on f.dim_id = d.dim_id');
+select rf_explain_filtered('select count(*) from rf_fact f join rf_dim d on f.dim_id = d.dim_id and f.txt = d.name');
+set gp_enable_runtime_filter to off;
+select count(*) from rf_explain_filtered('select count(*) from rf_fact f join rf_dim d on f.dim_id = d.dim_id');
+set gp_enable_runtime_filter to on;
+\t off
+drop function rf_explain_filtered(text);
+
+reset gp_enable_runtime_filter;
+reset enable_mergejoin;
+reset enable_nestloop;
+
+drop table rf_fact;
+drop table rf_fact_ao;
+drop table rf_fact_co;
+drop table rf_dim;
+drop table rf_dim2;
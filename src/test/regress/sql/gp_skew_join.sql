@@ -0,0 +1,34 @@
+--
+-- Joins on a skewed key. Redistributing skew_fact on k would send 90% of
+-- its rows to the segment that k = 1 hashes to, so GPORCA should rather
+-- broadcast skew_dim when optimizer_penalize_heavy_hitters is on.
+--
+create table skew_fact (k int, v int) distributed by (v);
+create table skew_dim (k int, x int) distributed by (x);
+insert into skew_fact select case when i % 10 = 0 then i else 1 end, i
+  from generate_series(1, 30000) i;
+insert into skew_dim select i, i from generate_series(1, 30000) i;
+analyze skew_fact;
+analyze skew_dim;
+-- the motions of the plan of a query
+create function skew_motions(query text) returns setof text as $$
+declare
+	line text;
+begin
+	for line in execute 'explain (costs off) ' || query loop
+		if line ~ 'Motion' then
+			return next substring(line from '([A-Za-z]+ Motion)');
+		end if;
+	end loop;
+end;
+$$ language plpgsql;
+set optimizer_penalize_heavy_hitters = off;
+select m, count(*) from skew_motions('select * from skew_fact f join skew_dim d on f.k = d.k') m
+  group by m order by m;
+set optimizer_penalize_heavy_hitters = on;
+select m, count(*) from skew_motions('select * from skew_fact f join skew_dim d on f.k = d.k') m
+  group by m order by m;
+reset optimizer_penalize_heavy_hitters;
+drop function skew_motions(text);
+drop table skew_fact;
+drop table skew_dim;
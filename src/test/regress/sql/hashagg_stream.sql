@@ -0,0 +1,45 @@
+--
+-- The bottom stage of a two stage hashagg streams its partial groups in
+-- small batches when it finds that it merges few input rows into groups.
+-- The results must be the same as when it keeps aggregating.
+--
+create or replace function hashagg_stream_explain(query text) returns setof text as
+$$
+declare
+  explainrow text;
+begin
+  for explainrow in execute 'EXPLAIN (ANALYZE, VERBOSE) ' || query
+  loop
+    return next explainrow;
+  end loop;
+end;
+$$ language plpgsql;
+create temp table hashagg_stream (a int, b int, c numeric) distributed by (a);
+insert into hashagg_stream select i, i, i % 7 from generate_series(1, 60000) i;
+analyze hashagg_stream;
+-- the planner's two stage aggregation streams its bottom stage
+set optimizer = off;
+set gp_eager_two_phase_agg = on;
+show gp_hashagg_stream_min_reduction;
+-- every group is unique, nothing to merge
+select count(*), sum(n), sum(s)
+  from (select b, count(*) n, sum(c) s from hashagg_stream group by b) t;
+select count(*) > 0 as streamed
+  from hashagg_stream_explain('select b, count(*) from hashagg_stream group by b') et
+  where et like '%Streamed partial groups%';
+-- most rows are merged
+select b % 100 as g, count(*), sum(c) from hashagg_stream group by 1 order by 1 limit 3;
+select count(*) > 0 as streamed
+  from hashagg_stream_explain('select b % 100, count(*) from hashagg_stream group by 1') et
+  where et like '%Streamed partial groups%';
+-- keep aggregating
+set gp_hashagg_stream_min_reduction = 0;
+select count(*), sum(n), sum(s)
+  from (select b, count(*) n, sum(c) s from hashagg_stream group by b) t;
+select count(*) > 0 as streamed
+  from hashagg_stream_explain('select b, count(*) from hashagg_stream group by b') et
+  where et like '%Streamed partial groups%';
+reset gp_hashagg_stream_min_reduction;
+reset gp_eager_two_phase_agg;
+reset optimizer;
+drop function hashagg_stream_explain(text);
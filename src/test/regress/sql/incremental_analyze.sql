@@ -905,6 +905,9 @@ select reloptions from pg_class where relname='hll_part_1_prt_6';
 -- hll stats should be present after partition exchange of table with "analyze_hll_non_part_table" enabled
 select 1 from pg_statistic where starelid='hll_part_1_prt_6'::regclass and stavalues5 is not null;
 
+-- the root of an analyzed partitioned table keeps the merged hll counter of its leaves
+select 1 from pg_statistic where starelid='hll_part'::regclass and stavalues5 is not null;
+
 -- verify that reloption is correctly set for partitioned table
 create table hll_part_def (i int, j int) with (analyze_hll_non_part_table=false) distributed by (i)
 partition by range(j)
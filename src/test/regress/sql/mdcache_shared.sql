@@ -0,0 +1,38 @@
+--
+-- The metadata cache shared by the sessions on the coordinator must not
+-- hand the committed definition of an object to a transaction that has
+-- changed it.
+--
+-- start_ignore
+\! gpconfig -c optimizer_mdcache_shared_size -v 1024 --masteronly
+\! PGDATESTYLE="" gpstop -rai
+-- end_ignore
+\c regression
+show optimizer_mdcache_shared_size;
+
+create table mdsc_t (a int, b int) distributed by (a);
+insert into mdsc_t values (1, 1);
+set optimizer_trace_fallback = on;
+
+-- publish the current definition in the shared cache
+select * from mdsc_t;
+
+begin;
+alter table mdsc_t add column c int default 2;
+select * from mdsc_t;
+insert into mdsc_t values (2, 2, 3);
+select * from mdsc_t order by a;
+rollback;
+select * from mdsc_t;
+
+-- committed changes are seen as well
+alter table mdsc_t add column d text default 'x';
+select * from mdsc_t;
+
+reset optimizer_trace_fallback;
+drop table mdsc_t;
+
+-- start_ignore
+\! gpconfig -r optimizer_mdcache_shared_size --masteronly
+\! PGDATESTYLE="" gpstop -rai
+-- end_ignore
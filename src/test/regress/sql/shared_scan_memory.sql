@@ -0,0 +1,79 @@
+--
+-- Cross-slice shared scans handing their tuples to the readers in shared
+-- memory. The results must be the same as through workfiles, and when the
+-- tuples don't fit in gp_shared_scan_memory_limit.
+--
+create temp table sisc_mem (a int, b int, c text) distributed by (a);
+insert into sisc_mem select i, i % 10, repeat('x', i % 50) from generate_series(1, 2000) i;
+analyze sisc_mem;
+set gp_cte_sharing = on;
+show gp_shared_scan_memory_limit;
+-- fits in memory
+with cte as (select a, b from sisc_mem where a <= 100)
+select count(*), sum(c1.a), sum(c2.a) from cte c1 join cte c2 on c1.b = c2.a;
+with cte as (select * from sisc_mem)
+select count(*), sum(length(c1.c)), sum(c2.b) from cte c1 join cte c2 on c1.a = c2.b + 1;
+-- always through workfiles
+set gp_shared_scan_memory_limit = 0;
+with cte as (select a, b from sisc_mem where a <= 100)
+select count(*), sum(c1.a), sum(c2.a) from cte c1 join cte c2 on c1.b = c2.a;
+with cte as (select * from sisc_mem)
+select count(*), sum(length(c1.c)), sum(c2.b) from cte c1 join cte c2 on c1.a = c2.b + 1;
+-- the small share fits, the large one spills
+set gp_shared_scan_memory_limit = '64kB';
+with cte as (select a, b from sisc_mem where a <= 100)
+select count(*), sum(c1.a), sum(c2.a) from cte c1 join cte c2 on c1.b = c2.a;
+with cte as (select * from sisc_mem)
+select count(*), sum(length(c1.c)), sum(c2.b) from cte c1 join cte c2 on c1.a = c2.b + 1;
+reset gp_shared_scan_memory_limit;
+reset gp_cte_sharing;
+--
+-- Check which path the shares took, by counting on the primaries the writers
+-- that kept their tuples in memory.  If no dynamic shared memory segment or
+-- shared hash table entry is left, the shares must fall back to workfiles
+-- (and FIFOs), with the same results.
+--
+-- start_ignore
+create extension if not exists gp_inject_fault;
+-- end_ignore
+set gp_cte_sharing = on;
+select gp_inject_fault_infinite('shareinput_writer_in_memory', 'skip', dbid)
+  from gp_segment_configuration where role = 'p' and content > -1;
+with cte as (select a, b from sisc_mem where a <= 100)
+select count(*), sum(c1.a), sum(c2.a) from cte c1 join cte c2 on c1.b = c2.a;
+select sum(substring(gp_inject_fault('shareinput_writer_in_memory', 'status', dbid)
+                     from 'num times hit:''([0-9]+)''')::int) > 0 as in_memory
+  from gp_segment_configuration where role = 'p' and content > -1;
+-- no segment left
+select gp_inject_fault_infinite('shareinput_writer_in_memory', 'reset', dbid)
+  from gp_segment_configuration where role = 'p' and content > -1;
+select gp_inject_fault_infinite('shareinput_writer_in_memory', 'skip', dbid)
+  from gp_segment_configuration where role = 'p' and content > -1;
+select gp_inject_fault_infinite('shareinput_dsm_segments_exhausted', 'skip', dbid)
+  from gp_segment_configuration where role = 'p' and content > -1;
+with cte as (select a, b from sisc_mem where a <= 100)
+select count(*), sum(c1.a), sum(c2.a) from cte c1 join cte c2 on c1.b = c2.a;
+select sum(substring(gp_inject_fault('shareinput_writer_in_memory', 'status', dbid)
+                     from 'num times hit:''([0-9]+)''')::int) > 0 as in_memory
+  from gp_segment_configuration where role = 'p' and content > -1;
+select sum(substring(gp_inject_fault('shareinput_dsm_segments_exhausted', 'status', dbid)
+                     from 'num times hit:''([0-9]+)''')::int) > 0 as exhausted
+  from gp_segment_configuration where role = 'p' and content > -1;
+select gp_inject_fault_infinite('shareinput_dsm_segments_exhausted', 'reset', dbid)
+  from gp_segment_configuration where role = 'p' and content > -1;
+-- no hash table entry left, synchronized through FIFOs
+select gp_inject_fault_infinite('shareinput_hash_full', 'skip', dbid)
+  from gp_segment_configuration where role = 'p' and content > -1;
+with cte as (select a, b from sisc_mem where a <= 100)
+select count(*), sum(c1.a), sum(c2.a) from cte c1 join cte c2 on c1.b = c2.a;
+select sum(substring(gp_inject_fault('shareinput_writer_in_memory', 'status', dbid)
+                     from 'num times hit:''([0-9]+)''')::int) > 0 as in_memory
+  from gp_segment_configuration where role = 'p' and content > -1;
+select sum(substring(gp_inject_fault('shareinput_hash_full', 'status', dbid)
+                     from 'num times hit:''([0-9]+)''')::int) > 0 as hash_full
+  from gp_segment_configuration where role = 'p' and content > -1;
+select gp_inject_fault_infinite('shareinput_hash_full', 'reset', dbid)
+  from gp_segment_configuration where role = 'p' and content > -1;
+select gp_inject_fault_infinite('shareinput_writer_in_memory', 'reset', dbid)
+  from gp_segment_configuration where role = 'p' and content > -1;
+reset gp_cte_sharing;